@@ -39,6 +39,8 @@ namespace std {
 %include "base/src/sgpp/base/datatypes/DataMatrixSP.hpp"
 %include "base/src/sgpp/base/datatypes/DataVector.hpp"
 %include "base/src/sgpp/base/datatypes/DataMatrix.hpp"
+%ignore sgpp::base::DataMatrixSymmetricSparse::setRows;
+%include "base/src/sgpp/base/datatypes/DataMatrixSymmetricSparse.hpp"
 
 %rename(GridPoint) sgpp::base::HashGridPoint;
 %rename(GridStorage) sgpp::base::HashGridStorage;
@@ -47,6 +49,7 @@ namespace std {
 %include "base/src/sgpp/base/grid/common/BoundingBox.hpp"
 %include "base/src/sgpp/base/grid/common/Stretching.hpp"
 %include "base/src/sgpp/base/grid/storage/hashmap/SerializationVersion.hpp"
+%include "base/src/sgpp/base/grid/storage/hashmap/PackedLevelIndex.hpp"
 %rename(operatorAssignment) sgpp::base::HashGridPoint::operator=;
 %rename(operatorParentheses) sgpp::base::HashGridPointPointerHashFunctor::operator();
 %rename(operatorParentheses) sgpp::base::HashGridPointPointerEqualityFunctor::operator();
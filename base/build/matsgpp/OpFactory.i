@@ -12,6 +12,9 @@
 %newobject sgpp::op_factory::createOperationConvert(sgpp::base::Grid& grid);
 %newobject sgpp::op_factory::createOperationIdentity(sgpp::base::Grid& grid);
 %newobject sgpp::op_factory::createOperationEval(sgpp::base::Grid& grid);
+%newobject sgpp::op_factory::createOperationEvalGradient(sgpp::base::Grid& grid);
+%newobject sgpp::op_factory::createOperationEvalHessian(sgpp::base::Grid& grid);
+%newobject sgpp::op_factory::createOperationEvalPartialDerivative(sgpp::base::Grid& grid);
 %newobject sgpp::op_factory::createOperationMultipleEval(sgpp::base::Grid& grid);
 %newobject sgpp::op_factory::createOperationEvalNaive(sgpp::base::Grid& grid);
 %newobject sgpp::op_factory::createOperationEvalGradientNaive(sgpp::base::Grid& grid);
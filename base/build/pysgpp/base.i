@@ -71,16 +71,20 @@ namespace std {
 %ignore sgpp::base::DataMatrixSP::operator[];
 %ignore sgpp::base::DataMatrixSP::toString(std::string& text) const;
 %include "base/src/sgpp/base/datatypes/DataMatrixSP.hpp"
+%ignore sgpp::base::DataMatrixSymmetricSparse::setRows;
+%include "base/src/sgpp/base/datatypes/DataMatrixSymmetricSparse.hpp"
 
 // The Good, i.e. without any modifications
 %ignore sgpp::base::BoundingBox::toString(std::string& text) const;
 %include "base/src/sgpp/base/grid/common/BoundingBox.hpp"
 %include "base/src/sgpp/base/grid/common/Stretching.hpp"
 %include "base/src/sgpp/base/grid/storage/hashmap/SerializationVersion.hpp"
+%include "base/src/sgpp/base/grid/storage/hashmap/PackedLevelIndex.hpp"
 %ignore sgpp::base::HashGridPoint::operator=;
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridPoint.hpp"
 %ignore sgpp::base::HashGridStorage::operator=;
 %ignore sgpp::base::HashGridStorage::operator[];
+%ignore sgpp::base::HashGridStorage::PointIterator;
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridStorage.hpp"
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridIterator.hpp"
 %include "base/src/sgpp/base/grid/GridStorage.hpp"
@@ -133,6 +137,11 @@ namespace std {
 %include "base/src/sgpp/base/grid/generation/functors/SurplusVolumeRefinementFunctor.hpp"
 %include "base/src/sgpp/base/grid/generation/PeriodicGridGenerator.hpp"
 %include "base/src/sgpp/base/grid/GridDataBase.hpp"
+%ignore sgpp::base::MappedGrid::getLevels;
+%ignore sgpp::base::MappedGrid::getIndices;
+%ignore sgpp::base::MappedGrid::getAlpha() const;
+%ignore sgpp::base::MappedGrid::eval(const double*, const DataVector&) const;
+%include "base/src/sgpp/base/grid/MappedGrid.hpp"
 
 %include "base/src/sgpp/base/algorithm/AlgorithmDGEMV.hpp"
 %include "base/src/sgpp/base/algorithm/AlgorithmMultipleEvaluation.hpp"
@@ -0,0 +1,84 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using sgpp::base::HashGenerator;
+using sgpp::base::HashGridPoint;
+using sgpp::base::HashGridStorage;
+using sgpp::base::HashGridStorageBackend;
+
+/**
+ * Looks up all grid points and their left children (which are mostly missing) in every
+ * dimension and returns the number of lookups per second.
+ */
+double measureLookups(HashGridStorage& storage, size_t repetitions, size_t& hits) {
+  const size_t dim = storage.getDimension();
+  size_t lookups = 0;
+  hits = 0;
+
+  auto begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t r = 0; r < repetitions; r++) {
+    for (size_t i = 0; i < storage.getSize(); i++) {
+      HashGridPoint point(storage.getPoint(i));
+      hits += storage.isContaining(point) ? 1 : 0;
+      lookups++;
+
+      for (size_t d = 0; d < dim; d++) {
+        HashGridPoint::level_type l = point.getLevel(d);
+        HashGridPoint::index_type idx = point.getIndex(d);
+        point.getLeftChild(d);
+        hits += storage.isContaining(point) ? 1 : 0;
+        point.set(d, l, idx);
+        lookups++;
+      }
+    }
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+  double seconds = std::chrono::duration<double>(end - begin).count();
+  return static_cast<double>(lookups) / seconds;
+}
+
+int main() {
+  std::cout << "HashGridStorage backend benchmark\n";
+  std::cout << "dim level points backend indexMB pointMB totalMB bytes/point lookups/s\n";
+
+  std::vector<size_t> dims = {10, 20, 50, 100};
+  HashGenerator generator;
+
+  for (size_t dim : dims) {
+    size_t level = (dim <= 20) ? 4 : 3;
+
+    for (HashGridStorageBackend backend :
+         {HashGridStorageBackend::UnorderedMap, HashGridStorageBackend::FlatHash}) {
+      HashGridStorage storage(dim);
+      storage.setBackend(backend);
+      generator.regular(storage, static_cast<HashGridPoint::level_type>(level));
+
+      // the points store one packed 64 bit level/index word per dimension
+      double pointMB = static_cast<double>(storage.getPointMemoryUsage()) / 1e6;
+      double indexMB = static_cast<double>(storage.getIndexMemoryUsage()) / 1e6;
+      double bytesPerPoint = (pointMB + indexMB) * 1e6 / static_cast<double>(storage.getSize());
+
+      size_t hits;
+      double throughput = measureLookups(storage, 3, hits);
+
+      std::cout << dim << " " << level << " " << storage.getSize() << " "
+                << ((backend == HashGridStorageBackend::FlatHash) ? "flat" : "map") << " "
+                << indexMB << " " << pointMB << " " << (indexMB + pointMB) << " " << bytesPerPoint
+                << " " << throughput << " (" << hits << " hits)\n";
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,77 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridStorage;
+using sgpp::base::OperationHierarchisation;
+
+/**
+ * Hierarchises a smooth function on regular B-spline sparse grids of increasing level
+ * and prints the runtimes of the hierarchisation and dehierarchisation (which should grow
+ * almost linearly in the number of grid points) and the residual of the interpolation
+ * conditions.
+ */
+int main() {
+  std::cout << "B-spline hierarchisation benchmark\n";
+  std::cout << "dim degree level points hierarchisation/s dehierarchisation/s residual\n";
+
+  const size_t degree = 3;
+
+  for (size_t dim : {2, 3, 5}) {
+    const size_t maxLevel = (dim == 2) ? 11 : ((dim == 3) ? 8 : 6);
+
+    for (size_t level = 3; level <= maxLevel; level++) {
+      std::unique_ptr<Grid> grid(Grid::createModBsplineGrid(dim, degree));
+      grid->getGenerator().regular(level);
+      GridStorage& storage = grid->getStorage();
+      const size_t n = storage.getSize();
+      DataVector x(dim);
+      DataVector functionValues(n);
+
+      for (size_t k = 0; k < n; k++) {
+        storage.getPoint(k).getStandardCoordinates(x);
+        double value = 1.0;
+
+        for (size_t t = 0; t < dim; t++) {
+          value *= std::sin(3.0 * x[t]) + x[t] * x[t];
+        }
+
+        functionValues[k] = value;
+      }
+
+      std::unique_ptr<OperationHierarchisation> op(
+          sgpp::op_factory::createOperationHierarchisation(*grid));
+      DataVector alpha(functionValues);
+
+      auto begin = std::chrono::high_resolution_clock::now();
+      op->doHierarchisation(alpha);
+      auto middle = std::chrono::high_resolution_clock::now();
+      op->doDehierarchisation(alpha);
+      auto end = std::chrono::high_resolution_clock::now();
+
+      alpha.sub(functionValues);
+
+      std::cout << dim << " " << degree << " " << level << " " << n << " "
+                << std::chrono::duration<double>(middle - begin).count() << " "
+                << std::chrono::duration<double>(end - middle).count() << " " << alpha.maxNorm()
+                << "\n";
+    }
+  }
+
+  return 0;
+}
@@ -157,6 +157,55 @@ class AlgorithmDGEMV {
       }
     }
   }
+
+  /**
+   * Performs the DGEMV Operation on the grid for multiple coefficient vectors at once,
+   * i.e., the affected basis functions of every data point are determined only once.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficient vectors (one column per vector, one row per grid point)
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result vectors (one column per vector, one row per data point)
+   */
+  void mult(GridStorage& storage, BASIS& basis, const DataMatrix& source,
+            DataMatrix& x, DataMatrix& result) {
+    typedef std::vector<std::pair<size_t, double> > IndexValVector;
+
+    const size_t numVectors = source.getNcols();
+    result.resizeRowsCols(x.getNrows(), numVectors);
+    result.setAll(0.0);
+
+    #pragma omp parallel
+    {
+      size_t result_size = result.getNrows();
+
+      DataVector line(x.getNcols());
+      IndexValVector vec;
+
+      GetAffectedBasisFunctions<BASIS> ga(storage);
+
+      #pragma omp for schedule (static)
+
+      for (size_t i = 0; i < result_size; i++) {
+        vec.clear();
+
+        x.getRow(i, line);
+
+        ga(basis, line, vec);
+
+        double* resultRow = result.getPointer() + i * numVectors;
+
+        for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
+          const double* sourceRow = source.getPointer() + iter->first * numVectors;
+
+          for (size_t j = 0; j < numVectors; j++) {
+            resultRow[j] += iter->second * sourceRow[j];
+          }
+        }
+      }
+    }
+  }
 };
 
 }  // namespace base
@@ -14,6 +14,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <utility>
+#include <vector>
 
 
 namespace sgpp {
@@ -72,6 +73,44 @@ class AlgorithmEvaluation {
    * @result result result of the function evaluation
    */
   double operator()(BASIS& basis, const DataVector& point, const DataVector& alpha) {
+    double result = 0.0;
+    traverse(basis, point,
+             [&alpha, &result](size_t seq, double value) { result += alpha[seq] * value; });
+    return result;
+  }
+
+  /**
+   * Determines all basis functions that are non-zero at a given evaluation point.
+   * For a given evaluation point \f$x\f$, it stores tuples (std::pair) of
+   * \f$(i,\phi_i(x))\f$ in the result vector for all basis functions that are non-zero.
+   * This allows evaluating linear combinations with multiple coefficient vectors
+   * while traversing the grid only once.
+   *
+   * @param       basis   a sparse grid basis
+   * @param       point   evaluation point within the domain
+   * @param[out]  result  indices and values of the non-zero basis functions
+   */
+  void getAffectedBasisFunctions(BASIS& basis, const DataVector& point,
+                                 std::vector<std::pair<size_t, double>>& result) {
+    result.clear();
+    traverse(basis, point,
+             [&result](size_t seq, double value) { result.emplace_back(seq, value); });
+  }
+
+ protected:
+  GridStorage& storage;
+
+  /**
+   * Transforms the evaluation point to the unit cube and calls accumulate(i, \f$\phi_i(x)\f$)
+   * for all basis functions that are non-zero at the evaluation point.
+   *
+   * @param basis       a sparse grid basis
+   * @param point       evaluation point within the domain
+   * @param accumulate  callable that is invoked with the sequence number and the value
+   *                    of each affected basis function
+   */
+  template <class ACCUMULATE>
+  void traverse(BASIS& basis, const DataVector& point, const ACCUMULATE& accumulate) {
     GridStorage::grid_iterator working(storage);
 
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
@@ -83,7 +122,7 @@ class AlgorithmEvaluation {
 
     for (size_t d = 0; d < dim; d++) {
       if (!bb->isContainingPoint(d, point[d])) {
-        return 0.0;
+        return;
       }
 
       newPoint[d] = bb->transformPointToUnitCube(d, point[d]);
@@ -102,16 +141,10 @@ class AlgorithmEvaluation {
       }
     }
 
-    double result = 0.0;
-    rec(basis, newPoint, 0, 1.0, working, source, alpha, result);
+    rec(basis, newPoint, 0, 1.0, working, source, accumulate);
     delete[] source;
-
-    return result;
   }
 
- protected:
-  GridStorage& storage;
-
   /**
    * Recursive traversal of the "tree" of basis functions for evaluation, used in operator().
    * For a given evaluation point \f$x\f$, it stores tuples (std::pair) of
@@ -123,13 +156,12 @@ class AlgorithmEvaluation {
    * @param value the value of the evaluation of the current basis function up to (excluding) dimension current_dim (product of the evaluations of the one-dimensional ones)
    * @param working iterator working on the GridStorage of the basis
    * @param source array of indices for each dimension (identifying the indices of the current grid point)
-   * @param alpha the spars grid's ansatzfunctions coefficients
-   * @param result reference to a double into which the result should be stored
+   * @param accumulate callable that is invoked for each affected basis function
    */
+  template <class ACCUMULATE>
   void rec(BASIS& basis, const DataVector& point, size_t current_dim,
            double value, GridStorage::grid_iterator& working,
-           index_t* source, const DataVector& alpha,
-           double& result) {
+           index_t* source, const ACCUMULATE& accumulate) {
     const unsigned int BITS_IN_BYTE = 8;
     // maximum possible level for the index type
     const level_t max_level = static_cast<level_t>(sizeof(index_t) * BITS_IN_BYTE - 1);
@@ -151,9 +183,9 @@ class AlgorithmEvaluation {
         const double new_value = basis.eval(work_level, work_index, point[current_dim]) * value;
 
         if (current_dim == storage.getDimension() - 1) {
-          result += alpha[seq] * new_value;
+          accumulate(seq, new_value);
         } else {
-          rec(basis, point, current_dim + 1, new_value, working, source, alpha, result);
+          rec(basis, point, current_dim + 1, new_value, working, source, accumulate);
         }
       }
 
@@ -0,0 +1,374 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ALGORITHMLOCALSUPPORTEVALUATION_HPP
+#define ALGORITHMLOCALSUPPORTEVALUATION_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/LevelIndexTypes.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Determines the basis functions of a sparse grid whose support contains a given point,
+ * for bases with local, but overlapping supports (B-splines, wavelets, fundamental splines,
+ * and their modified, boundary and Clenshaw-Curtis variants).
+ *
+ * In contrast to AlgorithmEvaluation, more than one basis function per subspace and
+ * dimension may be non-zero at a point. However, in every dimension, only the basis
+ * functions of level \f$l\f$ whose index \f$i\f$ satisfies
+ * \f$|u_l(x) - i| \le r\f$ can be non-zero, where \f$r\f$ is the radius of the support in
+ * multiples of the mesh width and \f$u_l(x) = 2^l x\f$
+ * (or \f$u_l(x) = 2^l \arccos(1 - 2x) / \pi\f$ for Clenshaw-Curtis grids) is the position
+ * of \f$x\f$ in index space. Hence, the one-dimensional basis functions (and their derivatives)
+ * are evaluated only for these indices and the grid points of every subspace are obtained as
+ * tensor products of the non-zero one-dimensional functions, i.e., only
+ * \f$\mathcal{O}(r^{d'})\f$ grid points are visited per subspace, where \f$d'\f$ is the number
+ * of dimensions in which the subspace is refined. The first and last index of every level are
+ * always taken into account, as the modified basis functions at the boundary have a larger
+ * support than the interior ones. Bases without derivatives (i.e., without evalDx and
+ * evalDxDx) can be used as long as derivativeOrder is zero.
+ *
+ * The subspaces and the one-dimensional indices of the grid are cached. The cache is rebuilt
+ * automatically if the number of grid points changes; if the grid is modified without
+ * changing its size, prepare() has to be called.
+ */
+template <class BASIS>
+class AlgorithmLocalSupportEvaluation {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage         storage of the sparse grid
+   * @param basis           one-dimensional basis
+   * @param supportRadius   radius of the support of the interior basis functions
+   *                        in multiples of the mesh width
+   * @param clenshawCurtis  whether the grid points are Clenshaw-Curtis points
+   */
+  AlgorithmLocalSupportEvaluation(GridStorage& storage, BASIS& basis, double supportRadius,
+                                  bool clenshawCurtis = false)
+      : storage(storage),
+        basis(basis),
+        supportRadius(supportRadius),
+        clenshawCurtis(clenshawCurtis),
+        preparedSize(0),
+        prepared(false),
+        numberOfSubspaces(0),
+        gridPoint(storage.getDimension()) {}
+
+  /**
+   * Constructor copying the cache of another algorithm for the same grid, e.g., to evaluate
+   * at different points in parallel with one basis per thread without rebuilding the cache.
+   *
+   * @param other   algorithm whose cache is copied
+   * @param basis   one-dimensional basis
+   */
+  AlgorithmLocalSupportEvaluation(const AlgorithmLocalSupportEvaluation& other, BASIS& basis)
+      : storage(other.storage),
+        basis(basis),
+        supportRadius(other.supportRadius),
+        clenshawCurtis(other.clenshawCurtis),
+        preparedSize(other.preparedSize),
+        prepared(other.prepared),
+        numberOfSubspaces(other.numberOfSubspaces),
+        subspaceLevels(other.subspaceLevels),
+        indices(other.indices),
+        entries(other.entries),
+        gridPoint(other.gridPoint) {}
+
+  /**
+   * Destructor.
+   */
+  ~AlgorithmLocalSupportEvaluation() {}
+
+  /**
+   * Rebuilds the cached subspaces and one-dimensional indices of the grid.
+   */
+  void prepare() {
+    const size_t n = storage.getSize();
+    const size_t d = storage.getDimension();
+    std::set<std::vector<level_t>> subspaces;
+    std::vector<level_t> level(d);
+
+    indices.assign(d, std::vector<std::vector<index_t>>());
+
+    for (size_t k = 0; k < n; k++) {
+      const GridPoint& gp = storage[k];
+
+      for (size_t t = 0; t < d; t++) {
+        const level_t l = gp.getLevel(t);
+        level[t] = l;
+
+        if (indices[t].size() <= l) {
+          indices[t].resize(l + 1);
+        }
+
+        indices[t][l].push_back(gp.getIndex(t));
+      }
+
+      subspaces.insert(level);
+    }
+
+    for (size_t t = 0; t < d; t++) {
+      for (std::vector<index_t>& indicesOfLevel : indices[t]) {
+        std::sort(indicesOfLevel.begin(), indicesOfLevel.end());
+        indicesOfLevel.erase(std::unique(indicesOfLevel.begin(), indicesOfLevel.end()),
+                             indicesOfLevel.end());
+      }
+    }
+
+    numberOfSubspaces = subspaces.size();
+    subspaceLevels.clear();
+    subspaceLevels.reserve(numberOfSubspaces * d);
+
+    for (const std::vector<level_t>& subspace : subspaces) {
+      subspaceLevels.insert(subspaceLevels.end(), subspace.begin(), subspace.end());
+    }
+
+    entries.assign(d, std::vector<std::vector<Entry>>());
+
+    for (size_t t = 0; t < d; t++) {
+      entries[t].resize(indices[t].size());
+    }
+
+    gridPoint = GridPoint(d);
+    preparedSize = n;
+    prepared = true;
+  }
+
+  /**
+   * Rebuilds the cache if it has not been built yet or if the number of grid points changed.
+   */
+  void prepareIfNecessary() {
+    if (!prepared || (storage.getSize() != preparedSize)) {
+      prepare();
+    }
+  }
+
+  /**
+   * Determines all basis functions whose support contains a point and evaluates their
+   * one-dimensional factors (and derivatives).
+   *
+   * @param      point            evaluation point in the unit cube
+   * @param      derivativeOrder  highest derivative to evaluate (0, 1 or 2)
+   * @param[out] sequenceNumbers  sequence numbers of the affected grid points
+   * @param[out] factors          one-dimensional factors, the o-th derivative of the factor
+   *                              of the k-th affected grid point in dimension t is stored at
+   *                              (k * dim + t) * (derivativeOrder + 1) + o
+   */
+  void getAffectedBasisFunctions(const DataVector& point, size_t derivativeOrder,
+                                 std::vector<size_t>& sequenceNumbers,
+                                 std::vector<double>& factors) {
+    prepareIfNecessary();
+
+    const size_t d = storage.getDimension();
+    const size_t stride = derivativeOrder + 1;
+
+    sequenceNumbers.clear();
+    factors.clear();
+
+    for (size_t t = 0; t < d; t++) {
+      evaluate1D(t, point[t], derivativeOrder);
+    }
+
+    std::vector<const std::vector<Entry>*> lists(d);
+    std::vector<size_t> counters(d);
+
+    for (size_t s = 0; s < numberOfSubspaces; s++) {
+      const level_t* level = &subspaceLevels[s * d];
+      bool empty = false;
+
+      for (size_t t = 0; t < d; t++) {
+        lists[t] = &entries[t][level[t]];
+
+        if (lists[t]->empty()) {
+          empty = true;
+          break;
+        }
+      }
+
+      if (empty) {
+        continue;
+      }
+
+      // iterate over the tensor product of the non-zero one-dimensional functions
+      std::fill(counters.begin(), counters.end(), 0);
+
+      while (true) {
+        for (size_t t = 0; t < d; t++) {
+          gridPoint.push(t, level[t], (*lists[t])[counters[t]].index);
+        }
+
+        gridPoint.rehash();
+        const size_t seq = storage.getSequenceNumber(gridPoint);
+
+        if (!storage.isInvalidSequenceNumber(seq)) {
+          sequenceNumbers.push_back(seq);
+
+          for (size_t t = 0; t < d; t++) {
+            const Entry& entry = (*lists[t])[counters[t]];
+            factors.insert(factors.end(), entry.values, entry.values + stride);
+          }
+        }
+
+        size_t t = 0;
+
+        while ((t < d) && (++counters[t] == lists[t]->size())) {
+          counters[t] = 0;
+          t++;
+        }
+
+        if (t == d) {
+          break;
+        }
+      }
+    }
+  }
+
+ protected:
+  /**
+   * One-dimensional basis function that may be non-zero at the current point.
+   */
+  struct Entry {
+    /// index of the basis function
+    index_t index;
+    /// value, first and second derivative
+    double values[3];
+  };
+
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// one-dimensional basis
+  BASIS& basis;
+  /// radius of the support in multiples of the mesh width
+  double supportRadius;
+  /// whether the grid points are Clenshaw-Curtis points
+  bool clenshawCurtis;
+  /// number of grid points when the cache was built
+  size_t preparedSize;
+  /// whether the cache has been built
+  bool prepared;
+  /// number of subspaces
+  size_t numberOfSubspaces;
+  /// level vectors of the subspaces (one after another)
+  std::vector<level_t> subspaceLevels;
+  /// sorted indices of the grid points per dimension and level
+  std::vector<std::vector<std::vector<index_t>>> indices;
+  /// non-zero one-dimensional basis functions per dimension and level
+  std::vector<std::vector<std::vector<Entry>>> entries;
+  /// temporary grid point for the lookups
+  GridPoint gridPoint;
+
+  /**
+   * Evaluates the one-dimensional basis functions of all levels in one dimension whose
+   * support may contain x and stores the non-zero ones in entries.
+   *
+   * @param t                dimension
+   * @param x                coordinate of the evaluation point
+   * @param derivativeOrder  highest derivative to evaluate (0, 1 or 2)
+   */
+  void evaluate1D(size_t t, double x, size_t derivativeOrder) {
+    const double xClamped = std::min(std::max(x, 0.0), 1.0);
+    const double u = clenshawCurtis ? std::acos(1.0 - 2.0 * xClamped) / M_PI : xClamped;
+
+    for (level_t l = 0; l < indices[t].size(); l++) {
+      const std::vector<index_t>& indicesOfLevel = indices[t][l];
+      std::vector<Entry>& entriesOfLevel = entries[t][l];
+      entriesOfLevel.clear();
+
+      if (indicesOfLevel.empty()) {
+        continue;
+      }
+
+      // one mesh width safety margin
+      const double center = u * static_cast<double>(static_cast<index_t>(1) << l);
+      const double lower = std::max(center - supportRadius - 1.0, 0.0);
+      const double upper = center + supportRadius + 1.0;
+
+      std::vector<index_t>::const_iterator first = std::lower_bound(
+          indicesOfLevel.begin(), indicesOfLevel.end(), static_cast<index_t>(std::ceil(lower)));
+      std::vector<index_t>::const_iterator last =
+          std::upper_bound(first, indicesOfLevel.end(), static_cast<index_t>(std::floor(upper)));
+
+      if (first != indicesOfLevel.begin()) {
+        addEntry(entriesOfLevel, l, indicesOfLevel.front(), x, derivativeOrder);
+      }
+
+      for (std::vector<index_t>::const_iterator it = first; it != last; ++it) {
+        addEntry(entriesOfLevel, l, *it, x, derivativeOrder);
+      }
+
+      if (last != indicesOfLevel.end()) {
+        addEntry(entriesOfLevel, l, indicesOfLevel.back(), x, derivativeOrder);
+      }
+    }
+  }
+
+  /**
+   * Evaluates a one-dimensional basis function and appends it to a list
+   * if it or one of its derivatives does not vanish.
+   *
+   * @param entriesOfLevel   list of non-zero basis functions
+   * @param l                level
+   * @param i                index
+   * @param x                coordinate of the evaluation point
+   * @param derivativeOrder  highest derivative to evaluate (0, 1 or 2)
+   */
+  void addEntry(std::vector<Entry>& entriesOfLevel, level_t l, index_t i, double x,
+                size_t derivativeOrder) {
+    Entry entry;
+    entry.index = i;
+    entry.values[0] = basis.eval(l, i, x);
+    entry.values[1] = (derivativeOrder >= 1) ? evalDerivative(basis, l, i, x, 1, 0) : 0.0;
+    entry.values[2] = (derivativeOrder >= 2) ? evalDerivative(basis, l, i, x, 2, 0) : 0.0;
+
+    if ((entry.values[0] != 0.0) || (entry.values[1] != 0.0) || (entry.values[2] != 0.0)) {
+      entriesOfLevel.push_back(entry);
+    }
+  }
+
+  /**
+   * Evaluates the first or second derivative of a basis function
+   * (overload for bases that provide derivatives).
+   *
+   * @param b       one-dimensional basis
+   * @param l       level
+   * @param i       index
+   * @param x       evaluation point
+   * @param order   order of the derivative (1 or 2)
+   * @return        value of the derivative
+   */
+  template <class B>
+  static auto evalDerivative(B& b, level_t l, index_t i, double x, size_t order, int)
+      -> decltype(b.evalDx(l, i, x) + b.evalDxDx(l, i, x)) {
+    return (order == 1) ? b.evalDx(l, i, x) : b.evalDxDx(l, i, x);
+  }
+
+  /**
+   * Overload for bases that do not provide derivatives, always throws.
+   *
+   * @return  nothing
+   */
+  template <class B>
+  static double evalDerivative(B&, level_t, index_t, double, size_t, long) {
+    throw operation_exception(
+        "AlgorithmLocalSupportEvaluation: The basis does not provide derivatives.");
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* ALGORITHMLOCALSUPPORTEVALUATION_HPP */
@@ -17,6 +17,7 @@
 
 #include <iostream>
 #include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -124,6 +125,92 @@ class AlgorithmMultipleEvaluation {
       }
     }
   }
+
+  /**
+   * Performs a transposed mass evaluation for multiple source vectors at once.
+   * Every data point is traversed only once for all source vectors.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the source vectors (one column per vector, one row per data point)
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result vectors of the matrix matrix multiplication
+   *        (one column per vector, one row per grid point)
+   */
+  void mult_transpose(GridStorage& storage, BASIS& basis, DataMatrix& source, DataMatrix& x,
+                      DataMatrix& result) {
+    const size_t numVectors = source.getNcols();
+    const size_t source_size = source.getNrows();
+    result.setAll(0.0);
+
+#pragma omp parallel
+    {
+      DataMatrix privateResult(result.getNrows(), numVectors, 0.0);
+      DataVector line(x.getNcols());
+      AlgorithmEvaluation<BASIS> AlgoEval(storage);
+      std::vector<std::pair<size_t, double>> affectedBasisFunctions;
+
+#pragma omp for schedule(static)
+
+      for (size_t i = 0; i < source_size; i++) {
+        x.getRow(i, line);
+        AlgoEval.getAffectedBasisFunctions(basis, line, affectedBasisFunctions);
+        const double* sourceRow = &source.getPointer()[i * numVectors];
+
+        for (const std::pair<size_t, double>& basisFunction : affectedBasisFunctions) {
+          double* resultRow = &privateResult.getPointer()[basisFunction.first * numVectors];
+
+          for (size_t j = 0; j < numVectors; j++) {
+            resultRow[j] += basisFunction.second * sourceRow[j];
+          }
+        }
+      }
+
+#pragma omp critical
+      { result.add(privateResult); }
+    }
+  }
+
+  /**
+   * Performs a mass evaluation for multiple coefficient vectors at once.
+   * Every data point is traversed only once for all coefficient vectors.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficient vectors (one column per vector, one row per grid point)
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result vectors of the matrix matrix multiplication
+   *        (one column per vector, one row per data point)
+   */
+  void mult(GridStorage& storage, BASIS& basis, DataMatrix& source, DataMatrix& x,
+            DataMatrix& result) {
+    const size_t numVectors = source.getNcols();
+    const size_t result_size = result.getNrows();
+    result.setAll(0.0);
+
+#pragma omp parallel
+    {
+      DataVector line(x.getNcols());
+      AlgorithmEvaluation<BASIS> AlgoEval(storage);
+      std::vector<std::pair<size_t, double>> affectedBasisFunctions;
+
+#pragma omp for schedule(static)
+
+      for (size_t i = 0; i < result_size; i++) {
+        x.getRow(i, line);
+        AlgoEval.getAffectedBasisFunctions(basis, line, affectedBasisFunctions);
+        double* resultRow = &result.getPointer()[i * numVectors];
+
+        for (const std::pair<size_t, double>& basisFunction : affectedBasisFunctions) {
+          const double* sourceRow = &source.getPointer()[basisFunction.first * numVectors];
+
+          for (size_t j = 0; j < numVectors; j++) {
+            resultRow[j] += basisFunction.second * sourceRow[j];
+          }
+        }
+      }
+    }
+  }
 };
 
 }  // namespace base
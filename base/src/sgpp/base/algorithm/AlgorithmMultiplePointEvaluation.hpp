@@ -0,0 +1,275 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ALGORITHMMULTIPLEPOINTEVALUATION_HPP
+#define ALGORITHMMULTIPLEPOINTEVALUATION_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/LevelIndexTypes.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Evaluates a linear combination of basis functions, its gradient and its Hessian
+ * at many points at once (e.g., a population of an optimizer or Monte Carlo samples).
+ *
+ * In contrast to calling OperationEval, OperationEvalGradient or OperationEvalHessian
+ * for every point, the one-dimensional basis functions (and their derivatives) are evaluated
+ * only once per point, dimension and distinct pair of level and index, and the grid points
+ * just look up their one-dimensional factors. Grid points with a vanishing factor
+ * are skipped. The points are distributed among OpenMP threads.
+ *
+ * The distinct one-dimensional basis functions are cached. The cache is rebuilt
+ * automatically if the number of grid points changes; if the grid is modified without
+ * changing its size, prepare() has to be called.
+ */
+template <class BASIS>
+class AlgorithmMultiplePointEvaluation {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage   storage of the sparse grid
+   * @param basis     one-dimensional basis
+   */
+  AlgorithmMultiplePointEvaluation(GridStorage& storage, BASIS& basis)
+      : storage(storage), basis(basis), preparedSize(0), prepared(false) {}
+
+  /**
+   * Destructor.
+   */
+  ~AlgorithmMultiplePointEvaluation() {}
+
+  /**
+   * Rebuilds the cached one-dimensional basis functions of the grid.
+   */
+  void prepare() {
+    const size_t n = storage.getSize();
+    const size_t d = storage.getDimension();
+
+    functions1D.assign(d, std::vector<uint64_t>());
+    functionIndices.resize(n * d);
+
+    for (size_t t = 0; t < d; t++) {
+      std::vector<uint64_t>& curFunctions = functions1D[t];
+      curFunctions.resize(n);
+
+      for (size_t k = 0; k < n; k++) {
+        curFunctions[k] = getKey(storage[k].getLevel(t), storage[k].getIndex(t));
+      }
+
+      std::sort(curFunctions.begin(), curFunctions.end());
+      curFunctions.erase(std::unique(curFunctions.begin(), curFunctions.end()),
+                         curFunctions.end());
+
+      for (size_t k = 0; k < n; k++) {
+        functionIndices[k * d + t] = static_cast<uint32_t>(
+            std::lower_bound(curFunctions.begin(), curFunctions.end(),
+                             getKey(storage[k].getLevel(t), storage[k].getIndex(t))) -
+            curFunctions.begin());
+      }
+    }
+
+    preparedSize = n;
+    prepared = true;
+  }
+
+  /**
+   * @param      alpha            coefficient vector
+   * @param      points           evaluation points (one point per row)
+   * @param      derivativeOrder  highest derivative to evaluate (0, 1 or 2)
+   * @param[out] values           values of the linear combination at the points
+   * @param[out] gradients        gradients of the linear combination at the points
+   *                              (one gradient per row, only if derivativeOrder >= 1)
+   * @param[out] hessians         Hessians of the linear combination at the points
+   *                              (only if derivativeOrder == 2)
+   */
+  void eval(const DataVector& alpha, const DataMatrix& points, size_t derivativeOrder,
+            DataVector& values, DataMatrix& gradients, std::vector<DataMatrix>& hessians) {
+    if (!prepared || (storage.getSize() != preparedSize)) {
+      prepare();
+    }
+
+    const size_t n = storage.getSize();
+    const size_t d = storage.getDimension();
+    const size_t numberOfPoints = points.getNrows();
+    const size_t stride = derivativeOrder + 1;
+    const BoundingBox& boundingBox = *storage.getBoundingBox();
+    std::vector<double> innerDerivative(d);
+
+    for (size_t t = 0; t < d; t++) {
+      innerDerivative[t] = 1.0 / boundingBox.getIntervalWidth(t);
+    }
+
+    values.resize(numberOfPoints);
+
+    if (derivativeOrder >= 1) {
+      gradients.resize(numberOfPoints, d);
+    }
+
+    if (derivativeOrder >= 2) {
+      hessians.resize(numberOfPoints);
+
+      for (DataMatrix& hessian : hessians) {
+        hessian.resize(d, d);
+      }
+    }
+
+#pragma omp parallel
+    {
+      // the bases are not required to be thread-safe
+      BASIS threadBasis(basis);
+      DataVector point(d);
+      DataVector gradient(d);
+      DataMatrix hessian(d, d);
+      std::vector<std::vector<double>> factors(d);
+      std::vector<const double*> curFactors(d);
+
+      for (size_t t = 0; t < d; t++) {
+        factors[t].resize(functions1D[t].size() * stride);
+      }
+
+#pragma omp for schedule(static)
+      for (size_t p = 0; p < numberOfPoints; p++) {
+        points.getRow(p, point);
+        boundingBox.transformPointToUnitCube(point);
+
+        // evaluate all distinct one-dimensional basis functions
+        for (size_t t = 0; t < d; t++) {
+          const std::vector<uint64_t>& curFunctions = functions1D[t];
+          double* curFactorsOfDim = factors[t].data();
+
+          for (size_t j = 0; j < curFunctions.size(); j++) {
+            const level_t l = static_cast<level_t>(curFunctions[j] >> 32);
+            const index_t i = static_cast<index_t>(curFunctions[j] & 0xffffffff);
+            double* f = &curFactorsOfDim[j * stride];
+
+            f[0] = threadBasis.eval(l, i, point[t]);
+
+            if (derivativeOrder >= 1) {
+              f[1] = threadBasis.evalDx(l, i, point[t]) * innerDerivative[t];
+            }
+
+            if (derivativeOrder >= 2) {
+              f[2] = threadBasis.evalDxDx(l, i, point[t]) * innerDerivative[t] *
+                     innerDerivative[t];
+            }
+          }
+        }
+
+        double value = 0.0;
+        gradient.setAll(0.0);
+        hessian.setAll(0.0);
+
+        for (size_t k = 0; k < n; k++) {
+          const uint32_t* curFunctionIndices = &functionIndices[k * d];
+          bool vanishes = false;
+          double curValue = alpha[k];
+
+          for (size_t t = 0; t < d; t++) {
+            const double* f = &factors[t][curFunctionIndices[t] * stride];
+            curFactors[t] = f;
+            curValue *= f[0];
+
+            if (std::all_of(f, f + stride, [](double x) { return x == 0.0; })) {
+              vanishes = true;
+              break;
+            }
+          }
+
+          if (vanishes) {
+            continue;
+          }
+
+          value += curValue;
+
+          if (derivativeOrder == 0) {
+            continue;
+          }
+
+          for (size_t t = 0; t < d; t++) {
+            double curGradient = alpha[k];
+
+            for (size_t t2 = 0; t2 < d; t2++) {
+              curGradient *= curFactors[t2][(t2 == t) ? 1 : 0];
+            }
+
+            gradient[t] += curGradient;
+          }
+
+          if (derivativeOrder == 1) {
+            continue;
+          }
+
+          for (size_t t = 0; t < d; t++) {
+            for (size_t t2 = t; t2 < d; t2++) {
+              double curHessian = alpha[k];
+
+              for (size_t t3 = 0; t3 < d; t3++) {
+                curHessian *= curFactors[t3][((t3 == t) ? 1 : 0) + ((t3 == t2) ? 1 : 0)];
+              }
+
+              hessian(t, t2) += curHessian;
+            }
+          }
+        }
+
+        values[p] = value;
+
+        if (derivativeOrder >= 1) {
+          gradients.setRow(p, gradient);
+        }
+
+        if (derivativeOrder >= 2) {
+          DataMatrix& curHessian = hessians[p];
+
+          for (size_t t = 0; t < d; t++) {
+            for (size_t t2 = t; t2 < d; t2++) {
+              curHessian(t, t2) = hessian(t, t2);
+              curHessian(t2, t) = hessian(t, t2);
+            }
+          }
+        }
+      }
+    }
+  }
+
+ protected:
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// one-dimensional basis
+  BASIS& basis;
+  /// number of grid points when the cache was built
+  size_t preparedSize;
+  /// whether the cache has been built
+  bool prepared;
+  /// sorted keys of the distinct one-dimensional basis functions per dimension
+  std::vector<std::vector<uint64_t>> functions1D;
+  /// position of the one-dimensional basis functions of the grid points in functions1D
+  std::vector<uint32_t> functionIndices;
+
+  /**
+   * @param l   level
+   * @param i   index
+   * @return    key of the one-dimensional basis function
+   */
+  static uint64_t getKey(level_t l, index_t i) {
+    return (static_cast<uint64_t>(l) << 32) | static_cast<uint64_t>(i);
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* ALGORITHMMULTIPLEPOINTEVALUATION_HPP */
@@ -0,0 +1,964 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ALGORITHMUNIDIRECTIONALHIERARCHISATION_HPP
+#define ALGORITHMUNIDIRECTIONALHIERARCHISATION_HPP
+
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/LevelIndexTypes.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Hierarchisation and dehierarchisation for bases with local, overlapping supports
+ * (e.g., B-splines), whose hierarchisation cannot be done by the BFS-based algorithms
+ * used for hat functions or fundamental splines.
+ *
+ * The hierarchisation is based on the unidirectional principle: dimension by dimension,
+ * the values on every pole (set of grid points that differ only in the current dimension)
+ * are replaced by the coefficients of the one-dimensional interpolant on the pole.
+ * The one-dimensional interpolation matrices are factorized once per distinct set of
+ * one-dimensional grid points. The grid points of a pole are sorted by their coordinate,
+ * such that the non-zero entries of every column of the interpolation matrix form
+ * a contiguous range around the diagonal. The narrow columns are factorized as band matrix
+ * (LU with partial pivoting), the few wide columns of the coarse basis functions, whose support
+ * contains many grid points of the pole, are taken into account as low-rank correction
+ * (Sherman-Morrison-Woodbury formula). Hence, a pole of length m with band width h and
+ * k wide columns costs O(m * (h + k)) per solve instead of O(m^2).
+ *
+ * For overlapping bases, the unidirectional principle is exact in 1D and on full grids,
+ * but only an approximation on general sparse grids. Therefore, it is used as initial guess
+ * and as preconditioner of BiCGStab, which solves the interpolation conditions up to a
+ * relative tolerance. The matrix-vector products of BiCGStab evaluate the interpolant at
+ * all grid points, which only visits the basis functions whose support contains the
+ * grid point (see AlgorithmLocalSupportEvaluation). If it is not too large, the sparse
+ * interpolation matrix is assembled once and cached for the duration of the hierarchisation.
+ * Usually, only a few iterations are necessary.
+ *
+ * The dehierarchisation is the evaluation of the interpolant at all grid points.
+ * Both operations are parallelized with OpenMP.
+ */
+template <class BASIS>
+class AlgorithmUnidirectionalHierarchisation {
+ public:
+  /// default relative tolerance for the residual of the interpolation conditions
+  static constexpr double DEFAULT_TOLERANCE = 1e-12;
+  /// default maximal number of BiCGStab iterations
+  static const size_t DEFAULT_MAX_ITERATIONS = 1000;
+  /// default maximal number of non-zero entries of the cached interpolation matrix
+  static const size_t DEFAULT_MAX_MATRIX_ENTRIES = static_cast<size_t>(1) << 25;
+
+  /**
+   * Constructor.
+   *
+   * @param storage         storage of the sparse grid
+   * @param basis           one-dimensional basis
+   * @param supportRadius   radius of the support of the basis functions
+   *                        in multiples of the mesh width
+   * @param tolerance       relative tolerance for the residual of the interpolation conditions
+   * @param maxIterations   maximal number of BiCGStab iterations
+   * @param maxMatrixEntries  maximal number of non-zero entries of the interpolation matrix
+   *                          to be cached during the hierarchisation (if the matrix has more
+   *                          entries, the matrix-vector products are computed on the fly)
+   */
+  AlgorithmUnidirectionalHierarchisation(GridStorage& storage, BASIS& basis,
+                                         double supportRadius,
+                                         double tolerance = DEFAULT_TOLERANCE,
+                                         size_t maxIterations = DEFAULT_MAX_ITERATIONS,
+                                         size_t maxMatrixEntries = DEFAULT_MAX_MATRIX_ENTRIES)
+      : storage(storage),
+        basis(basis),
+        supportRadius(supportRadius),
+        tolerance(tolerance),
+        maxIterations(maxIterations),
+        maxMatrixEntries(maxMatrixEntries),
+        numberOfIterations(0),
+        preparedSize(0),
+        prepared(false) {}
+
+  /**
+   * Destructor.
+   */
+  ~AlgorithmUnidirectionalHierarchisation() {}
+
+  /**
+   * Rebuilds the poles and the factorized one-dimensional interpolation matrices.
+   */
+  void prepare() {
+    const size_t n = storage.getSize();
+    const size_t d = storage.getDimension();
+    std::map<std::vector<uint64_t>, size_t> factorizationsOfPoints;
+    std::vector<uint64_t> points1D;
+
+    factorizations.clear();
+    poles.assign(d, Poles());
+
+    for (size_t t = 0; t < d; t++) {
+      Poles& polesOfDim = poles[t];
+      std::vector<size_t>& sequenceNumbers = polesOfDim.sequenceNumbers;
+
+      sequenceNumbers.resize(n);
+      std::iota(sequenceNumbers.begin(), sequenceNumbers.end(), 0);
+
+      // sort by the grid point without dimension t, then by the coordinate in dimension t
+      std::sort(sequenceNumbers.begin(), sequenceNumbers.end(), [this, t](size_t a, size_t b) {
+        const int comparison = compareWithoutDimension(a, b, t);
+        return (comparison != 0) ? (comparison < 0)
+                                 : (getCoordinate(getKey(a, t)) < getCoordinate(getKey(b, t)));
+      });
+
+      polesOfDim.offsets.clear();
+      polesOfDim.factorizations.clear();
+
+      for (size_t k = 0; k < n;) {
+        size_t k2 = k + 1;
+
+        while ((k2 < n) &&
+               (compareWithoutDimension(sequenceNumbers[k], sequenceNumbers[k2], t) == 0)) {
+          k2++;
+        }
+
+        points1D.resize(k2 - k);
+
+        for (size_t j = k; j < k2; j++) {
+          points1D[j - k] = getKey(sequenceNumbers[j], t);
+        }
+
+        auto it = factorizationsOfPoints.find(points1D);
+
+        if (it == factorizationsOfPoints.end()) {
+          it = factorizationsOfPoints.insert(std::make_pair(points1D, factorizations.size())).first;
+          factorizations.push_back(factorize(points1D));
+        }
+
+        polesOfDim.offsets.push_back(k);
+        polesOfDim.factorizations.push_back(it->second);
+        k = k2;
+      }
+
+      polesOfDim.offsets.push_back(n);
+    }
+
+    preparedSize = n;
+    prepared = true;
+  }
+
+  /**
+   * @param[in,out] values  function values at the grid points,
+   *                        will be replaced by the hierarchical coefficients
+   */
+  void hierarchise(DataVector& values) {
+    const size_t n = storage.getSize();
+    const DataVector rhs(values);
+    const double threshold = tolerance * std::max(rhs.maxNorm(), 1.0);
+    DataVector& x = values;
+    DataVector r(n), rHat(n), p(n), pHat(n), v(n), s(n), sHat(n), t(n);
+
+    // initial guess: unidirectional principle applied to the function values
+    applyUnidirectionalPrinciple(x);
+    numberOfIterations = 0;
+    assembleMatrix();
+
+    // outer loop: restart BiCGStab with the true residual (in case of breakdowns or
+    // if the recursively updated residual has drifted away from the true one)
+    while (true) {
+      multiplyMatrix(x, r);
+      r.mult(-1.0);
+      r.add(rhs);
+
+      if (r.maxNorm() <= threshold) {
+        clearMatrix();
+        return;
+      }
+
+      if (numberOfIterations >= maxIterations) {
+        clearMatrix();
+        throw operation_exception(
+            "AlgorithmUnidirectionalHierarchisation::hierarchise: BiCGStab did not converge.");
+      }
+
+      rHat = r;
+      p.setAll(0.0);
+      v.setAll(0.0);
+      double rho = 1.0;
+      double alpha = 1.0;
+      double omega = 1.0;
+
+      // BiCGStab with the unidirectional principle as right preconditioner
+      for (; numberOfIterations < maxIterations; numberOfIterations++) {
+        const double rhoNew = rHat.dotProduct(r);
+
+        // breakdown, restart (counting the iteration to guarantee termination)
+        if (rhoNew == 0.0) {
+          numberOfIterations++;
+          break;
+        }
+
+        // p = r + beta * (p - omega * v)
+        const double beta = (rhoNew / rho) * (alpha / omega);
+        p.axpy(-omega, v);
+        p.mult(beta);
+        p.add(r);
+
+        pHat = p;
+        applyUnidirectionalPrinciple(pHat);
+        multiplyMatrix(pHat, v);
+
+        const double rHatV = rHat.dotProduct(v);
+
+        if (rHatV == 0.0) {
+          numberOfIterations++;
+          break;
+        }
+
+        alpha = rhoNew / rHatV;
+        s = r;
+        s.axpy(-alpha, v);
+        x.axpy(alpha, pHat);
+
+        if (s.maxNorm() <= threshold) {
+          numberOfIterations++;
+          break;
+        }
+
+        sHat = s;
+        applyUnidirectionalPrinciple(sHat);
+        multiplyMatrix(sHat, t);
+
+        const double tt = t.dotProduct(t);
+        omega = (tt == 0.0) ? 0.0 : t.dotProduct(s) / tt;
+        x.axpy(omega, sHat);
+        r = s;
+        r.axpy(-omega, t);
+        rho = rhoNew;
+
+        if ((omega == 0.0) || (r.maxNorm() <= threshold)) {
+          numberOfIterations++;
+          break;
+        }
+      }
+    }
+  }
+
+  /**
+   * @param[in,out] alpha   hierarchical coefficients,
+   *                        will be replaced by the function values at the grid points
+   */
+  void dehierarchise(DataVector& alpha) {
+    const size_t n = storage.getSize();
+    const size_t d = storage.getDimension();
+    const DataVector coefficients(alpha);
+
+#pragma omp parallel
+    {
+      // the bases and the evaluation algorithm are not required to be thread-safe
+      BASIS threadBasis(basis);
+      AlgorithmLocalSupportEvaluation<BASIS> evaluation(storage, threadBasis, supportRadius);
+      DataVector point(d);
+      std::vector<size_t> sequenceNumbers;
+      std::vector<double> factors;
+
+#pragma omp for schedule(static)
+      for (size_t k = 0; k < n; k++) {
+        storage.getPoint(k).getStandardCoordinates(point);
+        evaluation.getAffectedBasisFunctions(point, 0, sequenceNumbers, factors);
+        double result = 0.0;
+
+        for (size_t j = 0; j < sequenceNumbers.size(); j++) {
+          double curValue = coefficients[sequenceNumbers[j]];
+
+          for (size_t t = 0; t < d; t++) {
+            curValue *= factors[j * d + t];
+          }
+
+          result += curValue;
+        }
+
+        alpha[k] = result;
+      }
+    }
+  }
+
+  /**
+   * Replaces the values on every pole by the coefficients of the one-dimensional interpolant,
+   * dimension by dimension.
+   *
+   * @param[in,out] values  function values at the grid points
+   */
+  void applyUnidirectionalPrinciple(DataVector& values) {
+    if (!prepared || (storage.getSize() != preparedSize)) {
+      prepare();
+    }
+
+    for (size_t t = 0; t < storage.getDimension(); t++) {
+      const Poles& polesOfDim = poles[t];
+      const size_t numberOfPoles = polesOfDim.factorizations.size();
+
+#pragma omp parallel
+      {
+        std::vector<double> pole;
+        std::vector<double> rhs;
+
+#pragma omp for schedule(dynamic, 64)
+        for (size_t q = 0; q < numberOfPoles; q++) {
+          const size_t* sequenceNumbers = &polesOfDim.sequenceNumbers[polesOfDim.offsets[q]];
+          const size_t m = polesOfDim.offsets[q + 1] - polesOfDim.offsets[q];
+
+          pole.resize(m);
+
+          for (size_t j = 0; j < m; j++) {
+            pole[j] = values[sequenceNumbers[j]];
+          }
+
+          solve(factorizations[polesOfDim.factorizations[q]], pole, rhs);
+
+          for (size_t j = 0; j < m; j++) {
+            values[sequenceNumbers[j]] = pole[j];
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * @return number of BiCGStab iterations of the last hierarchisation
+   */
+  size_t getNumberOfIterations() const { return numberOfIterations; }
+
+ protected:
+  /**
+   * Factorization of a one-dimensional interpolation matrix A (grid points sorted by their
+   * coordinate). A is split into A = B + W S^T, where B is a band matrix, which equals A
+   * except for the k wide columns, which are replaced by unit vectors, W contains the
+   * differences of the wide columns and the unit vectors, and S selects the wide columns.
+   * If the band structure does not pay off or B is singular, A is factorized as dense matrix.
+   */
+  struct Factorization {
+    /// number of rows and columns
+    size_t size;
+    /// whether A is factorized as dense matrix (lu, permutation)
+    bool dense;
+    /// dense LU: L (below the diagonal, unit diagonal) and U (on and above the diagonal)
+    std::vector<double> lu;
+    /// dense LU: row permutation
+    std::vector<size_t> permutation;
+    /// number of subdiagonals of B (the number of superdiagonals is the same)
+    size_t bandwidth;
+    /// banded LU of B in LAPACK band storage (3 * bandwidth + 1 rows, column-major)
+    std::vector<double> band;
+    /// banded LU: row interchanges
+    std::vector<size_t> pivots;
+    /// wide columns (in ascending order)
+    std::vector<size_t> wideColumns;
+    /// B^{-1} W (size x k, row-major)
+    std::vector<double> correction;
+    /// dense LU of the capacitance matrix I + S^T B^{-1} W (k x k)
+    std::vector<double> capacitanceLU;
+    /// row permutation of the LU of the capacitance matrix
+    std::vector<size_t> capacitancePermutation;
+  };
+
+  /**
+   * Poles of one dimension.
+   */
+  struct Poles {
+    /// sequence numbers of the grid points, pole after pole
+    std::vector<size_t> sequenceNumbers;
+    /// offsets of the poles in sequenceNumbers (with the total size as last entry)
+    std::vector<size_t> offsets;
+    /// factorization of the one-dimensional interpolation matrix of every pole
+    std::vector<size_t> factorizations;
+  };
+
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// one-dimensional basis
+  BASIS& basis;
+  /// radius of the support in multiples of the mesh width
+  double supportRadius;
+  /// relative tolerance for the residual of the interpolation conditions
+  double tolerance;
+  /// maximal number of BiCGStab iterations
+  size_t maxIterations;
+  /// maximal number of non-zero entries of the cached interpolation matrix
+  size_t maxMatrixEntries;
+  /// number of BiCGStab iterations of the last hierarchisation
+  size_t numberOfIterations;
+  /// number of grid points when the poles were built
+  size_t preparedSize;
+  /// whether the poles have been built
+  bool prepared;
+  /// poles per dimension
+  std::vector<Poles> poles;
+  /// factorizations of the distinct one-dimensional interpolation matrices
+  std::vector<Factorization> factorizations;
+  /// row offsets of the cached interpolation matrix in CSR format (empty if not cached)
+  std::vector<size_t> matrixOffsets;
+  /// column indices of the cached interpolation matrix
+  std::vector<uint32_t> matrixColumns;
+  /// non-zero entries of the cached interpolation matrix
+  std::vector<double> matrixValues;
+
+  /**
+   * Assembles the interpolation matrix (values of all basis functions at all grid points)
+   * in CSR format, if it has at most maxMatrixEntries non-zero entries.
+   */
+  void assembleMatrix() {
+    const size_t n = storage.getSize();
+    const size_t d = storage.getDimension();
+    const size_t blockSize = 1024;
+    std::vector<std::vector<uint32_t>> blockColumns(blockSize);
+    std::vector<std::vector<double>> blockValues(blockSize);
+    bool tooLarge = false;
+
+    clearMatrix();
+    matrixOffsets.push_back(0);
+
+#pragma omp parallel
+    {
+      // the bases and the evaluation algorithm are not required to be thread-safe
+      BASIS threadBasis(basis);
+      AlgorithmLocalSupportEvaluation<BASIS> evaluation(storage, threadBasis, supportRadius);
+      DataVector point(d);
+      std::vector<size_t> sequenceNumbers;
+      std::vector<double> factors;
+
+      for (size_t blockStart = 0; blockStart < n; blockStart += blockSize) {
+        const size_t blockEnd = std::min(blockStart + blockSize, n);
+
+#pragma omp for schedule(static)
+        for (size_t k = blockStart; k < blockEnd; k++) {
+          std::vector<uint32_t>& columns = blockColumns[k - blockStart];
+          std::vector<double>& values = blockValues[k - blockStart];
+
+          storage.getPoint(k).getStandardCoordinates(point);
+          evaluation.getAffectedBasisFunctions(point, 0, sequenceNumbers, factors);
+          columns.resize(sequenceNumbers.size());
+          values.resize(sequenceNumbers.size());
+
+          for (size_t j = 0; j < sequenceNumbers.size(); j++) {
+            double curValue = 1.0;
+
+            for (size_t t = 0; t < d; t++) {
+              curValue *= factors[j * d + t];
+            }
+
+            columns[j] = static_cast<uint32_t>(sequenceNumbers[j]);
+            values[j] = curValue;
+          }
+        }
+
+#pragma omp single
+        {
+          for (size_t k = blockStart; (k < blockEnd) && !tooLarge; k++) {
+            const std::vector<uint32_t>& columns = blockColumns[k - blockStart];
+            const std::vector<double>& values = blockValues[k - blockStart];
+
+            if (matrixColumns.size() + columns.size() > maxMatrixEntries) {
+              tooLarge = true;
+            } else {
+              matrixColumns.insert(matrixColumns.end(), columns.begin(), columns.end());
+              matrixValues.insert(matrixValues.end(), values.begin(), values.end());
+              matrixOffsets.push_back(matrixColumns.size());
+            }
+          }
+        }
+
+        // all threads see the same value of tooLarge after the implicit barrier of single
+        if (tooLarge) {
+          break;
+        }
+      }
+    }
+
+    if (tooLarge) {
+      clearMatrix();
+    }
+  }
+
+  /**
+   * Frees the cached interpolation matrix.
+   */
+  void clearMatrix() {
+    std::vector<size_t>().swap(matrixOffsets);
+    std::vector<uint32_t>().swap(matrixColumns);
+    std::vector<double>().swap(matrixValues);
+  }
+
+  /**
+   * Multiplies the interpolation matrix with a vector, i.e., evaluates the linear combination
+   * at all grid points, using the cached matrix if available.
+   *
+   * @param      x  coefficient vector
+   * @param[out] y  values of the linear combination at the grid points
+   */
+  void multiplyMatrix(const DataVector& x, DataVector& y) {
+    const size_t n = storage.getSize();
+
+    if (matrixOffsets.size() != n + 1) {
+      y = x;
+      dehierarchise(y);
+      return;
+    }
+
+    y.resize(n);
+
+#pragma omp parallel for schedule(static)
+    for (size_t k = 0; k < n; k++) {
+      double result = 0.0;
+
+      for (size_t j = matrixOffsets[k]; j < matrixOffsets[k + 1]; j++) {
+        result += matrixValues[j] * x[matrixColumns[j]];
+      }
+
+      y[k] = result;
+    }
+  }
+
+  /**
+   * @param k   sequence number of the grid point
+   * @param t   dimension
+   * @return    key of the one-dimensional grid point (level and index) in dimension t
+   */
+  uint64_t getKey(size_t k, size_t t) const {
+    return (static_cast<uint64_t>(storage[k].getLevel(t)) << 32) |
+           static_cast<uint64_t>(storage[k].getIndex(t));
+  }
+
+  /**
+   * @param key key of a one-dimensional grid point (see getKey)
+   * @return    coordinate of the grid point
+   */
+  static double getCoordinate(uint64_t key) {
+    return static_cast<double>(static_cast<index_t>(key & 0xffffffff)) /
+           static_cast<double>(static_cast<index_t>(1) << static_cast<level_t>(key >> 32));
+  }
+
+  /**
+   * Compares two grid points lexicographically, ignoring one dimension.
+   *
+   * @param a   sequence number of the first grid point
+   * @param b   sequence number of the second grid point
+   * @param t   dimension to ignore
+   * @return    negative, zero or positive value if the first grid point is
+   *            smaller than, equal to or greater than the second grid point
+   */
+  int compareWithoutDimension(size_t a, size_t b, size_t t) const {
+    for (size_t t2 = 0; t2 < storage.getDimension(); t2++) {
+      if (t2 == t) {
+        continue;
+      }
+
+      const uint64_t keyA = getKey(a, t2);
+      const uint64_t keyB = getKey(b, t2);
+
+      if (keyA != keyB) {
+        return (keyA < keyB) ? -1 : 1;
+      }
+    }
+
+    return 0;
+  }
+
+  /**
+   * Assembles and factorizes the interpolation matrix of a one-dimensional set of grid points.
+   *
+   * @param points1D  keys of the one-dimensional grid points, sorted by their coordinate
+   * @return          factorization of the interpolation matrix
+   */
+  Factorization factorize(const std::vector<uint64_t>& points1D) {
+    const size_t m = points1D.size();
+    std::vector<double> coordinates(m);
+    // first and last index of every level, as modified basis functions at the boundary
+    // may have a larger support than the interior ones
+    std::map<level_t, std::pair<index_t, index_t>> extremeIndices;
+
+    for (size_t a = 0; a < m; a++) {
+      const level_t l = static_cast<level_t>(points1D[a] >> 32);
+      const index_t i = static_cast<index_t>(points1D[a] & 0xffffffff);
+      coordinates[a] = getCoordinate(points1D[a]);
+      auto it = extremeIndices.find(l);
+
+      if (it == extremeIndices.end()) {
+        extremeIndices[l] = std::make_pair(i, i);
+      } else {
+        it->second.first = std::min(it->second.first, i);
+        it->second.second = std::max(it->second.second, i);
+      }
+    }
+
+    // non-zero entries of the columns (row, value) and their distance to the diagonal
+    std::vector<std::vector<std::pair<size_t, double>>> columns(m);
+    std::vector<size_t> widths(m, 0);
+
+    for (size_t b = 0; b < m; b++) {
+      const level_t l = static_cast<level_t>(points1D[b] >> 32);
+      const index_t i = static_cast<index_t>(points1D[b] & 0xffffffff);
+      const std::pair<index_t, index_t>& extremes = extremeIndices[l];
+      size_t begin = 0;
+      size_t end = m;
+
+      if ((i != extremes.first) && (i != extremes.second)) {
+        // one mesh width safety margin
+        const double h = 1.0 / static_cast<double>(static_cast<index_t>(1) << l);
+        const double iDbl = static_cast<double>(i);
+        begin = std::lower_bound(coordinates.begin(), coordinates.end(),
+                                 (iDbl - supportRadius - 1.0) * h) - coordinates.begin();
+        end = std::upper_bound(coordinates.begin(), coordinates.end(),
+                               (iDbl + supportRadius + 1.0) * h) - coordinates.begin();
+      }
+
+      for (size_t a = begin; a < end; a++) {
+        const double value = basis.eval(l, i, coordinates[a]);
+
+        if (value != 0.0) {
+          columns[b].emplace_back(a, value);
+          widths[b] = std::max(widths[b], (a > b) ? (a - b) : (b - a));
+        }
+      }
+    }
+
+    Factorization result;
+    result.size = m;
+    result.dense = true;
+
+    // choose the number k of wide columns that minimizes the estimated costs of the
+    // factorization (band LU, B^{-1} W and LU of the capacitance matrix)
+    std::vector<size_t> columnsByWidth(m);
+    std::iota(columnsByWidth.begin(), columnsByWidth.end(), 0);
+    std::sort(columnsByWidth.begin(), columnsByWidth.end(),
+              [&widths](size_t a, size_t b) { return widths[a] > widths[b]; });
+
+    const double mDbl = static_cast<double>(m);
+    double bestCosts = 2.0 / 3.0 * mDbl * mDbl * mDbl;
+    size_t bestK = m;
+
+    for (size_t k = 0; k < m; k++) {
+      const double h = static_cast<double>(widths[columnsByWidth[k]]);
+      const double kDbl = static_cast<double>(k);
+      const double costs = 3.0 * mDbl * h * h + 6.0 * mDbl * h * kDbl + kDbl * kDbl * kDbl;
+
+      if (costs < bestCosts) {
+        bestCosts = costs;
+        bestK = k;
+      }
+    }
+
+    if (bestK < m) {
+      result.dense = false;
+      result.bandwidth = widths[columnsByWidth[bestK]];
+      result.wideColumns.assign(columnsByWidth.begin(), columnsByWidth.begin() + bestK);
+      std::sort(result.wideColumns.begin(), result.wideColumns.end());
+
+      if (!factorizeBanded(columns, result)) {
+        result.dense = true;
+      }
+    }
+
+    if (result.dense) {
+      std::vector<double>& lu = result.lu;
+      lu.assign(m * m, 0.0);
+
+      for (size_t b = 0; b < m; b++) {
+        for (const std::pair<size_t, double>& entry : columns[b]) {
+          lu[entry.first * m + b] = entry.second;
+        }
+      }
+
+      if (!factorizeDense(lu, m, result.permutation)) {
+        throw operation_exception(
+            "AlgorithmUnidirectionalHierarchisation::factorize: "
+            "One-dimensional interpolation matrix is singular.");
+      }
+    }
+
+    return result;
+  }
+
+  /**
+   * Computes the banded LU of B, B^{-1} W and the LU of the capacitance matrix
+   * (see Factorization).
+   *
+   * @param         columns       non-zero entries of the columns of the interpolation matrix
+   * @param[in,out] factorization factorization with size, bandwidth and wideColumns set
+   * @return        false if B or the capacitance matrix is singular
+   */
+  static bool factorizeBanded(const std::vector<std::vector<std::pair<size_t, double>>>& columns,
+                              Factorization& factorization) {
+    const size_t m = factorization.size;
+    const size_t h = factorization.bandwidth;
+    const size_t ld = 3 * h + 1;
+    const std::vector<size_t>& wideColumns = factorization.wideColumns;
+    const size_t k = wideColumns.size();
+    std::vector<double>& band = factorization.band;
+    std::vector<bool> isWide(m, false);
+
+    for (size_t b : wideColumns) {
+      isWide[b] = true;
+    }
+
+    band.assign(ld * m, 0.0);
+
+    for (size_t b = 0; b < m; b++) {
+      if (isWide[b]) {
+        band[2 * h + b * ld] = 1.0;
+      } else {
+        for (const std::pair<size_t, double>& entry : columns[b]) {
+          band[2 * h + entry.first - b + b * ld] = entry.second;
+        }
+      }
+    }
+
+    // LU with partial pivoting in band storage (the element (a, b) is stored at
+    // 2 * h + a - b + b * ld), the fill-in increases the upper bandwidth to 2 * h
+    std::vector<size_t>& pivots = factorization.pivots;
+    pivots.resize(m);
+    size_t lastColumn = 0;
+
+    for (size_t j = 0; j < m; j++) {
+      const size_t rows = std::min(h, m - 1 - j);
+      double* column = &band[2 * h + j * ld];
+      size_t pivot = 0;
+
+      for (size_t a = 1; a <= rows; a++) {
+        if (std::abs(column[a]) > std::abs(column[pivot])) {
+          pivot = a;
+        }
+      }
+
+      pivots[j] = j + pivot;
+
+      if (column[pivot] == 0.0) {
+        return false;
+      }
+
+      lastColumn = std::max(lastColumn, std::min(j + h + pivot, m - 1));
+
+      if (pivot != 0) {
+        for (size_t b = j; b <= lastColumn; b++) {
+          std::swap(band[2 * h + j - b + b * ld], band[2 * h + j + pivot - b + b * ld]);
+        }
+      }
+
+      for (size_t a = 1; a <= rows; a++) {
+        column[a] /= column[0];
+      }
+
+      for (size_t b = j + 1; b <= lastColumn; b++) {
+        const double factor = band[2 * h + j - b + b * ld];
+
+        if (factor != 0.0) {
+          for (size_t a = 1; a <= rows; a++) {
+            band[2 * h + j + a - b + b * ld] -= column[a] * factor;
+          }
+        }
+      }
+    }
+
+    // B^{-1} W and capacitance matrix I + S^T B^{-1} W
+    std::vector<double>& correction = factorization.correction;
+    std::vector<double>& capacitance = factorization.capacitanceLU;
+    std::vector<double> w(m);
+    correction.resize(m * k);
+    capacitance.resize(k * k);
+
+    for (size_t s = 0; s < k; s++) {
+      std::fill(w.begin(), w.end(), 0.0);
+
+      for (const std::pair<size_t, double>& entry : columns[wideColumns[s]]) {
+        w[entry.first] = entry.second;
+      }
+
+      w[wideColumns[s]] -= 1.0;
+      solveBanded(factorization, w);
+
+      for (size_t a = 0; a < m; a++) {
+        correction[a * k + s] = w[a];
+      }
+
+      for (size_t r = 0; r < k; r++) {
+        capacitance[r * k + s] = ((r == s) ? 1.0 : 0.0) + w[wideColumns[r]];
+      }
+    }
+
+    return factorizeDense(capacitance, k, factorization.capacitancePermutation);
+  }
+
+  /**
+   * LU factorization with partial pivoting of a dense matrix.
+   *
+   * @param[in,out] lu          matrix (row-major), will be replaced by L and U
+   * @param         m           number of rows and columns
+   * @param[out]    permutation row permutation
+   * @return        false if the matrix is singular
+   */
+  static bool factorizeDense(std::vector<double>& lu, size_t m,
+                             std::vector<size_t>& permutation) {
+    permutation.resize(m);
+    std::iota(permutation.begin(), permutation.end(), 0);
+
+    for (size_t j = 0; j < m; j++) {
+      size_t pivot = j;
+
+      for (size_t a = j + 1; a < m; a++) {
+        if (std::abs(lu[a * m + j]) > std::abs(lu[pivot * m + j])) {
+          pivot = a;
+        }
+      }
+
+      if (lu[pivot * m + j] == 0.0) {
+        return false;
+      }
+
+      if (pivot != j) {
+        std::swap_ranges(lu.begin() + j * m, lu.begin() + (j + 1) * m, lu.begin() + pivot * m);
+        std::swap(permutation[j], permutation[pivot]);
+      }
+
+#pragma omp parallel for schedule(static) if (m > 256)
+      for (size_t a = j + 1; a < m; a++) {
+        const double factor = lu[a * m + j] / lu[j * m + j];
+        lu[a * m + j] = factor;
+
+        if (factor != 0.0) {
+          for (size_t b = j + 1; b < m; b++) {
+            lu[a * m + b] -= factor * lu[j * m + b];
+          }
+        }
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * @param         lu          LU factorization of a dense matrix (see factorizeDense)
+   * @param         permutation row permutation
+   * @param         m           number of rows and columns
+   * @param[in,out] x           right-hand side, will be replaced by the solution
+   * @param         rhs         temporary vector
+   */
+  static void solveDense(const std::vector<double>& lu, const std::vector<size_t>& permutation,
+                         size_t m, double* x, std::vector<double>& rhs) {
+    rhs.assign(x, x + m);
+
+    for (size_t a = 0; a < m; a++) {
+      double sum = rhs[permutation[a]];
+
+      for (size_t b = 0; b < a; b++) {
+        sum -= lu[a * m + b] * x[b];
+      }
+
+      x[a] = sum;
+    }
+
+    for (size_t a = m; a-- > 0;) {
+      double sum = x[a];
+
+      for (size_t b = a + 1; b < m; b++) {
+        sum -= lu[a * m + b] * x[b];
+      }
+
+      x[a] = sum / lu[a * m + a];
+    }
+  }
+
+  /**
+   * Solves B x = rhs with the banded LU of B (see factorizeBanded).
+   *
+   * @param         factorization factorization of the interpolation matrix
+   * @param[in,out] x             right-hand side, will be replaced by the solution
+   */
+  static void solveBanded(const Factorization& factorization, std::vector<double>& x) {
+    const size_t m = factorization.size;
+    const size_t h = factorization.bandwidth;
+    const size_t ld = 3 * h + 1;
+    const std::vector<double>& band = factorization.band;
+
+    for (size_t j = 0; j < m; j++) {
+      const size_t rows = std::min(h, m - 1 - j);
+      const double* column = &band[2 * h + j * ld];
+      std::swap(x[j], x[factorization.pivots[j]]);
+
+      for (size_t a = 1; a <= rows; a++) {
+        x[j + a] -= column[a] * x[j];
+      }
+    }
+
+    for (size_t j = m; j-- > 0;) {
+      const double* column = &band[2 * h + j * ld];
+      x[j] /= column[0];
+      const size_t first = (j > 2 * h) ? (j - 2 * h) : 0;
+
+      for (size_t a = first; a < j; a++) {
+        x[a] -= band[2 * h + a - j + j * ld] * x[j];
+      }
+    }
+  }
+
+  /**
+   * @param         factorization   factorization of the interpolation matrix
+   * @param[in,out] x               right-hand side, will be replaced by the solution
+   * @param         rhs             temporary vector
+   */
+  static void solve(const Factorization& factorization, std::vector<double>& x,
+                    std::vector<double>& rhs) {
+    const size_t m = factorization.size;
+
+    if (factorization.dense) {
+      solveDense(factorization.lu, factorization.permutation, m, x.data(), rhs);
+      return;
+    }
+
+    solveBanded(factorization, x);
+
+    const std::vector<size_t>& wideColumns = factorization.wideColumns;
+    const size_t k = wideColumns.size();
+
+    if (k == 0) {
+      return;
+    }
+
+    // x = y - B^{-1} W (I + S^T B^{-1} W)^{-1} S^T y with y = B^{-1} rhs
+    std::vector<double> t(k);
+
+    for (size_t s = 0; s < k; s++) {
+      t[s] = x[wideColumns[s]];
+    }
+
+    solveDense(factorization.capacitanceLU, factorization.capacitancePermutation, k, t.data(),
+               rhs);
+
+    for (size_t a = 0; a < m; a++) {
+      const double* correction = &factorization.correction[a * k];
+      double sum = 0.0;
+
+      for (size_t s = 0; s < k; s++) {
+        sum += correction[s] * t[s];
+      }
+
+      x[a] -= sum;
+    }
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* ALGORITHMUNIDIRECTIONALHIERARCHISATION_HPP */
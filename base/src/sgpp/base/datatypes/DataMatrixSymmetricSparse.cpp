@@ -0,0 +1,175 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrixSymmetricSparse.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+DataMatrixSymmetricSparse::DataMatrixSymmetricSparse() : DataMatrixSymmetricSparse(0) {}
+
+DataMatrixSymmetricSparse::DataMatrixSymmetricSparse(size_t size)
+    : size(size), rowOffsets(size + 1, 0) {}
+
+void DataMatrixSymmetricSparse::setRows(std::vector<std::vector<std::pair<size_t, double>>>& rows) {
+  size = rows.size();
+  rowOffsets.resize(size + 1);
+  rowOffsets[0] = 0;
+
+  for (size_t i = 0; i < size; i++) {
+    rowOffsets[i + 1] = rowOffsets[i] + rows[i].size();
+  }
+
+  columnIndices.resize(rowOffsets[size]);
+  values.resize(rowOffsets[size]);
+  blockBegin.clear();
+
+#pragma omp parallel for schedule(dynamic, 64)
+  for (size_t i = 0; i < size; i++) {
+    size_t k = rowOffsets[i];
+
+    for (const std::pair<size_t, double>& entry : rows[i]) {
+      columnIndices[k] = entry.first;
+      values[k] = entry.second;
+      k++;
+    }
+
+    std::vector<std::pair<size_t, double>>().swap(rows[i]);
+  }
+
+  rows.clear();
+}
+
+double DataMatrixSymmetricSparse::get(size_t row, size_t col) const {
+  if ((row >= size) || (col >= size)) {
+    throw data_exception("DataMatrixSymmetricSparse::get : index out of bounds");
+  }
+
+  if (row > col) {
+    std::swap(row, col);
+  }
+
+  const auto begin = columnIndices.begin() + rowOffsets[row];
+  const auto end = columnIndices.begin() + rowOffsets[row + 1];
+  const auto it = std::lower_bound(begin, end, col);
+
+  return ((it != end) && (*it == col)) ? values[it - columnIndices.begin()] : 0.0;
+}
+
+void DataMatrixSymmetricSparse::mult(const DataVector& x, DataVector& result) const {
+  if ((x.getSize() != size) || (result.getSize() != size)) {
+    throw data_exception("DataMatrixSymmetricSparse::mult : dimensions do not match");
+  }
+
+  size_t numberOfBlocks = 1;
+#ifdef _OPENMP
+  numberOfBlocks = static_cast<size_t>(omp_get_max_threads());
+#endif
+  numberOfBlocks = std::max(std::min(numberOfBlocks, size), static_cast<size_t>(1));
+
+  if (numberOfBlocks == 1) {
+    result.setAll(0.0);
+
+    for (size_t i = 0; i < size; i++) {
+      const double xi = x[i];
+      double sum = 0.0;
+
+      for (size_t k = rowOffsets[i]; k < rowOffsets[i + 1]; k++) {
+        const size_t j = columnIndices[k];
+        sum += values[k] * x[j];
+
+        if (j != i) {
+          result[j] += values[k] * xi;
+        }
+      }
+
+      result[i] += sum;
+    }
+
+    return;
+  }
+
+  // every block processes a contiguous range of rows with about the same number of entries,
+  // the contributions of the transposed upper triangle end up in rows of other blocks and
+  // are therefore accumulated in a separate buffer per block, which are summed up afterwards
+  if (blockBegin.size() != numberOfBlocks + 1) {
+    computeBlocks(numberOfBlocks);
+  }
+
+  buffers.resize(numberOfBlocks * size);
+
+#pragma omp parallel
+  {
+#pragma omp for schedule(static, 1)
+    for (size_t b = 0; b < numberOfBlocks; b++) {
+      double* buffer = &buffers[b * size];
+      std::fill(buffer, buffer + size, 0.0);
+
+      for (size_t i = blockBegin[b]; i < blockBegin[b + 1]; i++) {
+        const double xi = x[i];
+        double sum = 0.0;
+
+        for (size_t k = rowOffsets[i]; k < rowOffsets[i + 1]; k++) {
+          const size_t j = columnIndices[k];
+          sum += values[k] * x[j];
+
+          if (j != i) {
+            buffer[j] += values[k] * xi;
+          }
+        }
+
+        buffer[i] += sum;
+      }
+    }
+
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < size; i++) {
+      double sum = 0.0;
+
+      for (size_t b = 0; b < numberOfBlocks; b++) {
+        sum += buffers[b * size + i];
+      }
+
+      result[i] = sum;
+    }
+  }
+}
+
+void DataMatrixSymmetricSparse::computeBlocks(size_t numberOfBlocks) const {
+  const size_t nnz = values.size();
+  blockBegin.assign(numberOfBlocks + 1, size);
+
+  for (size_t b = 0; b < numberOfBlocks; b++) {
+    blockBegin[b] = static_cast<size_t>(
+        std::lower_bound(rowOffsets.begin(), rowOffsets.end() - 1, b * nnz / numberOfBlocks) -
+        rowOffsets.begin());
+  }
+}
+
+void DataMatrixSymmetricSparse::toDense(DataMatrix& dense) const {
+  dense.resizeRowsCols(size, size);
+  dense.setAll(0.0);
+
+  for (size_t i = 0; i < size; i++) {
+    for (size_t k = rowOffsets[i]; k < rowOffsets[i + 1]; k++) {
+      dense.set(i, columnIndices[k], values[k]);
+      dense.set(columnIndices[k], i, values[k]);
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,109 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef DATAMATRIXSYMMETRICSPARSE_HPP
+#define DATAMATRIXSYMMETRICSPARSE_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Symmetric square matrix of which only the nonzero entries of the upper triangle
+ * (including the diagonal) are stored in compressed sparse row (CSR) format.
+ * This is intended for matrices like the mass matrix \f$(\phi_i, \phi_j)_{L^2}\f$ of a sparse
+ * grid, which are symmetric and whose entries vanish for basis functions with disjoint supports.
+ */
+class DataMatrixSymmetricSparse {
+ public:
+  /**
+   * Creates an empty matrix.
+   */
+  DataMatrixSymmetricSparse();
+
+  /**
+   * Creates a zero matrix.
+   *
+   * @param size  number of rows and columns
+   */
+  explicit DataMatrixSymmetricSparse(size_t size);
+
+  /**
+   * Replaces the content of the matrix.
+   *
+   * @param rows  rows[i] contains the pairs \f$(j, a_{ij})\f$ of the entries with
+   *              \f$j \ge i\f$ to be stored, sorted by \f$j\f$
+   *              (the number of rows determines the size, rows is cleared)
+   */
+  void setRows(std::vector<std::vector<std::pair<size_t, double>>>& rows);
+
+  /**
+   * @return number of rows and columns
+   */
+  size_t getSize() const { return size; }
+
+  /**
+   * @return number of stored entries (nonzero entries of the upper triangle)
+   */
+  size_t getNumberOfNonZeros() const { return values.size(); }
+
+  /**
+   * @param row   row index
+   * @param col   column index
+   * @return      entry \f$a_{ij}\f$ (also for \f$i > j\f$)
+   */
+  double get(size_t row, size_t col) const;
+
+  /**
+   * Multiplies the matrix with a vector (in parallel if compiled with OpenMP).
+   * The buffers of the threads are kept between the calls, therefore the same matrix
+   * must not be multiplied concurrently.
+   *
+   * @param x       vector of length getSize()
+   * @param result  vector of length getSize() into which the product is stored
+   */
+  void mult(const DataVector& x, DataVector& result) const;
+
+  /**
+   * Stores the matrix in a dense matrix.
+   *
+   * @param dense   dense matrix, is resized to getSize() x getSize()
+   */
+  void toDense(DataMatrix& dense) const;
+
+ protected:
+  /// number of rows and columns
+  size_t size;
+  /// offsets of the rows in columnIndices and values (size + 1 entries)
+  std::vector<size_t> rowOffsets;
+  /// column indices of the stored entries
+  std::vector<size_t> columnIndices;
+  /// values of the stored entries
+  std::vector<double> values;
+  /// first rows of the row blocks of mult (with about the same number of entries per block)
+  mutable std::vector<size_t> blockBegin;
+  /// buffers of mult for the contributions of the transposed upper triangle (one per block)
+  mutable std::vector<double> buffers;
+
+  /**
+   * Distributes the rows to the given number of blocks for mult.
+   *
+   * @param numberOfBlocks  number of blocks
+   */
+  void computeBlocks(size_t numberOfBlocks) const;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* DATAMATRIXSYMMETRICSPARSE_HPP */
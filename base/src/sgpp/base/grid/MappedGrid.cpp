@@ -0,0 +1,393 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/MappedGrid.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/Basis.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+/// magic number at the beginning of every file
+const char MAGIC[8] = {'S', 'G', 'P', 'P', 'G', 'R', 'I', 'D'};
+/// written in the byte order of the writing machine to detect foreign files
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+/// alignment of the sections
+const uint64_t SECTION_ALIGNMENT = 64;
+
+/**
+ * Fixed-size header at the beginning of every file.
+ */
+struct BinaryGridHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint64_t dimension;
+  uint64_t numberOfPoints;
+  uint64_t descriptionOffset;
+  uint64_t descriptionSize;
+  uint64_t levelOffset;
+  uint64_t indexOffset;
+  uint64_t leafOffset;
+  /// zero if the file does not contain coefficients
+  uint64_t alphaOffset;
+  uint64_t fileSize;
+};
+
+inline uint64_t alignOffset(uint64_t offset) {
+  return (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+}
+
+void writePadding(std::ofstream& fout, uint64_t& position, uint64_t offset) {
+  static const char zeros[SECTION_ALIGNMENT] = {};
+  fout.write(zeros, static_cast<std::streamsize>(offset - position));
+  position = offset;
+}
+
+/**
+ * Whether the basis functions of the grid type can be evaluated by level and index in the unit
+ * cube alone, this excludes stretched grids and prewavelets.
+ */
+bool hasPointwiseBasis(GridType type) {
+  return (type != GridType::LinearStretched) && (type != GridType::LinearStretchedBoundary) &&
+         (type != GridType::Prewavelet);
+}
+
+/**
+ * Evaluates the linear combination of the basis functions of the mapped grid points at a point
+ * in the unit cube.
+ */
+double evalInPlace(SBasis& basis, const HashGridPoint::level_type* levels,
+                   const HashGridPoint::index_type* indices, const double* coefficients,
+                   size_t numberOfPoints, size_t dimension, const double* point) {
+  double result = 0.0;
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    const HashGridPoint::level_type* l = &levels[i * dimension];
+    const HashGridPoint::index_type* idx = &indices[i * dimension];
+    double value = coefficients[i];
+
+    // stop as soon as the point lies outside of the support
+    for (size_t d = 0; (d < dimension) && (value != 0.0); d++) {
+      value *= basis.eval(l[d], idx[d], point[d]);
+    }
+
+    result += value;
+  }
+
+  return result;
+}
+
+/**
+ * Creates the evaluation operation of the grid type, or the naive one if there is none.
+ */
+OperationEval* createEvalOperation(Grid& grid) {
+  try {
+    return op_factory::createOperationEval(grid);
+  } catch (factory_exception&) {
+    return op_factory::createOperationEvalNaive(grid);
+  }
+}
+
+/**
+ * Creates the multiple evaluation operation of the grid type, or the naive one if there is none.
+ */
+OperationMultipleEval* createMultipleEvalOperation(Grid& grid, DataMatrix& points) {
+  try {
+    return op_factory::createOperationMultipleEval(grid, points);
+  } catch (factory_exception&) {
+    return op_factory::createOperationMultipleEvalNaive(grid, points);
+  }
+}
+
+}  // namespace
+
+const uint32_t MappedGrid::FORMAT_VERSION;
+
+void MappedGrid::write(const std::string& filename, Grid& grid, const DataVector* alpha) {
+  static_assert(sizeof(HashGridPoint::level_type) == 4 && sizeof(HashGridPoint::index_type) == 4,
+                "binary grid format stores 32 bit levels and indices");
+
+  HashGridStorage& storage = grid.getStorage();
+  const uint64_t dim = storage.getDimension();
+  const uint64_t n = storage.getSize();
+
+  if ((alpha != nullptr) && (alpha->getSize() != n)) {
+    throw data_exception("MappedGrid::write : alpha has to have one entry per grid point");
+  }
+
+  // the grid parameters are stored as text serialization of an empty grid of the same type
+  std::unique_ptr<Grid> emptyGrid(grid.createGridOfEquivalentType(dim));
+
+  if (storage.getStretching() != nullptr) {
+    emptyGrid->setStretching(*storage.getStretching());
+  } else {
+    emptyGrid->setBoundingBox(*storage.getBoundingBox());
+  }
+
+  const std::string description = emptyGrid->serialize();
+
+  BinaryGridHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = FORMAT_VERSION;
+  header.byteOrderMark = BYTE_ORDER_MARK;
+  header.dimension = dim;
+  header.numberOfPoints = n;
+  header.descriptionOffset = alignOffset(sizeof(BinaryGridHeader));
+  header.descriptionSize = description.size();
+  header.levelOffset = alignOffset(header.descriptionOffset + header.descriptionSize);
+  header.indexOffset = alignOffset(header.levelOffset + n * dim * 4);
+  header.leafOffset = alignOffset(header.indexOffset + n * dim * 4);
+  header.fileSize = header.leafOffset + n;
+
+  if (alpha != nullptr) {
+    header.alphaOffset = alignOffset(header.fileSize);
+    header.fileSize = header.alphaOffset + n * sizeof(double);
+  }
+
+  std::ofstream fout(filename.c_str(), std::ios::binary);
+
+  if (!fout) {
+    throw file_exception("MappedGrid::write : unable to open file for write access");
+  }
+
+  uint64_t position = sizeof(BinaryGridHeader);
+  fout.write(reinterpret_cast<const char*>(&header), sizeof(BinaryGridHeader));
+  writePadding(fout, position, header.descriptionOffset);
+  fout.write(description.data(), static_cast<std::streamsize>(description.size()));
+  position += description.size();
+
+  // write levels and indices point by point to avoid a second copy of the grid
+  std::vector<HashGridPoint::level_type> row(dim);
+
+  writePadding(fout, position, header.levelOffset);
+
+  for (size_t i = 0; i < n; i++) {
+    HashGridPoint& point = storage.getPoint(i);
+
+    for (size_t d = 0; d < dim; d++) {
+      row[d] = point.getLevel(d);
+    }
+
+    fout.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(4 * dim));
+  }
+
+  position += n * dim * 4;
+  writePadding(fout, position, header.indexOffset);
+
+  for (size_t i = 0; i < n; i++) {
+    HashGridPoint& point = storage.getPoint(i);
+
+    for (size_t d = 0; d < dim; d++) {
+      row[d] = point.getIndex(d);
+    }
+
+    fout.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(4 * dim));
+  }
+
+  position += n * dim * 4;
+  writePadding(fout, position, header.leafOffset);
+
+  for (size_t i = 0; i < n; i++) {
+    const char leaf = storage.getPoint(i).isLeaf() ? 1 : 0;
+    fout.write(&leaf, 1);
+  }
+
+  position += n;
+
+  if (alpha != nullptr) {
+    writePadding(fout, position, header.alphaOffset);
+    fout.write(reinterpret_cast<const char*>(alpha->getPointer()),
+               static_cast<std::streamsize>(n * sizeof(double)));
+  }
+
+  if (!fout) {
+    throw file_exception("MappedGrid::write : error while writing the file");
+  }
+}
+
+MappedGrid::MappedGrid(const std::string& filename)
+    : file(filename, MappedFile::AccessPattern::Random),
+      dimension(0),
+      numberOfPoints(0),
+      levels(nullptr),
+      indices(nullptr),
+      leaves(nullptr),
+      alpha(nullptr),
+      gridDescription(),
+      emptyGrid(),
+      evaluationGrid() {
+  if (file.getSize() < sizeof(BinaryGridHeader)) {
+    throw file_exception("MappedGrid : file is too small for a binary grid");
+  }
+
+  parseHeader();
+}
+
+MappedGrid::~MappedGrid() {}
+
+void MappedGrid::parseHeader() {
+  const char* data = file.getData();
+  BinaryGridHeader header;
+  std::memcpy(&header, data, sizeof(BinaryGridHeader));
+
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    throw file_exception("MappedGrid : file is not a binary grid");
+  } else if (header.byteOrderMark != BYTE_ORDER_MARK) {
+    throw file_exception("MappedGrid : binary grid has been written with a different byte order");
+  } else if (header.version > FORMAT_VERSION) {
+    throw file_exception("MappedGrid : binary grid has been written with a newer version");
+  }
+
+  const uint64_t n = header.numberOfPoints;
+  const uint64_t dim = header.dimension;
+
+  // check that all sections lie inside of the file
+  if ((header.fileSize > file.getSize()) ||
+      (header.descriptionOffset + header.descriptionSize > header.fileSize) ||
+      (header.levelOffset + n * dim * 4 > header.fileSize) ||
+      (header.indexOffset + n * dim * 4 > header.fileSize) ||
+      (header.leafOffset + n > header.fileSize) ||
+      ((header.alphaOffset != 0) && (header.alphaOffset + n * sizeof(double) > header.fileSize)) ||
+      (header.levelOffset % 4 != 0) || (header.indexOffset % 4 != 0) ||
+      (header.alphaOffset % sizeof(double) != 0)) {
+    throw file_exception("MappedGrid : binary grid is truncated or corrupt");
+  }
+
+  dimension = static_cast<size_t>(dim);
+  numberOfPoints = static_cast<size_t>(n);
+  levels = reinterpret_cast<const HashGridPoint::level_type*>(data + header.levelOffset);
+  indices = reinterpret_cast<const HashGridPoint::index_type*>(data + header.indexOffset);
+  leaves = reinterpret_cast<const uint8_t*>(data + header.leafOffset);
+  alpha = (header.alphaOffset != 0) ? reinterpret_cast<const double*>(data + header.alphaOffset)
+                                    : nullptr;
+  gridDescription.assign(data + header.descriptionOffset, header.descriptionSize);
+  emptyGrid.reset(Grid::unserialize(gridDescription));
+}
+
+GridType MappedGrid::getType() const { return emptyGrid->getType(); }
+
+Grid* MappedGrid::createGrid() const {
+  std::unique_ptr<Grid> grid(Grid::unserialize(gridDescription));
+  HashGridStorage& storage = grid->getStorage();
+  HashGridPoint point(dimension);
+
+  storage.reserve(numberOfPoints);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    for (size_t d = 0; d < dimension; d++) {
+      point.push(d, levels[i * dimension + d], indices[i * dimension + d]);
+    }
+
+    point.setLeaf(isLeaf(i));
+    point.rehash();
+    storage.insert(point);
+  }
+
+  return grid.release();
+}
+
+void MappedGrid::getAlpha(DataVector& result) const {
+  if (alpha == nullptr) {
+    throw data_exception("MappedGrid::getAlpha : file does not contain coefficients");
+  }
+
+  result.resize(numberOfPoints);
+  std::memcpy(result.getPointer(), alpha, numberOfPoints * sizeof(double));
+}
+
+Grid& MappedGrid::getEvaluationGrid() const {
+  std::call_once(evaluationGridCreated, [this]() { evaluationGrid.reset(createGrid()); });
+  return *evaluationGrid;
+}
+
+double MappedGrid::eval(const DataVector& point) const {
+  if (alpha == nullptr) {
+    throw data_exception("MappedGrid::eval : file does not contain coefficients");
+  }
+
+  return eval(alpha, point);
+}
+
+double MappedGrid::eval(const double* coefficients, const DataVector& point) const {
+  if (point.getSize() != dimension) {
+    throw data_exception("MappedGrid::eval : dimension mismatch");
+  }
+
+  if (!hasPointwiseBasis(getType())) {
+    DataVector coefficientVector(const_cast<double*>(coefficients), numberOfPoints);
+    std::unique_ptr<OperationEval> opEval(createEvalOperation(getEvaluationGrid()));
+    return opEval->eval(coefficientVector, point);
+  }
+
+  // some bases have an internal state, hence every evaluation uses its own basis
+  std::unique_ptr<Grid> basisGrid(emptyGrid->createGridOfEquivalentType(dimension));
+  DataVector unitPoint(point);
+  emptyGrid->getBoundingBox().transformPointToUnitCube(unitPoint);
+
+  return evalInPlace(basisGrid->getBasis(), levels, indices, coefficients, numberOfPoints,
+                     dimension, unitPoint.getPointer());
+}
+
+void MappedGrid::multiEval(const DataMatrix& points, DataVector& result) const {
+  if (alpha == nullptr) {
+    throw data_exception("MappedGrid::multiEval : file does not contain coefficients");
+  }
+
+  if (points.getNcols() != dimension) {
+    throw data_exception("MappedGrid::multiEval : dimension mismatch");
+  }
+
+  const size_t numberOfEvaluations = points.getNrows();
+  result.resize(numberOfEvaluations);
+
+  if (!hasPointwiseBasis(getType())) {
+    // the operations take the points and coefficients by non-const reference
+    DataMatrix evaluationPoints(points);
+    DataVector coefficientVector(const_cast<double*>(alpha), numberOfPoints);
+    std::unique_ptr<OperationMultipleEval> opMultipleEval(
+        createMultipleEvalOperation(getEvaluationGrid(), evaluationPoints));
+    opMultipleEval->mult(coefficientVector, result);
+    return;
+  }
+
+  BoundingBox& boundingBox = emptyGrid->getBoundingBox();
+
+#pragma omp parallel
+  {
+    // some bases have an internal state, hence every thread uses its own basis
+    std::unique_ptr<Grid> basisGrid(emptyGrid->createGridOfEquivalentType(dimension));
+    SBasis& basis = basisGrid->getBasis();
+    DataVector unitPoint(dimension);
+
+#pragma omp for schedule(dynamic, 16)
+    for (size_t r = 0; r < numberOfEvaluations; r++) {
+      points.getRow(r, unitPoint);
+      boundingBox.transformPointToUnitCube(unitPoint);
+      result[r] = evalInPlace(basis, levels, indices, alpha, numberOfPoints, dimension,
+                              unitPoint.getPointer());
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,205 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef MAPPEDGRID_HPP
+#define MAPPEDGRID_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/tools/MappedFile.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Read-only view of a grid (and optionally its coefficient vector) stored in the binary
+ * grid format. In contrast to Grid::unserialize, the file is not parsed: it is memory-mapped
+ * and the levels, indices and coefficients are used in place. Hence, opening a file is
+ * independent of the number of grid points and several processes mapping the same file share
+ * the same physical pages.
+ *
+ * The file consists of a fixed header followed by sections, each aligned to 64 bytes:
+ *  - the text serialization of an empty grid of the same type (grid type, bounding box or
+ *    stretching, degree etc.),
+ *  - the levels of all grid points (numberOfPoints x dimension, 32 bit, row-major),
+ *  - the indices of all grid points (numberOfPoints x dimension, 32 bit, row-major),
+ *  - the leaf properties of all grid points (one byte per point),
+ *  - the coefficients (numberOfPoints doubles), if present.
+ *
+ * All numbers are stored in the byte order of the writing machine, which is checked when
+ * the file is opened.
+ *
+ * The evaluation methods work directly on the mapped levels, indices and coefficients: the
+ * points are transformed to the unit cube with the bounding box of the file and the basis
+ * functions of the grid type are evaluated for all grid points (stopping at the first dimension
+ * in which the point lies outside of the support). Only stretched grids and prewavelets, whose
+ * basis functions cannot be evaluated by level and index alone, use the evaluation operations
+ * of the grid type instead. As these need a GridStorage, the grid is created from the file (see createGrid()) on
+ * the first evaluation and kept until the MappedGrid is destroyed.
+ */
+class MappedGrid {
+ public:
+  /// version of the binary grid format written by write()
+  static const uint32_t FORMAT_VERSION = 1;
+
+  /**
+   * Writes a grid and optionally its coefficients in the binary grid format.
+   *
+   * @param filename  name of the file
+   * @param grid      the grid
+   * @param alpha     coefficient vector (nullptr if no coefficients should be stored)
+   */
+  static void write(const std::string& filename, Grid& grid, const DataVector* alpha = nullptr);
+
+  /**
+   * Constructor, maps a file in the binary grid format into memory.
+   *
+   * @param filename  name of the file
+   */
+  explicit MappedGrid(const std::string& filename);
+
+  MappedGrid(const MappedGrid&) = delete;
+  MappedGrid& operator=(const MappedGrid&) = delete;
+
+  /**
+   * Destructor, unmaps the file
+   */
+  ~MappedGrid();
+
+  /**
+   * @return dimension of the grid
+   */
+  inline size_t getDimension() const { return dimension; }
+
+  /**
+   * @return number of grid points
+   */
+  inline size_t getSize() const { return numberOfPoints; }
+
+  /**
+   * @return levels of the grid points (row-major, getSize() x getDimension())
+   */
+  inline const HashGridPoint::level_type* getLevels() const { return levels; }
+
+  /**
+   * @return indices of the grid points (row-major, getSize() x getDimension())
+   */
+  inline const HashGridPoint::index_type* getIndices() const { return indices; }
+
+  /**
+   * @param seq sequence number of a grid point
+   * @return    true if the grid point is a leaf
+   */
+  inline bool isLeaf(size_t seq) const { return leaves[seq] != 0; }
+
+  /**
+   * @return true if the file contains coefficients
+   */
+  inline bool hasAlpha() const { return alpha != nullptr; }
+
+  /**
+   * @return coefficients of the grid points (nullptr if the file does not contain any)
+   */
+  inline const double* getAlpha() const { return alpha; }
+
+  /**
+   * @return type of the grid
+   */
+  GridType getType() const;
+
+  /**
+   * Creates a regular (modifiable) grid with the grid points of the file.
+   *
+   * @return pointer to the new grid, the caller is responsible for deleting it
+   */
+  Grid* createGrid() const;
+
+  /**
+   * Copies the coefficients into a DataVector.
+   *
+   * @param result  DataVector that is resized and filled with the coefficients
+   */
+  void getAlpha(DataVector& result) const;
+
+  /**
+   * Evaluates the sparse grid function given by the coefficients of the file at a point
+   * (see OperationEval::eval).
+   *
+   * @param point evaluation point
+   * @return      value of the sparse grid function
+   */
+  double eval(const DataVector& point) const;
+
+  /**
+   * Evaluates the sparse grid function with the given coefficients at a point
+   * (see OperationEval::eval).
+   *
+   * @param coefficients  coefficients of the grid points (getSize() entries)
+   * @param point         evaluation point
+   * @return              value of the sparse grid function
+   */
+  double eval(const double* coefficients, const DataVector& point) const;
+
+  /**
+   * Evaluates the sparse grid function given by the coefficients of the file at several points
+   * (see OperationMultipleEval::mult).
+   *
+   * @param points  evaluation points (one per row)
+   * @param result  values of the sparse grid function (resized to the number of points)
+   */
+  void multiEval(const DataMatrix& points, DataVector& result) const;
+
+ private:
+  /// the mapped file
+  MappedFile file;
+
+  /// dimension of the grid
+  size_t dimension;
+  /// number of grid points
+  size_t numberOfPoints;
+  /// levels of the grid points (points into the mapped file)
+  const HashGridPoint::level_type* levels;
+  /// indices of the grid points (points into the mapped file)
+  const HashGridPoint::index_type* indices;
+  /// leaf properties of the grid points (points into the mapped file)
+  const uint8_t* leaves;
+  /// coefficients of the grid points (points into the mapped file, nullptr if absent)
+  const double* alpha;
+  /// text serialization of an empty grid of the same type
+  std::string gridDescription;
+  /// empty grid of the same type
+  std::unique_ptr<Grid> emptyGrid;
+
+  /// grid created from the file for the evaluations of stretched grids and prewavelets
+  mutable std::unique_ptr<Grid> evaluationGrid;
+  /// guards the creation of evaluationGrid
+  mutable std::once_flag evaluationGridCreated;
+
+  /**
+   * Checks the header and sets the pointers to the sections.
+   */
+  void parseHeader();
+
+  /**
+   * @return grid created from the file for the evaluations of stretched grids and prewavelets
+   *         (created on the first call)
+   */
+  Grid& getEvaluationGrid() const;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* MAPPEDGRID_HPP */
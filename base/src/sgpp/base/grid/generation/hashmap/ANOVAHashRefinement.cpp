@@ -15,7 +15,7 @@ namespace base {
 void ANOVAHashRefinement::refineGridpoint(GridStorage& storage, size_t refine_index) {
   GridPoint point(storage[refine_index]);
   // Sets leaf property of index, which is refined to false
-  storage[refine_index].setLeaf(false);
+  setLeafProperty(storage, refine_index, false);
 
   for (size_t d = 0; d < storage.getDimension(); d++) {
     // For ANOVA refinement create children only in the dimensions with level
@@ -9,6 +9,14 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 
 namespace sgpp {
 namespace base {
@@ -97,5 +105,195 @@ bool AbstractRefinement::isRefinable(GridStorage& storage, GridPoint& point) {
   return false;
 }
 
+void AbstractRefinement::collectIndicators(
+  GridStorage& storage, const RefinementFunctor& functor,
+  const std::function<bool(GridPoint&)>& isCandidate,
+  const std::function<void(const GridStorage::grid_map_iterator&,
+                           refinement_list_type&)>& add) {
+  GridStorage::grid_map_iterator end_iter = storage.end();
+
+  if (!useConcurrentRefinement()) {
+    GridPoint point;
+
+    for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter; iter++) {
+      point = *(iter->first);
+
+      if (isCandidate(point)) {
+        refinement_list_type current_value_list = getIndicator(storage, iter, functor);
+        add(iter, current_value_list);
+      }
+    }
+
+    return;
+  }
+
+  // evaluate the indicators in parallel, but add them in the iteration order of the
+  // storage to get the same collection as the serial version
+  std::vector<GridStorage::grid_map_iterator> iters;
+  iters.reserve(storage.getSize());
+
+  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter; iter++) {
+    iters.push_back(iter);
+  }
+
+  std::vector<refinement_list_type> values(iters.size());
+  std::vector<char> isCandidateValue(iters.size(), 0);
+
+  #pragma omp parallel for schedule(dynamic, 64)
+  for (size_t i = 0; i < iters.size(); i++) {
+    GridPoint point(*(iters[i]->first));
+
+    if (isCandidate(point)) {
+      isCandidateValue[i] = 1;
+      values[i] = getIndicator(storage, iters[i], functor);
+    }
+  }
+
+  for (size_t i = 0; i < iters.size(); i++) {
+    if (isCandidateValue[i] != 0) {
+      add(iters[i], values[i]);
+    }
+  }
+}
+
+void AbstractRefinement::refineGridpoints(GridStorage& storage,
+                                          const std::vector<size_t>& refineIndices) {
+  size_t numberOfBlocks = 1;
+
+  if (useConcurrentRefinement()) {
+#ifdef _OPENMP
+    numberOfBlocks = static_cast<size_t>(omp_get_max_threads());
+#endif
+    numberOfBlocks = std::min(numberOfBlocks, refineIndices.size());
+  }
+
+  if (numberOfBlocks <= 1) {
+    for (size_t seq : refineIndices) {
+      refineGridpoint(storage, seq);
+    }
+
+    return;
+  }
+
+  // every block refines a contiguous range of refineIndices, the storage is only read,
+  // new grid points and leaf property changes are staged
+  std::vector<std::unique_ptr<StagingBuffer>> buffers(numberOfBlocks);
+  stagingBuffers.assign(numberOfBlocks, nullptr);
+  stagingStorage = &storage;
+
+  #pragma omp parallel for schedule(static, 1) num_threads(static_cast<int>(numberOfBlocks))
+  for (size_t b = 0; b < numberOfBlocks; b++) {
+    buffers[b].reset(new StagingBuffer(storage.getDimension()));
+#ifdef _OPENMP
+    stagingBuffers[omp_get_thread_num()] = buffers[b].get();
+#else
+    stagingBuffers[0] = buffers[b].get();
+#endif
+    const size_t first = b * refineIndices.size() / numberOfBlocks;
+    const size_t last = (b + 1) * refineIndices.size() / numberOfBlocks;
+
+    for (size_t i = first; i < last; i++) {
+      refineGridpoint(storage, refineIndices[i]);
+    }
+  }
+
+  stagingStorage = nullptr;
+
+  // merge the blocks in order, a block is refined again on the merged storage if it depends
+  // on grid points created by a preceding block (e.g. a common missing ancestor)
+  for (size_t b = 0; b < numberOfBlocks; b++) {
+    StagingBuffer& buffer = *buffers[b];
+
+    if (isStagingValid(storage, buffer)) {
+      for (size_t k = 0; k < buffer.operations.size(); k++) {
+        if (buffer.isInsertion[k]) {
+          storage.insert(buffer.operations[k]);
+        } else {
+          storage.getPoint(storage.getSequenceNumber(buffer.operations[k]))
+              .setLeaf(buffer.operations[k].isLeaf());
+        }
+      }
+    } else {
+      const size_t first = b * refineIndices.size() / numberOfBlocks;
+      const size_t last = (b + 1) * refineIndices.size() / numberOfBlocks;
+
+      for (size_t i = first; i < last; i++) {
+        refineGridpoint(storage, refineIndices[i]);
+      }
+    }
+
+    buffers[b].reset();
+  }
+}
+
+AbstractRefinement::StagingBuffer& AbstractRefinement::getStagingBuffer() {
+#ifdef _OPENMP
+  return *stagingBuffers[omp_get_thread_num()];
+#else
+  return *stagingBuffers[0];
+#endif
+}
+
+bool AbstractRefinement::containsStagedGridpoint(GridStorage& storage, GridPoint& point) {
+  if (&storage != stagingStorage) {
+    return storage.isContaining(point);
+  }
+
+  if (storage.isContaining(point)) {
+    return true;
+  }
+
+  StagingBuffer& buffer = getStagingBuffer();
+
+  if (buffer.points.isContaining(point)) {
+    return true;
+  }
+
+  if (!buffer.missingPoints.isContaining(point)) {
+    buffer.missingPoints.insert(point);
+  }
+
+  return false;
+}
+
+void AbstractRefinement::stageGridpoint(GridStorage& storage, GridPoint& point,
+                                        bool insertion) {
+  if (&storage != stagingStorage) {
+    if (insertion) {
+      storage.insert(point);
+    } else {
+      storage.getPoint(storage.getSequenceNumber(point)).setLeaf(point.isLeaf());
+    }
+
+    return;
+  }
+
+  StagingBuffer& buffer = getStagingBuffer();
+
+  if (insertion) {
+    buffer.points.insert(point);
+  }
+
+  buffer.operations.push_back(point);
+  buffer.isInsertion.push_back(insertion);
+}
+
+bool AbstractRefinement::isStagingValid(GridStorage& storage, StagingBuffer& buffer) {
+  // all these points were missing in the storage before the merge
+  for (size_t i = 0; i < buffer.missingPoints.getSize(); i++) {
+    if (storage.isContaining(buffer.missingPoints.getPoint(i))) {
+      return false;
+    }
+  }
+
+  for (size_t i = 0; i < buffer.points.getSize(); i++) {
+    if (storage.isContaining(buffer.points.getPoint(i))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 }  // namespace base
 }  // namespace sgpp
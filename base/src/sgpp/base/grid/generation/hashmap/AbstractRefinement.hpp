@@ -12,6 +12,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <forward_list>
+#include <functional>
 #include <iosfwd>
 #include <vector>
 #include <unordered_map>
@@ -130,6 +131,12 @@ class AbstractRefinement {
   typedef std::vector<refinement_pair_type> refinement_container_type;
 
 
+  /**
+   * Constructor, the refinement is serial by default
+   */
+  AbstractRefinement() : concurrentRefinement(false), stagingStorage(nullptr) {}
+
+
   /**
    * Refines a grid according to a RefinementFunctor provided.
    * Refines up to RefinementFunctor::getRefinementsNum() grid points if
@@ -182,6 +189,29 @@ class AbstractRefinement {
    */
   bool isRefinable(GridStorage& storage, GridPoint& point);
 
+  /**
+   * Enables or disables the concurrent refinement. If enabled, the refinement indicators are
+   * evaluated and the grid points are refined with several OpenMP threads. Every thread refines
+   * a contiguous block of the points to refine and stages the new grid points and leaf property
+   * changes without modifying the storage (see insertGridpoint). The blocks are then merged in
+   * order. If a block looked up a point that has been created by a preceding block, it is
+   * refined again on the merged storage. Hence, the refined grid including its sequence numbers
+   * is identical to the one of the serial refinement.
+   *
+   * The RefinementFunctor has to be thread-safe. Refinements whose point creation logic
+   * doesn't support staging (see supportsConcurrentRefinement) always refine serially.
+   *
+   * @param concurrentRefinement true to enable the concurrent refinement
+   */
+  void setConcurrentRefinement(bool concurrentRefinement) {
+    this->concurrentRefinement = concurrentRefinement;
+  }
+
+  /**
+   * @return true if the concurrent refinement is enabled
+   */
+  bool isConcurrentRefinement() const { return concurrentRefinement; }
+
   /**
    * Destructor
    */
@@ -230,7 +260,7 @@ class AbstractRefinement {
                                          GridPoint& point) {
     // For efficiency this function is defined the header file, this way it
     // be easily inlined by compiler.
-    if (!storage.isContaining(point)) {
+    if (!containsGridpoint(storage, point)) {
       // save old leaf value
       bool saveLeaf = point.isLeaf();
       point.setLeaf(false);
@@ -239,7 +269,7 @@ class AbstractRefinement {
       point.setLeaf(saveLeaf);
     } else {
       // set stored index to false
-      storage.getPoint((storage.find(&point))->second).setLeaf(false);
+      setLeafProperty(storage, point, false);
     }
   }
 
@@ -305,10 +335,174 @@ class AbstractRefinement {
     const GridStorage::grid_map_iterator& iter,
     const RefinementFunctor& functor) const = 0;
 
+  /**
+   * @return true if the point creation logic (refineGridpoint, createGridpoint and the methods
+   *         called by them) accesses the storage only through containsGridpoint,
+   *         insertGridpoint and setLeafProperty and doesn't modify other data, i.e. the
+   *         grid points can be refined concurrently (false by default)
+   */
+  virtual bool supportsConcurrentRefinement() const { return false; }
+
+  /**
+   * @return true if the concurrent refinement is enabled and supported
+   */
+  bool useConcurrentRefinement() const {
+    return concurrentRefinement && supportsConcurrentRefinement();
+  }
+
+  /**
+   * Calls add for the refinement indicators (see getIndicator) of all grid points for which
+   * isCandidate returns true in the iteration order of the storage. If the concurrent
+   * refinement is enabled and supported, isCandidate and the indicators are evaluated with
+   * several OpenMP threads, but add is still called in the same order by one thread.
+   *
+   * @param storage     hashmap that stores the grid points
+   * @param functor     refinement functor
+   * @param isCandidate returns true if the grid point (which it may change temporarily)
+   *                    can be refined
+   * @param add         processes the iterator and the indicators of a candidate
+   */
+  void collectIndicators(
+    GridStorage& storage, const RefinementFunctor& functor,
+    const std::function<bool(GridPoint&)>& isCandidate,
+    const std::function<void(const GridStorage::grid_map_iterator&,
+                             refinement_list_type&)>& add);
+
+  /**
+   * Refines the given grid points in the given order by calling refineGridpoint(), either
+   * serially or concurrently (see setConcurrentRefinement).
+   *
+   * @param storage       hashmap that stores the grid points
+   * @param refineIndices sequence numbers of the grid points to refine
+   */
+  void refineGridpoints(GridStorage& storage, const std::vector<size_t>& refineIndices);
+
+  /**
+   * Tests if a grid point is contained in the storage (including the points staged by the
+   * current thread during the concurrent refinement).
+   *
+   * @param storage hashmap that stores the grid points
+   * @param point   grid point
+   * @return        true if the point is contained
+   */
+  inline bool containsGridpoint(GridStorage& storage, GridPoint& point) {
+    if (stagingStorage == nullptr) {
+      return storage.isContaining(point);
+    } else {
+      return containsStagedGridpoint(storage, point);
+    }
+  }
+
+  /**
+   * Inserts a grid point into the storage (or stages it during the concurrent refinement).
+   *
+   * @param storage hashmap that stores the grid points
+   * @param point   grid point that is not contained yet
+   */
+  inline void insertGridpoint(GridStorage& storage, GridPoint& point) {
+    if (stagingStorage == nullptr) {
+      storage.insert(point);
+    } else {
+      stageGridpoint(storage, point, true);
+    }
+  }
+
+  /**
+   * Sets the leaf property of a stored grid point (or stages the change during the
+   * concurrent refinement).
+   *
+   * @param storage hashmap that stores the grid points
+   * @param point   grid point that is contained in the storage
+   * @param isLeaf  new leaf property
+   */
+  inline void setLeafProperty(GridStorage& storage, GridPoint& point, bool isLeaf) {
+    if (stagingStorage == nullptr) {
+      storage.getPoint(storage.getSequenceNumber(point)).setLeaf(isLeaf);
+    } else {
+      GridPoint stagedPoint(point);
+      stagedPoint.setLeaf(isLeaf);
+      stageGridpoint(storage, stagedPoint, false);
+    }
+  }
+
+  /**
+   * Sets the leaf property of a stored grid point (or stages the change during the
+   * concurrent refinement).
+   *
+   * @param storage hashmap that stores the grid points
+   * @param seq     sequence number of the grid point
+   * @param isLeaf  new leaf property
+   */
+  inline void setLeafProperty(GridStorage& storage, size_t seq, bool isLeaf) {
+    if (stagingStorage == nullptr) {
+      storage[seq].setLeaf(isLeaf);
+    } else {
+      setLeafProperty(storage, storage[seq], isLeaf);
+    }
+  }
+
   friend class
   // need to be a friend since it delegates the calls to
   // protected class methods
     RefinementDecorator;
+
+ private:
+  /**
+   * Grid points and leaf property changes staged by one block of the concurrent refinement
+   */
+  struct StagingBuffer {
+    /**
+     * @param dimension dimension of the grid
+     */
+    explicit StagingBuffer(size_t dimension) : points(dimension), missingPoints(dimension) {}
+
+    /// staged grid points
+    GridStorage points;
+    /// grid points that have been looked up, but are neither stored nor staged
+    GridStorage missingPoints;
+    /// staged operations in order, i.e. insertions and leaf property changes of grid points
+    std::vector<GridPoint> operations;
+    /// true if the corresponding operation is an insertion
+    std::vector<bool> isInsertion;
+  };
+
+  /// true if the refinement uses several threads
+  bool concurrentRefinement;
+  /// storage that is refined concurrently (null pointer if the refinement is serial)
+  GridStorage* stagingStorage;
+  /// staging buffer of the block that is processed by each thread
+  std::vector<StagingBuffer*> stagingBuffers;
+
+  /**
+   * @return staging buffer of the calling thread
+   */
+  StagingBuffer& getStagingBuffer();
+
+  /**
+   * Staged version of containsGridpoint, lookups of missing grid points are recorded.
+   *
+   * @param storage hashmap that stores the grid points
+   * @param point   grid point
+   * @return        true if the point is stored or has been staged by the calling thread
+   */
+  bool containsStagedGridpoint(GridStorage& storage, GridPoint& point);
+
+  /**
+   * Stages the insertion or the leaf property change of a grid point.
+   *
+   * @param storage   hashmap that stores the grid points
+   * @param point     grid point
+   * @param insertion true for an insertion, false for a leaf property change
+   */
+  void stageGridpoint(GridStorage& storage, GridPoint& point, bool insertion);
+
+  /**
+   * @param storage hashmap that stores the grid points (merged up to the preceding block)
+   * @param buffer  staging buffer of a block
+   * @return        true if none of the points created or looked up by the block
+   *                has been created by a preceding block
+   */
+  static bool isStagingValid(GridStorage& storage, StagingBuffer& buffer);
 };
 
 
@@ -52,13 +52,29 @@ void HashCoarsening::free_coarsen_NFirstOnly(GridStorage& storage,
   // surplus in removeCandidates
   size_t max_idx = 0;
 
+  // evaluate the functor for all leaves in parallel, the candidates are selected
+  // afterwards in the same order as in the serial version
+  std::vector<CoarseningFunctor::value_type> values;
+
+  if (concurrentCoarsening && (numFirstPoints > minIndexConsidered)) {
+    values.resize(numFirstPoints - minIndexConsidered);
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (size_t z = minIndexConsidered; z < numFirstPoints; z++) {
+      if (storage.getPoint(z).isLeaf()) {
+        values[z - minIndexConsidered] = functor(storage, z);
+      }
+    }
+  }
+
   // assure that only the first numFirstPoints are checked for coarsening
   // also assure, that indices bigger than minIndexConsidered are not checked
   for (size_t z = minIndexConsidered; z < numFirstPoints; z++) {
     GridPoint& point = storage.getPoint(z);
 
     if (point.isLeaf()) {
-      CoarseningFunctor::value_type current_value = functor(storage, z);
+      CoarseningFunctor::value_type current_value =
+          values.empty() ? functor(storage, z) : values[z - minIndexConsidered];
 
       if (current_value < removeCandidates[max_idx].second) {
         // Replace the maximum point array of removable candidates,
@@ -24,6 +24,11 @@ namespace base {
  */
 class HashCoarsening {
  public:
+  /**
+   * Constructor, the coarsening is serial by default
+   */
+  HashCoarsening() : concurrentCoarsening(false) {}
+
   /**
    * Performs coarsening on grid. It's possible to remove a certain number
    * of gridpoints in one coarsening step. This number is specified within the
@@ -89,6 +94,27 @@ class HashCoarsening {
    * @param storage hashmap that stores the grid points
    */
   size_t getNumberOfRemovablePoints(GridStorage& storage);
+
+  /**
+   * Enables or disables the concurrent coarsening. If enabled, the coarsening functor is
+   * evaluated for the leaves with several OpenMP threads; the removal candidates are selected
+   * afterwards in the order of the sequence numbers. Hence, the coarsened grid is identical to
+   * the one of the serial coarsening. The CoarseningFunctor has to be thread-safe.
+   *
+   * @param concurrentCoarsening true to enable the concurrent coarsening
+   */
+  void setConcurrentCoarsening(bool concurrentCoarsening) {
+    this->concurrentCoarsening = concurrentCoarsening;
+  }
+
+  /**
+   * @return true if the concurrent coarsening is enabled
+   */
+  bool isConcurrentCoarsening() const { return concurrentCoarsening; }
+
+ private:
+  /// true if the coarsening functor is evaluated with several threads
+  bool concurrentCoarsening;
 };
 
 }  // namespace base
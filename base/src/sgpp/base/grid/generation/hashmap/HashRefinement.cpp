@@ -16,6 +16,41 @@
 namespace sgpp {
 namespace base {
 
+namespace {
+
+/**
+ * @param storage hashmap that stores the grid points
+ * @param point   grid point (restored on return)
+ * @return        true if the point has at least one child missing
+ */
+bool hasMissingChild(const GridStorage& storage, GridPoint& point) {
+  for (size_t d = 0; d < storage.getDimension(); d++) {
+    index_t source_index;
+    level_t source_level;
+    point.get(d, source_level, source_index);
+
+    // test existence of left and right child
+    point.set(d, source_level + 1, 2 * source_index - 1);
+    bool missing = !storage.isContaining(point);
+
+    if (!missing) {
+      point.set(d, source_level + 1, 2 * source_index + 1);
+      missing = !storage.isContaining(point);
+    }
+
+    // reset current grid point in dimension d
+    point.set(d, source_level, source_index);
+
+    if (missing) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
+
 void HashRefinement::addElementToCollection(
   const GridStorage::grid_map_iterator& iter,
   AbstractRefinement::refinement_list_type current_value_list,
@@ -46,53 +81,16 @@ void HashRefinement::collectRefinablePoints(GridStorage& storage,
 
   // max value equals min value
 
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
-  // start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    // check for each grid point whether it can be refined
-    // (i.e., whether not all kids exist yet)
-    // if yes, check whether it belongs to the refinements_num largest ones
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      // test existence of left child
-      point.set(d, source_level + 1, 2 * source_index - 1);
-      child_iter = storage.find(&point);
-
-      // if there no more grid points --> test if we should refine the grid
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
-      }
-
-      // test existence of right child
-      point.set(d, source_level + 1, 2 * source_index + 1);
-      child_iter = storage.find(&point);
-
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
-      }
-
-      // reset current grid point in dimension d
-      point.set(d, source_level, source_index);
-    }
-  }
+  // check for each grid point whether it can be refined
+  // (i.e., whether not all kids exist yet)
+  // if yes, check whether it belongs to the refinements_num largest ones
+  collectIndicators(
+      storage, functor, [&storage](GridPoint& point) { return hasMissingChild(storage, point); },
+      [this, refinements_num, &collection](
+          const GridStorage::grid_map_iterator& iter,
+          AbstractRefinement::refinement_list_type& current_value_list) {
+        addElementToCollection(iter, current_value_list, refinements_num, collection);
+      });
 }
 
 AbstractRefinement::refinement_list_type HashRefinement::getIndicator(
@@ -111,14 +109,16 @@ AbstractRefinement::refinement_list_type HashRefinement::getIndicator(
 void HashRefinement::refineGridpointsCollection(GridStorage& storage,
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
-
   double threshold = functor.getRefinementThreshold();
+  std::vector<size_t> refineIndices;
 
   for (AbstractRefinement::refinement_pair_type& pair : collection) {
     if (pair.second >= threshold) {
-      refineGridpoint(storage, pair.first->getSeq());
+      refineIndices.push_back(pair.first->getSeq());
     }
   }
+
+  refineGridpoints(storage, refineIndices);
 }
 
 void HashRefinement::free_refine(GridStorage& storage,
@@ -204,7 +204,7 @@ void HashRefinement::refineGridpoint1D(GridStorage& storage, GridPoint& point, s
   // generate left child, if necessary
   point.set(d, source_level + 1, 2 * source_index - 1);
 
-  if (!storage.isContaining(point)) {
+  if (!containsGridpoint(storage, point)) {
     point.setLeaf(true);
     createGridpoint(storage, point);
   }
@@ -212,7 +212,7 @@ void HashRefinement::refineGridpoint1D(GridStorage& storage, GridPoint& point, s
   // generate right child, if necessary
   point.set(d, source_level + 1, 2 * source_index + 1);
 
-  if (!storage.isContaining(point)) {
+  if (!containsGridpoint(storage, point)) {
     point.setLeaf(true);
     createGridpoint(storage, point);
   }
@@ -229,7 +229,7 @@ void HashRefinement::refineGridpoint(GridStorage& storage,
                                      size_t refine_index) {
   GridPoint point(storage[refine_index]);
   // Sets leaf property of index, which is refined to false
-  storage[refine_index].setLeaf(false);
+  setLeafProperty(storage, refine_index, false);
 
   for (size_t d = 0; d < storage.getDimension(); d++) {
     refineGridpoint1D(storage, point, d);
@@ -244,7 +244,7 @@ void HashRefinement::createGridpoint(GridStorage& storage, GridPoint& point) {
     createGridpoint1D(point, d, storage, source_index, source_level);
   }
 
-  storage.insert(point);
+  insertGridpoint(storage, point);
 }
 
 }  // namespace base
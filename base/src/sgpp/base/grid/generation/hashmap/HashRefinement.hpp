@@ -136,6 +136,11 @@ class HashRefinement: public AbstractRefinement {
     GridStorage& storage,
     const GridStorage::grid_map_iterator& iter,
     const RefinementFunctor& functor) const override;
+
+  /**
+   * @return true, the point creation logic supports the concurrent refinement
+   */
+  bool supportsConcurrentRefinement() const override { return true; }
 };
 
 
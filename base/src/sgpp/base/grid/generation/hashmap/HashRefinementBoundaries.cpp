@@ -16,6 +16,47 @@
 namespace sgpp {
 namespace base {
 
+namespace {
+
+/**
+ * @param storage hashmap that stores the grid points
+ * @param point   grid point (restored on return)
+ * @return        true if the point has at least one child missing
+ *                (points on level 0 only have one child on level 1)
+ */
+bool hasMissingChild(const GridStorage& storage, GridPoint& point) {
+  for (size_t d = 0; d < storage.getDimension(); d++) {
+    index_t source_index;
+    level_t source_level;
+    point.get(d, source_level, source_index);
+    bool missing;
+
+    if (source_level == 0) {
+      // we only have one child on level 1
+      point.set(d, 1, 1);
+      missing = !storage.isContaining(point);
+    } else {
+      // left and right child
+      point.set(d, source_level + 1, 2 * source_index - 1);
+      missing = !storage.isContaining(point);
+
+      if (!missing) {
+        point.set(d, source_level + 1, 2 * source_index + 1);
+        missing = !storage.isContaining(point);
+      }
+    }
+
+    point.set(d, source_level, source_index);
+
+    if (missing) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
 
 void HashRefinementBoundaries::addElementToCollection(
   const GridStorage::grid_map_iterator& iter,
@@ -58,64 +99,15 @@ void HashRefinementBoundaries::collectRefinablePoints(GridStorage& storage,
     AbstractRefinement::refinement_container_type& collection) {
 
   size_t refinements_num = functor.getRefinementsNum();
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
 
   // I think this may be dependent on local support
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      if (source_level == 0) {
-        // we only have one child on level 1
-        point.set(d, 1, 1);
-        child_iter = storage.find(&point);
-
-        // if there no more grid points --> test if we should refine the grid
-        if (child_iter == end_iter) {
-          AbstractRefinement::refinement_list_type current_value_list =
-            getIndicator(storage, iter, functor);
-          addElementToCollection(iter, current_value_list, refinements_num,
-                                 collection);
-          break;
-        }
-      } else {
-        // left child
-        point.set(d, source_level + 1, 2 * source_index - 1);
-        child_iter = storage.find(&point);
-
-        // if there no more grid points --> test if we should refine the grid
-        if (child_iter == end_iter) {
-          AbstractRefinement::refinement_list_type current_value_list =
-            getIndicator(storage, iter, functor);
-          addElementToCollection(iter, current_value_list, refinements_num,
-                                 collection);
-          break;
-        }
-
-        // right child
-        point.set(d, source_level + 1, 2 * source_index + 1);
-        child_iter = storage.find(&point);
-
-        if (child_iter == end_iter) {
-          AbstractRefinement::refinement_list_type current_value_list =
-            getIndicator(storage, iter, functor);
-          addElementToCollection(iter, current_value_list, refinements_num,
-                                 collection);
-          break;
-        }
-      }
-
-      point.set(d, source_level, source_index);
-    }
-  }
+  collectIndicators(
+      storage, functor, [&storage](GridPoint& point) { return hasMissingChild(storage, point); },
+      [this, refinements_num, &collection](
+          const GridStorage::grid_map_iterator& iter,
+          AbstractRefinement::refinement_list_type& current_value_list) {
+        addElementToCollection(iter, current_value_list, refinements_num, collection);
+      });
 }
 
 
@@ -123,12 +115,15 @@ void HashRefinementBoundaries::refineGridpointsCollection(GridStorage& storage,
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
   double threshold = functor.getRefinementThreshold();
+  std::vector<size_t> refineIndices;
 
   for (AbstractRefinement::refinement_pair_type& pair : collection) {
     if (pair.second >= threshold) {
-      refineGridpoint(storage, pair.first->getSeq());
+      refineIndices.push_back(pair.first->getSeq());
     }
   }
+
+  refineGridpoints(storage, refineIndices);
 }
 
 void HashRefinementBoundaries::free_refine(GridStorage& storage,
@@ -230,7 +225,7 @@ void HashRefinementBoundaries::refineGridpoint1D(GridStorage& storage,
     // we only have one child on level 1
     point.set(d, 1, 1);
 
-    if (!storage.isContaining(point)) {
+    if (!containsGridpoint(storage, point)) {
       point.setLeaf(true);
       createGridpoint(storage, point);
     }
@@ -238,7 +233,7 @@ void HashRefinementBoundaries::refineGridpoint1D(GridStorage& storage,
     // generate left child, if necessary
     point.set(d, source_level + 1, 2 * source_index - 1);
 
-    if (!storage.isContaining(point)) {
+    if (!containsGridpoint(storage, point)) {
       point.setLeaf(true);
       createGridpoint(storage, point);
     }
@@ -246,7 +241,7 @@ void HashRefinementBoundaries::refineGridpoint1D(GridStorage& storage,
     // generate right child, if necessary
     point.set(d, source_level + 1, 2 * source_index + 1);
 
-    if (!storage.isContaining(point)) {
+    if (!containsGridpoint(storage, point)) {
       point.setLeaf(true);
       createGridpoint(storage, point);
     }
@@ -261,7 +256,7 @@ void HashRefinementBoundaries::refineGridpoint(GridStorage& storage,
   GridPoint point(storage[refine_index]);
 
   // Sets leaf property of index, which is refined to false
-  storage[refine_index].setLeaf(false);
+  setLeafProperty(storage, refine_index, false);
 
   for (size_t d = 0; d < storage.getDimension(); d++) {
     refineGridpoint1D(storage, point, d);
@@ -314,7 +309,7 @@ void HashRefinementBoundaries::createGridpointGeneral(GridStorage& storage,
     createGridpoint1D(point, d, storage, source_index, source_level);
   }
 
-  storage.insert(point);
+  insertGridpoint(storage, point);
 }
 
 
@@ -334,40 +329,40 @@ void HashRefinementBoundaries::createGridpointLevelZeroConsistency(
         // if we have already a left boundary...
         point.set(d, 0, 0);
 
-        if (storage.isContaining(point)) {
+        if (containsGridpoint(storage, point)) {
           // ... we have to read leaf property
           bool Leaf = point.isLeaf();
           // ... we have to generate the correspondending right boundary
           point.set(d, 0, 1);
 
-          if (!storage.isContaining(point)) {
+          if (!containsGridpoint(storage, point)) {
             bool saveLeaf = point.isLeaf();
             point.setLeaf(Leaf);
             createGridpoint(storage, point);
             point.setLeaf(saveLeaf);
           } else {
             // set stored index to Leaf from the left boundary
-            storage.getPoint(storage.find(&point)->second).setLeaf(Leaf);
+            setLeafProperty(storage, point, Leaf);
           }
         }
 
         // if we have already a right boundary...
         point.set(d, 0, 1);
 
-        if (storage.isContaining(point)) {
+        if (containsGridpoint(storage, point)) {
           // ... we have to read leaf property
           bool Leaf = point.isLeaf();
           // ... we have to generate the correspondending right boundary
           point.set(d, 0, 0);
 
-          if (!storage.isContaining(point)) {
+          if (!containsGridpoint(storage, point)) {
             bool saveLeaf = point.isLeaf();
             point.setLeaf(Leaf);
             createGridpoint(storage, point);
             point.setLeaf(saveLeaf);
           } else {
             // set stored index to Leaf from the right boundary
-            storage.getPoint(storage.find(&point)->second).setLeaf(Leaf);
+            setLeafProperty(storage, point, Leaf);
           }
         }
 
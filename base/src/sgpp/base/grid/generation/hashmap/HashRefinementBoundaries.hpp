@@ -151,6 +151,11 @@ class HashRefinementBoundaries: public AbstractRefinement {
     GridStorage& storage,
     const GridStorage::grid_map_iterator& iter,
     const RefinementFunctor& functor) const override;
+
+  /**
+   * @return true, the point creation logic supports the concurrent refinement
+   */
+  bool supportsConcurrentRefinement() const override { return true; }
 };
 
 }  // namespace base
@@ -259,7 +259,7 @@ void HashRefinementBoundariesMaxLevel::refineGridpoint1D(GridStorage& storage,
       // we only have one child on level 1
       point.set(d, 1, 1);
 
-      if (!storage.isContaining(point)) {
+      if (!containsGridpoint(storage, point)) {
         point.setLeaf(true);
         createGridpoint(storage, point);
       }
@@ -267,7 +267,7 @@ void HashRefinementBoundariesMaxLevel::refineGridpoint1D(GridStorage& storage,
       // generate left child, if necessary
       point.set(d, source_level + 1, 2 * source_index - 1);
 
-      if (!storage.isContaining(point)) {
+      if (!containsGridpoint(storage, point)) {
         point.setLeaf(true);
         createGridpoint(storage, point);
       }
@@ -275,7 +275,7 @@ void HashRefinementBoundariesMaxLevel::refineGridpoint1D(GridStorage& storage,
       // generate right child, if necessary
       point.set(d, source_level + 1, 2 * source_index + 1);
 
-      if (!storage.isContaining(point)) {
+      if (!containsGridpoint(storage, point)) {
         point.setLeaf(true);
         createGridpoint(storage, point);
       }
@@ -291,7 +291,7 @@ void HashRefinementBoundariesMaxLevel::refineGridpoint(GridStorage& storage,
   GridPoint point(storage[refine_index]);
 
   // Sets leaf property of point, which is refined to false
-  storage[refine_index].setLeaf(false);
+  setLeafProperty(storage, refine_index, false);
 
   for (size_t d = 0; d < storage.getDimension(); d++) {
     refineGridpoint1D(storage, point, d, maxLevel);
@@ -16,7 +16,7 @@ namespace base {
 
 
 void HashRefinementInconsistent::createGridpoint(GridStorage& storage, GridPoint& point) {
-  storage.insert(point);
+  insertGridpoint(storage, point);
 }
 
 }  // namespace base
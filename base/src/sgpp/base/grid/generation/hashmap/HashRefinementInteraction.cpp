@@ -40,7 +40,7 @@ void HashRefinementInteraction::createGridpoint(GridStorage& storage, GridPoint&
     }
   }
 
-  storage.insert(index);
+  insertGridpoint(storage, index);
 }
 
 void HashRefinementInteraction::collectRefinablePoints(GridStorage& storage,
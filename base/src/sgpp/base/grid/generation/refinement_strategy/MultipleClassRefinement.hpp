@@ -49,6 +49,10 @@ class MultipleClassRefinement : public HashRefinement {
   void collectRefinablePoints(GridStorage& storage,
         RefinementFunctor& functor,
         AbstractRefinement::refinement_container_type& collection) override;
+  /**
+   * @return false, the refinement inserts points into the grids of the classes
+   */
+  bool supportsConcurrentRefinement() const override { return false; }
 
  private:
     // Additional data for combined grid
@@ -0,0 +1,167 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/hashmap/FlatHashGridIndex.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+const size_t FlatHashGridIndex::notFound = std::numeric_limits<size_t>::max();
+const size_t FlatHashGridIndex::emptySlot = std::numeric_limits<size_t>::max();
+
+FlatHashGridIndex::FlatHashGridIndex()
+    : seqs(),
+      hashes(),
+      numberOfEntries(0),
+      mask(0),
+      shift(64) {}
+
+size_t FlatHashGridIndex::find(const HashGridPoint& point, const point_list& points) const {
+  if (numberOfEntries == 0) {
+    return notFound;
+  }
+
+  return seqs[findSlot(point, points)];
+}
+
+void FlatHashGridIndex::insert(const HashGridPoint& point, size_t seq, const point_list& points) {
+  // keep the load factor below 3/4
+  if (4 * (numberOfEntries + 1) > 3 * seqs.size()) {
+    rehash((seqs.size() == 0) ? 16 : 2 * seqs.size());
+  }
+
+  const size_t slot = findSlot(point, points);
+
+  if (seqs[slot] == emptySlot) {
+    hashes[slot] = point.getHash();
+    numberOfEntries++;
+  }
+
+  seqs[slot] = seq;
+}
+
+bool FlatHashGridIndex::erase(const HashGridPoint& point, const point_list& points) {
+  if (numberOfEntries == 0) {
+    return false;
+  }
+
+  size_t hole = findSlot(point, points);
+
+  if (seqs[hole] == emptySlot) {
+    return false;
+  }
+
+  // backward shift deletion: move following entries of the probe sequence into the hole
+  // if their home slot does not lie cyclically in (hole, next]
+  size_t next = (hole + 1) & mask;
+
+  while (seqs[next] != emptySlot) {
+    const size_t home = homeSlot(hashes[next]);
+
+    if (((next - home) & mask) >= ((next - hole) & mask)) {
+      seqs[hole] = seqs[next];
+      hashes[hole] = hashes[next];
+      hole = next;
+    }
+
+    next = (next + 1) & mask;
+  }
+
+  seqs[hole] = emptySlot;
+  numberOfEntries--;
+  return true;
+}
+
+void FlatHashGridIndex::clear() {
+  std::fill(seqs.begin(), seqs.end(), emptySlot);
+  numberOfEntries = 0;
+}
+
+void FlatHashGridIndex::rebuild(const point_list& points) {
+  clear();
+  reserve(points.size());
+
+  for (size_t i = 0; i < points.size(); i++) {
+    insert(*points[i], i, points);
+  }
+}
+
+void FlatHashGridIndex::reserve(size_t n) {
+  size_t capacity = (seqs.size() == 0) ? 16 : seqs.size();
+
+  while (4 * n > 3 * capacity) {
+    capacity *= 2;
+  }
+
+  if (capacity != seqs.size()) {
+    rehash(capacity);
+  }
+}
+
+void FlatHashGridIndex::swap(FlatHashGridIndex& other) {
+  seqs.swap(other.seqs);
+  hashes.swap(other.hashes);
+  std::swap(numberOfEntries, other.numberOfEntries);
+  std::swap(mask, other.mask);
+  std::swap(shift, other.shift);
+}
+
+size_t FlatHashGridIndex::getMemoryUsage() const {
+  return seqs.capacity() * sizeof(size_t) + hashes.capacity() * sizeof(size_t);
+}
+
+size_t FlatHashGridIndex::findSlot(const HashGridPoint& point, const point_list& points) const {
+  const size_t hash = point.getHash();
+  const size_t dim = point.getDimension();
+  size_t slot = homeSlot(hash);
+
+  // linear probing until the point or the first empty slot is found
+  while (seqs[slot] != emptySlot) {
+    // only points with equal hash values are dereferenced
+    if ((hashes[slot] == hash) && (points[seqs[slot]]->getDimension() == dim) &&
+        points[seqs[slot]]->equals(point)) {
+      return slot;
+    }
+
+    slot = (slot + 1) & mask;
+  }
+
+  return slot;
+}
+
+void FlatHashGridIndex::rehash(size_t capacity) {
+  std::vector<size_t> oldSeqs(capacity, emptySlot);
+  std::vector<size_t> oldHashes(capacity, 0);
+  oldSeqs.swap(seqs);
+  oldHashes.swap(hashes);
+
+  mask = capacity - 1;
+  shift = 64;
+
+  for (size_t c = capacity; c > 1; c >>= 1) {
+    shift--;
+  }
+
+  // reinsert all entries, the cached hashes make key comparisons unnecessary
+  for (size_t slot = 0; slot < oldSeqs.size(); slot++) {
+    if (oldSeqs[slot] != emptySlot) {
+      size_t newSlot = homeSlot(oldHashes[slot]);
+
+      while (seqs[newSlot] != emptySlot) {
+        newSlot = (newSlot + 1) & mask;
+      }
+
+      seqs[newSlot] = oldSeqs[slot];
+      hashes[newSlot] = oldHashes[slot];
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
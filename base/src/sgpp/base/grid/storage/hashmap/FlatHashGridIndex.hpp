@@ -0,0 +1,160 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef FLATHASHGRIDINDEX_HPP
+#define FLATHASHGRIDINDEX_HPP
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Open-addressing hash index that maps grid points to their sequence numbers.
+ *
+ * In contrast to a node-based std::unordered_map, the index does not allocate per entry.
+ * It consists of two contiguous arrays (structure of arrays) holding the sequence number and
+ * the cached hash value of every slot. Collisions are resolved by linear probing, deletions
+ * use backward shifting, so no tombstones are needed.
+ *
+ * The index does not store the keys itself. If the cached hash values match, the point is
+ * compared with the grid point of the stored sequence number, whose packed level/index words
+ * (see PackedLevelIndex) are compared word by word.
+ */
+class FlatHashGridIndex {
+ public:
+  /// list of grid points the sequence numbers refer to
+  typedef std::vector<HashGridPoint*> point_list;
+
+  /// value returned by find() if a point is not contained in the index
+  static const size_t notFound;
+
+  /**
+   * Constructor, creates an empty index
+   */
+  FlatHashGridIndex();
+
+  /**
+   * Looks up the sequence number of a grid point.
+   *
+   * @param point   grid point to look for
+   * @param points  list of grid points the stored sequence numbers refer to
+   * @return        sequence number of the point or FlatHashGridIndex::notFound
+   */
+  size_t find(const HashGridPoint& point, const point_list& points) const;
+
+  /**
+   * Inserts a grid point. If an equal grid point is already contained, only its sequence
+   * number is updated (like std::unordered_map::operator[]).
+   *
+   * @param point   grid point to insert
+   * @param seq     sequence number of the point
+   * @param points  list of grid points the stored sequence numbers refer to
+   */
+  void insert(const HashGridPoint& point, size_t seq, const point_list& points);
+
+  /**
+   * Removes a grid point from the index.
+   *
+   * @param point   grid point to remove
+   * @param points  list of grid points the stored sequence numbers refer to
+   * @return        true if the point was contained in the index
+   */
+  bool erase(const HashGridPoint& point, const point_list& points);
+
+  /**
+   * Removes all entries, but keeps the allocated memory of the table.
+   */
+  void clear();
+
+  /**
+   * Rebuilds the index from scratch such that points[i] is mapped to i.
+   *
+   * @param points  list of grid points
+   */
+  void rebuild(const point_list& points);
+
+  /**
+   * Makes sure that n points can be stored without growing the table.
+   *
+   * @param n       number of points
+   */
+  void reserve(size_t n);
+
+  /**
+   * Exchanges the contents of two indices.
+   *
+   * @param other the other index
+   */
+  void swap(FlatHashGridIndex& other);
+
+  /**
+   * @return number of points stored in the index
+   */
+  inline size_t size() const { return numberOfEntries; }
+
+  /**
+   * @return number of slots of the table
+   */
+  inline size_t getCapacity() const { return seqs.size(); }
+
+  /**
+   * @return memory occupied by the table in bytes
+   */
+  size_t getMemoryUsage() const;
+
+ private:
+  /// marks an empty slot in the seqs array
+  static const size_t emptySlot;
+
+  /// sequence numbers of the points stored in the slots
+  std::vector<size_t> seqs;
+  /// cached hash values of the points stored in the slots
+  std::vector<size_t> hashes;
+  /// number of used slots
+  size_t numberOfEntries;
+  /// number of slots minus one (number of slots is a power of two)
+  size_t mask;
+  /// shift for Fibonacci hashing (64 minus log2 of the number of slots)
+  size_t shift;
+
+  /**
+   * Maps a hash value to its home slot. HashGridPoint::getHash is weak in the high bits,
+   * so the value is scrambled by Fibonacci hashing first.
+   *
+   * @param hash  hash value
+   * @return      home slot
+   */
+  inline size_t homeSlot(size_t hash) const {
+    return static_cast<size_t>((static_cast<uint64_t>(hash) * 11400714819323198485ull) >> shift);
+  }
+
+  /**
+   * Searches the slot of a grid point.
+   *
+   * @param point   grid point
+   * @param points  list of grid points the stored sequence numbers refer to
+   * @return        slot containing the point or the first empty slot of its probe sequence
+   */
+  size_t findSlot(const HashGridPoint& point, const point_list& points) const;
+
+  /**
+   * Resizes the table to the given number of slots and reinserts all entries.
+   *
+   * @param capacity  new number of slots (power of two)
+   */
+  void rehash(size_t capacity);
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* FLATHASHGRIDINDEX_HPP */
@@ -5,6 +5,7 @@
 
 #include <sgpp/base/grid/storage/hashmap/HashGridIterator.hpp>
 #include <sgpp/base/exception/generation_exception.hpp>
+#include <sgpp/base/grid/storage/hashmap/PackedLevelIndex.hpp>
 #include <sgpp/base/grid/storage/hashmap/SerializationVersion.hpp>
 
 #include <memory>
@@ -74,50 +75,31 @@ HashGridIterator::resetToLevelOne(size_t d) {
 
 void
 HashGridIterator::leftChild(size_t dim) {
-  index_type::level_type l;
-  index_type::index_type i;
-  index.get(dim, l, i);
-  index.set(dim, l + 1, 2 * i - 1);
+  index.setPackedLevelIndex(dim, PackedLevelIndex::leftChild(index.getPackedLevelIndex(dim)));
   this->seq_ = storage.getSequenceNumber(index);
 }
 
 void
 HashGridIterator::rightChild(size_t dim) {
-  index_type::level_type l;
-  index_type::index_type i;
-  index.get(dim, l, i);
-  index.set(dim, l + 1, 2 * i + 1);
+  index.setPackedLevelIndex(dim, PackedLevelIndex::rightChild(index.getPackedLevelIndex(dim)));
   this->seq_ = storage.getSequenceNumber(index);
 }
 
 void
 HashGridIterator::up(size_t d) {
-  index_type::level_type l;
-  index_type::index_type i;
-  index.get(d, l, i);
-
-  i /= 2;
-  i += i % 2 == 0 ? 1 : 0;
-
-  index.set(d, l - 1, i);
+  index.setPackedLevelIndex(d, PackedLevelIndex::parent(index.getPackedLevelIndex(d)));
   this->seq_ = storage.getSequenceNumber(index);
 }
 
 void
 HashGridIterator::stepLeft(size_t d) {
-  index_type::level_type l;
-  index_type::index_type i;
-  index.get(d, l, i);
-  index.set(d, l, i - 2);
+  index.setPackedLevelIndex(d, PackedLevelIndex::stepLeft(index.getPackedLevelIndex(d)));
   this->seq_ = storage.getSequenceNumber(index);
 }
 
 void
 HashGridIterator::stepRight(size_t d) {
-  index_type::level_type l;
-  index_type::index_type i;
-  index.get(d, l, i);
-  index.set(d, l, i + 2);
+  index.setPackedLevelIndex(d, PackedLevelIndex::stepRight(index.getPackedLevelIndex(d)));
   this->seq_ = storage.getSequenceNumber(index);
 }
 
@@ -133,32 +115,24 @@ HashGridIterator::hint() const {
 
 bool
 HashGridIterator::hintLeft(size_t d) {
-  index_type::level_type l;
-  index_type::index_type i;
-  bool hasIndex = true;
+  const index_type::packed_type w = index.getPackedLevelIndex(d);
+  index.setPackedLevelIndex(d, PackedLevelIndex::leftChild(w));
 
-  index.get(d, l, i);
-  index.set(d, l + 1, 2 * i - 1);
+  const bool hasIndex = storage.isContaining(index);
 
-  hasIndex = storage.isContaining(index);
-
-  index.set(d, l, i);
+  index.setPackedLevelIndex(d, w);
 
   return hasIndex;
 }
 
 bool
 HashGridIterator::hintRight(size_t d) {
-  index_type::level_type l;
-  index_type::index_type i;
-  bool hasIndex = true;
-
-  index.get(d, l, i);
-  index.set(d, l + 1, 2 * i + 1);
+  const index_type::packed_type w = index.getPackedLevelIndex(d);
+  index.setPackedLevelIndex(d, PackedLevelIndex::rightChild(w));
 
-  hasIndex = storage.isContaining(index);
+  const bool hasIndex = storage.isContaining(index);
 
-  index.set(d, l, i);
+  index.setPackedLevelIndex(d, w);
 
   return hasIndex;
 }
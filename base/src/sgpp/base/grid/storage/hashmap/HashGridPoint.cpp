@@ -15,54 +15,80 @@
 #include <algorithm>
 #include <utility>
 #include <map>
+#include <type_traits>
 #include <vector>
 
 namespace sgpp {
 namespace base {
 
 HashGridPoint::HashGridPoint(size_t dimension)
-    : dimension(dimension), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
-  leaf = false;
+    : dimension(dimension),
+      levelIndex(nullptr),
+      leaf(false),
+      ownsArrays(false),
+      arenaAllocated(false),
+      hash(0) {
+  allocateArrays();
 }
 
 HashGridPoint::HashGridPoint()
-    : dimension(0), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
-  leaf = false;
-}
+    : dimension(0),
+      levelIndex(nullptr),
+      leaf(false),
+      ownsArrays(false),
+      arenaAllocated(false),
+      hash(0) {}
 
 HashGridPoint::HashGridPoint(const HashGridPoint& o)
-    : dimension(o.dimension), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
-  leaf = false;
+    : dimension(o.dimension),
+      levelIndex(nullptr),
+      leaf(false),
+      ownsArrays(false),
+      arenaAllocated(false),
+      hash(0) {
+  allocateArrays();
 
   for (size_t d = 0; d < dimension; d++) {
-    level[d] = o.level[d];
-    index[d] = o.index[d];
+    levelIndex[d] = o.levelIndex[d];
   }
 
   leaf = o.leaf;
   rehash();
 }
 
+HashGridPoint::HashGridPoint(const HashGridPoint& o, packed_type* levelIndex)
+    : dimension(o.dimension),
+      levelIndex(levelIndex),
+      leaf(o.leaf),
+      ownsArrays(false),
+      arenaAllocated(true),
+      hash(0) {
+  for (size_t d = 0; d < dimension; d++) {
+    this->levelIndex[d] = o.levelIndex[d];
+  }
+
+  rehash();
+}
+
 HashGridPoint::HashGridPoint(std::istream& istream, int version)
-    : dimension(0), level(nullptr), index(nullptr), hInv(nullptr), hash(0) {
+    : dimension(0),
+      levelIndex(nullptr),
+      leaf(false),
+      ownsArrays(false),
+      arenaAllocated(false),
+      hash(0) {
   size_t temp_leaf;
+  level_type l;
+  index_type i;
 
   istream >> dimension;
 
-  level = new level_type[dimension];
-  index = new index_type[dimension];
-  hInv = new index_type[dimension];
-  leaf = false;
+  allocateArrays();
 
   for (size_t d = 0; d < dimension; d++) {
-    istream >> level[d];
-    istream >> index[d];
+    istream >> l;
+    istream >> i;
+    levelIndex[d] = PackedLevelIndex::pack(l, i);
   }
 
   if (version >= 2 && version != 4) {
@@ -91,26 +117,31 @@ HashGridPoint::HashGridPoint(std::istream& istream, int version)
 /**
  * Destructor
  */
-HashGridPoint::~HashGridPoint() {
-  if (level) {
-    delete[] level;
-  }
+HashGridPoint::~HashGridPoint() { freeArrays(); }
+
+void HashGridPoint::allocateArrays() {
+  static_assert(std::is_same<level_type, PackedLevelIndex::level_type>::value &&
+                    std::is_same<index_type, PackedLevelIndex::index_type>::value,
+                "every level/index pair has to be representable as a packed word");
+  levelIndex = new packed_type[dimension];
+  ownsArrays = true;
+}
 
-  if (index) {
-    delete[] index;
+void HashGridPoint::freeArrays() {
+  if (ownsArrays) {
+    delete[] levelIndex;
   }
 
-  if (hInv) {
-    delete[] hInv;
-  }
+  levelIndex = nullptr;
+  ownsArrays = false;
 }
 
 void HashGridPoint::serialize(std::ostream& ostream, int version) {
   ostream << dimension << std::endl;
 
   for (size_t d = 0; d < dimension; d++) {
-    ostream << level[d] << " ";
-    ostream << index[d] << " ";
+    ostream << getLevel(d) << " ";
+    ostream << getIndex(d) << " ";
   }
 
   ostream << std::endl;
@@ -128,7 +159,7 @@ size_t HashGridPoint::getDimension() const { return dimension; }
 
 void HashGridPoint::setLeaf(bool isLeaf) { leaf = isLeaf; }
 
-bool HashGridPoint::isLeaf() { return leaf; }
+bool HashGridPoint::isLeaf() const { return leaf; }
 
 void HashGridPoint::getStandardCoordinates(DataVector& coordinates) const {
   coordinates.resize(dimension);
@@ -140,7 +171,7 @@ void HashGridPoint::getStandardCoordinates(DataVector& coordinates) const {
 
 bool HashGridPoint::isInnerPoint() const {
   for (size_t d = 0; d < dimension; d++) {
-    if (level[d] == 0) {
+    if (getLevel(d) == 0) {
       return false;
     }
   }
@@ -151,9 +182,11 @@ bool HashGridPoint::isInnerPoint() const {
 void HashGridPoint::rehash() {
   size_t hash = 0xdeadbeef;
 
+  // same hash values as for separate level and index arrays, so the iteration order of
+  // hash-based containers (and therefore the numbering of refined grids) doesn't change
   for (size_t d = 0; d < dimension; d++) {
-    hInv[d] = static_cast<index_type>(1) << level[d];
-    hash = hInv[d] + index[d] + hash * 65599;
+    hash = PackedLevelIndex::getHInv(levelIndex[d]) + PackedLevelIndex::getIndex(levelIndex[d]) +
+           hash * 65599;
   }
 
   this->hash = hash;
@@ -163,13 +196,7 @@ size_t HashGridPoint::getHash() const { return hash; }
 
 bool HashGridPoint::equals(const HashGridPoint& rhs) const {
   for (size_t d = 0; d < dimension; d++) {
-    if (level[d] != rhs.level[d]) {
-      return false;
-    }
-  }
-
-  for (size_t d = 0; d < dimension; d++) {
-    if (index[d] != rhs.index[d]) {
+    if (levelIndex[d] != rhs.levelIndex[d]) {
       return false;
     }
   }
@@ -185,28 +212,13 @@ HashGridPoint& HashGridPoint::operator=(const HashGridPoint& rhs) {
   }
 
   if (dimension != rhs.dimension) {
-    if (level) {
-      delete[] level;
-    }
-
-    if (index) {
-      delete[] index;
-    }
-
-    if (hInv) {
-      delete[] hInv;
-    }
-
+    freeArrays();
     dimension = rhs.dimension;
-
-    level = new level_type[dimension];
-    index = new index_type[dimension];
-    hInv = new index_type[dimension];
+    allocateArrays();
   }
 
   for (size_t d = 0; d < dimension; d++) {
-    level[d] = rhs.level[d];
-    index[d] = rhs.index[d];
+    levelIndex[d] = rhs.levelIndex[d];
   }
 
   leaf = rhs.leaf;
@@ -230,8 +242,8 @@ void HashGridPoint::toString(std::ostream& stream) const {
       stream << ",";
     }
 
-    stream << " " << this->level[i];
-    stream << ", " << this->index[i];
+    stream << " " << getLevel(i);
+    stream << ", " << getIndex(i);
   }
 
   stream << " ]";
@@ -241,34 +253,34 @@ HashGridPoint::level_type HashGridPoint::getLevelSum() const {
   HashGridPoint::level_type levelsum = 0;
 
   for (size_t d = 0; d < dimension; d++) {
-    levelsum += level[d];
+    levelsum += getLevel(d);
   }
 
   return levelsum;
 }
 
 HashGridPoint::level_type HashGridPoint::getLevelMax() const {
-  HashGridPoint::level_type levelmax = level[0];
+  HashGridPoint::level_type levelmax = getLevel(0);
 
   for (size_t d = 1; d < dimension; d++) {
-    levelmax = std::max(levelmax, level[d]);
+    levelmax = std::max(levelmax, getLevel(d));
   }
 
   return levelmax;
 }
 
 HashGridPoint::level_type HashGridPoint::getLevelMin() const {
-  HashGridPoint::level_type levelmin = level[0];
+  HashGridPoint::level_type levelmin = getLevel(0);
 
   for (size_t d = 1; d < dimension; d++) {
-    levelmin = std::min(levelmin, level[d]);
+    levelmin = std::min(levelmin, getLevel(d));
   }
 
   return levelmin;
 }
 
 bool HashGridPoint::isHierarchicalAncestor(HashGridPoint& gpj, size_t dim) {
-  size_t leveli = level[dim], indexi = index[dim];
+  size_t leveli = getLevel(dim), indexi = getIndex(dim);
   size_t levelj = gpj.getLevel(dim), indexj = gpj.getIndex(dim);
 
   return (levelj >= leveli) && (indexi == ((indexj >> (levelj - leveli)) | 1));
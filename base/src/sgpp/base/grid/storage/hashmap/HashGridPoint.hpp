@@ -7,6 +7,7 @@
 #define HASHGRIDPOINT_HPP
 
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/storage/hashmap/PackedLevelIndex.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <sys/types.h>
@@ -29,6 +30,9 @@ namespace base {
  * ansatzfunctions that are not zero in every dimension. Instances
  * of this class are members in the hashmap that represents the
  * whole grid.
+ *
+ * The level and index of every dimension are stored as one packed 64 bit word
+ * (see PackedLevelIndex), so hashing and comparing points are plain word operations.
  */
 class HashGridPoint {
  public:
@@ -36,6 +40,8 @@ class HashGridPoint {
   typedef uint32_t level_type;
   /// index type
   typedef uint32_t index_type;
+  /// packed level/index word of one dimension
+  typedef PackedLevelIndex::word_type packed_type;
 
   /**
    * Constructor of a n-Dim gridpoint
@@ -93,8 +99,7 @@ class HashGridPoint {
    * @param i the index of the ansatzfunction
    */
   inline void set(size_t d, level_type l, index_type i) {
-    level[d] = l;
-    index[d] = i;
+    levelIndex[d] = PackedLevelIndex::pack(l, i);
     rehash();
   }
 
@@ -108,8 +113,7 @@ class HashGridPoint {
    * @param isLeaf specifies if this gridpoint has any childrens in any dimension
    */
   inline void set(size_t d, level_type l, index_type i, bool isLeaf) {
-    level[d] = l;
-    index[d] = i;
+    levelIndex[d] = PackedLevelIndex::pack(l, i);
     leaf = isLeaf;
     rehash();
   }
@@ -123,8 +127,7 @@ class HashGridPoint {
    * @param i the index of the ansatzfunction
    */
   inline void push(size_t d, level_type l, index_type i) {
-    level[d] = l;
-    index[d] = i;
+    levelIndex[d] = PackedLevelIndex::pack(l, i);
   }
 
   /**
@@ -137,8 +140,7 @@ class HashGridPoint {
    * @param isLeaf specifies if this gridpoint has any childrens in any dimension
    */
   inline void push(size_t d, level_type l, index_type i, bool isLeaf) {
-    level[d] = l;
-    index[d] = i;
+    levelIndex[d] = PackedLevelIndex::pack(l, i);
     leaf = isLeaf;
   }
 
@@ -150,8 +152,8 @@ class HashGridPoint {
    * @param i reference parameter for the index of the ansatz function
    */
   inline void get(size_t d, level_type& l, index_type& i) const {
-    l = level[d];
-    i = index[d];
+    l = PackedLevelIndex::getLevel(levelIndex[d]);
+    i = PackedLevelIndex::getIndex(levelIndex[d]);
   }
 
   /**
@@ -160,7 +162,7 @@ class HashGridPoint {
    * @param d the dimension in which the ansatz function should be read
    * @return level
    */
-  inline level_type getLevel(size_t d) const { return level[d]; }
+  inline level_type getLevel(size_t d) const { return PackedLevelIndex::getLevel(levelIndex[d]); }
 
   /**
    * gets index <i>i</i> in dimension <i>d</i>
@@ -168,7 +170,26 @@ class HashGridPoint {
    * @param d the dimension in which the ansatz function should be read
    * @return index
    */
-  inline index_type getIndex(size_t d) const { return index[d]; }
+  inline index_type getIndex(size_t d) const { return PackedLevelIndex::getIndex(levelIndex[d]); }
+
+  /**
+   * Sets the packed level/index word in dimension <i>d</i> and rehashs the HashGridPoint object
+   *
+   * @param d the dimension in which the ansatzfunction is set
+   * @param w packed level/index word (see PackedLevelIndex)
+   */
+  inline void setPackedLevelIndex(size_t d, packed_type w) {
+    levelIndex[d] = w;
+    rehash();
+  }
+
+  /**
+   * gets the packed level/index word in dimension <i>d</i>
+   *
+   * @param d the dimension in which the ansatz function should be read
+   * @return packed level/index word (see PackedLevelIndex)
+   */
+  inline packed_type getPackedLevelIndex(size_t d) const { return levelIndex[d]; }
 
   /**
    * Set the leaf property; a grid point is called a leaf, if it has <b>not a single</b> child.
@@ -182,7 +203,7 @@ class HashGridPoint {
    *
    * @return Returns true if this grid point has <b>no</b> children, otherwise false
    */
-  bool isLeaf();
+  bool isLeaf() const;
 
   /**
    * determines the coordinate in a given dimension
@@ -194,8 +215,8 @@ class HashGridPoint {
    * @return the coordinate in the given dimension
    */
   inline double getStandardCoordinate(size_t d) const {
-    // cast 1 to index_type to ensure that 1 << level[d] doesn't overflow
-    return static_cast<double>(index[d]) / static_cast<double>(hInv[d]);
+    return static_cast<double>(PackedLevelIndex::getIndex(levelIndex[d])) /
+           static_cast<double>(PackedLevelIndex::getHInv(levelIndex[d]));
   }
 
   /**
@@ -216,7 +237,7 @@ class HashGridPoint {
   bool isInnerPoint() const;
 
   /**
-   * rehashs the current gridpoint and sets hInv
+   * rehashs the current gridpoint
    */
   void rehash();
 
@@ -321,10 +342,7 @@ class HashGridPoint {
    * @param dim the dimension in which the modification is taken place
    */
   inline void getLeftChild(size_t dim) {
-    level_type l;
-    index_type i;
-    get(dim, l, i);
-    set(dim, l + 1, 2 * i - 1);
+    setPackedLevelIndex(dim, PackedLevelIndex::leftChild(levelIndex[dim]));
   }
 
   /**
@@ -333,10 +351,7 @@ class HashGridPoint {
    * @param dim the dimension in which the modification is taken place
    */
   inline void getRightChild(size_t dim) {
-    level_type l;
-    index_type i;
-    get(dim, l, i);
-    set(dim, l + 1, 2 * i + 1);
+    setPackedLevelIndex(dim, PackedLevelIndex::rightChild(levelIndex[dim]));
   }
 
   /**
@@ -353,11 +368,8 @@ class HashGridPoint {
    * @param dim the dimension in which the modification is taken place
    */
   inline void getParent(size_t dim) {
-    level_type l;
-    index_type i;
-    get(dim, l, i);
-    if (l > 1) {
-      set(dim, l - 1, (i >> 1) | 1);
+    if (getLevel(dim) > 1) {
+      setPackedLevelIndex(dim, PackedLevelIndex::parent(levelIndex[dim]));
     }
   }
 
@@ -371,15 +383,16 @@ class HashGridPoint {
    */
   inline void getRightBoundaryPoint(size_t dim) {
     static_assert(sizeof(index_type) == 4, "this implementation is limited to 32bit indices");
-    index_type rindex = index[dim] + 1;
+    const level_type l = getLevel(dim);
+    index_type rindex = getIndex(dim) + 1;
     level_type n =
         multiplyDeBruijnBitPosition[(static_cast<level_type>((rindex & -rindex) * 0x077CB531U)) >>
                                     27];
     // check whether the ancestor is a boundary point or not
-    if (n == 0 || n >= level[dim]) {
+    if (n == 0 || n >= l) {
       set(dim, 0, 1);
     } else {
-      set(dim, level[dim] - n, rindex >> n);
+      set(dim, l - n, rindex >> n);
     }
   }
 
@@ -393,15 +406,16 @@ class HashGridPoint {
    */
   inline void getLeftBoundaryPoint(size_t dim) {
     static_assert(sizeof(index_type) == 4, "this implementation is limited to 32bit indices");
-    index_type lindex = index[dim] - 1;
+    const level_type l = getLevel(dim);
+    index_type lindex = getIndex(dim) - 1;
     level_type n =
         multiplyDeBruijnBitPosition[(static_cast<level_type>((lindex & -lindex) * 0x077CB531U)) >>
                                     27];
     // check whether the ancestor is a boundary point or not
-    if (n == 0 || n >= level[dim]) {
+    if (n == 0 || n >= l) {
       set(dim, 0, 0);
     } else {
-      set(dim, level[dim] - n, lindex >> n);
+      set(dim, l - n, lindex >> n);
     }
   }
 
@@ -450,17 +464,36 @@ class HashGridPoint {
  private:
   /// the dimension of the gridpoint
   size_t dimension;
-  /// pointer to array that stores the ansatzfunctions' level
-  level_type* level;
-  /// pointer to array that stores the ansatzfunctions' indices
-  index_type* index;
-  /// pointer to array that stores the mesh widths (1 << level[d] for each dimension)
-  index_type* hInv;
+  /// pointer to array that stores the ansatzfunctions' packed level/index words
+  packed_type* levelIndex;
   /// stores if this gridpoint is a leaf
   bool leaf;
+  /// true if the level/index array has been allocated by this object
+  bool ownsArrays;
+  /// true if the object itself lives in the memory of a HashGridPointArena
+  bool arenaAllocated;
   /// stores the hashvalue of the gridpoint
   size_t hash;
 
+  /**
+   * Copy-Constructor used by HashGridPointArena, which places the level/index array
+   * in the given memory block instead of allocating it
+   *
+   * @param o           constant reference to HashGridPoint object
+   * @param levelIndex  memory for o.getDimension() packed level/index words
+   */
+  HashGridPoint(const HashGridPoint& o, packed_type* levelIndex);
+
+  /**
+   * Allocates the level/index array.
+   */
+  void allocateArrays();
+
+  /**
+   * Frees the level/index array if it has been allocated by this object.
+   */
+  void freeArrays();
+
   /// helper array to find the lowest significant bit efficiently for 32 bit unsigned ints
   /// -> needed for finding the grid point at the boundary of the support
   static std::vector<level_type> multiplyDeBruijnBitPosition;
@@ -469,6 +502,7 @@ class HashGridPoint {
   friend struct HashGridPointPointerEqualityFunctor;
   friend struct HashGridPointHashFunctor;
   friend struct HashGridPointEqualityFunctor;
+  friend class HashGridPointArena;
 };
 
 struct HashGridPointPointerHashFunctor {
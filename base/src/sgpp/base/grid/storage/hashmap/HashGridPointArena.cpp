@@ -0,0 +1,103 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPointArena.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+const size_t HashGridPointArena::initialChunkSlots = 16;
+const size_t HashGridPointArena::maxChunkBytes = 1 << 20;
+
+HashGridPointArena::HashGridPointArena()
+    : dimension(0),
+      slotSize(0),
+      chunks(),
+      chunkSlots(),
+      usedSlotsInLastChunk(0),
+      freeSlots() {}
+
+HashGridPointArena::~HashGridPointArena() {}
+
+HashGridPoint* HashGridPointArena::create(const HashGridPoint& point) {
+  if (chunks.empty()) {
+    // the first point determines the slot layout
+    const size_t alignment = alignof(std::max_align_t);
+    dimension = point.getDimension();
+    slotSize = sizeof(HashGridPoint) + dimension * sizeof(HashGridPoint::packed_type);
+    slotSize = (slotSize + alignment - 1) / alignment * alignment;
+  } else if (point.getDimension() != dimension) {
+    return new HashGridPoint(point);
+  }
+
+  char* slot = allocateSlot();
+  HashGridPoint::packed_type* levelIndex =
+      reinterpret_cast<HashGridPoint::packed_type*>(slot + sizeof(HashGridPoint));
+  return new (slot) HashGridPoint(point, levelIndex);
+}
+
+void HashGridPointArena::destroy(HashGridPoint* point) {
+  if (point->arenaAllocated) {
+    point->~HashGridPoint();
+    freeSlots.push_back(reinterpret_cast<char*>(point));
+  } else {
+    delete point;
+  }
+}
+
+void HashGridPointArena::clear(const point_list& points) {
+  for (HashGridPoint* point : points) {
+    if (point->arenaAllocated) {
+      // only frees heap memory of points whose dimension has been changed
+      point->~HashGridPoint();
+    } else {
+      delete point;
+    }
+  }
+
+  chunks.clear();
+  chunkSlots.clear();
+  freeSlots.clear();
+  usedSlotsInLastChunk = 0;
+}
+
+size_t HashGridPointArena::getMemoryUsage() const {
+  size_t result = 0;
+
+  for (size_t slots : chunkSlots) {
+    result += slots * slotSize;
+  }
+
+  return result;
+}
+
+char* HashGridPointArena::allocateSlot() {
+  if (!freeSlots.empty()) {
+    char* slot = freeSlots.back();
+    freeSlots.pop_back();
+    return slot;
+  }
+
+  if (chunks.empty() || (usedSlotsInLastChunk == chunkSlots.back())) {
+    // double the chunk size until the maximal chunk size is reached
+    size_t slots = chunkSlots.empty() ? initialChunkSlots : 2 * chunkSlots.back();
+    slots = std::max(std::min(slots, maxChunkBytes / slotSize), static_cast<size_t>(1));
+
+    chunks.emplace_back(new char[slots * slotSize]);
+    chunkSlots.push_back(slots);
+    usedSlotsInLastChunk = 0;
+  }
+
+  return chunks.back().get() + (usedSlotsInLastChunk++) * slotSize;
+}
+
+}  // namespace base
+}  // namespace sgpp
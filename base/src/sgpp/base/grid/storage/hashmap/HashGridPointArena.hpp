@@ -0,0 +1,111 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef HASHGRIDPOINTARENA_HPP
+#define HASHGRIDPOINTARENA_HPP
+
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Chunked arena that allocates HashGridPoint objects together with their level/index arrays.
+ *
+ * Every point occupies one fixed-size slot consisting of the HashGridPoint object followed
+ * by its packed level/index words. Slots are carved from chunks whose size doubles
+ * up to 1 MiB, slots of destroyed points are reused. Hence, generating a grid of N points
+ * needs about N * slotSize / 1 MiB calls to the allocator (plus a few for the first, smaller
+ * chunks) instead of 2N, e.g. one allocation per roughly 9000 points for d = 10. Capping the
+ * chunk size keeps the unused part of the last chunk small for large grids.
+ *
+ * The slot size is determined by the dimension of the first point created. Points of a
+ * different dimension are allocated on the heap as a fallback.
+ */
+class HashGridPointArena {
+ public:
+  /// list of grid points
+  typedef std::vector<HashGridPoint*> point_list;
+
+  /**
+   * Constructor, creates an empty arena (no memory is allocated until the first point
+   * is created)
+   */
+  HashGridPointArena();
+
+  /**
+   * Destructor, releases all chunks. The points have to be destroyed before
+   * (see clear()), otherwise heap memory of points whose dimension was changed is leaked.
+   */
+  ~HashGridPointArena();
+
+  /**
+   * Creates a copy of a grid point in the arena.
+   *
+   * @param point grid point to copy
+   * @return      pointer to the new point
+   */
+  HashGridPoint* create(const HashGridPoint& point);
+
+  /**
+   * Destroys a point that was created by create() and makes its slot available again.
+   *
+   * @param point pointer to the point
+   */
+  void destroy(HashGridPoint* point);
+
+  /**
+   * Destroys all given points (which have to be all points created by this arena that
+   * are still alive) and releases the chunks.
+   *
+   * @param points list of all living points of the arena
+   */
+  void clear(const point_list& points);
+
+  /**
+   * @return number of chunks allocated by the arena
+   */
+  inline size_t getNumberOfChunks() const { return chunks.size(); }
+
+  /**
+   * @return memory occupied by the chunks in bytes
+   */
+  size_t getMemoryUsage() const;
+
+ private:
+  /// number of slots of the first chunk
+  static const size_t initialChunkSlots;
+  /// maximal size of a chunk in bytes (unless a single slot is larger)
+  static const size_t maxChunkBytes;
+
+  /// dimension of the points stored in the slots
+  size_t dimension;
+  /// size of one slot in bytes
+  size_t slotSize;
+  /// allocated chunks
+  std::vector<std::unique_ptr<char[]>> chunks;
+  /// number of slots of each chunk
+  std::vector<size_t> chunkSlots;
+  /// number of slots used in the last chunk
+  size_t usedSlotsInLastChunk;
+  /// slots of destroyed points
+  std::vector<char*> freeSlots;
+
+  /**
+   * @return pointer to an unused slot
+   */
+  char* allocateSlot();
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* HASHGRIDPOINTARENA_HPP */
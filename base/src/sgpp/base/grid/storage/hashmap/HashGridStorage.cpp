@@ -7,6 +7,7 @@
 
 #include <sgpp/base/exception/generation_exception.hpp>
 
+#include <atomic>
 #include <exception>
 #include <list>
 #include <memory>
@@ -23,6 +24,9 @@ HashGridStorage::HashGridStorage(size_t dimension)
       dimension(dimension),
       list(),
       map(),
+      flatIndex(),
+      backend(HashGridStorageBackend::UnorderedMap),
+      arena(),
       algoDims(),
       boundingBox(new BoundingBox(dimension)),
       stretching(nullptr),
@@ -37,6 +41,9 @@ HashGridStorage::HashGridStorage(BoundingBox& creationBoundingBox)
       dimension(creationBoundingBox.getDimension()),
       list(),
       map(),
+      flatIndex(),
+      backend(HashGridStorageBackend::UnorderedMap),
+      arena(),
       algoDims(),
       boundingBox(new BoundingBox(creationBoundingBox)),
       stretching(nullptr),
@@ -52,6 +59,9 @@ HashGridStorage::HashGridStorage(Stretching& creationStretching)
       dimension(creationStretching.getDimension()),
       list(),
       map(),
+      flatIndex(),
+      backend(HashGridStorageBackend::UnorderedMap),
+      arena(),
       algoDims(),
       boundingBox(nullptr),
       stretching(new Stretching(creationStretching)),
@@ -67,6 +77,9 @@ HashGridStorage::HashGridStorage(std::string& istr)
       dimension(0lu),
       list(),
       map(),
+      flatIndex(),
+      backend(HashGridStorageBackend::UnorderedMap),
+      arena(),
       algoDims() {
   std::istringstream istream;
   istream.str(istr);
@@ -83,6 +96,9 @@ HashGridStorage::HashGridStorage(std::istream& istream)
       dimension(0lu),
       list(),
       map(),
+      flatIndex(),
+      backend(HashGridStorageBackend::UnorderedMap),
+      arena(),
       algoDims() {
   parseGridDescription(istream);
 
@@ -96,6 +112,9 @@ HashGridStorage::HashGridStorage(HashGridStorage& copyFrom)
       dimension(copyFrom.dimension),
       list(),
       map(),
+      flatIndex(),
+      backend(copyFrom.backend),
+      arena(),
       algoDims(copyFrom.algoDims),
       boundingBox(copyFrom.bUseStretching ? nullptr : new BoundingBox(*copyFrom.boundingBox)),
       stretching(copyFrom.bUseStretching ? new Stretching(*copyFrom.stretching) : nullptr),
@@ -117,6 +136,7 @@ void HashGridStorage::operator=(const HashGridStorage& other) {
 
   dimension = other.dimension;
   algoDims = other.algoDims;
+  setBackend(other.backend);
   bUseStretching = other.bUseStretching;
 
   if (other.bUseStretching) {
@@ -138,62 +158,53 @@ HashGridStorage::~HashGridStorage() {
     delete boundingBox;
   }
 
-  for (grid_list_iterator iter = list.begin(); iter != list.end(); iter++) {
-    delete *iter;
-  }
+  arena.clear(list);
 }
 
 void HashGridStorage::clear() {
-  // delete all grid points
-  for (grid_list_iterator iter = list.begin(); iter != list.end(); iter++) {
-    delete *iter;
-  }
+  markModified();
+
+  // delete all grid points and release the memory of the arena at once
+  arena.clear(list);
 
   // remove all elements from hashmap
   map.clear();
+  flatIndex.clear();
   // remove all list entries
   list.clear();
 }
 
 std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoints) {
-  point_pointer curPoint;
   std::vector<size_t> remainingPoints;
-  size_t delCounter = 0;
+  markModified();
 
   // sort list
   removePoints.sort();
+  removePoints.unique();
 
-  // DEBUG : print list points to delete, sorted
-  // std::cout << std::endl << "List of points to delete, sorted" << std::endl;
-  // for(std::list<size_t>::iterator iter = removePoints.begin();
-  // iter != removePoints.end(); iter++)
-  // {
-  //   std::cout << " " << *iter << " ";
-  // }
-  // std::cout << std::endl;
-
-  // Remove points with given indices for index vector and hashmap
-  for (std::list<size_t>::iterator iter = removePoints.begin(); iter != removePoints.end();
-       iter++) {
-    size_t tmpIndex = *iter;
-    size_t curPos = tmpIndex - delCounter;
+  remainingPoints.reserve(list.size());
 
-    // GridPoint
-    curPoint = list[curPos];
+  // keep all points whose indices are not contained in the sorted list,
+  // the remaining points are moved to the front of the list without being copied
+  // (pointers and references to them stay valid), the slots of the removed points
+  // are reused by the next insertions
+  std::list<size_t>::iterator removeIter = removePoints.begin();
+  size_t numberOfRemainingPoints = 0;
 
-    // erase point
-    delCounter++;
-    map.erase(curPoint);
-    list.erase(list.begin() + curPos);
-  }
-
-  // reset all entries in hash map and build list of remaining
   for (size_t i = 0; i < list.size(); i++) {
-    curPoint = list[i];
-    remainingPoints.push_back(map[curPoint]);
-    map[curPoint] = i;
+    if ((removeIter != removePoints.end()) && (*removeIter == i)) {
+      ++removeIter;
+      arena.destroy(list[i]);
+    } else {
+      remainingPoints.push_back(i);
+      list[numberOfRemainingPoints++] = list[i];
+    }
   }
 
+  // renumber the remaining points consecutively
+  list.resize(numberOfRemainingPoints);
+  rebuildIndex();
+
   // reset the whole grid's leaf property in order
   // to guarantee a consistent grid
   recalcLeafProperty();
@@ -258,7 +269,7 @@ void HashGridStorage::toString(std::ostream& stream) const {
   stream << "[";
   int i = 0;
 
-  for (grid_map_const_iterator iter = map.begin(); iter != map.end(); iter++, i++) {
+  for (grid_map_const_iterator iter = begin(); iter != end(); iter++, i++) {
     if (i != 0) {
       stream << ",";
     }
@@ -271,12 +282,12 @@ void HashGridStorage::toString(std::ostream& stream) const {
   stream << " ]";
 }
 
-size_t HashGridStorage::getSize() const { return map.size(); }
+size_t HashGridStorage::getSize() const { return indexSize(); }
 
 size_t HashGridStorage::getNumberOfInnerPoints() const {
   size_t innerPoints = 0;
 
-  for (size_t p = 0; p < map.size(); p++) {
+  for (size_t p = 0; p < indexSize(); p++) {
     if (list[p]->isInnerPoint()) innerPoints++;
   }
 
@@ -285,10 +296,17 @@ size_t HashGridStorage::getNumberOfInnerPoints() const {
 
 size_t HashGridStorage::getDimension() const { return dimension; }
 
+uint64_t HashGridStorage::nextVersion() {
+  static std::atomic<uint64_t> counter(0);
+  return ++counter;
+}
+
 size_t HashGridStorage::insert(const point_type& index) {
-  point_pointer insert = new HashGridPoint(index);
+  markAppended();
+  point_pointer insert = arena.create(index);
   list.push_back(insert);
-  return (map[insert] = list.size() - 1);
+  indexInsert(insert, list.size() - 1);
+  return list.size() - 1;
 }
 
 void HashGridStorage::insert(point_type& index, std::vector<size_t>& insertedPoints) {
@@ -324,22 +342,24 @@ void HashGridStorage::insert(point_type& index, std::vector<size_t>& insertedPoi
 
 void HashGridStorage::update(point_type& index, size_t pos) {
   if (pos < list.size()) {
+    markModified();
     // Remove old element at pos
     point_pointer del = list[pos];
-    map.erase(del);
-    delete del;
+    indexErase(del);
+    arena.destroy(del);
     // Insert update
-    point_pointer insert = new HashGridPoint(index);
+    point_pointer insert = arena.create(index);
     list[pos] = insert;
-    map[insert] = pos;
+    indexInsert(insert, pos);
   }
 }
 
 void HashGridStorage::deleteLast() {
+  markModified();
   point_pointer del = list.back();
-  map.erase(del);
+  indexErase(del);
   list.pop_back();
-  delete del;
+  arena.destroy(del);
 }
 
 void HashGridStorage::setAlgorithmicDimensions(std::vector<size_t> newAlgoDims) {
@@ -355,6 +375,56 @@ void HashGridStorage::setAlgorithmicDimensions(std::vector<size_t> newAlgoDims)
   }
 }
 
+void HashGridStorage::setBackend(HashGridStorageBackend backend) {
+  if (backend == this->backend) {
+    return;
+  }
+
+  // release the memory of the old index
+  grid_map().swap(map);
+  FlatHashGridIndex().swap(flatIndex);
+
+  this->backend = backend;
+  rebuildIndex();
+}
+
+size_t HashGridStorage::getIndexMemoryUsage() const {
+  if (backend == HashGridStorageBackend::FlatHash) {
+    return flatIndex.getMemoryUsage();
+  } else {
+    // bucket array plus one node per entry (next pointer, key/value pair, cached hash)
+    return map.bucket_count() * sizeof(void*) +
+           map.size() * (sizeof(grid_map::value_type) + sizeof(void*) + sizeof(size_t));
+  }
+}
+
+size_t HashGridStorage::getPointMemoryUsage() const {
+  return arena.getMemoryUsage() + list.capacity() * sizeof(point_pointer);
+}
+
+void HashGridStorage::reserve(size_t n) {
+  list.reserve(n);
+
+  if (backend == HashGridStorageBackend::FlatHash) {
+    flatIndex.reserve(n);
+  } else {
+    map.reserve(n);
+  }
+}
+
+void HashGridStorage::rebuildIndex() {
+  if (backend == HashGridStorageBackend::FlatHash) {
+    flatIndex.rebuild(list);
+  } else {
+    map.clear();
+    map.reserve(list.size());
+
+    for (size_t i = 0; i < list.size(); i++) {
+      map[list[i]] = i;
+    }
+  }
+}
+
 void HashGridStorage::recalcLeafProperty() {
   point_pointer point;
   grid_map_iterator iter;
@@ -364,7 +434,7 @@ void HashGridStorage::recalcLeafProperty() {
   bool isLeaf = true;
 
   // iterate through the grid
-  for (iter = map.begin(); iter != map.end(); iter++) {
+  for (iter = begin(); iter != end(); iter++) {
     point = iter->first;
     isLeaf = true;
 
@@ -593,6 +663,7 @@ void HashGridStorage::getLevelIndexMaskArraysForModEval(DataMatrixSP& level, Dat
 }
 
 void HashGridStorage::parseGridDescription(std::istream& istream) {
+  markModified();
   int version;
   istream >> version;
   istream >> dimension;
@@ -660,10 +731,12 @@ void HashGridStorage::parseGridDescription(std::istream& istream) {
     }
   }
 
+  reserve(list.size() + num);
+
   for (size_t i = 0; i < num; i++) {
-    point_pointer index = new HashGridPoint(istream, version);
+    point_pointer index = arena.create(HashGridPoint(istream, version));
     list.push_back(index);
-    map[index] = i;
+    indexInsert(index, list.size() - 1);
   }
 
   // set's the grid point's leaf information which is not saved in version 1
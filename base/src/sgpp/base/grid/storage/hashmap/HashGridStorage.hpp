@@ -8,7 +8,9 @@
 
 #include <sgpp/base/exception/generation_exception.hpp>
 
+#include <sgpp/base/grid/storage/hashmap/FlatHashGridIndex.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPointArena.hpp>
 #include <sgpp/base/grid/storage/hashmap/SerializationVersion.hpp>
 
 #include <sgpp/base/grid/common/BoundingBox.hpp>
@@ -29,6 +31,7 @@
 #include <sstream>
 #include <string>
 #include <typeinfo>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
@@ -36,6 +39,16 @@ namespace base {
 
 class HashGridIterator;
 
+/**
+ * Data structure that is used by HashGridStorage to map grid points to sequence numbers.
+ */
+enum class HashGridStorageBackend {
+  /// node-based std::unordered_map (default)
+  UnorderedMap,
+  /// open-addressing table with contiguous slot arrays, see FlatHashGridIndex
+  FlatHash
+};
+
 /**
  * Generic hash table based storage of grid points.
  */
@@ -50,13 +63,94 @@ class HashGridStorage {
   /// unordered_map of index_pointers
   typedef std::unordered_map<point_pointer, size_t, HashGridPointPointerHashFunctor,
                              HashGridPointPointerEqualityFunctor> grid_map;
-  /// iterator of grid_map
-  typedef grid_map::iterator grid_map_iterator;
-  /// const_iterator of grid_map
-  typedef grid_map::const_iterator grid_map_const_iterator;
 
   /// vector of index_pointers
   typedef std::vector<point_pointer> grid_list;
+
+  /**
+   * Iterator over pairs of grid points and sequence numbers that works for
+   * every HashGridStorageBackend. For the UnorderedMap backend, it traverses the
+   * hash map, for the FlatHash backend, it traverses the points in the order of their
+   * sequence numbers.
+   */
+  class PointIterator {
+   public:
+    /// pair of grid point and sequence number
+    typedef std::pair<point_pointer, size_t> value_type;
+
+    /**
+     * Constructor for the UnorderedMap backend
+     *
+     * @param mapIter iterator of the underlying hash map
+     */
+    explicit PointIterator(grid_map::const_iterator mapIter)
+        : mapIter(mapIter), list(nullptr), seq(0), current() {}
+
+    /**
+     * Constructor for the FlatHash backend
+     *
+     * @param list  list of grid points of the storage
+     * @param seq   sequence number the iterator points to
+     */
+    PointIterator(const grid_list* list, size_t seq)
+        : mapIter(), list(list), seq(seq), current() {}
+
+    /**
+     * Default constructor, creates a singular iterator
+     */
+    PointIterator() : mapIter(), list(nullptr), seq(0), current() {}
+
+    inline const value_type& operator*() const {
+      if (list == nullptr) {
+        current.first = mapIter->first;
+        current.second = mapIter->second;
+      } else {
+        current.first = (*list)[seq];
+        current.second = seq;
+      }
+
+      return current;
+    }
+
+    inline const value_type* operator->() const { return &(operator*()); }
+
+    inline PointIterator& operator++() {
+      if (list == nullptr) {
+        ++mapIter;
+      } else {
+        ++seq;
+      }
+
+      return *this;
+    }
+
+    inline PointIterator operator++(int) {
+      PointIterator result(*this);
+      ++(*this);
+      return result;
+    }
+
+    inline bool operator==(const PointIterator& other) const {
+      return (list == nullptr) ? (mapIter == other.mapIter) : (seq == other.seq);
+    }
+
+    inline bool operator!=(const PointIterator& other) const { return !(*this == other); }
+
+   private:
+    /// iterator of the hash map (UnorderedMap backend)
+    grid_map::const_iterator mapIter;
+    /// list of grid points (FlatHash backend), nullptr for the UnorderedMap backend
+    const grid_list* list;
+    /// current sequence number (FlatHash backend)
+    size_t seq;
+    /// dereferenced value
+    mutable value_type current;
+  };
+
+  /// iterator over the stored grid points
+  typedef PointIterator grid_map_iterator;
+  /// const iterator over the stored grid points
+  typedef PointIterator grid_map_const_iterator;
   /// iterator of grid_list
   typedef grid_list::iterator grid_list_iterator;
   /// const iterator of grid_list
@@ -131,6 +225,8 @@ class HashGridStorage {
    * Remove several point from HashGridStorage. The points to removed
    * are stored in a list. This function returns a vector of remaining points
    * given by their
+   * "old" index. The remaining points are not copied, i.e. pointers and references to them
+   * stay valid.
    *
    * @param removePoints vector containing the indices of the points that should be removed
    *
@@ -196,6 +292,25 @@ class HashGridStorage {
    */
   size_t getDimension() const;
 
+  /**
+   * Returns a number that changes whenever grid points are inserted, updated or deleted.
+   * The numbers are unique among all grid storages of the process, i.e., a storage created at the
+   * address of a destroyed one cannot be mistaken for it. Changes of grid points through the
+   * references returned by getPoint() or operator[] are not detected.
+   *
+   * @return version of the grid points
+   */
+  inline uint64_t getVersion() const { return version; }
+
+  /**
+   * Returns a number that changes whenever existing grid points are updated, deleted or
+   * reordered, but not if grid points are appended (e.g. by refinement), i.e., if it did not
+   * change, the first grid points are still the same (see getVersion()).
+   *
+   * @return version of the existing grid points
+   */
+  inline uint64_t getLayoutVersion() const { return layoutVersion; }
+
   /**
    * gets the index number for given gridpoint by its sequence number
    *
@@ -293,15 +408,19 @@ class HashGridStorage {
 
   /**
    * set iterator to the first position in the map
+   *
+   * The iteration order depends on the backend (see setBackend) and is not the order of the
+   * sequence numbers. Use getPoint() to traverse the grid points in sequence order.
+   *
    * @return iterator pointing to the beginning of the map
    */
-  grid_map_iterator begin();
+  grid_map_iterator begin() const;
 
   /**
    * sets the iterator to last position in the map
    * @return iterator pointing to the end of the map
    */
-  grid_map_iterator end();
+  grid_map_iterator end() const;
 
   /**
    * Tests if index is in the storage
@@ -330,6 +449,50 @@ class HashGridStorage {
    */
   bool isInvalidSequenceNumber(size_t s);
 
+  /**
+   * Switches the data structure that maps grid points to sequence numbers. The index
+   * is rebuilt from the current grid points, sequence numbers are not changed.
+   * The backend is not part of the serialization format.
+   *
+   * The backends iterate over the grid points (begin(), end()) in different orders. Algorithms
+   * that insert points while iterating, e.g. refinement, may thus assign different sequence
+   * numbers to the new points, depending on the backend. The sequence numbers of the existing
+   * points (getPoint(), serialize()) are preserved in any case.
+   *
+   * @param backend the new backend
+   */
+  void setBackend(HashGridStorageBackend backend);
+
+  /**
+   * @return the data structure that maps grid points to sequence numbers
+   */
+  inline HashGridStorageBackend getBackend() const { return backend; }
+
+  /**
+   * Estimates the memory occupied by the index that maps grid points to sequence numbers,
+   * excluding the grid points themselves.
+   *
+   * @return memory usage in bytes
+   */
+  size_t getIndexMemoryUsage() const;
+
+  /**
+   * Estimates the memory occupied by the grid points (including their packed level/index
+   * words) and the list of grid points, excluding the index. Points whose dimension differs
+   * from the first point are allocated on the heap and are not taken into account.
+   *
+   * @return memory usage in bytes
+   */
+  size_t getPointMemoryUsage() const;
+
+  /**
+   * Reserves memory for at least n grid points, which avoids rehashing during
+   * the generation of large grids.
+   *
+   * @param n number of grid points
+   */
+  void reserve(size_t n);
+
   /**
    * returns the algorithmic dimensions (the dimensions in which the Up Down
    * operations should be applied)
@@ -521,8 +684,14 @@ class HashGridStorage {
 
   /// the grid points
   grid_list list;
-  /// the indices of the grid points
+  /// the indices of the grid points (UnorderedMap backend)
   grid_map map;
+  /// the indices of the grid points (FlatHash backend)
+  FlatHashGridIndex flatIndex;
+  /// data structure used for the indices of the grid points
+  HashGridStorageBackend backend;
+  /// memory of the grid points
+  HashGridPointArena arena;
   /// algorithmic dimension, these are used in Up/Downs
   std::vector<size_t> algoDims;
 
@@ -534,49 +703,143 @@ class HashGridStorage {
   /// Flag to check if stretching or boundingBox used
   bool bUseStretching;
 
+  /// version of the grid points (see getVersion())
+  uint64_t version = nextVersion();
+  /// version of the existing grid points (see getLayoutVersion())
+  uint64_t layoutVersion = version;
+
+  /**
+   * @return a new version number (unique among all grid storages)
+   */
+  static uint64_t nextVersion();
+
+  /**
+   * Updates the version after grid points were appended.
+   */
+  inline void markAppended() { version = nextVersion(); }
+
+  /**
+   * Updates the versions after existing grid points were changed.
+   */
+  inline void markModified() { layoutVersion = version = nextVersion(); }
+
   /**
    * Parses the gird's information (grid points, dimensions, bounding box) from a string stream
    *
    * @param istream the string stream that contains the information
    */
   void parseGridDescription(std::istream& istream);
+
+  /**
+   * Looks up the sequence number of a grid point in the active index.
+   *
+   * @param point grid point
+   * @return      sequence number or FlatHashGridIndex::notFound
+   */
+  inline size_t indexFind(const HashGridPoint& point) const {
+    if (backend == HashGridStorageBackend::FlatHash) {
+      return flatIndex.find(point, list);
+    } else {
+      grid_map::const_iterator iter = map.find(const_cast<point_pointer>(&point));
+      return (iter != map.end()) ? iter->second : FlatHashGridIndex::notFound;
+    }
+  }
+
+  /**
+   * Maps a grid point to a sequence number in the active index.
+   *
+   * @param point grid point, has to be stored in the grid list
+   * @param seq   sequence number
+   */
+  inline void indexInsert(point_pointer point, size_t seq) {
+    if (backend == HashGridStorageBackend::FlatHash) {
+      flatIndex.insert(*point, seq, list);
+    } else {
+      map[point] = seq;
+    }
+  }
+
+  /**
+   * Removes a grid point from the active index. Has to be called before the point
+   * is removed from the grid list.
+   *
+   * @param point grid point
+   */
+  inline void indexErase(point_pointer point) {
+    if (backend == HashGridStorageBackend::FlatHash) {
+      flatIndex.erase(*point, list);
+    } else {
+      map.erase(point);
+    }
+  }
+
+  /**
+   * @return number of grid points in the active index
+   */
+  inline size_t indexSize() const {
+    return (backend == HashGridStorageBackend::FlatHash) ? flatIndex.size() : map.size();
+  }
+
+  /**
+   * Rebuilds the active index such that list[i] is mapped to i.
+   */
+  void rebuildIndex();
 };
 
 HashGridStorage::point_pointer inline HashGridStorage::create(point_type& index) {
-  point_pointer insert = new HashGridPoint(index);
+  point_pointer insert = arena.create(index);
   return insert;
 }
 
-void inline HashGridStorage::destroy(point_pointer index) { delete index; }
+void inline HashGridStorage::destroy(point_pointer index) { arena.destroy(index); }
 
 unsigned int inline HashGridStorage::store(point_pointer index) {
+  markAppended();
   list.push_back(index);
-  return static_cast<unsigned int>(map[index] = static_cast<unsigned int>(list.size() - 1));
+  indexInsert(index, list.size() - 1);
+  return static_cast<unsigned int>(list.size() - 1);
 }
 
 HashGridStorage::grid_map_iterator inline HashGridStorage::find(point_pointer index) {
-  return map.find(index);
+  if (backend == HashGridStorageBackend::FlatHash) {
+    size_t seq = flatIndex.find(*index, list);
+    return PointIterator(&list, (seq == FlatHashGridIndex::notFound) ? list.size() : seq);
+  } else {
+    return PointIterator(map.find(index));
+  }
 }
 
-HashGridStorage::grid_map_iterator inline HashGridStorage::begin() { return map.begin(); }
+HashGridStorage::grid_map_iterator inline HashGridStorage::begin() const {
+  if (backend == HashGridStorageBackend::FlatHash) {
+    return PointIterator(&list, 0);
+  } else {
+    return PointIterator(map.begin());
+  }
+}
 
-HashGridStorage::grid_map_iterator inline HashGridStorage::end() { return map.end(); }
+HashGridStorage::grid_map_iterator inline HashGridStorage::end() const {
+  if (backend == HashGridStorageBackend::FlatHash) {
+    return PointIterator(&list, list.size());
+  } else {
+    return PointIterator(map.end());
+  }
+}
 
 bool inline HashGridStorage::isContaining(HashGridPoint& index) const {
-  return map.find(&index) != map.end();
+  return indexFind(index) != FlatHashGridIndex::notFound;
 }
 
 size_t inline HashGridStorage::getSequenceNumber(HashGridPoint& index) const {
-  grid_map_const_iterator iter = map.find(&index);
+  size_t seq = indexFind(index);
 
-  if (iter != map.end()) {
-    return iter->second;
+  if (seq != FlatHashGridIndex::notFound) {
+    return seq;
   } else {
-    return map.size() + 1;
+    return indexSize() + 1;
   }
 }
 
-bool inline HashGridStorage::isInvalidSequenceNumber(size_t s) { return s > map.size(); }
+bool inline HashGridStorage::isInvalidSequenceNumber(size_t s) { return s > indexSize(); }
 
 std::vector<size_t> inline HashGridStorage::getAlgorithmicDimensions() { return algoDims; }
 
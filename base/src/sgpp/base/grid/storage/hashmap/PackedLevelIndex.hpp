@@ -0,0 +1,118 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PACKEDLEVELINDEX_HPP
+#define PACKEDLEVELINDEX_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Encodes the one-dimensional level/index pair of a grid point in a single 64 bit word.
+ * The level is stored in the upper 32 bits, the index in the lower 32 bits. Hence, every pair
+ * of 32 bit level and index is represented exactly, including the out-of-range indices that
+ * occur temporarily during navigation (e.g., the left child of index 0).
+ *
+ * The navigation functions work directly on the packed words and wrap around in the same
+ * way as the corresponding operations on 32 bit levels and indices.
+ */
+class PackedLevelIndex {
+ public:
+  /// word type
+  typedef uint64_t word_type;
+  /// level type
+  typedef uint32_t level_type;
+  /// index type
+  typedef uint32_t index_type;
+
+  /// number of bits used for the index
+  static const unsigned int indexBits = 32;
+  /// bit mask of the index part
+  static const word_type indexMask = (static_cast<word_type>(1) << indexBits) - 1;
+  /// bit mask of the level part
+  static const word_type levelMask = ~indexMask;
+  /// packed word with level 1 and index 0, i.e., the increment of the level part
+  static const word_type levelOne = static_cast<word_type>(1) << indexBits;
+
+  /**
+   * @param l level
+   * @param i index
+   * @return  packed level/index word
+   */
+  static inline word_type pack(level_type l, index_type i) {
+    return (static_cast<word_type>(l) << indexBits) | static_cast<word_type>(i);
+  }
+
+  /**
+   * @param w packed level/index word
+   * @return  level
+   */
+  static inline level_type getLevel(word_type w) {
+    return static_cast<level_type>(w >> indexBits);
+  }
+
+  /**
+   * @param w packed level/index word
+   * @return  index
+   */
+  static inline index_type getIndex(word_type w) { return static_cast<index_type>(w & indexMask); }
+
+  /**
+   * @param w packed level/index word
+   * @return  mesh width inverse 2^l
+   */
+  static inline index_type getHInv(word_type w) {
+    return static_cast<index_type>(1) << getLevel(w);
+  }
+
+  /**
+   * @param w packed level/index word (l, i)
+   * @return  left child (l + 1, 2i - 1)
+   */
+  static inline word_type leftChild(word_type w) {
+    return ((w + levelOne) & levelMask) | ((2 * w - 1) & indexMask);
+  }
+
+  /**
+   * @param w packed level/index word (l, i)
+   * @return  right child (l + 1, 2i + 1)
+   */
+  static inline word_type rightChild(word_type w) {
+    return ((w + levelOne) & levelMask) | ((2 * w + 1) & indexMask);
+  }
+
+  /**
+   * @param w packed level/index word (l, i)
+   * @return  hierarchical parent (l - 1, floor(i / 2) rounded up to the next odd number)
+   */
+  static inline word_type parent(word_type w) {
+    return ((w - levelOne) & levelMask) | (((w & indexMask) >> 1) | 1);
+  }
+
+  /**
+   * @param w packed level/index word (l, i)
+   * @return  left neighbor on the same level (l, i - 2)
+   */
+  static inline word_type stepLeft(word_type w) {
+    return (w & levelMask) | ((w - 2) & indexMask);
+  }
+
+  /**
+   * @param w packed level/index word (l, i)
+   * @return  right neighbor on the same level (l, i + 2)
+   */
+  static inline word_type stepRight(word_type w) {
+    return (w & levelMask) | ((w + 2) & indexMask);
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* PACKEDLEVELINDEX_HPP */
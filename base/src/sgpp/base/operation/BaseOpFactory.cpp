@@ -24,6 +24,7 @@
 
 #include <sgpp/base/grid/type/PrewaveletGrid.hpp>
 
+#include <sgpp/base/operation/hash/OperationHierarchisationBspline.hpp>
 #include <sgpp/base/operation/hash/OperationHierarchisationFundamentalSpline.hpp>
 #include <sgpp/base/operation/hash/OperationHierarchisationLinear.hpp>
 #include <sgpp/base/operation/hash/OperationHierarchisationLinearBoundary.hpp>
@@ -38,6 +39,7 @@
 #include <sgpp/base/operation/hash/OperationHierarchisationModPoly.hpp>
 #include <sgpp/base/operation/hash/OperationHierarchisationModPolyClenshawCurtis.hpp>
 #include <sgpp/base/operation/hash/OperationHierarchisationModWavelet.hpp>
+#include <sgpp/base/operation/hash/OperationHierarchisationNakBsplineBoundaryCombigrid.hpp>
 #include <sgpp/base/operation/hash/OperationHierarchisationPoly.hpp>
 #include <sgpp/base/operation/hash/OperationHierarchisationPolyBoundary.hpp>
 #include <sgpp/base/operation/hash/OperationHierarchisationPolyClenshawCurtis.hpp>
@@ -202,6 +204,24 @@
 #include <sgpp/base/operation/hash/OperationEvalPartialDerivativeWaveletBoundaryNaive.hpp>
 #include <sgpp/base/operation/hash/OperationEvalPartialDerivativeWaveletNaive.hpp>
 
+#include <sgpp/base/operation/hash/OperationEvalGradientLocalSupport.hpp>
+#include <sgpp/base/operation/hash/OperationEvalHessianLocalSupport.hpp>
+#include <sgpp/base/operation/hash/OperationEvalLocalSupport.hpp>
+#include <sgpp/base/operation/hash/OperationEvalPartialDerivativeLocalSupport.hpp>
+
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBoundaryBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineClenshawCurtisBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineModifiedBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineModifiedClenshawCurtisBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/FundamentalSplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/FundamentalSplineModifiedBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/PolyModifiedBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/WaveletBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/WaveletBoundaryBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/WaveletModifiedBasis.hpp>
+
 #include <sgpp/globaldef.hpp>
 
 #include <cstring>
@@ -211,6 +231,77 @@ namespace sgpp {
 
 namespace op_factory {
 
+namespace {
+
+/**
+ * Creates an evaluation operation that only visits the basis functions whose support
+ * contains the evaluation point (see base::AlgorithmLocalSupportEvaluation).
+ *
+ * @param grid  grid with B-spline, wavelet, fundamental spline or polynomial basis
+ * @return      pointer to the new operation or nullptr if the grid type is not supported
+ */
+template <template <class> class OPERATION, class RESULT>
+RESULT* createLocalSupportOperation(base::Grid& grid) {
+  base::GridStorage& storage = grid.getStorage();
+  // radius of the B-spline support in multiples of the mesh width
+  auto bsplineRadius = [](size_t degree) { return static_cast<double>(degree + 1) / 2.0; };
+  // wavelets are cut off at distance two mesh widths from their center
+  const double waveletRadius = 2.0;
+  // polynomials are supported on the interval between the two hierarchical neighbors
+  const double polyRadius = 1.0;
+
+  if (grid.getType() == base::GridType::Bspline) {
+    const base::SBsplineBase basis(dynamic_cast<base::BsplineGrid&>(grid).getDegree());
+    return new OPERATION<base::SBsplineBase>(storage, basis, bsplineRadius(basis.getDegree()));
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    const base::SBsplineModifiedBase basis(dynamic_cast<base::ModBsplineGrid&>(grid).getDegree());
+    return new OPERATION<base::SBsplineModifiedBase>(storage, basis,
+                                                     bsplineRadius(basis.getDegree()));
+  } else if (grid.getType() == base::GridType::ModBsplineClenshawCurtis) {
+    const base::SBsplineModifiedClenshawCurtisBase basis(
+        dynamic_cast<base::ModBsplineClenshawCurtisGrid&>(grid).getDegree());
+    return new OPERATION<base::SBsplineModifiedClenshawCurtisBase>(
+        storage, basis, bsplineRadius(basis.getDegree()), true);
+  } else if (grid.getType() == base::GridType::BsplineBoundary) {
+    const base::SBsplineBoundaryBase basis(
+        dynamic_cast<base::BsplineBoundaryGrid&>(grid).getDegree());
+    return new OPERATION<base::SBsplineBoundaryBase>(storage, basis,
+                                                     bsplineRadius(basis.getDegree()));
+  } else if (grid.getType() == base::GridType::BsplineClenshawCurtis) {
+    const base::SBsplineClenshawCurtisBase basis(
+        dynamic_cast<base::BsplineClenshawCurtisGrid&>(grid).getDegree());
+    return new OPERATION<base::SBsplineClenshawCurtisBase>(storage, basis,
+                                                           bsplineRadius(basis.getDegree()), true);
+  } else if (grid.getType() == base::GridType::Wavelet) {
+    return new OPERATION<base::SWaveletBase>(storage, base::SWaveletBase(), waveletRadius);
+  } else if (grid.getType() == base::GridType::ModWavelet) {
+    return new OPERATION<base::SWaveletModifiedBase>(storage, base::SWaveletModifiedBase(),
+                                                     waveletRadius);
+  } else if (grid.getType() == base::GridType::WaveletBoundary) {
+    return new OPERATION<base::SWaveletBoundaryBase>(storage, base::SWaveletBoundaryBase(),
+                                                     waveletRadius);
+  } else if (grid.getType() == base::GridType::FundamentalSpline) {
+    const base::SFundamentalSplineBase basis(
+        dynamic_cast<base::FundamentalSplineGrid&>(grid).getDegree());
+    return new OPERATION<base::SFundamentalSplineBase>(storage, basis, basis.getSupportRadius());
+  } else if (grid.getType() == base::GridType::ModFundamentalSpline) {
+    const base::SFundamentalSplineModifiedBase basis(
+        dynamic_cast<base::ModFundamentalSplineGrid&>(grid).getDegree());
+    return new OPERATION<base::SFundamentalSplineModifiedBase>(storage, basis,
+                                                               basis.getSupportRadius());
+  } else if (grid.getType() == base::GridType::Poly) {
+    const base::SPolyBase basis(dynamic_cast<base::PolyGrid&>(grid).getDegree());
+    return new OPERATION<base::SPolyBase>(storage, basis, polyRadius);
+  } else if (grid.getType() == base::GridType::ModPoly) {
+    const base::SPolyModifiedBase basis(dynamic_cast<base::ModPolyGrid&>(grid).getDegree());
+    return new OPERATION<base::SPolyModifiedBase>(storage, basis, polyRadius);
+  } else {
+    return nullptr;
+  }
+}
+
+}  // namespace
+
 base::OperationMatrix* createOperationDiagonal(base::Grid& grid, double multiplicationFactor) {
   return new base::OperationDiagonal(&(grid.getStorage()), multiplicationFactor);
 }
@@ -269,6 +360,16 @@ base::OperationHierarchisation* createOperationHierarchisation(base::Grid& grid)
   } else if (grid.getType() == base::GridType::ModFundamentalSpline) {
     return new base::OperationHierarchisationModFundamentalSpline(
         dynamic_cast<base::ModFundamentalSplineGrid*>(&grid));
+  } else if (grid.getType() == base::GridType::Bspline) {
+    return new base::OperationHierarchisationBspline(
+        grid.getStorage(), dynamic_cast<base::BsplineGrid*>(&grid)->getDegree());
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    return new base::OperationHierarchisationModBspline(
+        grid.getStorage(), dynamic_cast<base::ModBsplineGrid*>(&grid)->getDegree());
+  } else if (grid.getType() == base::GridType::NakBsplineBoundaryCombigrid) {
+    return new base::OperationHierarchisationNakBsplineBoundaryCombigrid(
+        grid.getStorage(),
+        dynamic_cast<base::NakBsplineBoundaryCombigridGrid*>(&grid)->getDegree());
   } else {
     throw base::factory_exception(
         "createOperationHierarchisation is not implemented for this grid type.");
@@ -457,11 +558,60 @@ base::OperationEval* createOperationEval(base::Grid& grid) {
     return new base::OperationEvalLinearStretchedBoundary(grid.getStorage());
   } else if (grid.getType() == base::GridType::Periodic) {
     return new base::OperationEvalPeriodic(grid.getStorage());
-  } else {
+  }
+
+  base::OperationEval* op =
+      createLocalSupportOperation<base::OperationEvalLocalSupport, base::OperationEval>(grid);
+
+  if (op == nullptr) {
     throw base::factory_exception(
         "createOperationEval is not implemented for this grid type. "
         "Try createOperationEvalNaive instead.");
   }
+
+  return op;
+}
+
+base::OperationEvalGradient* createOperationEvalGradient(base::Grid& grid) {
+  base::OperationEvalGradient* op =
+      createLocalSupportOperation<base::OperationEvalGradientLocalSupport,
+                                  base::OperationEvalGradient>(grid);
+
+  if (op == nullptr) {
+    throw base::factory_exception(
+        "createOperationEvalGradient is not implemented for this grid type. "
+        "Try createOperationEvalGradientNaive instead.");
+  }
+
+  return op;
+}
+
+base::OperationEvalHessian* createOperationEvalHessian(base::Grid& grid) {
+  base::OperationEvalHessian* op =
+      createLocalSupportOperation<base::OperationEvalHessianLocalSupport,
+                                  base::OperationEvalHessian>(grid);
+
+  if (op == nullptr) {
+    throw base::factory_exception(
+        "createOperationEvalHessian is not implemented for this grid type. "
+        "Try createOperationEvalHessianNaive instead.");
+  }
+
+  return op;
+}
+
+base::OperationEvalPartialDerivative* createOperationEvalPartialDerivative(base::Grid& grid) {
+  base::OperationEvalPartialDerivative* op =
+      createLocalSupportOperation<base::OperationEvalPartialDerivativeLocalSupport,
+                                  base::OperationEvalPartialDerivative>(grid);
+
+  if (op == nullptr) {
+    throw base::factory_exception(
+        "createOperationEvalPartialDerivative is not implemented for this grid type. "
+        "Try createOperationEvalPartialDerivativeNaive instead.");
+  }
+
+  return op;
 }
 
 base::OperationMultipleEval* createOperationMultipleEval(base::Grid& grid,
@@ -111,6 +111,39 @@ base::OperationMatrix* createOperationIdentity(base::Grid& grid);
  * @return Pointer to the new OperationEval object for the Grid grid
  */
 base::OperationEval* createOperationEval(base::Grid& grid);
+/**
+ * Factory method, returning an OperationEvalGradient for the grid at hand.
+ * In contrast to createOperationEvalGradientNaive, the returned operation only evaluates
+ * the basis functions whose support contains the evaluation point.
+ * Supported are grids with B-spline, wavelet, fundamental spline and polynomial bases.
+ * Note: object has to be freed after use.
+ *
+ * @param grid Grid which is to be used
+ * @return Pointer to the new OperationEvalGradient object for the Grid grid
+ */
+base::OperationEvalGradient* createOperationEvalGradient(base::Grid& grid);
+/**
+ * Factory method, returning an OperationEvalHessian for the grid at hand.
+ * In contrast to createOperationEvalHessianNaive, the returned operation only evaluates
+ * the basis functions whose support contains the evaluation point.
+ * Supported are grids with B-spline, wavelet, fundamental spline and polynomial bases.
+ * Note: object has to be freed after use.
+ *
+ * @param grid Grid which is to be used
+ * @return Pointer to the new OperationEvalHessian object for the Grid grid
+ */
+base::OperationEvalHessian* createOperationEvalHessian(base::Grid& grid);
+/**
+ * Factory method, returning an OperationEvalPartialDerivative for the grid at hand.
+ * In contrast to createOperationEvalPartialDerivativeNaive, the returned operation only
+ * evaluates the basis functions whose support contains the evaluation point.
+ * Supported are grids with B-spline, wavelet, fundamental spline and polynomial bases.
+ * Note: object has to be freed after use.
+ *
+ * @param grid Grid which is to be used
+ * @return Pointer to the new OperationEvalPartialDerivative object for the Grid grid
+ */
+base::OperationEvalPartialDerivative* createOperationEvalPartialDerivative(base::Grid& grid);
 /**
  * Factory method, returning an OperationMultipleEval for the grid at hand.
  * Note: object has to be freed after use.
@@ -58,6 +58,14 @@ class OperationDiagonal : public OperationMatrix {
     }
   }
 
+  void getDiagonal(DataVector& diagonal) override {
+    if (diagonal.getSize() != multiplicators.getSize()) {
+      calculateMultiplicators(diagonal);
+    }
+
+    diagonal = multiplicators;
+  }
+
  private:
   GridStorage* gridStorage;
   const double exponentBase;
@@ -59,6 +59,28 @@ class OperationEval {
       value[j] = eval(curAlpha, point);
     }
   }
+
+  /**
+   * Evaluates the sparse grid function at multiple points.
+   * Implementations may evaluate the points in parallel.
+   *
+   * @param      alpha  coefficient vector
+   * @param      points evaluation points (one point per row)
+   * @param[out] values values of the linear combination at the points
+   */
+  virtual void evalMultiple(const DataVector& alpha,
+                            const DataMatrix& points,
+                            DataVector& values) {
+    const size_t numberOfPoints = points.getNrows();
+    DataVector point(points.getNcols());
+
+    values.resize(numberOfPoints);
+
+    for (size_t p = 0; p < numberOfPoints; p++) {
+      points.getRow(p, point);
+      values[p] = eval(alpha, point);
+    }
+  }
 };
 
 }  // namespace base
@@ -7,12 +7,15 @@
 #define OPERATIONEVALBSPLINENAIVE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/AlgorithmMultiplePointEvaluation.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -28,7 +31,8 @@ class OperationEvalBsplineNaive : public OperationEval {
    * @param degree    B-spline degree
    */
   OperationEvalBsplineNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    multiplePointEvaluation(storage, base) {
   }
 
   /**
@@ -52,6 +56,14 @@ class OperationEvalBsplineNaive : public OperationEval {
   void eval(const DataMatrix& alpha, const DataVector& point,
             DataVector& value) override;
 
+  /**
+   * @param      alpha  coefficient vector
+   * @param      points evaluation points (one point per row)
+   * @param[out] values values of the linear combination at the points
+   */
+  void evalMultiple(const DataVector& alpha, const DataMatrix& points,
+                    DataVector& values) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -59,6 +71,8 @@ class OperationEvalBsplineNaive : public OperationEval {
   SBsplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// algorithm for evaluating at multiple points
+  AlgorithmMultiplePointEvaluation<SBsplineBase> multiplePointEvaluation;
 };
 
 }  // namespace base
@@ -66,6 +66,35 @@ class OperationEvalGradient {
     }
   }
 
+  /**
+   * Evaluates the linear combination and its gradient at multiple points.
+   * Implementations may evaluate the points in parallel.
+   *
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (one point per row)
+   * @param[out]  values    values of the linear combination at the points
+   * @param[out]  gradients gradients of the linear combination at the points
+   *                        (each row is a gradient vector)
+   */
+  virtual void evalGradientMultiple(const DataVector& alpha,
+                                    const DataMatrix& points,
+                                    DataVector& values,
+                                    DataMatrix& gradients) {
+    const size_t numberOfPoints = points.getNrows();
+    const size_t d = points.getNcols();
+    DataVector point(d);
+    DataVector curGradient(d);
+
+    values.resize(numberOfPoints);
+    gradients.resize(numberOfPoints, d);
+
+    for (size_t p = 0; p < numberOfPoints; p++) {
+      points.getRow(p, point);
+      values[p] = evalGradient(alpha, point, curGradient);
+      gradients.setRow(p, curGradient);
+    }
+  }
+
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
 };
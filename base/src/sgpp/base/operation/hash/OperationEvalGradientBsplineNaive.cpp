@@ -6,6 +6,8 @@
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradientBsplineNaive.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -110,5 +112,13 @@ void OperationEvalGradientBsplineNaive::evalGradient(const DataMatrix& alpha,
   }
 }
 
+void OperationEvalGradientBsplineNaive::evalGradientMultiple(const DataVector& alpha,
+                                                             const DataMatrix& points,
+                                                             DataVector& values,
+                                                             DataMatrix& gradients) {
+  std::vector<DataMatrix> hessians;
+  multiplePointEvaluation.eval(alpha, points, 1, values, gradients, hessians);
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -7,10 +7,14 @@
 #define OPERATIONEVALGRADIENTBSPLINE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/AlgorithmMultiplePointEvaluation.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -30,7 +34,8 @@ class OperationEvalGradientBsplineNaive : public OperationEvalGradient {
     storage(storage),
     base(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    multiplePointEvaluation(storage, base) {
   }
 
   /**
@@ -60,6 +65,18 @@ class OperationEvalGradientBsplineNaive : public OperationEvalGradient {
                     DataVector& value,
                     DataMatrix& gradient) override;
 
+  /**
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (one point per row)
+   * @param[out]  values    values of the linear combination at the points
+   * @param[out]  gradients gradients of the linear combination at the points
+   *                        (each row is a gradient vector)
+   */
+  void evalGradientMultiple(const DataVector& alpha,
+                            const DataMatrix& points,
+                            DataVector& values,
+                            DataMatrix& gradients) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -69,6 +86,8 @@ class OperationEvalGradientBsplineNaive : public OperationEvalGradient {
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// algorithm for evaluating at multiple points
+  AlgorithmMultiplePointEvaluation<SBsplineBase> multiplePointEvaluation;
 };
 
 }  // namespace base
@@ -0,0 +1,245 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONEVALGRADIENTLOCALSUPPORT_HPP
+#define OPERATIONEVALGRADIENTLOCALSUPPORT_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
+#include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Operation for evaluating linear combinations of basis functions with local, overlapping
+ * supports (e.g., B-splines, wavelets or fundamental splines) and their gradients.
+ * Only the basis functions whose support contains the evaluation point are visited
+ * (see AlgorithmLocalSupportEvaluation).
+ */
+template <class BASIS>
+class OperationEvalGradientLocalSupport : public OperationEvalGradient {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage         storage of the sparse grid
+   * @param basis           one-dimensional basis
+   * @param supportRadius   radius of the support of the interior basis functions
+   *                        in multiples of the mesh width
+   * @param clenshawCurtis  whether the grid points are Clenshaw-Curtis points
+   */
+  OperationEvalGradientLocalSupport(GridStorage& storage, const BASIS& basis,
+                                    double supportRadius, bool clenshawCurtis = false)
+      : storage(storage),
+        base(basis),
+        algorithm(storage, base, supportRadius, clenshawCurtis),
+        pointInUnitCube(storage.getDimension()),
+        innerDerivative(storage.getDimension()) {}
+
+  /**
+   * Destructor.
+   */
+  ~OperationEvalGradientLocalSupport() override {}
+
+  /**
+   * @param       alpha     coefficient vector
+   * @param       point     evaluation point
+   * @param[out]  gradient  gradient of linear combination
+   * @return                value of linear combination
+   */
+  double evalGradient(const DataVector& alpha, const DataVector& point,
+                      DataVector& gradient) override {
+    const size_t d = storage.getDimension();
+    double result = 0.0;
+
+    prepareEvaluation(point);
+
+    gradient.resize(d);
+    gradient.setAll(0.0);
+
+    DataVector curGradient(d);
+
+    for (size_t k = 0; k < sequenceNumbers.size(); k++) {
+      const double curValue = evalBasisFunction(&factors[2 * k * d], curGradient);
+      const double curAlpha = alpha[sequenceNumbers[k]];
+
+      result += curAlpha * curValue;
+
+      for (size_t t = 0; t < d; t++) {
+        gradient[t] += curAlpha * curGradient[t];
+      }
+    }
+
+    return result;
+  }
+
+  /**
+   * @param       alpha     coefficient matrix (each column is a coefficient vector)
+   * @param       point     evaluation point
+   * @param[out]  value     values of linear combination
+   * @param[out]  gradient  Jacobian of linear combination (each row is a gradient vector)
+   */
+  void evalGradient(const DataMatrix& alpha, const DataVector& point, DataVector& value,
+                    DataMatrix& gradient) override {
+    const size_t d = storage.getDimension();
+    const size_t m = alpha.getNcols();
+
+    prepareEvaluation(point);
+
+    value.resize(m);
+    value.setAll(0.0);
+
+    gradient.resize(m, d);
+    gradient.setAll(0.0);
+
+    DataVector curGradient(d);
+
+    for (size_t k = 0; k < sequenceNumbers.size(); k++) {
+      const double curValue = evalBasisFunction(&factors[2 * k * d], curGradient);
+
+      for (size_t j = 0; j < m; j++) {
+        const double curAlpha = alpha(sequenceNumbers[k], j);
+        value[j] += curAlpha * curValue;
+
+        for (size_t t = 0; t < d; t++) {
+          gradient(j, t) += curAlpha * curGradient[t];
+        }
+      }
+    }
+  }
+
+  /**
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (one point per row)
+   * @param[out]  values    values of the linear combination at the points
+   * @param[out]  gradients gradients of the linear combination at the points
+   *                        (each row is a gradient vector)
+   */
+  void evalGradientMultiple(const DataVector& alpha, const DataMatrix& points,
+                            DataVector& values, DataMatrix& gradients) override {
+    const size_t d = storage.getDimension();
+    const size_t numberOfPoints = points.getNrows();
+
+    values.resize(numberOfPoints);
+    gradients.resize(numberOfPoints, d);
+    prepareInnerDerivative();
+    // build the cache only once, the threads copy it
+    algorithm.prepareIfNecessary();
+
+#pragma omp parallel
+    {
+      // the bases are not required to be thread-safe
+      BASIS threadBasis(base);
+      AlgorithmLocalSupportEvaluation<BASIS> threadAlgorithm(algorithm, threadBasis);
+      DataVector point(d);
+      DataVector curGradient(d);
+      std::vector<size_t> threadSequenceNumbers;
+      std::vector<double> threadFactors;
+
+#pragma omp for schedule(dynamic, 16)
+      for (size_t j = 0; j < numberOfPoints; j++) {
+        points.getRow(j, point);
+        storage.getBoundingBox()->transformPointToUnitCube(point);
+        threadAlgorithm.getAffectedBasisFunctions(point, 1, threadSequenceNumbers,
+                                                  threadFactors);
+
+        double result = 0.0;
+        double* gradient = gradients.getPointer() + j * d;
+        std::fill(gradient, gradient + d, 0.0);
+
+        for (size_t k = 0; k < threadSequenceNumbers.size(); k++) {
+          const double curValue = evalBasisFunction(&threadFactors[2 * k * d], curGradient);
+          const double curAlpha = alpha[threadSequenceNumbers[k]];
+
+          result += curAlpha * curValue;
+
+          for (size_t t = 0; t < d; t++) {
+            gradient[t] += curAlpha * curGradient[t];
+          }
+        }
+
+        values[j] = result;
+      }
+    }
+  }
+
+ protected:
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// 1D basis
+  BASIS base;
+  /// algorithm for determining the affected basis functions
+  AlgorithmLocalSupportEvaluation<BASIS> algorithm;
+  /// untransformed evaluation point (temporary vector)
+  DataVector pointInUnitCube;
+  /// inner derivative (temporary vector)
+  DataVector innerDerivative;
+  /// sequence numbers of the affected basis functions (temporary vector)
+  std::vector<size_t> sequenceNumbers;
+  /// 1D factors of the affected basis functions (temporary vector)
+  std::vector<double> factors;
+
+  /**
+   * Computes the inner derivatives of the transformation from the bounding box
+   * to the unit cube.
+   */
+  void prepareInnerDerivative() {
+    const size_t d = storage.getDimension();
+
+    for (size_t t = 0; t < d; t++) {
+      innerDerivative[t] = 1.0 / storage.getBoundingBox()->getIntervalWidth(t);
+    }
+  }
+
+  /**
+   * Transforms the evaluation point to the unit cube and determines the affected
+   * basis functions.
+   *
+   * @param point evaluation point
+   */
+  void prepareEvaluation(const DataVector& point) {
+    pointInUnitCube = point;
+    storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
+    prepareInnerDerivative();
+    algorithm.getAffectedBasisFunctions(pointInUnitCube, 1, sequenceNumbers, factors);
+  }
+
+  /**
+   * @param       curFactors  1D factors of the basis function and their derivatives
+   * @param[out]  gradient    gradient of the basis function
+   * @return                  value of the basis function
+   */
+  double evalBasisFunction(const double* curFactors, DataVector& gradient) {
+    const size_t d = storage.getDimension();
+    double curValue = 1.0;
+
+    gradient.setAll(1.0);
+
+    for (size_t t = 0; t < d; t++) {
+      const double val1d = curFactors[2 * t];
+      const double dx1d = curFactors[2 * t + 1] * innerDerivative[t];
+
+      curValue *= val1d;
+
+      for (size_t t2 = 0; t2 < d; t2++) {
+        gradient[t2] *= ((t2 == t) ? dx1d : val1d);
+      }
+    }
+
+    return curValue;
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONEVALGRADIENTLOCALSUPPORT_HPP */
@@ -6,6 +6,8 @@
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradientModBsplineNaive.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -110,5 +112,13 @@ void OperationEvalGradientModBsplineNaive::evalGradient(const DataMatrix& alpha,
   }
 }
 
+void OperationEvalGradientModBsplineNaive::evalGradientMultiple(const DataVector& alpha,
+                                                                const DataMatrix& points,
+                                                                DataVector& values,
+                                                                DataMatrix& gradients) {
+  std::vector<DataMatrix> hessians;
+  multiplePointEvaluation.eval(alpha, points, 1, values, gradients, hessians);
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -7,10 +7,14 @@
 #define OPERATIONEVALGRADIENTMODBSPLINE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/AlgorithmMultiplePointEvaluation.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineModifiedBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -31,7 +35,8 @@ class OperationEvalGradientModBsplineNaive : public OperationEvalGradient {
     storage(storage),
     base(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    multiplePointEvaluation(storage, base) {
   }
 
   /**
@@ -61,6 +66,18 @@ class OperationEvalGradientModBsplineNaive : public OperationEvalGradient {
                     DataVector& value,
                     DataMatrix& gradient) override;
 
+  /**
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (one point per row)
+   * @param[out]  values    values of the linear combination at the points
+   * @param[out]  gradients gradients of the linear combination at the points
+   *                        (each row is a gradient vector)
+   */
+  void evalGradientMultiple(const DataVector& alpha,
+                            const DataMatrix& points,
+                            DataVector& values,
+                            DataMatrix& gradients) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -70,6 +87,8 @@ class OperationEvalGradientModBsplineNaive : public OperationEvalGradient {
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// algorithm for evaluating at multiple points
+  AlgorithmMultiplePointEvaluation<SBsplineModifiedBase> multiplePointEvaluation;
 };
 
 }  // namespace base
@@ -77,6 +77,39 @@ class OperationEvalHessian {
       gradient.setRow(j, curGradient);
     }
   }
+
+  /**
+   * Evaluates the linear combination, its gradient and its Hessian at multiple points.
+   * Implementations may evaluate the points in parallel.
+   *
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (one point per row)
+   * @param[out]  values    values of the linear combination at the points
+   * @param[out]  gradients gradients of the linear combination at the points
+   *                        (each row is a gradient vector)
+   * @param[out]  hessians  Hessians of the linear combination at the points
+   */
+  virtual void evalHessianMultiple(const DataVector& alpha,
+                                   const DataMatrix& points,
+                                   DataVector& values,
+                                   DataMatrix& gradients,
+                                   std::vector<DataMatrix>& hessians) {
+    const size_t numberOfPoints = points.getNrows();
+    const size_t d = points.getNcols();
+    DataVector point(d);
+    DataVector curGradient(d);
+
+    values.resize(numberOfPoints);
+    gradients.resize(numberOfPoints, d);
+    hessians.resize(numberOfPoints);
+
+    for (size_t p = 0; p < numberOfPoints; p++) {
+      points.getRow(p, point);
+      hessians[p].resize(d, d);
+      values[p] = evalHessian(alpha, point, curGradient, hessians[p]);
+      gradients.setRow(p, curGradient);
+    }
+  }
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
 };
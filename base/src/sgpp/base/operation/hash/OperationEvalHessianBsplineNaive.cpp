@@ -171,5 +171,13 @@ void OperationEvalHessianBsplineNaive::evalHessian(const DataMatrix& alpha,
   }
 }
 
+void OperationEvalHessianBsplineNaive::evalHessianMultiple(const DataVector& alpha,
+                                                           const DataMatrix& points,
+                                                           DataVector& values,
+                                                           DataMatrix& gradients,
+                                                           std::vector<DataMatrix>& hessians) {
+  multiplePointEvaluation.eval(alpha, points, 2, values, gradients, hessians);
+}
+
 }  // namespace base
 }  // namespace sgpp
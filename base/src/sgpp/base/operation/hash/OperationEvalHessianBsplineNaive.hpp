@@ -7,6 +7,7 @@
 #define OPERATIONEVALHESSIANBSPLINE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/AlgorithmMultiplePointEvaluation.hpp>
 #include <sgpp/base/operation/hash/OperationEvalHessian.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
@@ -34,7 +35,8 @@ class OperationEvalHessianBsplineNaive : public OperationEvalHessian {
     storage(storage),
     base(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    multiplePointEvaluation(storage, base) {
   }
 
   /**
@@ -68,6 +70,20 @@ class OperationEvalHessianBsplineNaive : public OperationEvalHessian {
                    DataMatrix& gradient,
                    std::vector<DataMatrix>& hessian) override;
 
+  /**
+   * @param       alpha     coefficient vector
+   * @param       points    evaluation points (one point per row)
+   * @param[out]  values    values of the linear combination at the points
+   * @param[out]  gradients gradients of the linear combination at the points
+   *                        (each row is a gradient vector)
+   * @param[out]  hessians  Hessians of the linear combination at the points
+   */
+  void evalHessianMultiple(const DataVector& alpha,
+                           const DataMatrix& points,
+                           DataVector& values,
+                           DataMatrix& gradients,
+                           std::vector<DataMatrix>& hessians) override;
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -77,6 +93,8 @@ class OperationEvalHessianBsplineNaive : public OperationEvalHessian {
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// algorithm for evaluating at multiple points
+  AlgorithmMultiplePointEvaluation<SBsplineBase> multiplePointEvaluation;
 };
 
 }  // namespace base
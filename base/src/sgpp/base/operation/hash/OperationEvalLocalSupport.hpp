@@ -0,0 +1,174 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONEVALLOCALSUPPORT_HPP
+#define OPERATIONEVALLOCALSUPPORT_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Operation for evaluating linear combinations of basis functions with local, overlapping
+ * supports (e.g., B-splines, wavelets or fundamental splines). In contrast to the naive
+ * operations, only the basis functions whose support contains the evaluation point
+ * are visited (see AlgorithmLocalSupportEvaluation).
+ */
+template <class BASIS>
+class OperationEvalLocalSupport : public OperationEval {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage         storage of the sparse grid
+   * @param basis           one-dimensional basis
+   * @param supportRadius   radius of the support of the interior basis functions
+   *                        in multiples of the mesh width
+   * @param clenshawCurtis  whether the grid points are Clenshaw-Curtis points
+   */
+  OperationEvalLocalSupport(GridStorage& storage, const BASIS& basis, double supportRadius,
+                            bool clenshawCurtis = false)
+      : storage(storage),
+        base(basis),
+        algorithm(storage, base, supportRadius, clenshawCurtis),
+        pointInUnitCube(storage.getDimension()) {}
+
+  /**
+   * Destructor.
+   */
+  ~OperationEvalLocalSupport() override {}
+
+  /**
+   * @param alpha     coefficient vector
+   * @param point     evaluation point
+   * @return          value of the linear combination
+   */
+  double eval(const DataVector& alpha, const DataVector& point) override {
+    const size_t d = storage.getDimension();
+    double result = 0.0;
+
+    pointInUnitCube = point;
+    storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
+    algorithm.getAffectedBasisFunctions(pointInUnitCube, 0, sequenceNumbers, factors);
+
+    for (size_t k = 0; k < sequenceNumbers.size(); k++) {
+      const double* curFactors = &factors[k * d];
+      double curValue = 1.0;
+
+      for (size_t t = 0; t < d; t++) {
+        curValue *= curFactors[t];
+      }
+
+      result += alpha[sequenceNumbers[k]] * curValue;
+    }
+
+    return result;
+  }
+
+  /**
+   * @param      alpha  coefficient matrix (each column is a coefficient vector)
+   * @param      point  evaluation point
+   * @param[out] value  values of linear combination
+   */
+  void eval(const DataMatrix& alpha, const DataVector& point, DataVector& value) override {
+    const size_t d = storage.getDimension();
+    const size_t m = alpha.getNcols();
+
+    pointInUnitCube = point;
+    storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
+    algorithm.getAffectedBasisFunctions(pointInUnitCube, 0, sequenceNumbers, factors);
+
+    value.resize(m);
+    value.setAll(0.0);
+
+    for (size_t k = 0; k < sequenceNumbers.size(); k++) {
+      const double* curFactors = &factors[k * d];
+      double curValue = 1.0;
+
+      for (size_t t = 0; t < d; t++) {
+        curValue *= curFactors[t];
+      }
+
+      for (size_t j = 0; j < m; j++) {
+        value[j] += alpha(sequenceNumbers[k], j) * curValue;
+      }
+    }
+  }
+
+  /**
+   * @param      alpha  coefficient vector
+   * @param      points evaluation points (one point per row)
+   * @param[out] values values of the linear combination at the points
+   */
+  void evalMultiple(const DataVector& alpha, const DataMatrix& points,
+                    DataVector& values) override {
+    const size_t d = storage.getDimension();
+    const size_t numberOfPoints = points.getNrows();
+
+    values.resize(numberOfPoints);
+    // build the cache only once, the threads copy it
+    algorithm.prepareIfNecessary();
+
+#pragma omp parallel
+    {
+      // the bases are not required to be thread-safe
+      BASIS threadBasis(base);
+      AlgorithmLocalSupportEvaluation<BASIS> threadAlgorithm(algorithm, threadBasis);
+      DataVector point(d);
+      std::vector<size_t> threadSequenceNumbers;
+      std::vector<double> threadFactors;
+
+#pragma omp for schedule(dynamic, 16)
+      for (size_t j = 0; j < numberOfPoints; j++) {
+        points.getRow(j, point);
+        storage.getBoundingBox()->transformPointToUnitCube(point);
+        threadAlgorithm.getAffectedBasisFunctions(point, 0, threadSequenceNumbers,
+                                                  threadFactors);
+
+        double result = 0.0;
+
+        for (size_t k = 0; k < threadSequenceNumbers.size(); k++) {
+          const double* curFactors = &threadFactors[k * d];
+          double curValue = 1.0;
+
+          for (size_t t = 0; t < d; t++) {
+            curValue *= curFactors[t];
+          }
+
+          result += alpha[threadSequenceNumbers[k]] * curValue;
+        }
+
+        values[j] = result;
+      }
+    }
+  }
+
+ protected:
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// 1D basis
+  BASIS base;
+  /// algorithm for determining the affected basis functions
+  AlgorithmLocalSupportEvaluation<BASIS> algorithm;
+  /// untransformed evaluation point (temporary vector)
+  DataVector pointInUnitCube;
+  /// sequence numbers of the affected basis functions (temporary vector)
+  std::vector<size_t> sequenceNumbers;
+  /// 1D factors of the affected basis functions (temporary vector)
+  std::vector<double> factors;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONEVALLOCALSUPPORT_HPP */
@@ -6,6 +6,8 @@
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/OperationEvalModBsplineNaive.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -73,5 +75,12 @@ void OperationEvalModBsplineNaive::eval(const DataMatrix& alpha,
   }
 }
 
+void OperationEvalModBsplineNaive::evalMultiple(const DataVector& alpha, const DataMatrix& points,
+                                                DataVector& values) {
+  DataMatrix gradients;
+  std::vector<DataMatrix> hessians;
+  multiplePointEvaluation.eval(alpha, points, 0, values, gradients, hessians);
+}
+
 }  // namespace base
 }  // namespace sgpp
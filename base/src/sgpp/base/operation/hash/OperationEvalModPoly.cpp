@@ -35,5 +35,37 @@ double OperationEvalModPoly::eval(const DataVector& alpha,
   return result;
 }
 
+void OperationEvalModPoly::evalMultiple(const DataVector& alpha, const DataMatrix& points,
+                                        DataVector& values) {
+  typedef std::vector<std::pair<size_t, double> > IndexValVector;
+
+  const size_t numberOfPoints = points.getNrows();
+  values.resize(numberOfPoints);
+
+#pragma omp parallel
+  {
+    // the basis is not required to be thread-safe
+    SPolyModifiedBase threadBase(base);
+    GetAffectedBasisFunctions<SPolyModifiedBase> ga(storage);
+    IndexValVector vec;
+    DataVector point(points.getNcols());
+
+#pragma omp for schedule(static)
+    for (size_t p = 0; p < numberOfPoints; p++) {
+      points.getRow(p, point);
+      vec.clear();
+      ga(threadBase, point, vec);
+
+      double result = 0.0;
+
+      for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
+        result += iter->second * alpha[iter->first];
+      }
+
+      values[p] = result;
+    }
+  }
+}
+
 }  // namespace base
 }  // namespace sgpp
@@ -0,0 +1,168 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONEVALPARTIALDERIVATIVELOCALSUPPORT_HPP
+#define OPERATIONEVALPARTIALDERIVATIVELOCALSUPPORT_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
+#include <sgpp/base/operation/hash/OperationEvalPartialDerivative.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Operation for evaluating partial derivatives of linear combinations of basis functions
+ * with local, overlapping supports (e.g., B-splines, wavelets or fundamental splines).
+ * Only the basis functions whose support contains the evaluation point are visited
+ * (see AlgorithmLocalSupportEvaluation).
+ */
+template <class BASIS>
+class OperationEvalPartialDerivativeLocalSupport : public OperationEvalPartialDerivative {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage         storage of the sparse grid
+   * @param basis           one-dimensional basis
+   * @param supportRadius   radius of the support of the interior basis functions
+   *                        in multiples of the mesh width
+   * @param clenshawCurtis  whether the grid points are Clenshaw-Curtis points
+   */
+  OperationEvalPartialDerivativeLocalSupport(GridStorage& storage, const BASIS& basis,
+                                             double supportRadius, bool clenshawCurtis = false)
+      : storage(storage),
+        base(basis),
+        algorithm(storage, base, supportRadius, clenshawCurtis),
+        pointInUnitCube(storage.getDimension()) {}
+
+  /**
+   * Destructor.
+   */
+  ~OperationEvalPartialDerivativeLocalSupport() override {}
+
+  /**
+   * @param       alpha               coefficient vector
+   * @param       point               evaluation point
+   * @param       derivDim            dimension in which the partial derivative should be taken
+   * @param[out]  partialDerivative   value of the partial derivative of the linear combination
+   * @return                          value of the linear combination
+   */
+  double evalPartialDerivative(const DataVector& alpha, const DataVector& point,
+                               size_t derivDim, double& partialDerivative) override {
+    double result = 0.0;
+    const double innerDerivative = prepareEvaluation(point, derivDim);
+
+    partialDerivative = 0.0;
+
+    for (size_t k = 0; k < sequenceNumbers.size(); k++) {
+      double curPartialDerivative;
+      const double curValue =
+          evalBasisFunction(k, derivDim, innerDerivative, curPartialDerivative);
+      const double curAlpha = alpha[sequenceNumbers[k]];
+
+      result += curAlpha * curValue;
+      partialDerivative += curAlpha * curPartialDerivative;
+    }
+
+    return result;
+  }
+
+  /**
+   * @param       alpha               coefficient matrix (each column is a coefficient vector)
+   * @param       point               evaluation point
+   * @param       derivDim            dimension in which the partial derivative should be taken
+   * @param[out]  value               values of the linear combination
+   * @param[out]  partialDerivative   values of the partial derivatives of the linear combination
+   *                                  (the j-th entry corresponds to the j-th column of alpha)
+   */
+  void evalPartialDerivative(const DataMatrix& alpha, const DataVector& point, size_t derivDim,
+                             DataVector& value, DataVector& partialDerivative) override {
+    const size_t m = alpha.getNcols();
+    const double innerDerivative = prepareEvaluation(point, derivDim);
+
+    value.resize(m);
+    value.setAll(0.0);
+    partialDerivative.resize(m);
+    partialDerivative.setAll(0.0);
+
+    for (size_t k = 0; k < sequenceNumbers.size(); k++) {
+      double curPartialDerivative;
+      const double curValue =
+          evalBasisFunction(k, derivDim, innerDerivative, curPartialDerivative);
+
+      for (size_t j = 0; j < m; j++) {
+        const double curAlpha = alpha(sequenceNumbers[k], j);
+        value[j] += curAlpha * curValue;
+        partialDerivative[j] += curAlpha * curPartialDerivative;
+      }
+    }
+  }
+
+ protected:
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// 1D basis
+  BASIS base;
+  /// algorithm for determining the affected basis functions
+  AlgorithmLocalSupportEvaluation<BASIS> algorithm;
+  /// untransformed evaluation point (temporary vector)
+  DataVector pointInUnitCube;
+  /// sequence numbers of the affected basis functions (temporary vector)
+  std::vector<size_t> sequenceNumbers;
+  /// 1D factors of the affected basis functions (temporary vector)
+  std::vector<double> factors;
+
+  /**
+   * Transforms the evaluation point to the unit cube and determines the affected
+   * basis functions.
+   *
+   * @param point     evaluation point
+   * @param derivDim  dimension in which the partial derivative should be taken
+   * @return          inner derivative in dimension derivDim
+   */
+  double prepareEvaluation(const DataVector& point, size_t derivDim) {
+    pointInUnitCube = point;
+    storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
+    algorithm.getAffectedBasisFunctions(pointInUnitCube, 1, sequenceNumbers, factors);
+    return 1.0 / storage.getBoundingBox()->getIntervalWidth(derivDim);
+  }
+
+  /**
+   * @param       k                   number of the affected basis function
+   * @param       derivDim            dimension in which the partial derivative should be taken
+   * @param       innerDerivative     inner derivative in dimension derivDim
+   * @param[out]  partialDerivative   partial derivative of the basis function
+   * @return                          value of the basis function
+   */
+  double evalBasisFunction(size_t k, size_t derivDim, double innerDerivative,
+                           double& partialDerivative) {
+    const size_t d = storage.getDimension();
+    const double* curFactors = &factors[2 * k * d];
+    double curValue = 1.0;
+
+    partialDerivative = 1.0;
+
+    for (size_t t = 0; t < d; t++) {
+      const double val1d = curFactors[2 * t];
+
+      curValue *= val1d;
+      partialDerivative *=
+          ((t == derivDim) ? curFactors[2 * t + 1] * innerDerivative : val1d);
+    }
+
+    return curValue;
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONEVALPARTIALDERIVATIVELOCALSUPPORT_HPP */
@@ -40,6 +40,16 @@ class OperationEvalPoly : public OperationEval {
   double eval(const DataVector& alpha,
                const DataVector& point) override;
 
+  /**
+   * Evaluates the sparse grid function at multiple points in parallel.
+   *
+   * @param      alpha  coefficient vector
+   * @param      points evaluation points (one point per row)
+   * @param[out] values values of the linear combination at the points
+   */
+  void evalMultiple(const DataVector& alpha, const DataMatrix& points,
+                    DataVector& values) override;
+
  protected:
   /// Pointer to GridStorage object
   GridStorage& storage;
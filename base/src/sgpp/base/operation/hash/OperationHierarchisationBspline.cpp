@@ -0,0 +1,25 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/operation/hash/OperationHierarchisationBspline.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+
+namespace sgpp {
+namespace base {
+
+void OperationHierarchisationBspline::doHierarchisation(
+  DataVector& node_values) {
+  algorithm.hierarchise(node_values);
+}
+
+void OperationHierarchisationBspline::doDehierarchisation(
+  DataVector& alpha) {
+  algorithm.dehierarchise(alpha);
+}
+
+}  // namespace base
+}  // namespace sgpp
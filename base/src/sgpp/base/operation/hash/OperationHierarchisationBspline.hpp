@@ -0,0 +1,71 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONHIERARCHISATIONBSPLINE_HPP
+#define OPERATIONHIERARCHISATIONBSPLINE_HPP
+
+#include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+#include <sgpp/base/algorithm/AlgorithmUnidirectionalHierarchisation.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+
+#include <sgpp/globaldef.hpp>
+
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Hierarchisation on sparse grid, bspline case
+ * (see AlgorithmUnidirectionalHierarchisation)
+ */
+class OperationHierarchisationBspline : public OperationHierarchisation {
+ public:
+  /**
+   * Constructor
+   *
+   * @param storage the grid's GridStorage object
+   * @param degree the bspline's degree
+   */
+  explicit OperationHierarchisationBspline(
+    GridStorage& storage, size_t degree) : storage(storage), base(degree),
+    algorithm(storage, base, static_cast<double>(base.getDegree() + 1) / 2.0) {}
+
+  /**
+   * Destructor
+   */
+  ~OperationHierarchisationBspline() override {}
+
+  /**
+   * Implements the hierarchisation on a sparse grid with bspline base functions
+   *
+   * @param node_values the functions values in the node base
+   *
+   */
+  void doHierarchisation(DataVector& node_values) override;
+
+  /**
+   * Implements the dehierarchisation on a sparse grid with bspline base functions
+   *
+   * @param alpha the coefficients of the sparse grid's base functions
+   *
+   */
+  void doDehierarchisation(DataVector& alpha) override;
+
+ protected:
+  /// Pointer to GridStorage object
+  GridStorage& storage;
+  /// Bspline Basis object
+  SBsplineBase base;
+  /// hierarchisation algorithm
+  AlgorithmUnidirectionalHierarchisation<SBsplineBase> algorithm;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONHIERARCHISATIONBSPLINE_HPP */
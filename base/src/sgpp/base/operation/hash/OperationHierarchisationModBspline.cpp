@@ -5,8 +5,6 @@
 
 #include <sgpp/base/operation/hash/OperationHierarchisationModBspline.hpp>
 
-#include <sgpp/base/exception/operation_exception.hpp>
-
 #include <sgpp/globaldef.hpp>
 
 
@@ -15,14 +13,12 @@ namespace base {
 
 void OperationHierarchisationModBspline::doHierarchisation(
   DataVector& node_values) {
-  throw operation_exception(
-    "This operation is not implemented, yet! Sorry ;-)");
+  algorithm.hierarchise(node_values);
 }
 
 void OperationHierarchisationModBspline::doDehierarchisation(
   DataVector& alpha) {
-  throw operation_exception(
-    "This operation is not implemented, yet! Sorry ;-)");
+  algorithm.dehierarchise(alpha);
 }
 
 }  // namespace base
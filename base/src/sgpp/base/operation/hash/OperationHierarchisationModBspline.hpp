@@ -7,6 +7,7 @@
 #define OPERATIONHIERARCHISATIONMODBSPLINE_HPP
 
 #include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+#include <sgpp/base/algorithm/AlgorithmUnidirectionalHierarchisation.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineModifiedBasis.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
@@ -20,7 +21,7 @@ namespace base {
 
 /**
  * Hierarchisation on sparse grid, mod bspline case
- *
+ * (see AlgorithmUnidirectionalHierarchisation)
  */
 class OperationHierarchisationModBspline : public OperationHierarchisation {
  public:
@@ -28,10 +29,11 @@ class OperationHierarchisationModBspline : public OperationHierarchisation {
    * Constructor
    *
    * @param storage the grid's GridStorage object
-   * @param degree the bsplinenom's max. degree
+   * @param degree the bspline's degree
    */
   explicit OperationHierarchisationModBspline(
-    GridStorage& storage, size_t degree) : storage(storage), base(degree) {}
+    GridStorage& storage, size_t degree) : storage(storage), base(degree),
+    algorithm(storage, base, static_cast<double>(base.getDegree() + 1) / 2.0) {}
 
   /**
    * Destructor
@@ -39,7 +41,7 @@ class OperationHierarchisationModBspline : public OperationHierarchisation {
   ~OperationHierarchisationModBspline() override {}
 
   /**
-   * Implements the hierarchisation on a sprase grid with mod bspline base functions
+   * Implements the hierarchisation on a sparse grid with mod bspline base functions
    *
    * @param node_values the functions values in the node base
    *
@@ -47,7 +49,7 @@ class OperationHierarchisationModBspline : public OperationHierarchisation {
   void doHierarchisation(DataVector& node_values) override;
 
   /**
-   * Implements the dehierarchisation on a sprase grid with mod bspline base functions
+   * Implements the dehierarchisation on a sparse grid with mod bspline base functions
    *
    * @param alpha the coefficients of the sparse grid's base functions
    *
@@ -59,6 +61,8 @@ class OperationHierarchisationModBspline : public OperationHierarchisation {
   GridStorage& storage;
   /// Mod Bspline Basis object
   SBsplineModifiedBase base;
+  /// hierarchisation algorithm
+  AlgorithmUnidirectionalHierarchisation<SBsplineModifiedBase> algorithm;
 };
 
 }  // namespace base
@@ -0,0 +1,71 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONHIERARCHISATIONNAKBSPLINEBOUNDARYCOMBIGRID_HPP
+#define OPERATIONHIERARCHISATIONNAKBSPLINEBOUNDARYCOMBIGRID_HPP
+
+#include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+#include <sgpp/base/algorithm/AlgorithmUnidirectionalHierarchisation.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/common/basis/NakBsplineBoundaryCombigridBasis.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+
+#include <sgpp/globaldef.hpp>
+
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Hierarchisation on sparse grid, not-a-knot bspline boundary case
+ * (see AlgorithmUnidirectionalHierarchisation)
+ */
+class OperationHierarchisationNakBsplineBoundaryCombigrid : public OperationHierarchisation {
+ public:
+  /**
+   * Constructor
+   *
+   * @param storage the grid's GridStorage object
+   * @param degree the bspline's degree
+   */
+  explicit OperationHierarchisationNakBsplineBoundaryCombigrid(
+    GridStorage& storage, size_t degree) : storage(storage), base(degree),
+    algorithm(storage, base, static_cast<double>(base.getDegree())) {}
+
+  /**
+   * Destructor
+   */
+  ~OperationHierarchisationNakBsplineBoundaryCombigrid() override {}
+
+  /**
+   * Implements the hierarchisation on a sparse grid with not-a-knot bspline boundary base functions
+   *
+   * @param node_values the functions values in the node base
+   *
+   */
+  void doHierarchisation(DataVector& node_values) override;
+
+  /**
+   * Implements the dehierarchisation on a sparse grid with not-a-knot bspline boundary base functions
+   *
+   * @param alpha the coefficients of the sparse grid's base functions
+   *
+   */
+  void doDehierarchisation(DataVector& alpha) override;
+
+ protected:
+  /// Pointer to GridStorage object
+  GridStorage& storage;
+  /// Not-a-knot Bspline Boundary Basis object
+  SNakBsplineBoundaryCombigridBase base;
+  /// hierarchisation algorithm
+  AlgorithmUnidirectionalHierarchisation<SNakBsplineBoundaryCombigridBase> algorithm;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONHIERARCHISATIONNAKBSPLINEBOUNDARYCOMBIGRID_HPP */
@@ -35,6 +35,10 @@ class OperationIdentity: public OperationMatrix {
   void mult(DataVector& alpha, DataVector& result) override {
     result = alpha;
   }
+
+  void getDiagonal(DataVector& diagonal) override {
+    diagonal.setAll(1.0);
+  }
 };
 
 }  // namespace base
@@ -6,7 +6,9 @@
 #ifndef OPERATIONMATRIX_HPP
 #define OPERATIONMATRIX_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -38,6 +40,39 @@ class OperationMatrix {
    * @param result DataVector into which the result of the Laplace operation is stored
    */
   virtual void mult(DataVector& alpha, DataVector& result) = 0;
+
+  /**
+   * Multiplication with multiple vectors at once (e.g., for solving systems with
+   * multiple right-hand sides). The default implementation calls mult() for every column.
+   *
+   * @param alpha DataMatrix whose columns are the vectors to be multiplied
+   * @param result DataMatrix into which the results are stored (one column per vector)
+   */
+  virtual void multBlock(DataMatrix& alpha, DataMatrix& result) {
+    const size_t numVectors = alpha.getNcols();
+    DataVector alphaColumn(alpha.getNrows());
+    DataVector resultColumn(alpha.getNrows());
+    result.resizeRowsCols(alpha.getNrows(), numVectors);
+
+    for (size_t j = 0; j < numVectors; j++) {
+      alpha.getColumn(j, alphaColumn);
+      mult(alphaColumn, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
+
+  /**
+   * Computes the diagonal of the matrix (e.g., for Jacobi preconditioning).
+   * The default implementation throws an operation_exception, as the diagonal of a
+   * matrix-free operator is in general only available by multiplying it with all unit vectors.
+   *
+   * @param[in,out] diagonal DataVector with one entry per row of the matrix,
+   *                         into which the diagonal is stored
+   */
+  virtual void getDiagonal(DataVector& diagonal) {
+    throw operation_exception(
+        "OperationMatrix::getDiagonal: The diagonal is not available for this operation.");
+  }
 };
 
 }  // namespace base
@@ -0,0 +1,296 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+#include <sgpp/base/operation/hash/common/basis/Basis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+/**
+ * Whether the basis functions of the grid can be evaluated on their own (i.e. by level and
+ * index in the unit cube), this excludes stretched grids and prewavelets.
+ */
+bool hasPointwiseBasis(GridType type) {
+  return (type != GridType::LinearStretched) && (type != GridType::LinearStretchedBoundary) &&
+         (type != GridType::Prewavelet);
+}
+
+/**
+ * Whether the basis of the grid has no internal state, i.e. can be evaluated by multiple threads.
+ */
+bool hasThreadSafeBasis(GridType type) {
+  return (type == GridType::Linear) || (type == GridType::LinearL0Boundary) ||
+         (type == GridType::LinearBoundary) || (type == GridType::LinearTruncatedBoundary) ||
+         (type == GridType::ModLinear);
+}
+
+/**
+ * Returns the data points at which the basis functions have to be evaluated to match mult() and
+ * multTranspose() of the kernel (transformed to the unit cube or not, unitData is only used if the
+ * points have to be transformed), or nullptr if the treatment of the bounding box is unknown.
+ */
+const double* getEvaluationData(Grid& grid, DataMatrix& dataset,
+                                OperationMultipleEval::BoundingBoxTreatment treatment,
+                                DataMatrix& unitData) {
+  BoundingBox& boundingBox = grid.getBoundingBox();
+
+  if (!hasPointwiseBasis(grid.getType())) {
+    return nullptr;
+  } else if (boundingBox.isUnitCube() ||
+             (treatment == OperationMultipleEval::BoundingBoxTreatment::Ignored)) {
+    return dataset.getPointer();
+  } else if (treatment == OperationMultipleEval::BoundingBoxTreatment::Transformed) {
+    unitData = dataset;
+    boundingBox.transformPointsToUnitCube(unitData);
+    return unitData.getPointer();
+  } else {
+    return nullptr;
+  }
+}
+
+/**
+ * Adds factor * sum_k alpha[coefficients[k]] * phi_{points[k]}(x_j) to result[j]
+ * for all data points x_j.
+ */
+void addEvaluations(Grid& grid, const double* data, size_t numData, const DataVector& alpha,
+                    const std::vector<const HashGridPoint*>& points,
+                    const std::vector<size_t>& coefficients, double factor, DataVector& result) {
+  SBasis& basis = grid.getBasis();
+  const size_t dim = grid.getDimension();
+
+#pragma omp parallel for schedule(static) if (hasThreadSafeBasis(grid.getType()))
+  for (size_t j = 0; j < numData; j++) {
+    const double* x = data + j * dim;
+    double sum = 0.0;
+
+    for (size_t k = 0; k < points.size(); k++) {
+      const HashGridPoint& point = *points[k];
+      double value = alpha[coefficients[k]];
+
+      // most basis functions vanish in the first dimensions already
+      for (size_t t = 0; (t < dim) && (value != 0.0); t++) {
+        value *= basis.eval(point.getLevel(t), point.getIndex(t), x[t]);
+      }
+
+      sum += value;
+    }
+
+    result[j] += factor * sum;
+  }
+}
+
+}  // namespace
+
+void OperationMultipleEval::multBlock(DataMatrix& alpha, DataMatrix& result) {
+  const size_t numVectors = alpha.getNcols();
+  const size_t numData = dataset.getNrows();
+  const BoundingBoxTreatment treatment = getBoundingBoxTreatment();
+  result.resizeRowsCols(numData, numVectors);
+
+  DataMatrix unitData;
+  const double* data = ((treatment != BoundingBoxTreatment::Unknown) &&
+                        hasThreadSafeBasis(grid.getType()))
+                           ? getEvaluationData(grid, dataset, treatment, unitData)
+                           : nullptr;
+
+  if (data == nullptr) {
+    DataVector alphaColumn(alpha.getNrows());
+    DataVector resultColumn(numData);
+
+    for (size_t j = 0; j < numVectors; j++) {
+      alpha.getColumn(j, alphaColumn);
+      this->mult(alphaColumn, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+
+    return;
+  }
+
+  GridStorage& storage = grid.getStorage();
+  SBasis& basis = grid.getBasis();
+  const size_t dim = grid.getDimension();
+  const size_t numPoints = storage.getSize();
+  result.setAll(0.0);
+
+#pragma omp parallel for schedule(static)
+  for (size_t j = 0; j < numData; j++) {
+    const double* x = data + j * dim;
+    double* resultRow = result.getPointer() + j * numVectors;
+
+    for (size_t k = 0; k < numPoints; k++) {
+      const HashGridPoint& point = storage.getPoint(k);
+      double value = 1.0;
+
+      for (size_t t = 0; (t < dim) && (value != 0.0); t++) {
+        value *= basis.eval(point.getLevel(t), point.getIndex(t), x[t]);
+      }
+
+      if (value != 0.0) {
+        const double* alphaRow = alpha.getPointer() + k * numVectors;
+
+        for (size_t c = 0; c < numVectors; c++) {
+          resultRow[c] += value * alphaRow[c];
+        }
+      }
+    }
+  }
+}
+
+void OperationMultipleEval::multIncremental(DataVector& alpha, DataVector& result,
+                                            const std::vector<size_t>& gridPoints) {
+  if (gridPoints.empty()) {
+    return;
+  }
+
+  DataMatrix unitData;
+  const double* data = getEvaluationData(grid, dataset, getBoundingBoxTreatment(), unitData);
+
+  if (data == nullptr) {
+    DataVector changedAlpha(alpha.getSize(), 0.0);
+    DataVector update(result.getSize());
+
+    for (size_t k : gridPoints) {
+      changedAlpha[k] = alpha[k];
+    }
+
+    this->mult(changedAlpha, update);
+    result.add(update);
+    return;
+  }
+
+  GridStorage& storage = grid.getStorage();
+  std::vector<const HashGridPoint*> points;
+  points.reserve(gridPoints.size());
+
+  for (size_t k : gridPoints) {
+    points.push_back(&storage.getPoint(k));
+  }
+
+  addEvaluations(grid, data, dataset.getNrows(), alpha, points, gridPoints, 1.0, result);
+}
+
+void OperationMultipleEval::multRemoved(const DataVector& alpha, DataVector& result,
+                                        const std::vector<HashGridPoint>& removedPoints,
+                                        const std::vector<size_t>& removedSeq) {
+  if (removedPoints.size() != removedSeq.size()) {
+    throw operation_exception(
+        "OperationMultipleEval::multRemoved: Numbers of grid points and sequence numbers differ.");
+  } else if (removedPoints.empty()) {
+    return;
+  }
+
+  DataMatrix unitData;
+  const double* data = getEvaluationData(grid, dataset, getBoundingBoxTreatment(), unitData);
+
+  if (data == nullptr) {
+    throw operation_exception(
+        "OperationMultipleEval::multRemoved: Basis functions cannot be evaluated directly.");
+  }
+
+  std::vector<const HashGridPoint*> points;
+  points.reserve(removedPoints.size());
+
+  for (const HashGridPoint& point : removedPoints) {
+    points.push_back(&point);
+  }
+
+  addEvaluations(grid, data, dataset.getNrows(), alpha, points, removedSeq, -1.0, result);
+}
+
+void OperationMultipleEval::multTransposeIncremental(DataVector& source, DataVector& result,
+                                                     const std::vector<size_t>& gridPoints) {
+  if (gridPoints.empty()) {
+    return;
+  }
+
+  DataMatrix unitData;
+  const double* data = getEvaluationData(grid, dataset, getBoundingBoxTreatment(), unitData);
+
+  if (data == nullptr) {
+    DataVector completeResult(result.getSize());
+    this->multTranspose(source, completeResult);
+
+    for (size_t k : gridPoints) {
+      result[k] = completeResult[k];
+    }
+
+    return;
+  }
+
+  GridStorage& storage = grid.getStorage();
+  SBasis& basis = grid.getBasis();
+  const size_t numData = dataset.getNrows();
+  const size_t dim = dataset.getNcols();
+
+#pragma omp parallel for schedule(dynamic) if (hasThreadSafeBasis(grid.getType()))
+  for (size_t i = 0; i < gridPoints.size(); i++) {
+    const HashGridPoint& point = storage.getPoint(gridPoints[i]);
+    double sum = 0.0;
+
+    for (size_t j = 0; j < numData; j++) {
+      const double* x = data + j * dim;
+      double value = source[j];
+
+      for (size_t t = 0; (t < dim) && (value != 0.0); t++) {
+        value *= basis.eval(point.getLevel(t), point.getIndex(t), x[t]);
+      }
+
+      sum += value;
+    }
+
+    result[gridPoints[i]] = sum;
+  }
+}
+
+void OperationMultipleEval::getBBTDiagonal(DataVector& diagonal) {
+  DataMatrix unitData;
+  const double* data = getEvaluationData(grid, dataset, getBoundingBoxTreatment(), unitData);
+
+  if (data == nullptr) {
+    throw operation_exception(
+        "OperationMultipleEval::getBBTDiagonal: Basis functions cannot be evaluated directly.");
+  }
+
+  GridStorage& storage = grid.getStorage();
+  SBasis& basis = grid.getBasis();
+  const size_t gridSize = storage.getSize();
+  const size_t numData = dataset.getNrows();
+  const size_t dim = dataset.getNcols();
+
+  diagonal.resize(gridSize);
+
+#pragma omp parallel for schedule(dynamic) if (hasThreadSafeBasis(grid.getType()))
+  for (size_t k = 0; k < gridSize; k++) {
+    const HashGridPoint& point = storage.getPoint(k);
+    double sum = 0.0;
+
+    for (size_t j = 0; j < numData; j++) {
+      const double* x = data + j * dim;
+      double value = 1.0;
+
+      for (size_t t = 0; (t < dim) && (value != 0.0); t++) {
+        value *= basis.eval(point.getLevel(t), point.getIndex(t), x[t]);
+      }
+
+      sum += value * value;
+    }
+
+    diagonal[k] = sum;
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
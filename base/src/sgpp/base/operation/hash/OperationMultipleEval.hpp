@@ -10,10 +10,12 @@
 #include <sgpp/base/exception/not_implemented_exception.hpp>
 #include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
 
 #include <sgpp/globaldef.hpp>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -25,6 +27,19 @@ namespace base {
  * points
  */
 class OperationMultipleEval {
+ public:
+  /**
+   * Treatment of the bounding box of the grid by mult() and multTranspose() of a kernel.
+   */
+  enum class BoundingBoxTreatment {
+    /// the data points are transformed from the bounding box to the unit cube
+    Transformed,
+    /// the data points are used as they are, i.e., the bounding box is ignored
+    Ignored,
+    /// unknown (or neither of both)
+    Unknown
+  };
+
  protected:
   Grid& grid;
   DataMatrix& dataset;
@@ -101,6 +116,116 @@ class OperationMultipleEval {
     throw sgpp::base::not_implemented_exception();
   }
 
+  /**
+   * Multiplication of @f$B^T@f$ with multiple vectors at once
+   *
+   * This default implementation evaluates the basis functions directly (see multIncremental) in
+   * parallel over the data points, every basis function is evaluated only once per data point for
+   * all vectors. This is only done for kernels that declare how they treat the bounding box and
+   * grids with a stateless basis, otherwise mult() is called for every column. Kernels that
+   * traverse the grid hierarchically override it to do so only once for all vectors.
+   *
+   * @param alpha matrix whose columns are the vectors to which @f$B@f$ is applied
+   *        (one row per grid point)
+   * @param result matrix whose columns are the results of the matrix vector multiplications
+   *        (one row per data point)
+   */
+  virtual void multBlock(DataMatrix& alpha, DataMatrix& result);
+
+  /**
+   * Multiplication of @f$B@f$ with multiple vectors at once
+   *
+   * This default implementation calls multTranspose() for every column. Implementations may
+   * override it to stream the dataset only once for all vectors.
+   *
+   * @param source matrix whose columns are the vectors to which @f$B^T@f$ is applied
+   *        (one row per data point)
+   * @param result matrix whose columns are the results of the matrix vector multiplications
+   *        (one row per grid point)
+   */
+  virtual void multTransposeBlock(DataMatrix& source, DataMatrix& result) {
+    const size_t numVectors = source.getNcols();
+    DataVector sourceColumn(source.getNrows());
+    DataVector resultColumn(grid.getSize());
+    result.resizeRowsCols(grid.getSize(), numVectors);
+
+    for (size_t j = 0; j < numVectors; j++) {
+      source.getColumn(j, sourceColumn);
+      this->multTranspose(sourceColumn, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
+
+  /**
+   * Incremental update of the result of mult() if the coefficients of only some grid points
+   * changed, e.g. after grid points were inserted by refinement: computes
+   * @f$result \mathrel{+}= \sum_{k \in gridPoints} \alpha_k \varphi_k(\vec{x}_j)@f$, i.e. only the
+   * columns of @f$B^T@f$ belonging to the given grid points are evaluated.
+   * After grid points were removed (e.g. by coarsening), use multRemoved().
+   *
+   * This default implementation evaluates the basis functions of the given grid points directly
+   * at the data points (treating the bounding box like mult(), see getBoundingBoxTreatment).
+   * If this is not possible (grids whose basis functions cannot be evaluated on their own or
+   * unknown treatment of a non-trivial bounding box), it falls back to mult() with all other
+   * coefficients set to zero.
+   *
+   * @param alpha coefficient vector (one entry per grid point, only the entries of gridPoints
+   *        are used)
+   * @param result result of mult() that is updated (one entry per data point)
+   * @param gridPoints sequence numbers of the grid points whose coefficients changed
+   */
+  virtual void multIncremental(DataVector& alpha, DataVector& result,
+                               const std::vector<size_t>& gridPoints);
+
+  /**
+   * Incremental update of the result of mult() after grid points were removed from the grid,
+   * e.g. by HashCoarsening::free_coarsen (see its parameters removedPoints and removedSeq):
+   * computes @f$result \mathrel{-}= \sum_k \alpha_{s_k} \varphi_{p_k}(\vec{x}_j)@f$ for the
+   * removed grid points @f$p_k@f$ with the old sequence numbers @f$s_k@f$.
+   *
+   * This default implementation evaluates the basis functions of the removed grid points directly
+   * (see multIncremental). If this is not possible, an operation_exception is thrown and mult()
+   * has to be called again.
+   *
+   * @param alpha coefficient vector before the removal (one entry per old grid point)
+   * @param result result of mult() that is updated (one entry per data point)
+   * @param removedPoints removed grid points
+   * @param removedSeq old sequence numbers of the removed grid points
+   */
+  virtual void multRemoved(const DataVector& alpha, DataVector& result,
+                           const std::vector<HashGridPoint>& removedPoints,
+                           const std::vector<size_t>& removedSeq);
+
+  /**
+   * Incremental update of the result of multTranspose() if grid points were inserted (e.g. by
+   * refinement): computes only the entries of @f$B source@f$ belonging to the given grid points,
+   * all other entries of result are left unchanged.
+   * Entries of removed grid points have to be removed by the caller, e.g. with the old sequence
+   * numbers removedSeq of HashCoarsening::free_coarsen and DataVector::remove (the remaining grid
+   * points keep their order, see HashGridStorage::deletePoints).
+   *
+   * This default implementation evaluates the basis functions of the given grid points directly
+   * (see multIncremental). If this is not possible, it falls back to multTranspose().
+   *
+   * @param source vector, to which @f$B@f$ is applied (one entry per data point)
+   * @param result result of multTranspose(), has to have one entry per grid point
+   * @param gridPoints sequence numbers of the grid points whose entries are computed
+   */
+  virtual void multTransposeIncremental(DataVector& source, DataVector& result,
+                                        const std::vector<size_t>& gridPoints);
+
+  /**
+   * Computes the diagonal of @f$B B^T@f$, i.e. @f$\sum_j \varphi_k(\vec{x}_j)^2@f$ for every grid
+   * point @f$k@f$ (e.g. for Jacobi preconditioning of least squares systems).
+   *
+   * This default implementation evaluates the basis functions directly (see multIncremental),
+   * which costs as much as one multTranspose() of a naive kernel. If this is not possible,
+   * an operation_exception is thrown.
+   *
+   * @param diagonal result (one entry per grid point)
+   */
+  virtual void getBBTDiagonal(DataVector& diagonal);
+
   /**
    * Evaluate multiple datapoints with the specified grid
    *
@@ -121,6 +246,15 @@ class OperationMultipleEval {
 
   virtual double getDuration() = 0;
 
+  /**
+   * Kernels should override this if they evaluate the basis functions at the data points like
+   * the default incremental updates (multIncremental etc.), otherwise these have to fall back to
+   * mult() and multTranspose() for grids with a non-trivial bounding box.
+   *
+   * @return treatment of the bounding box of the grid by mult() and multTranspose()
+   */
+  virtual BoundingBoxTreatment getBoundingBoxTreatment() { return BoundingBoxTreatment::Unknown; }
+
   /**
    * Name of this implementation of the operation.
    */
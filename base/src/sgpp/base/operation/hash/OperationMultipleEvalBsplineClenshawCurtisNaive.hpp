@@ -26,6 +26,10 @@ class OperationMultipleEvalBsplineClenshawCurtisNaive : public OperationMultiple
 
   double getDuration() override;
 
+  BoundingBoxTreatment getBoundingBoxTreatment() override {
+    return BoundingBoxTreatment::Transformed;
+  }
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -26,6 +26,22 @@ void OperationMultipleEvalLinear::multTranspose(DataVector& alpha, DataVector& r
   op.mult_transpose(storage, base, alpha, this->dataset, result);
 }
 
+void OperationMultipleEvalLinear::multBlock(DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmMultipleEvaluation<SLinearBase> op;
+  LinearBasis<unsigned int, unsigned int> base;
+
+  result.resizeRowsCols(this->dataset.getNrows(), alpha.getNcols());
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
+void OperationMultipleEvalLinear::multTransposeBlock(DataMatrix& source, DataMatrix& result) {
+  AlgorithmMultipleEvaluation<SLinearBase> op;
+  LinearBasis<unsigned int, unsigned int> base;
+
+  result.resizeRowsCols(storage.getSize(), source.getNcols());
+  op.mult_transpose(storage, base, source, this->dataset, result);
+}
+
 double OperationMultipleEvalLinear::getDuration() { return 0.0; }
 
 }  // namespace base
@@ -35,9 +35,15 @@ class OperationMultipleEvalLinear : public OperationMultipleEval {
 
   void mult(DataVector& alpha, DataVector& result) override;
   void multTranspose(DataVector& source, DataVector& result) override;
+  void multBlock(DataMatrix& alpha, DataMatrix& result) override;
+  void multTransposeBlock(DataMatrix& source, DataMatrix& result) override;
 
   double getDuration() override;
 
+  BoundingBoxTreatment getBoundingBoxTreatment() override {
+    return BoundingBoxTreatment::Transformed;
+  }
+
  protected:
   /// reference to the grid's GridStorage object
   GridStorage& storage;
@@ -26,6 +26,13 @@ void OperationMultipleEvalLinearBoundary::multTranspose(DataVector& source, Data
   op.mult_transposed(storage, base, source, this->dataset, result);
 }
 
+void OperationMultipleEvalLinearBoundary::multBlock(DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearBoundaryBase> op;
+  LinearBoundaryBasis<unsigned int, unsigned int> base;
+
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
 double OperationMultipleEvalLinearBoundary::getDuration() { return 0.0; }
 
 }  // namespace base
@@ -37,9 +37,14 @@ class OperationMultipleEvalLinearBoundary : public OperationMultipleEval {
 
   void mult(DataVector& alpha, DataVector& result) override;
   void multTranspose(DataVector& source, DataVector& result) override;
+  void multBlock(DataMatrix& alpha, DataMatrix& result) override;
 
   double getDuration() override;
 
+  BoundingBoxTreatment getBoundingBoxTreatment() override {
+    return BoundingBoxTreatment::Transformed;
+  }
+
  protected:
   /// Pointer to GridStorage object
   GridStorage& storage;
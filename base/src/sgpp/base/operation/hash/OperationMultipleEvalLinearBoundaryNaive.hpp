@@ -26,6 +26,10 @@ class OperationMultipleEvalLinearBoundaryNaive : public OperationMultipleEval {
 
   double getDuration() override;
 
+  BoundingBoxTreatment getBoundingBoxTreatment() override {
+    return BoundingBoxTreatment::Transformed;
+  }
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
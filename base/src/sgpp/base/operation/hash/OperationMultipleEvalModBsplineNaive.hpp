@@ -27,6 +27,10 @@ class OperationMultipleEvalModBsplineNaive : public OperationMultipleEval {
 
   double getDuration() override;
 
+  BoundingBoxTreatment getBoundingBoxTreatment() override {
+    return BoundingBoxTreatment::Transformed;
+  }
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
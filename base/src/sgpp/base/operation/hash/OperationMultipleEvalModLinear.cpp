@@ -27,6 +27,13 @@ void OperationMultipleEvalModLinear::multTranspose(DataVector& source, DataVecto
   op.mult_transposed(storage, base, source, this->dataset, result);
 }
 
+void OperationMultipleEvalModLinear::multBlock(DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearModifiedBase> op;
+  LinearModifiedBasis<unsigned int, unsigned int> base;
+
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
 double OperationMultipleEvalModLinear::getDuration() { return 0.0; }
 
 }  // namespace base
@@ -24,6 +24,12 @@ void OperationMultipleEvalModPoly::multTranspose(DataVector& source, DataVector&
   op.mult_transposed(storage, base, source, this->dataset, result);
 }
 
+void OperationMultipleEvalModPoly::multBlock(DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmDGEMV<SPolyModifiedBase> op;
+
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
 double OperationMultipleEvalModPoly::getDuration() { return 0.0; }
 
 }  // namespace base
@@ -27,6 +27,13 @@ void OperationMultipleEvalPeriodic::multTranspose(DataVector& source, DataVector
   op.mult_transposed(storage, base, source, this->dataset, result);
 }
 
+void OperationMultipleEvalPeriodic::multBlock(DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearPeriodicBasis> op;
+  LinearPeriodicBasis<unsigned int, unsigned int> base;
+
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
 double OperationMultipleEvalPeriodic::getDuration() { return 0.0; }
 
 }  // namespace base
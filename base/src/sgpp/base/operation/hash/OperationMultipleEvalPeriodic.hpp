@@ -37,9 +37,14 @@ class OperationMultipleEvalPeriodic : public OperationMultipleEval {
 
   void mult(DataVector& alpha, DataVector& result) override;
   void multTranspose(DataVector& source, DataVector& result) override;
+  void multBlock(DataMatrix& alpha, DataMatrix& result) override;
 
   double getDuration() override;
 
+  BoundingBoxTreatment getBoundingBoxTreatment() override {
+    return BoundingBoxTreatment::Ignored;
+  }
+
  protected:
   /// Pointer to GridStorage object
   GridStorage& storage;
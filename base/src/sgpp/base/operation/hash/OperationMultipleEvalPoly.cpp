@@ -25,6 +25,12 @@ void OperationMultipleEvalPoly::multTranspose(DataVector& source, DataVector& re
   op.mult_transposed(storage, base, source, this->dataset, result);
 }
 
+void OperationMultipleEvalPoly::multBlock(DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmDGEMV<SPolyBase> op;
+
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
 double OperationMultipleEvalPoly::getDuration() { return 0.0; }
 
 }  // namespace base
@@ -22,6 +22,12 @@ void OperationMultipleEvalPolyBoundary::multTranspose(DataVector& source, DataVe
   op.mult_transposed(storage, base, source, this->dataset, result);
 }
 
+void OperationMultipleEvalPolyBoundary::multBlock(DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmDGEMV<SPolyBoundaryBase> op;
+
+  op.mult(storage, base, alpha, this->dataset, result);
+}
+
 double OperationMultipleEvalPolyBoundary::getDuration() { return 0.0; }
 
 }  // namespace base
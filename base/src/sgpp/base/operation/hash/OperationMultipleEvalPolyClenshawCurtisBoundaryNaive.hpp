@@ -27,6 +27,10 @@ class OperationMultipleEvalPolyClenshawCurtisBoundaryNaive : public OperationMul
 
   double getDuration() override;
 
+  BoundingBoxTreatment getBoundingBoxTreatment() override {
+    return BoundingBoxTreatment::Transformed;
+  }
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
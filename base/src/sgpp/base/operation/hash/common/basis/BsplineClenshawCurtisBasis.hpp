@@ -43,12 +43,39 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
   explicit BsplineClenshawCurtisBasis(size_t degree)
       : bsplineBasis(BsplineBasis<LT, IT>(degree)),
         xi(std::vector<double>(degree + 2, 0.0)),
-        clenshawCurtisTable(ClenshawCurtisTable::getInstance()) {}
+        clenshawCurtisTable(ClenshawCurtisTable::getInstance()) {
+#ifdef _OPENMP
+    omp_init_nest_lock(&xiLock);
+#endif
+  }
+
+  /**
+   * Copy constructor, the copy has its own knot vector and lock, i.e., copies can be used
+   * by different threads without blocking each other.
+   *
+   * @param other basis to be copied
+   */
+  BsplineClenshawCurtisBasis(const BsplineClenshawCurtisBasis& other)
+      : Basis<LT, IT>(other),
+        bsplineBasis(other.bsplineBasis),
+        xi(other.xi),
+        clenshawCurtisTable(other.clenshawCurtisTable),
+        coordinates(other.coordinates),
+        weights(other.weights),
+        integrationInitialized(other.integrationInitialized) {
+#ifdef _OPENMP
+    omp_init_nest_lock(&xiLock);
+#endif
+  }
 
   /**
    * Destructor.
    */
-  ~BsplineClenshawCurtisBasis() override {}
+  ~BsplineClenshawCurtisBasis() override {
+#ifdef _OPENMP
+    omp_destroy_nest_lock(&xiLock);
+#endif
+  }
 
   /**
    * @param x     evaluation point
@@ -195,11 +222,14 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
           bsplineBasis.getDegree());
     } else {
       double res = 0.0;
-#pragma omp critical
-      {
-        constructKnots(l, i);
-        res = nonUniformBSpline(x, bsplineBasis.getDegree(), 0);
-      }
+#ifdef _OPENMP
+      omp_set_nest_lock(&xiLock);
+#endif
+      constructKnots(l, i);
+      res = nonUniformBSpline(x, bsplineBasis.getDegree(), 0);
+#ifdef _OPENMP
+      omp_unset_nest_lock(&xiLock);
+#endif
       return res;
     }
   }
@@ -218,11 +248,14 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
           bsplineBasis.getDegree());
     } else {
       double res = 0.0;
-#pragma omp critical
-      {
-        constructKnots(l, i);
-        res = nonUniformBSplineDx(x, bsplineBasis.getDegree(), 0);
-      }
+#ifdef _OPENMP
+      omp_set_nest_lock(&xiLock);
+#endif
+      constructKnots(l, i);
+      res = nonUniformBSplineDx(x, bsplineBasis.getDegree(), 0);
+#ifdef _OPENMP
+      omp_unset_nest_lock(&xiLock);
+#endif
       return res;
     }
   }
@@ -241,11 +274,14 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
           bsplineBasis.getDegree());
     } else {
       double res = 0.0;
-#pragma omp critical
-      {
-        constructKnots(l, i);
-        res = nonUniformBSplineDxDx(x, bsplineBasis.getDegree(), 0);
-      }
+#ifdef _OPENMP
+      omp_set_nest_lock(&xiLock);
+#endif
+      constructKnots(l, i);
+      res = nonUniformBSplineDxDx(x, bsplineBasis.getDegree(), 0);
+#ifdef _OPENMP
+      omp_unset_nest_lock(&xiLock);
+#endif
       return res;
     }
   }
@@ -267,33 +303,36 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
 
     double res = 0.0;
 
-#pragma omp critical
-    {
-      const IT hInv = static_cast<IT>(1) << l;
-      size_t degree = bsplineBasis.getDegree();
-      size_t erster_abschnitt = std::max(0, -static_cast<int>(i - (degree + 1) / 2));
-      size_t letzter_abschnitt = std::min(degree, hInv + (degree + 1) / 2 - i - 1);
-      size_t quadLevel = (degree + 1) / 2;
-      if (!integrationInitialized) {
-        sgpp::base::GaussLegendreQuadRule1D gauss;
-        gauss.getLevelPointsAndWeightsNormalized(quadLevel, coordinates, weights);
-        integrationInitialized = true;
-      }
-      constructKnots(l, i);
-      for (size_t j = erster_abschnitt; j <= letzter_abschnitt; j++) {
-        double left = std::max(0.0, xi[j]);
-        double right = std::min(1.0, xi[j + 1]);
-        // std::cout << "Left: " << left << std::endl;
-        // std::cout << "Right: " << right << std::endl;
-        double h = right - left;
-        double temp_res = 0.0;
-        for (size_t c = 0; c < quadLevel; c++) {
-          double x = (h * coordinates[c]) + left;
-          temp_res += weights[c] * nonUniformBSpline(x, degree, 0);
-        }
-        res += h * temp_res;
+#ifdef _OPENMP
+    omp_set_nest_lock(&xiLock);
+#endif
+    const IT hInv = static_cast<IT>(1) << l;
+    size_t degree = bsplineBasis.getDegree();
+    size_t erster_abschnitt = std::max(0, -static_cast<int>(i - (degree + 1) / 2));
+    size_t letzter_abschnitt = std::min(degree, hInv + (degree + 1) / 2 - i - 1);
+    size_t quadLevel = (degree + 1) / 2;
+    if (!integrationInitialized) {
+      sgpp::base::GaussLegendreQuadRule1D gauss;
+      gauss.getLevelPointsAndWeightsNormalized(quadLevel, coordinates, weights);
+      integrationInitialized = true;
+    }
+    constructKnots(l, i);
+    for (size_t j = erster_abschnitt; j <= letzter_abschnitt; j++) {
+      double left = std::max(0.0, xi[j]);
+      double right = std::min(1.0, xi[j + 1]);
+      // std::cout << "Left: " << left << std::endl;
+      // std::cout << "Right: " << right << std::endl;
+      double h = right - left;
+      double temp_res = 0.0;
+      for (size_t c = 0; c < quadLevel; c++) {
+        double x = (h * coordinates[c]) + left;
+        temp_res += weights[c] * nonUniformBSpline(x, degree, 0);
       }
+      res += h * temp_res;
     }
+#ifdef _OPENMP
+    omp_unset_nest_lock(&xiLock);
+#endif
     return res;
   }
 
@@ -304,6 +343,10 @@ class BsplineClenshawCurtisBasis : public Basis<LT, IT> {
   std::vector<double> xi;
   /// reference to the Clenshaw-Curtis cache table
   ClenshawCurtisTable& clenshawCurtisTable;
+#ifdef _OPENMP
+  /// lock protecting xi
+  omp_nest_lock_t xiLock;
+#endif
   DataVector coordinates;
   DataVector weights;
   bool integrationInitialized = false;
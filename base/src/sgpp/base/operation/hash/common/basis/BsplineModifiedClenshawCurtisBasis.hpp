@@ -53,6 +53,25 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
 #endif
   }
 
+  /**
+   * Copy constructor, the copy has its own knot vector and lock, i.e., copies can be used
+   * by different threads without blocking each other.
+   *
+   * @param other basis to be copied
+   */
+  BsplineModifiedClenshawCurtisBasis(const BsplineModifiedClenshawCurtisBasis& other)
+      : Basis<LT, IT>(other),
+        degree(other.degree),
+        xi(other.xi),
+        clenshawCurtisTable(other.clenshawCurtisTable),
+        coordinates(other.coordinates),
+        weights(other.weights),
+        integrationInitialized(other.integrationInitialized) {
+#ifdef _OPENMP
+    omp_init_nest_lock(&xiLock);
+#endif
+  }
+
   /**
    * Destructor.
    */
@@ -382,6 +382,15 @@ class FundamentalSplineBasis : public Basis<LT, IT> {
    */
   inline size_t getDegree() const override { return bsplineBasis.getDegree(); }
 
+  /**
+   * @return      radius of the support of the basis functions
+   *              in multiples of the mesh width
+   */
+  inline double getSupportRadius() const {
+    return static_cast<double>(coefficients.size() - 1) +
+           static_cast<double>(bsplineBasis.getDegree() + 1) / 2.0;
+  }
+
   /**
    * @param l     level of basis function
    * @param i     index of basis function
@@ -439,6 +439,12 @@ class FundamentalSplineModifiedBasis : public Basis<LT, IT> {
    */
   inline size_t getDegree() const override { return bsplineBasis.getDegree(); }
 
+  /**
+   * @return      radius of the support of the non-modified basis functions
+   *              in multiples of the mesh width
+   */
+  inline double getSupportRadius() const { return fundamentalSplineBasis.getSupportRadius(); }
+
   /**
    * @param l     level of basis function
    * @param i     index of basis function
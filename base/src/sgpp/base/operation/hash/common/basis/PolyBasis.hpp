@@ -122,6 +122,35 @@ class PolyBasis : public Basis<LT, IT> {
     return result * sum;
   }
 
+  double evalDxDx(LT level, IT index, double x) {
+    // logarithmic derivative method as in evalDx:
+    // f'' = f * ((sum_k 1/(x - x_k))^2 - sum_k 1/(x - x_k)^2)
+    double hInvDbl = static_cast<double>(1 << level);
+    double h = 1 / hInvDbl;
+    size_t deg = std::min<size_t>(degree, level + 1);
+    double result = eval(level, index, x);
+    if (result == 0.0) return 0.0;
+
+    double sum = 0.0;
+    double sumOfSquares = 0.0;
+    // see eval-function for explanation of traversal code
+    size_t root = index;
+    size_t id = root;
+    root++;
+    double summand = 1 / (x - h * static_cast<double>(root));
+    sum += summand;
+    sumOfSquares += summand * summand;
+    root -= 2;
+    for (size_t j = 2; j < static_cast<size_t>(1 << deg); j *= 2) {
+      summand = 1 / (x - h * static_cast<double>(root));
+      sum += summand;
+      sumOfSquares += summand * summand;
+      root += idxtable[id & 3] * j;
+      id >>= 1;
+    }
+    return result * (sum * sum - sumOfSquares);
+  }
+
   /**
    * Evaluate a basis function.
    * Has a dependence on the absolute position of grid point and support.
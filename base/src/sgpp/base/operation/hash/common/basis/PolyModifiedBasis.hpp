@@ -80,6 +80,17 @@ class PolyModifiedBasis : public Basis<LT, IT> {
     }
   }
 
+  double evalDxDx(LT level, IT index, double x) {
+    const IT hInv = static_cast<IT>(1) << level;
+    if ((level == 1) || (index == 1) || (index == hInv - 1)) {
+      // constant or linear basis functions
+      return 0.0;
+    } else {
+      // interior basis function
+      return polyBasis.evalDxDx(level, index, x);
+    }
+  }
+
   double getIntegral(LT level, IT index) override {
     const IT hInv = static_cast<IT>(1) << level;
 
@@ -0,0 +1,98 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/MappedFile.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+MappedFile::MappedFile(const std::string& filename, AccessPattern pattern)
+    : filename(filename), data(nullptr), size(0), mapped(false), buffer() {
+#ifndef _WIN32
+  int fd = open(filename.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    throw file_exception("MappedFile: unable to open file for read access");
+  }
+
+  struct stat fileStatus;
+
+  if (fstat(fd, &fileStatus) != 0) {
+    close(fd);
+    throw file_exception("MappedFile: unable to determine the file size");
+  }
+
+  size = static_cast<size_t>(fileStatus.st_size);
+
+  // empty files cannot be mapped
+  if (size > 0) {
+    void* address = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+    if (address == MAP_FAILED) {
+      close(fd);
+      throw file_exception("MappedFile: unable to map the file into memory");
+    }
+
+    data = static_cast<const char*>(address);
+    mapped = true;
+
+#ifdef POSIX_MADV_SEQUENTIAL
+    if (pattern == AccessPattern::Sequential) {
+      posix_madvise(address, size, POSIX_MADV_SEQUENTIAL);
+    } else if (pattern == AccessPattern::Random) {
+      posix_madvise(address, size, POSIX_MADV_RANDOM);
+    }
+#endif
+  }
+
+  // the mapping stays valid after the descriptor has been closed
+  close(fd);
+#else
+  (void)pattern;
+  std::ifstream fin(filename.c_str(), std::ios::binary | std::ios::ate);
+
+  if (!fin) {
+    throw file_exception("MappedFile: unable to open file for read access");
+  }
+
+  size = static_cast<size_t>(fin.tellg());
+
+  if (size > 0) {
+    buffer.reset(new char[size]);
+    fin.seekg(0);
+    fin.read(buffer.get(), static_cast<std::streamsize>(size));
+
+    if (!fin) {
+      throw file_exception("MappedFile: unable to read the file");
+    }
+
+    data = buffer.get();
+  }
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+  if (mapped) {
+    munmap(const_cast<char*>(data), size);
+  }
+#endif
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,97 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Read-only memory mapping of a file, the mapping is released by the destructor.
+ * Processes mapping the same file share its physical pages. If mmap is not available
+ * (Windows), the file is read into memory instead.
+ *
+ * The beginning of the data is aligned at least as well as memory returned by new,
+ * i.e., sections of the file whose offsets are multiples of their element size can be
+ * used in place.
+ */
+class MappedFile {
+ public:
+  /**
+   * Expected access pattern, passed to the kernel as hint for read-ahead.
+   */
+  enum class AccessPattern { Normal, Sequential, Random };
+
+  /**
+   * Constructor, maps the file into memory.
+   * Throws a file_exception if the file cannot be opened or mapped.
+   *
+   * @param filename  name of the file
+   * @param pattern   expected access pattern
+   */
+  explicit MappedFile(const std::string& filename, AccessPattern pattern = AccessPattern::Normal);
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * Destructor, unmaps the file.
+   */
+  ~MappedFile();
+
+  /**
+   * @return begin of the data (nullptr if the file is empty)
+   */
+  inline const char* getData() const { return data; }
+
+  /**
+   * @return size of the file in bytes
+   */
+  inline size_t getSize() const { return size; }
+
+  /**
+   * @return begin of the data
+   */
+  inline const char* begin() const { return data; }
+
+  /**
+   * @return end of the data
+   */
+  inline const char* end() const { return data + size; }
+
+  /**
+   * @return name of the file
+   */
+  inline const std::string& getFilename() const { return filename; }
+
+  /**
+   * @return true if the file has been mapped, false if it has been read into memory
+   */
+  inline bool isMapped() const { return mapped; }
+
+ private:
+  /// name of the file
+  std::string filename;
+  /// begin of the data
+  const char* data;
+  /// size of the file in bytes
+  size_t size;
+  /// true if the file has been mapped (and has to be unmapped)
+  bool mapped;
+  /// contents of the file if it could not be mapped
+  std::unique_ptr<char[]> buffer;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* MAPPEDFILE_HPP */
@@ -42,10 +42,14 @@
 #include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/algorithm/AlgorithmEvaluation.hpp>
 #include <sgpp/base/algorithm/AlgorithmEvaluationTransposed.hpp>
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
 #include <sgpp/base/algorithm/AlgorithmMultipleEvaluation.hpp>
+#include <sgpp/base/algorithm/AlgorithmMultiplePointEvaluation.hpp>
+#include <sgpp/base/algorithm/AlgorithmUnidirectionalHierarchisation.hpp>
 #include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
 #include <sgpp/base/application/ScreenOutput.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixSymmetricSparse.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/grid/GridDataBase.hpp>
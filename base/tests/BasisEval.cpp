@@ -30,6 +30,10 @@ double basisEvalDx(sgpp::base::SBasis& basis, sgpp::base::level_t l,
       dynamic_cast<sgpp::base::SWaveletBoundaryBase*>(&basis);
   sgpp::base::SWaveletModifiedBase* waveletModifiedBasis =
       dynamic_cast<sgpp::base::SWaveletModifiedBase*>(&basis);
+  sgpp::base::SPolyBase* polyBasis =
+      dynamic_cast<sgpp::base::SPolyBase*>(&basis);
+  sgpp::base::SPolyModifiedBase* polyModifiedBasis =
+      dynamic_cast<sgpp::base::SPolyModifiedBase*>(&basis);
 
   if (bsplineBasis != nullptr) {
     return bsplineBasis->evalDx(l, i, x);
@@ -51,6 +55,10 @@ double basisEvalDx(sgpp::base::SBasis& basis, sgpp::base::level_t l,
     return waveletBoundaryBasis->evalDx(l, i, x);
   } else if (waveletModifiedBasis != nullptr) {
     return waveletModifiedBasis->evalDx(l, i, x);
+  } else if (polyBasis != nullptr) {
+    return polyBasis->evalDx(l, i, x);
+  } else if (polyModifiedBasis != nullptr) {
+    return polyModifiedBasis->evalDx(l, i, x);
   } else {
     BOOST_THROW_EXCEPTION(std::runtime_error("Invalid basis."));
     return NAN;
@@ -79,6 +87,10 @@ double basisEvalDxDx(sgpp::base::SBasis& basis, sgpp::base::level_t l,
       dynamic_cast<sgpp::base::SWaveletBoundaryBase*>(&basis);
   sgpp::base::SWaveletModifiedBase* waveletModifiedBasis =
       dynamic_cast<sgpp::base::SWaveletModifiedBase*>(&basis);
+  sgpp::base::SPolyBase* polyBasis =
+      dynamic_cast<sgpp::base::SPolyBase*>(&basis);
+  sgpp::base::SPolyModifiedBase* polyModifiedBasis =
+      dynamic_cast<sgpp::base::SPolyModifiedBase*>(&basis);
 
   if (bsplineBasis != nullptr) {
     return bsplineBasis->evalDxDx(l, i, x);
@@ -100,6 +112,10 @@ double basisEvalDxDx(sgpp::base::SBasis& basis, sgpp::base::level_t l,
     return waveletBoundaryBasis->evalDxDx(l, i, x);
   } else if (waveletModifiedBasis != nullptr) {
     return waveletModifiedBasis->evalDxDx(l, i, x);
+  } else if (polyBasis != nullptr) {
+    return polyBasis->evalDxDx(l, i, x);
+  } else if (polyModifiedBasis != nullptr) {
+    return polyModifiedBasis->evalDxDx(l, i, x);
   } else {
     BOOST_THROW_EXCEPTION(std::runtime_error("Invalid basis."));
     return NAN;
@@ -0,0 +1,82 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixSymmetricSparse.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataMatrixSymmetricSparse;
+using sgpp::base::DataVector;
+using sgpp::base::data_exception;
+
+BOOST_AUTO_TEST_SUITE(TestDataMatrixSymmetricSparse)
+
+BOOST_AUTO_TEST_CASE(testMultAndGet) {
+  const size_t n = 200;
+
+  // banded symmetric matrix with some empty rows
+  DataMatrix dense(n, n, 0.0);
+  std::vector<std::vector<std::pair<size_t, double>>> rows(n);
+
+  for (size_t i = 0; i < n; i++) {
+    if (i % 7 == 3) {
+      continue;
+    }
+
+    for (size_t j = i; j < std::min(i + 5, n); j += 2) {
+      const double value = std::sin(static_cast<double>(i + 2 * j)) + 0.1;
+      rows[i].emplace_back(j, value);
+      dense.set(i, j, value);
+      dense.set(j, i, value);
+    }
+  }
+
+  DataMatrixSymmetricSparse sparse;
+  sparse.setRows(rows);
+
+  BOOST_CHECK_EQUAL(sparse.getSize(), n);
+  BOOST_CHECK(rows.empty());
+
+  DataMatrix denseFromSparse;
+  sparse.toDense(denseFromSparse);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      BOOST_CHECK_EQUAL(sparse.get(i, j), dense.get(i, j));
+      BOOST_CHECK_EQUAL(denseFromSparse.get(i, j), dense.get(i, j));
+    }
+  }
+
+  DataVector x(n);
+
+  for (size_t i = 0; i < n; i++) {
+    x[i] = std::cos(static_cast<double>(i));
+  }
+
+  DataVector result(n);
+  DataVector resultDense(n);
+  sparse.mult(x, result);
+  dense.mult(x, resultDense);
+
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_SMALL(result[i] - resultDense[i], 1e-12);
+  }
+
+  DataVector wrongSize(n + 1);
+  BOOST_CHECK_THROW(sparse.mult(wrongSize, result), data_exception);
+  BOOST_CHECK_THROW(sparse.get(n, 0), data_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
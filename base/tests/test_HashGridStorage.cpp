@@ -7,22 +7,44 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusCoarseningFunctor.hpp>
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/grid/generation/hashmap/ANOVAHashRefinement.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashCoarsening.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashRefinementBoundaries.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridIterator.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPointArena.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+#include <sgpp/base/grid/storage/hashmap/PackedLevelIndex.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cstdint>
+#include <list>
+#include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
+using sgpp::base::ANOVAHashRefinement;
+using sgpp::base::AbstractRefinement;
 using sgpp::base::DataVector;
+using sgpp::base::HashCoarsening;
 using sgpp::base::HashGenerator;
+using sgpp::base::HashGridIterator;
 using sgpp::base::HashGridPoint;
+using sgpp::base::HashGridPointArena;
 using sgpp::base::HashGridStorage;
+using sgpp::base::HashGridStorageBackend;
 using sgpp::base::HashRefinement;
 using sgpp::base::HashRefinementBoundaries;
+using sgpp::base::PackedLevelIndex;
+using sgpp::base::SurplusCoarseningFunctor;
 using sgpp::base::SurplusRefinementFunctor;
 
 BOOST_AUTO_TEST_SUITE(TestHashGridStorage)
@@ -194,6 +216,317 @@ BOOST_AUTO_TEST_CASE(testSeq) {
   BOOST_CHECK(s.isInvalidSequenceNumber(seq));
 }
 
+BOOST_AUTO_TEST_CASE(testFlatHashBackend) {
+  HashGridStorage s(3);
+  HashGridStorage sFlat(3);
+  HashGenerator g;
+
+  sFlat.setBackend(HashGridStorageBackend::FlatHash);
+  BOOST_CHECK(sFlat.getBackend() == HashGridStorageBackend::FlatHash);
+
+  g.regular(s, 5);
+  g.regular(sFlat, 5);
+  BOOST_CHECK_EQUAL(s.getSize(), sFlat.getSize());
+
+  // same sequence numbers and leaf properties as with the default backend
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK(s.getPoint(i).equals(sFlat.getPoint(i)));
+    BOOST_CHECK_EQUAL(sFlat.getSequenceNumber(s.getPoint(i)), i);
+    BOOST_CHECK_EQUAL(sFlat.find(&s.getPoint(i))->second, i);
+    BOOST_CHECK_EQUAL(s.getPoint(i).isLeaf(), sFlat.getPoint(i).isLeaf());
+  }
+
+  size_t numberOfPoints = 0;
+
+  for (HashGridStorage::grid_map_iterator iter = sFlat.begin(); iter != sFlat.end(); iter++) {
+    BOOST_CHECK(iter->first->equals(sFlat.getPoint(iter->second)));
+    numberOfPoints++;
+  }
+
+  BOOST_CHECK_EQUAL(numberOfPoints, sFlat.getSize());
+
+  HashGridPoint p(3);
+  p.set(0, 6, 1);
+  p.set(1, 1, 1);
+  p.set(2, 1, 1);
+  BOOST_CHECK(!sFlat.isContaining(p));
+  BOOST_CHECK(sFlat.find(&p) == sFlat.end());
+  BOOST_CHECK(sFlat.isInvalidSequenceNumber(sFlat.getSequenceNumber(p)));
+
+  // deleting points renumbers the remaining points consecutively
+  std::list<size_t> removePoints;
+  removePoints.push_back(s.getSize() - 1);
+  removePoints.push_back(3);
+  std::vector<size_t> remaining = s.deletePoints(removePoints);
+  std::vector<size_t> remainingFlat = sFlat.deletePoints(removePoints);
+
+  BOOST_CHECK_EQUAL(s.getSize(), sFlat.getSize());
+  BOOST_CHECK_EQUAL_COLLECTIONS(remaining.begin(), remaining.end(), remainingFlat.begin(),
+                                remainingFlat.end());
+
+  for (size_t i = 0; i < sFlat.getSize(); i++) {
+    BOOST_CHECK_EQUAL(sFlat.getSequenceNumber(s.getPoint(i)), i);
+  }
+
+  // the serialization format does not depend on the backend
+  BOOST_CHECK_EQUAL(s.serialize(), sFlat.serialize());
+
+  // switching the backend keeps the sequence numbers
+  sFlat.setBackend(HashGridStorageBackend::UnorderedMap);
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK_EQUAL(sFlat.getSequenceNumber(s.getPoint(i)), i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testFlatHashBackendRefinement) {
+  HashGridStorage s(2);
+  HashGridStorage sFlat(2);
+  HashGenerator g;
+  HashRefinement r;
+
+  sFlat.setBackend(HashGridStorageBackend::FlatHash);
+  g.regular(s, 3);
+  g.regular(sFlat, 3);
+
+  DataVector alpha(s.getSize(), 1.0);
+  alpha[s.getSize() - 1] = 2.0;
+  SurplusRefinementFunctor f(alpha, 1);
+
+  r.free_refine(s, f);
+  r.free_refine(sFlat, f);
+
+  BOOST_CHECK_EQUAL(s.getSize(), sFlat.getSize());
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK(sFlat.isContaining(s.getPoint(i)));
+  }
+
+  // the new points may be numbered differently, but the serialization of each storage keeps
+  // its sequence numbers; deserialized storages use the default backend
+  std::string serialized = sFlat.serialize();
+  HashGridStorage sDeserialized(serialized);
+  BOOST_CHECK(sDeserialized.getBackend() == HashGridStorageBackend::UnorderedMap);
+  BOOST_CHECK_EQUAL(sDeserialized.getSize(), sFlat.getSize());
+
+  for (size_t i = 0; i < sFlat.getSize(); i++) {
+    BOOST_CHECK(sDeserialized.getPoint(i).equals(sFlat.getPoint(i)));
+    BOOST_CHECK_EQUAL(sDeserialized.getSequenceNumber(sFlat.getPoint(i)), i);
+  }
+
+  std::istringstream stream(serialized);
+  HashGridStorage sStream(stream);
+  BOOST_CHECK(sStream.getBackend() == HashGridStorageBackend::UnorderedMap);
+  BOOST_CHECK_EQUAL(sStream.serialize(), serialized);
+}
+
+BOOST_AUTO_TEST_CASE(testPackedLevelIndex) {
+  PackedLevelIndex::word_type w = PackedLevelIndex::pack(3, 5);
+  BOOST_CHECK_EQUAL(PackedLevelIndex::getLevel(w), 3U);
+  BOOST_CHECK_EQUAL(PackedLevelIndex::getIndex(w), 5U);
+  BOOST_CHECK_EQUAL(PackedLevelIndex::getHInv(w), 8U);
+
+  w = PackedLevelIndex::pack(31, 0xFFFFFFFFU);
+  BOOST_CHECK_EQUAL(PackedLevelIndex::getLevel(w), 31U);
+  BOOST_CHECK_EQUAL(PackedLevelIndex::getIndex(w), 0xFFFFFFFFU);
+
+  // the navigation on packed words wraps around like the one on 32 bit levels and indices
+  const std::vector<HashGridPoint::level_type> levels = {0, 1, 3, 31, 0xFFFFFFFFU};
+  const std::vector<HashGridPoint::index_type> indices = {0, 1, 5, 0x80000001U, 0xFFFFFFFFU};
+
+  for (HashGridPoint::level_type l : levels) {
+    for (HashGridPoint::index_type i : indices) {
+      w = PackedLevelIndex::pack(l, i);
+      BOOST_CHECK_EQUAL(PackedLevelIndex::leftChild(w), PackedLevelIndex::pack(l + 1, 2 * i - 1));
+      BOOST_CHECK_EQUAL(PackedLevelIndex::rightChild(w), PackedLevelIndex::pack(l + 1, 2 * i + 1));
+      BOOST_CHECK_EQUAL(PackedLevelIndex::parent(w), PackedLevelIndex::pack(l - 1, (i >> 1) | 1));
+      BOOST_CHECK_EQUAL(PackedLevelIndex::stepLeft(w), PackedLevelIndex::pack(l, i - 2));
+      BOOST_CHECK_EQUAL(PackedLevelIndex::stepRight(w), PackedLevelIndex::pack(l, i + 2));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testFlatHashDeepLevels) {
+  HashGridStorage s(2);
+  HashGenerator g;
+
+  s.setBackend(HashGridStorageBackend::FlatHash);
+  g.regular(s, 4);
+
+  HashGridPoint p(2);
+  p.set(0, 30, (1U << 30) - 1);
+  p.set(1, 1, 1);
+  BOOST_CHECK(!s.isContaining(p));
+  size_t seq = s.insert(p);
+  BOOST_CHECK_EQUAL(s.getSequenceNumber(p), seq);
+
+  // points that only differ in the level of one dimension are distinguished
+  p.set(0, 31, (1U << 30) - 1);
+  BOOST_CHECK(!s.isContaining(p));
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK_EQUAL(s.getSequenceNumber(s.getPoint(i)), i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testIteratorNavigation) {
+  for (HashGridStorageBackend backend :
+       {HashGridStorageBackend::UnorderedMap, HashGridStorageBackend::FlatHash}) {
+    HashGridStorage s(2);
+    HashGenerator g;
+    s.setBackend(backend);
+    g.regular(s, 3);
+
+    HashGridIterator iter(s);
+    HashGridPoint p(2);
+    p.set(0, 1, 1);
+    p.set(1, 1, 1);
+    BOOST_CHECK_EQUAL(iter.seq(), s.getSequenceNumber(p));
+    BOOST_CHECK(iter.hintLeft(0));
+    BOOST_CHECK(iter.hintRight(1));
+
+    iter.leftChild(0);
+    p.set(0, 2, 1);
+    BOOST_CHECK_EQUAL(iter.seq(), s.getSequenceNumber(p));
+
+    iter.stepRight(0);
+    p.set(0, 2, 3);
+    BOOST_CHECK_EQUAL(iter.seq(), s.getSequenceNumber(p));
+
+    iter.rightChild(1);
+    p.set(1, 2, 3);
+    BOOST_CHECK_EQUAL(iter.seq(), s.getSequenceNumber(p));
+
+    // the left neighbor of index 1 does not exist
+    iter.stepLeft(0);
+    iter.stepLeft(0);
+    BOOST_CHECK(s.isInvalidSequenceNumber(iter.seq()));
+
+    iter.set(0, 2, 1);
+    iter.up(1);
+    iter.leftChild(0);
+    p.set(0, 3, 1);
+    p.set(1, 1, 1);
+    BOOST_CHECK_EQUAL(iter.seq(), s.getSequenceNumber(p));
+    BOOST_CHECK(!iter.hintLeft(0));
+
+    iter.up(0);
+    p.set(0, 2, 1);
+    BOOST_CHECK_EQUAL(iter.seq(), s.getSequenceNumber(p));
+
+    iter.up(0);
+    p.set(0, 1, 1);
+    BOOST_CHECK_EQUAL(iter.seq(), s.getSequenceNumber(p));
+    BOOST_CHECK_EQUAL(iter.getGridDepth(0), 3U);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testMemoryUsage) {
+  HashGridStorage s(10);
+  HashGenerator g;
+  g.regular(s, 3);
+
+  // one packed word per dimension, the object header and the list entry
+  BOOST_CHECK_GE(s.getPointMemoryUsage(),
+                 s.getSize() * (sizeof(HashGridPoint) + 10 * sizeof(HashGridPoint::packed_type)));
+  BOOST_CHECK_LE(s.getPointMemoryUsage(),
+                 2 * s.getSize() *
+                     (sizeof(HashGridPoint) + 10 * sizeof(HashGridPoint::packed_type) +
+                      sizeof(HashGridPoint*)));
+}
+
+BOOST_AUTO_TEST_CASE(testArena) {
+  HashGridPointArena arena;
+  HashGridPointArena::point_list points;
+  HashGridPoint p(3);
+
+  for (HashGridPoint::index_type i = 1; i < 64; i += 2) {
+    p.set(0, 6, i);
+    p.set(1, 1, 1);
+    p.set(2, 2, 3);
+    points.push_back(arena.create(p));
+  }
+
+  // 32 points fit into the first two chunks (16 + 32 slots)
+  BOOST_CHECK_EQUAL(arena.getNumberOfChunks(), 2U);
+
+  for (size_t i = 0; i < points.size(); i++) {
+    BOOST_CHECK_EQUAL(points[i]->getIndex(0), 2 * i + 1);
+    BOOST_CHECK_EQUAL(points[i]->getIndex(2), 3U);
+    BOOST_CHECK_EQUAL(points[i]->getHash(), HashGridPoint(*points[i]).getHash());
+  }
+
+  // slots of destroyed points are reused
+  HashGridPoint* q = points.back();
+  points.pop_back();
+  arena.destroy(q);
+  points.push_back(arena.create(p));
+  BOOST_CHECK_EQUAL(points.back(), q);
+
+  // points of a different dimension and points whose dimension changes use the heap
+  points.push_back(arena.create(HashGridPoint(5)));
+  *points[0] = HashGridPoint(7);
+  BOOST_CHECK_EQUAL(points[0]->getDimension(), 7U);
+  BOOST_CHECK_EQUAL(arena.getNumberOfChunks(), 2U);
+
+  arena.clear(points);
+  BOOST_CHECK_EQUAL(arena.getNumberOfChunks(), 0U);
+  BOOST_CHECK_EQUAL(arena.getMemoryUsage(), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(testArenaRefineCoarsen) {
+  HashGridStorage s(2);
+  HashGenerator g;
+  HashRefinement r;
+  g.regular(s, 3);
+
+  std::vector<HashGridPoint*> regularPoints;
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    regularPoints.push_back(&s.getPoint(i));
+  }
+
+  std::set<HashGridPoint*> removedPoints;
+
+  for (size_t k = 0; k < 5; k++) {
+    DataVector alpha(s.getSize(), 1.0);
+    alpha[s.getSize() - 1] = 2.0;
+    SurplusRefinementFunctor f(alpha, 1);
+    r.free_refine(s, f);
+
+    // later refinements reuse the slots of the removed points
+    if (k > 0) {
+      for (size_t i = 17; i < s.getSize(); i++) {
+        BOOST_CHECK(removedPoints.count(&s.getPoint(i)) == 1);
+      }
+    }
+
+    // remove all points that have been added by the refinement
+    std::list<size_t> removePoints;
+    removedPoints.clear();
+
+    for (size_t i = 17; i < s.getSize(); i++) {
+      removePoints.push_back(i);
+      removedPoints.insert(&s.getPoint(i));
+    }
+
+    s.deletePoints(removePoints);
+    BOOST_CHECK_EQUAL(s.getSize(), 17U);
+
+    // the remaining points are not moved
+    for (size_t i = 0; i < s.getSize(); i++) {
+      BOOST_CHECK_EQUAL(&s.getPoint(i), regularPoints[i]);
+      BOOST_CHECK_EQUAL(s.getSequenceNumber(s.getPoint(i)), i);
+      BOOST_CHECK_EQUAL(s.getPoint(i).getDimension(), 2U);
+    }
+  }
+
+  HashGridStorage sCopy(s);
+  s.clear();
+  BOOST_CHECK_EQUAL(s.getSize(), 0U);
+  BOOST_CHECK_EQUAL(sCopy.getSize(), 17U);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(TestHashGridStorageWithT)
@@ -617,6 +950,113 @@ BOOST_AUTO_TEST_CASE(testFreeRefine) {
   BOOST_CHECK_EQUAL(s.getSize(), 5U);
 }
 
+void checkConcurrentRefinement(AbstractRefinement& r, HashGridStorage& s,
+                               HashGridStorage& sConcurrent, size_t numRefinements) {
+#ifdef _OPENMP
+  // use several blocks even on machines with one core
+  int numThreads = omp_get_max_threads();
+  omp_set_num_threads(4);
+#endif
+
+  for (size_t k = 0; k < 4; k++) {
+    DataVector alpha(s.getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = static_cast<double>((7 * i) % 11);
+    }
+
+    std::vector<size_t> added;
+    std::vector<size_t> addedConcurrent;
+    SurplusRefinementFunctor f(alpha, numRefinements);
+    r.setConcurrentRefinement(false);
+    r.free_refine(s, f, &added);
+    r.setConcurrentRefinement(true);
+    r.free_refine(sConcurrent, f, &addedConcurrent);
+
+    // same points with the same sequence numbers and leaf properties
+    BOOST_CHECK_EQUAL(s.getSize(), sConcurrent.getSize());
+    BOOST_CHECK(added == addedConcurrent);
+
+    for (size_t i = 0; i < s.getSize(); i++) {
+      BOOST_CHECK(s.getPoint(i).equals(sConcurrent.getPoint(i)));
+      BOOST_CHECK_EQUAL(s.getPoint(i).isLeaf(), sConcurrent.getPoint(i).isLeaf());
+    }
+  }
+
+#ifdef _OPENMP
+  omp_set_num_threads(numThreads);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(testConcurrentFreeRefine) {
+  HashGenerator g;
+
+  // the storages are generated in the same way to get the same iteration order
+  HashGridStorage s(3);
+  HashGridStorage sConcurrent(3);
+  g.regular(s, 2);
+  g.regular(sConcurrent, 2);
+  HashRefinement r;
+  checkConcurrentRefinement(r, s, sConcurrent, 8);
+
+  // many refinements with common missing ancestors
+  HashGridStorage s2(2);
+  HashGridStorage s2Concurrent(2);
+  g.regular(s2, 3);
+  g.regular(s2Concurrent, 3);
+  checkConcurrentRefinement(r, s2, s2Concurrent, 100);
+
+  HashGridStorage sBoundaries(3);
+  HashGridStorage sBoundariesConcurrent(3);
+  g.regularWithBoundaries(sBoundaries, 2, 1);
+  g.regularWithBoundaries(sBoundariesConcurrent, 2, 1);
+  HashRefinementBoundaries rBoundaries;
+  checkConcurrentRefinement(rBoundaries, sBoundaries, sBoundariesConcurrent, 8);
+
+  HashGridStorage sAnova(3);
+  HashGridStorage sAnovaConcurrent(3);
+  g.regular(sAnova, 3);
+  g.regular(sAnovaConcurrent, 3);
+  ANOVAHashRefinement rAnova;
+  checkConcurrentRefinement(rAnova, sAnova, sAnovaConcurrent, 8);
+}
+
+BOOST_AUTO_TEST_CASE(testConcurrentFreeCoarsen) {
+  HashGenerator g;
+  HashGridStorage s(3);
+  HashGridStorage sConcurrent(3);
+  g.regular(s, 4);
+  g.regular(sConcurrent, 4);
+
+  DataVector alpha(s.getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>((7 * i) % 11);
+  }
+
+  DataVector alphaConcurrent(alpha);
+  SurplusCoarseningFunctor f(alpha, 20, 5.0);
+  SurplusCoarseningFunctor fConcurrent(alphaConcurrent, 20, 5.0);
+  HashCoarsening c;
+  HashCoarsening cConcurrent;
+  cConcurrent.setConcurrentCoarsening(true);
+
+  std::vector<size_t> removed;
+  std::vector<size_t> removedConcurrent;
+  c.free_coarsen(s, f, alpha, nullptr, &removed);
+  cConcurrent.free_coarsen(sConcurrent, fConcurrent, alphaConcurrent, nullptr,
+                           &removedConcurrent);
+
+  BOOST_CHECK(!removed.empty());
+  BOOST_CHECK(removed == removedConcurrent);
+  BOOST_CHECK_EQUAL(s.getSize(), sConcurrent.getSize());
+
+  for (size_t i = 0; i < s.getSize(); i++) {
+    BOOST_CHECK(s.getPoint(i).equals(sConcurrent.getPoint(i)));
+    BOOST_CHECK_EQUAL(alpha[i], alphaConcurrent[i]);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testFreeRefineTruncatedBoundaries) {
   HashGridStorage s(2);
   HashGenerator g;
@@ -0,0 +1,194 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/MappedGrid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::base::BoundingBox1D;
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridType;
+using sgpp::base::MappedGrid;
+using sgpp::base::OperationEval;
+using sgpp::base::factory_exception;
+using sgpp::base::file_exception;
+
+namespace {
+
+/**
+ * Creates the naive evaluation operation, which follows the bounding box, or the evaluation
+ * operation of the grid type if there is no naive one.
+ */
+OperationEval* createReferenceOperation(Grid& grid) {
+  try {
+    return sgpp::op_factory::createOperationEvalNaive(grid);
+  } catch (factory_exception&) {
+    return sgpp::op_factory::createOperationEval(grid);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestMappedGrid)
+
+BOOST_AUTO_TEST_CASE(testWriteMapEval) {
+  const size_t dim = 3;
+  std::unique_ptr<Grid> grid(Grid::createModLinearGrid(dim));
+  grid->getGenerator().regular(4);
+
+  DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = std::sin(static_cast<double>(i));
+  }
+
+  std::string filename = "test_MappedGrid.sgb";
+  MappedGrid::write(filename, *grid, &alpha);
+
+  {
+    MappedGrid mapped(filename);
+    BOOST_CHECK_EQUAL(mapped.getDimension(), dim);
+    BOOST_CHECK_EQUAL(mapped.getSize(), grid->getSize());
+    BOOST_CHECK(mapped.hasAlpha());
+    BOOST_CHECK(mapped.getType() == GridType::ModLinear);
+
+    // the grid created from the file has the same points in the same order
+    std::unique_ptr<Grid> newGrid(mapped.createGrid());
+    BOOST_CHECK(newGrid->getType() == GridType::ModLinear);
+    BOOST_CHECK_EQUAL(newGrid->getSize(), grid->getSize());
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      BOOST_CHECK(newGrid->getStorage().getPoint(i).equals(grid->getStorage().getPoint(i)));
+      BOOST_CHECK_EQUAL(newGrid->getStorage().getPoint(i).isLeaf(),
+                        grid->getStorage().getPoint(i).isLeaf());
+    }
+
+    DataVector newAlpha;
+    mapped.getAlpha(newAlpha);
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      BOOST_CHECK_EQUAL(newAlpha[i], alpha[i]);
+    }
+
+    // in place evaluation gives the same values as OperationEval
+    std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEval(*grid));
+    DataMatrix points(10, dim);
+    DataVector point(dim);
+
+    for (size_t r = 0; r < points.getNrows(); r++) {
+      for (size_t d = 0; d < dim; d++) {
+        points.set(r, d, std::fmod(0.123 * static_cast<double>(r + 1) *
+                                   static_cast<double>(d + 2), 1.0));
+      }
+    }
+
+    DataVector result;
+    mapped.multiEval(points, result);
+
+    for (size_t r = 0; r < points.getNrows(); r++) {
+      points.getRow(r, point);
+      const double expected = opEval->eval(alpha, point);
+      BOOST_CHECK_CLOSE(mapped.eval(point), expected, 1e-10);
+      BOOST_CHECK_CLOSE(result[r], expected, 1e-10);
+    }
+  }
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testEvalWithBoundingBox) {
+  // the in place evaluation follows the bounding box and the basis of the grid type
+  const size_t dim = 2;
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.emplace_back(Grid::createLinearGrid(dim));
+  grids.emplace_back(Grid::createLinearBoundaryGrid(dim));
+  grids.emplace_back(Grid::createBsplineGrid(dim, 3));
+  grids.emplace_back(Grid::createModBsplineGrid(dim, 3));
+  grids.emplace_back(Grid::createPolyBoundaryGrid(dim, 2));
+  grids.emplace_back(Grid::createPrewaveletGrid(dim));
+
+  DataMatrix points(20, dim);
+
+  for (size_t r = 0; r < points.getNrows(); r++) {
+    points.set(r, 0, -1.0 + 3.0 * std::fmod(0.137 * static_cast<double>(r + 1), 1.0));
+    points.set(r, 1, std::fmod(0.291 * static_cast<double>(r + 1), 1.0));
+  }
+
+  std::string filename = "test_MappedGrid.sgb";
+
+  for (std::unique_ptr<Grid>& grid : grids) {
+    grid->getGenerator().regular(4);
+    grid->getBoundingBox().setBoundary(0, BoundingBox1D(-1.0, 2.0));
+    DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = std::cos(static_cast<double>(i));
+    }
+
+    MappedGrid::write(filename, *grid, &alpha);
+    MappedGrid mapped(filename);
+
+    std::unique_ptr<OperationEval> opEval(createReferenceOperation(*grid));
+    DataVector result;
+    DataVector point(dim);
+    mapped.multiEval(points, result);
+    BOOST_REQUIRE_EQUAL(result.getSize(), points.getNrows());
+
+    for (size_t r = 0; r < points.getNrows(); r++) {
+      points.getRow(r, point);
+      const double expected = opEval->eval(alpha, point);
+      BOOST_CHECK_SMALL(result[r] - expected, 1e-10);
+      BOOST_CHECK_SMALL(mapped.eval(point) - expected, 1e-10);
+    }
+  }
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testWithoutAlphaAndCorruptFile) {
+  std::unique_ptr<Grid> grid(Grid::createPolyGrid(2, 3));
+  grid->getGenerator().regular(3);
+
+  std::string filename = "test_MappedGrid.sgb";
+  MappedGrid::write(filename, *grid);
+
+  {
+    MappedGrid mapped(filename);
+    BOOST_CHECK(!mapped.hasAlpha());
+    BOOST_CHECK(mapped.getType() == GridType::Poly);
+
+    std::unique_ptr<Grid> newGrid(mapped.createGrid());
+    BOOST_CHECK_EQUAL(newGrid->getSize(), grid->getSize());
+    BOOST_CHECK_EQUAL(newGrid->serialize(), grid->serialize());
+  }
+
+  // a file that is not a binary grid is rejected
+  {
+    std::ofstream fout(filename.c_str());
+    fout << grid->serialize();
+  }
+
+  BOOST_CHECK_THROW(MappedGrid mapped(filename), file_exception);
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,7 @@
 #include <sgpp/base/operation/hash/common/basis/PolyClenshawCurtisBasis.hpp>
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
 #include <vector>
@@ -42,6 +43,7 @@ using sgpp::base::SPolyBase;
 using sgpp::base::SPolyBoundaryBase;
 using sgpp::base::SPolyModifiedBase;
 using sgpp::base::SPolyClenshawCurtisBoundaryBase;
+using sgpp::base::SurplusRefinementFunctor;
 
 double basisEval(SBasis& basis, GridPoint::level_type l, GridPoint::index_type i, double x) {
   return basis.eval(l, i, x);
@@ -425,3 +427,239 @@ BOOST_AUTO_TEST_CASE(TestOperationEvalNaive) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestOperationEvalLocalSupport) {
+  const size_t d = 3;
+  const size_t l = 3;
+  const size_t p = 3;
+  const size_t m = 2;
+  const size_t N = 20;
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineBoundaryGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineClenshawCurtisGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineGrid(d, p + 2)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineClenshawCurtisGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createFundamentalSplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModFundamentalSplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createWaveletGrid(d)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createWaveletBoundaryGrid(d)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModWaveletGrid(d)));
+
+  for (std::unique_ptr<Grid>& gridPtr : grids) {
+    Grid& grid = *gridPtr;
+
+    // create adaptively refined sparse grid
+    grid.getGenerator().regular(l);
+    DataVector alpha(grid.getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = normalDistribution(generator);
+    }
+
+    SurplusRefinementFunctor refinementFunctor(alpha, 5);
+    grid.getGenerator().refine(refinementFunctor);
+    const size_t n = grid.getSize();
+
+    // set random bounding box
+    BoundingBox& boundingBox = grid.getBoundingBox();
+
+    for (size_t t = 0; t < d; t++) {
+      const double left = normalDistribution(generator);
+      const double right = left + std::abs(normalDistribution(generator));
+      boundingBox.setBoundary(t, BoundingBox1D(left, right));
+    }
+
+    DataVector alphaVector(n);
+    DataMatrix alphaMatrix(n, m);
+
+    for (size_t i = 0; i < n; i++) {
+      alphaVector[i] = normalDistribution(generator);
+
+      for (size_t q = 0; q < m; q++) {
+        alphaMatrix(i, q) = normalDistribution(generator);
+      }
+    }
+
+    std::unique_ptr<OperationEval> opEvalNaive(sgpp::op_factory::createOperationEvalNaive(grid));
+    std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEval(grid));
+    std::unique_ptr<OperationEvalGradient> opEvalGradientNaive(
+        sgpp::op_factory::createOperationEvalGradientNaive(grid));
+    std::unique_ptr<OperationEvalGradient> opEvalGradient(
+        sgpp::op_factory::createOperationEvalGradient(grid));
+    std::unique_ptr<OperationEvalHessian> opEvalHessianNaive(
+        sgpp::op_factory::createOperationEvalHessianNaive(grid));
+    std::unique_ptr<OperationEvalHessian> opEvalHessian(
+        sgpp::op_factory::createOperationEvalHessian(grid));
+    std::unique_ptr<OperationEvalPartialDerivative> opEvalPartialDerivativeNaive(
+        sgpp::op_factory::createOperationEvalPartialDerivativeNaive(grid));
+    std::unique_ptr<OperationEvalPartialDerivative> opEvalPartialDerivative(
+        sgpp::op_factory::createOperationEvalPartialDerivative(grid));
+
+    DataVector y(d);
+
+    for (size_t r = 0; r < N; r++) {
+      // evaluate at random point (including the corners of the bounding box)
+      for (size_t t = 0; t < d; t++) {
+        const double x = (r < 2) ? static_cast<double>(r) : uniformDistribution(generator);
+        y[t] = boundingBox.getIntervalOffset(t) + boundingBox.getIntervalWidth(t) * x;
+      }
+
+      // vector version
+      checkClose(opEvalNaive->eval(alphaVector, y), opEval->eval(alphaVector, y));
+
+      DataVector gradientNaive(d), gradient(d);
+      DataMatrix hessianNaive(d, d), hessian(d, d);
+      checkClose(opEvalGradientNaive->evalGradient(alphaVector, y, gradientNaive),
+                 opEvalGradient->evalGradient(alphaVector, y, gradient));
+      checkClose(gradientNaive, gradient);
+      checkClose(opEvalHessianNaive->evalHessian(alphaVector, y, gradientNaive, hessianNaive),
+                 opEvalHessian->evalHessian(alphaVector, y, gradient, hessian));
+      checkClose(gradientNaive, gradient);
+      checkClose(hessianNaive, hessian);
+
+      for (size_t t = 0; t < d; t++) {
+        double partialDerivativeNaive, partialDerivative;
+        checkClose(opEvalPartialDerivativeNaive->evalPartialDerivative(alphaVector, y, t,
+                                                                       partialDerivativeNaive),
+                   opEvalPartialDerivative->evalPartialDerivative(alphaVector, y, t,
+                                                                  partialDerivative));
+        checkClose(partialDerivativeNaive, partialDerivative);
+      }
+
+      // matrix version
+      DataVector valueNaive(m), value(m);
+      opEvalNaive->eval(alphaMatrix, y, valueNaive);
+      opEval->eval(alphaMatrix, y, value);
+      checkClose(valueNaive, value);
+
+      DataMatrix jacobianNaive(m, d), jacobian(m, d);
+      std::vector<DataMatrix> hessiansNaive, hessians;
+      opEvalHessianNaive->evalHessian(alphaMatrix, y, valueNaive, jacobianNaive, hessiansNaive);
+      opEvalHessian->evalHessian(alphaMatrix, y, value, jacobian, hessians);
+      checkClose(valueNaive, value);
+      checkClose(jacobianNaive, jacobian);
+      checkClose(hessiansNaive, hessians);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestOperationEvalMultiple) {
+  const size_t d = 3;
+  const size_t l = 4;
+  const size_t p = 3;
+  const size_t N = 50;
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.push_back(std::unique_ptr<Grid>(Grid::createBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModBsplineGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createPolyGrid(d, p)));
+  grids.push_back(std::unique_ptr<Grid>(Grid::createModPolyGrid(d, p)));
+
+  for (std::unique_ptr<Grid>& gridPtr : grids) {
+    Grid& grid = *gridPtr;
+    const bool isPoly =
+        (grid.getType() == GridType::Poly) || (grid.getType() == GridType::ModPoly);
+
+    grid.getGenerator().regular(l);
+    const size_t n = grid.getSize();
+
+    // polynomial operations do not support bounding boxes
+    if (!isPoly) {
+      for (size_t t = 0; t < d; t++) {
+        const double left = normalDistribution(generator);
+        const double right = left + std::abs(normalDistribution(generator));
+        grid.getBoundingBox().setBoundary(t, BoundingBox1D(left, right));
+      }
+    }
+
+    BoundingBox& boundingBox = grid.getBoundingBox();
+    DataVector alpha(n);
+
+    for (size_t i = 0; i < n; i++) {
+      alpha[i] = normalDistribution(generator);
+    }
+
+    DataMatrix points(N, d);
+
+    for (size_t r = 0; r < N; r++) {
+      for (size_t t = 0; t < d; t++) {
+        points(r, t) = boundingBox.getIntervalOffset(t) +
+                       boundingBox.getIntervalWidth(t) * uniformDistribution(generator);
+      }
+    }
+
+    std::vector<std::unique_ptr<OperationEval>> opEvals;
+    std::vector<std::unique_ptr<OperationEvalGradient>> opEvalGradients;
+    std::vector<std::unique_ptr<OperationEvalHessian>> opEvalHessians;
+
+    opEvals.push_back(
+        std::unique_ptr<OperationEval>(sgpp::op_factory::createOperationEval(grid)));
+    opEvals.push_back(
+        std::unique_ptr<OperationEval>(sgpp::op_factory::createOperationEvalNaive(grid)));
+    opEvalGradients.push_back(std::unique_ptr<OperationEvalGradient>(
+        sgpp::op_factory::createOperationEvalGradient(grid)));
+    opEvalHessians.push_back(std::unique_ptr<OperationEvalHessian>(
+        sgpp::op_factory::createOperationEvalHessian(grid)));
+
+    if (!isPoly) {
+      opEvalGradients.push_back(std::unique_ptr<OperationEvalGradient>(
+          sgpp::op_factory::createOperationEvalGradientNaive(grid)));
+      opEvalHessians.push_back(std::unique_ptr<OperationEvalHessian>(
+          sgpp::op_factory::createOperationEvalHessianNaive(grid)));
+    }
+
+    DataVector point(d);
+    DataVector values;
+    DataMatrix gradients;
+    std::vector<DataMatrix> hessians;
+
+    for (std::unique_ptr<OperationEval>& opEval : opEvals) {
+      opEval->evalMultiple(alpha, points, values);
+      BOOST_CHECK_EQUAL(values.getSize(), N);
+
+      for (size_t r = 0; r < N; r++) {
+        points.getRow(r, point);
+        checkClose(values[r], opEval->eval(alpha, point));
+      }
+    }
+
+    for (std::unique_ptr<OperationEvalGradient>& opEvalGradient : opEvalGradients) {
+      opEvalGradient->evalGradientMultiple(alpha, points, values, gradients);
+      DataVector gradient(d), gradient2(d);
+
+      for (size_t r = 0; r < N; r++) {
+        points.getRow(r, point);
+        checkClose(values[r], opEvalGradient->evalGradient(alpha, point, gradient));
+        gradients.getRow(r, gradient2);
+        checkClose(gradient, gradient2);
+      }
+    }
+
+    for (std::unique_ptr<OperationEvalHessian>& opEvalHessian : opEvalHessians) {
+      opEvalHessian->evalHessianMultiple(alpha, points, values, gradients, hessians);
+      BOOST_CHECK_EQUAL(hessians.size(), N);
+      DataVector gradient(d), gradient2(d);
+      DataMatrix hessian(d, d);
+
+      for (size_t r = 0; r < N; r++) {
+        points.getRow(r, point);
+        checkClose(values[r], opEvalHessian->evalHessian(alpha, point, gradient, hessian));
+        gradients.getRow(r, gradient2);
+        checkClose(gradient, gradient2);
+        checkClose(hessian, hessians[r]);
+      }
+    }
+  }
+}
@@ -205,6 +205,39 @@ BOOST_AUTO_TEST_CASE(testHierarchisationModFundamentalSpline) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testHierarchisationBspline) {
+  int level = 5;
+
+  for (int dim = 1; dim < 4; dim++) {
+    for (int degree = 1; degree < 6; degree += 2) {
+      std::unique_ptr<Grid> grid(Grid::createBsplineGrid(dim, degree));
+      testHierarchisationDehierarchisation(*grid, level, &parabola, 1e-8, true);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testHierarchisationModBspline) {
+  int level = 5;
+
+  for (int dim = 1; dim < 4; dim++) {
+    for (int degree = 1; degree < 6; degree += 2) {
+      std::unique_ptr<Grid> grid(Grid::createModBsplineGrid(dim, degree));
+      testHierarchisationDehierarchisation(*grid, level, &parabola, 1e-8, true);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testHierarchisationNakBsplineBoundaryCombigrid) {
+  int level = 4;
+
+  for (int dim = 1; dim < 4; dim++) {
+    for (int degree = 1; degree < 6; degree += 2) {
+      std::unique_ptr<Grid> grid(Grid::createNakBsplineBoundaryCombigridGrid(dim, degree));
+      testHierarchisationDehierarchisation(*grid, level, &parabolaBoundary, 1e-8, true);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testHierarchisationPoly) {
   int level = 5;
   int degree[4] = {2, 3, 5, 8};
@@ -8,16 +8,28 @@
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusCoarseningFunctor.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashCoarsening.hpp>
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <cmath>
+#include <memory>
+#include <vector>
+
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::base::GridStorage;
+using sgpp::base::HashCoarsening;
+using sgpp::base::HashGridPoint;
 using sgpp::base::OperationMultipleEval;
+using sgpp::base::SurplusCoarseningFunctor;
+using sgpp::base::SurplusRefinementFunctor;
 
 BOOST_AUTO_TEST_SUITE(TestOperationMultipleEval)
 
@@ -78,4 +90,237 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalBlock) {
+  const size_t dim = 3;
+  const size_t numberDataPoints = 200;
+  const size_t numberVectors = 3;
+
+  // hierarchical kernels of all grid types with a blocked multiplication, naive kernels use
+  // the blocked default of OperationMultipleEval (for the B-spline grid the one by columns)
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.emplace_back(Grid::createLinearGrid(dim));
+  grids.emplace_back(Grid::createModLinearGrid(dim));
+  grids.emplace_back(Grid::createLinearBoundaryGrid(dim));
+  grids.emplace_back(Grid::createPeriodicGrid(dim));
+  grids.emplace_back(Grid::createPolyGrid(dim, 3));
+  grids.emplace_back(Grid::createModPolyGrid(dim, 3));
+  grids.emplace_back(Grid::createPolyBoundaryGrid(dim, 3));
+  grids.emplace_back(Grid::createLinearBoundaryGrid(dim));
+  grids.emplace_back(Grid::createBsplineGrid(dim, 3));
+  const size_t numberHierarchicalKernels = 7;
+
+  for (size_t g = 0; g < grids.size(); g++) {
+    std::unique_ptr<Grid>& grid = grids[g];
+    grid->getGenerator().regular(4);
+    // the polynomial boundary kernel supports neither bounding boxes nor points outside of them
+    const bool unitCube = (grid->getType() == sgpp::base::GridType::PolyBoundary);
+
+    if (!unitCube) {
+      grid->getBoundingBox().setBoundary(0, BoundingBox1D(-1.0, 2.0));
+    }
+
+    const size_t N = grid->getSize();
+
+    // some points lie on the boundary or outside of the bounding box
+    DataMatrix dataset(numberDataPoints, dim);
+
+    for (size_t i = 0; i < numberDataPoints; ++i) {
+      for (size_t t = 0; t < dim; ++t) {
+        dataset(i, t) = std::abs(std::sin(static_cast<double>(i * dim + t)));
+      }
+    }
+
+    dataset(0, 1) = 1.0;
+
+    if (!unitCube) {
+      dataset(1, 0) = 2.0;
+      dataset(2, 0) = 2.5;
+    }
+
+    DataMatrix alpha(N, numberVectors);
+    DataMatrix source(numberDataPoints, numberVectors);
+
+    for (size_t j = 0; j < numberVectors; ++j) {
+      for (size_t i = 0; i < N; ++i) {
+        alpha(i, j) = std::cos(static_cast<double>(i + j * N));
+      }
+
+      for (size_t i = 0; i < numberDataPoints; ++i) {
+        source(i, j) = std::cos(static_cast<double>(i * (j + 1)));
+      }
+    }
+
+    std::unique_ptr<OperationMultipleEval> op(
+        (g < numberHierarchicalKernels)
+            ? sgpp::op_factory::createOperationMultipleEval(*grid, dataset)
+            : sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+    DataMatrix result;
+    DataMatrix resultTranspose;
+    op->multBlock(alpha, result);
+    op->multTransposeBlock(source, resultTranspose);
+
+    BOOST_CHECK_EQUAL(result.getNrows(), numberDataPoints);
+    BOOST_CHECK_EQUAL(result.getNcols(), numberVectors);
+    BOOST_CHECK_EQUAL(resultTranspose.getNrows(), N);
+    BOOST_CHECK_EQUAL(resultTranspose.getNcols(), numberVectors);
+
+    for (size_t j = 0; j < numberVectors; ++j) {
+      DataVector alphaColumn(N);
+      DataVector resultColumn(numberDataPoints);
+      alpha.getColumn(j, alphaColumn);
+      op->mult(alphaColumn, resultColumn);
+
+      for (size_t i = 0; i < numberDataPoints; ++i) {
+        BOOST_CHECK_SMALL(result(i, j) - resultColumn[i], 1e-12);
+      }
+
+      DataVector sourceColumn(numberDataPoints);
+      DataVector resultTransposeColumn(N);
+      source.getColumn(j, sourceColumn);
+      op->multTranspose(sourceColumn, resultTransposeColumn);
+
+      for (size_t i = 0; i < N; ++i) {
+        BOOST_CHECK_SMALL(resultTranspose(i, j) - resultTransposeColumn[i], 1e-12);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalIncremental) {
+  const size_t dim = 3;
+  const size_t numberDataPoints = 300;
+
+  // the kernels of the linear and the B-spline grid transform the data points to the unit cube,
+  // the kernels of the modified linear and polynomial grids ignore the bounding box,
+  // the prewavelet and polynomial boundary grids use the fallback to the complete multiplication
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.emplace_back(Grid::createLinearGrid(dim));
+  grids.emplace_back(Grid::createLinearBoundaryGrid(dim));
+  grids.emplace_back(Grid::createBsplineGrid(dim, 3));
+  grids.emplace_back(Grid::createModLinearGrid(dim));
+  grids.emplace_back(Grid::createPolyGrid(dim, 3));
+  grids.emplace_back(Grid::createModPolyGrid(dim, 3));
+  grids.emplace_back(Grid::createPrewaveletGrid(dim));
+  grids.emplace_back(Grid::createPolyBoundaryGrid(dim, 3));
+  // the B-spline grid is only supported by the naive kernel
+  const size_t naiveGrid = 2;
+  const size_t firstFallbackGrid = 6;
+
+  // the data points lie in the unit cube and in the bounding box of the grids
+  DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; ++i) {
+    for (size_t t = 0; t < dim; ++t) {
+      dataset(i, t) = std::abs(std::sin(static_cast<double>(i * dim + t)));
+    }
+  }
+
+  DataVector source(numberDataPoints);
+
+  for (size_t i = 0; i < numberDataPoints; ++i) {
+    source[i] = std::cos(static_cast<double>(i));
+  }
+
+  for (size_t g = 0; g < grids.size(); ++g) {
+    std::unique_ptr<Grid>& grid = grids[g];
+    grid->getGenerator().regular(3);
+    grid->getBoundingBox().setBoundary(0, BoundingBox1D(-1.0, 2.0));
+
+    auto createOperation = [&grid, &dataset, g]() {
+      return (g == naiveGrid)
+                 ? sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset)
+                 : sgpp::op_factory::createOperationMultipleEval(*grid, dataset);
+    };
+
+    DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < alpha.getSize(); ++i) {
+      alpha[i] = std::cos(static_cast<double>(i));
+    }
+
+    DataVector result(numberDataPoints);
+    DataVector resultTranspose(grid->getSize());
+    std::unique_ptr<OperationMultipleEval> op(createOperation());
+    op->mult(alpha, result);
+    op->multTranspose(source, resultTranspose);
+
+    // refine and assign coefficients to the new grid points only
+    std::vector<size_t> addedPoints;
+    SurplusRefinementFunctor functor(alpha, 5);
+    grid->getGenerator().refine(functor, &addedPoints);
+    BOOST_REQUIRE(!addedPoints.empty());
+    alpha.resizeZero(grid->getSize());
+    resultTranspose.resizeZero(grid->getSize());
+
+    for (size_t k : addedPoints) {
+      alpha[k] = 1.0 + static_cast<double>(k % 3);
+    }
+
+    // change an old coefficient as well
+    std::vector<size_t> changedPoints(addedPoints);
+    changedPoints.push_back(1);
+    DataVector alphaChange(alpha.getSize(), 0.0);
+    alphaChange[1] = 0.5;
+    alpha[1] += 0.5;
+
+    for (size_t k : addedPoints) {
+      alphaChange[k] = alpha[k];
+    }
+
+    op.reset(createOperation());
+    op->multIncremental(alphaChange, result, changedPoints);
+    op->multTransposeIncremental(source, resultTranspose, addedPoints);
+
+    DataVector resultReference(numberDataPoints);
+    DataVector resultTransposeReference(grid->getSize());
+    op->mult(alpha, resultReference);
+    op->multTranspose(source, resultTransposeReference);
+
+    for (size_t i = 0; i < numberDataPoints; ++i) {
+      BOOST_CHECK_SMALL(result[i] - resultReference[i], 1e-10);
+    }
+
+    for (size_t i = 0; i < grid->getSize(); ++i) {
+      BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeReference[i], 1e-10);
+    }
+
+    // coarsen (removes the first leaves) and remove the contributions of the removed points
+    std::vector<HashGridPoint> removedPoints;
+    std::vector<size_t> removedSeq;
+    DataVector coarseningValues(grid->getSize(), 0.5);
+    SurplusCoarseningFunctor coarseningFunctor(coarseningValues, 4, 0.6);
+    DataVector alphaOld(alpha);
+    HashCoarsening().free_coarsen(grid->getStorage(), coarseningFunctor, alpha, &removedPoints,
+                                  &removedSeq);
+    BOOST_REQUIRE(!removedPoints.empty());
+    BOOST_REQUIRE_EQUAL(alpha.getSize(), grid->getSize());
+
+    op.reset(createOperation());
+
+    if (g >= firstFallbackGrid) {
+      BOOST_CHECK_THROW(op->multRemoved(alphaOld, result, removedPoints, removedSeq),
+                        sgpp::base::operation_exception);
+      continue;
+    }
+
+    op->multRemoved(alphaOld, result, removedPoints, removedSeq);
+    resultTranspose.remove(removedSeq);
+
+    resultReference.resize(numberDataPoints);
+    resultTransposeReference.resize(grid->getSize());
+    op->mult(alpha, resultReference);
+    op->multTranspose(source, resultTransposeReference);
+
+    for (size_t i = 0; i < numberDataPoints; ++i) {
+      BOOST_CHECK_SMALL(result[i] - resultReference[i], 1e-10);
+    }
+
+    BOOST_REQUIRE_EQUAL(resultTranspose.getSize(), grid->getSize());
+
+    for (size_t i = 0; i < grid->getSize(); ++i) {
+      BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeReference[i], 1e-10);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -276,6 +276,35 @@ void fundamentalSplineTest(SBasis& basis, bool modified = false) {
   }
 }
 
+void polyDerivativesTest(SBasis& basis) {
+  // Test derivatives of polynomial basis functions in the interior of their support
+  // (the functions are cut off at the boundary of their support).
+  const double dx = 1e-8;
+  const double tol1 = 1e-3;
+  const double tol2 = 1e-2;
+
+  for (level_t l = 1; l < 6; l++) {
+    const double h = 1.0 / static_cast<double>(static_cast<index_t>(1) << l);
+
+    for (index_t i = 1; i < (static_cast<index_t>(1) << l); i += 2) {
+      for (size_t j = 1; j < 20; j++) {
+        const double x = h * (static_cast<double>(i) - 1.0 + static_cast<double>(j) / 10.0);
+
+        if ((x <= dx) || (x >= 1.0 - dx) || (j == 10)) {
+          // skip the domain boundary and the kink of the modified functions
+          continue;
+        }
+
+        errorTest((basis.eval(l, i, x + dx) - basis.eval(l, i, x - dx)) / (2.0 * dx),
+                  basisEvalDx(basis, l, i, x), tol1);
+        errorTest(
+            (basisEvalDx(basis, l, i, x + dx) - basisEvalDx(basis, l, i, x - dx)) / (2.0 * dx),
+            basisEvalDxDx(basis, l, i, x), tol2);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE(TestAlgorithms)
 
 BOOST_AUTO_TEST_CASE(TestLinearBasis) {
@@ -417,6 +446,22 @@ BOOST_AUTO_TEST_CASE(TestWaveletModifiedBasis) {
   derivativesTest(basis, 2, 1, 2);
 }
 
+BOOST_AUTO_TEST_CASE(TestPolyBasis) {
+  // Test polynomial basis.
+  for (size_t p = 2; p <= 5; p++) {
+    sgpp::base::SPolyBase basis(p);
+    polyDerivativesTest(basis);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestPolyModifiedBasis) {
+  // Test modified polynomial basis.
+  for (size_t p = 2; p <= 5; p++) {
+    sgpp::base::SPolyModifiedBase basis(p);
+    polyDerivativesTest(basis);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(TestGetAffectedBasisFunctions) {
   GridPoint i(1);
   GridStorage s(1);
@@ -129,6 +129,7 @@
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp"
+%include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp"
 %ignore  sgpp::datadriven::FileSampleDecorator::operator=(FileSampleDecorator&&);
 %rename(__assign__) sgpp::datadriven::FileSampleDecorator::operator =;
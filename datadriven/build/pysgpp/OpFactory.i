@@ -49,3 +49,7 @@
     sgpp::base::Grid& grid, sgpp::base::DataMatrix& dataset,
     sgpp::datadriven::OperationMultipleEvalConfiguration& configuration);
 %newobject sgpp::op_factory::createOperationCovariance(sgpp::base::Grid& grid);
+%newobject sgpp::op_factory::createOperationCreateGraph(sgpp::base::DataMatrix& dataset, size_t k);
+%newobject sgpp::op_factory::createOperationPruneGraph(
+    sgpp::base::Grid& grid, sgpp::base::DataVector& alpha, sgpp::base::DataMatrix& data,
+    double threshold, size_t k, sgpp::datadriven::OperationMultipleEvalConfiguration configuration);
@@ -8,6 +8,7 @@
 %shared_ptr(sgpp::datadriven::DMSystemMatrix)
 %shared_ptr(sgpp::datadriven::DensitySystemMatrix)
 %shared_ptr(sgpp::datadriven::OperationRegularizationDiagonal)
+%shared_ptr(sgpp::datadriven::OperationMultipleEvalPlan)
 
 %{
 #include <sgpp/solver/TypesSolver.hpp>
@@ -30,6 +31,8 @@
 %include "datadriven/src/sgpp/datadriven/algorithm/DMSystemMatrix.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/DensitySystemMatrix.hpp"
 %include "datadriven/src/sgpp/datadriven/tools/Dataset.hpp"
+%ignore sgpp::datadriven::BinaryDatasetFile::BinaryDatasetFile(const char*, size_t);
+%include "datadriven/src/sgpp/datadriven/tools/BinaryDatasetFile.hpp"
 %include "datadriven/src/sgpp/datadriven/configuration/ParallelConfiguration.hpp"
 %include "datadriven/src/sgpp/datadriven/configuration/BatchConfiguration.hpp"
 %include "datadriven/src/sgpp/datadriven/configuration/CrossvalidationConfiguration.hpp"
@@ -50,6 +53,8 @@
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatDMSDenseIChol.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatDMSOrthoAdapt.hpp"
 %ignore *::operator=;
+%ignore sgpp::datadriven::DBMatOfflineFile::getMatrix;
+%include "datadriven/src/sgpp/datadriven/algorithm/DBMatOfflineFile.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatOffline.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatOfflineGE.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatOfflineChol.hpp"
@@ -138,6 +143,7 @@
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp"
+%include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/FileSampleDecorator.hpp"
 #ifdef ZLIB
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/GzipFileSampleDecorator.hpp"
@@ -222,7 +228,10 @@
 %include "datadriven/src/sgpp/datadriven/operation/hash/simple/OperationMakePositiveCandidateSetAlgorithm.hpp"
 %include "datadriven/src/sgpp/datadriven/operation/hash/simple/OperationMakePositive.hpp"
 %include "datadriven/src/sgpp/datadriven/operation/hash/simple/OperationLimitFunctionValueRange.hpp"
+%include "datadriven/src/sgpp/datadriven/operation/hash/simple/OperationCreateGraph.hpp"
+%include "datadriven/src/sgpp/datadriven/operation/hash/simple/OperationPruneGraph.hpp"
 
+%include "datadriven/src/sgpp/datadriven/operation/hash/OperationMultipleEvalPlan.hpp"
 %include "datadriven/src/sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp"
 
 // --------------------------------------
@@ -0,0 +1,89 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/ParallelDatasetReader.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+
+using sgpp::datadriven::CSVTools;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::ParallelDatasetReader;
+
+/**
+ * Compares the line-by-line CSV reader (CSVTools) with the memory-mapped parallel reader
+ * (ParallelDatasetReader) on a generated CSV file.
+ *
+ * usage: benchmark_DatasetReader [numberInstances] [dimension]
+ */
+int main(int argc, char** argv) {
+  const size_t numberInstances = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 500000;
+  const size_t dimension = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 10;
+  const std::string filename = "benchmark_DatasetReader.csv";
+
+  // write the benchmark file
+  {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    std::ofstream fout(filename.c_str());
+    fout << std::setprecision(12);
+
+    for (size_t d = 0; d < dimension; d++) {
+      fout << "x" << d << ",";
+    }
+
+    fout << "class\n";
+
+    for (size_t i = 0; i < numberInstances; i++) {
+      for (size_t d = 0; d < dimension; d++) {
+        fout << distribution(generator) << ",";
+      }
+
+      fout << ((distribution(generator) < 0.5) ? -1 : 1) << "\n";
+    }
+  }
+
+  std::ifstream sizeStream(filename.c_str(), std::ios::binary | std::ios::ate);
+  const double megabytes = static_cast<double>(sizeStream.tellg()) / 1e6;
+  std::cout << "file: " << numberInstances << " instances, " << dimension << " dimensions, "
+            << megabytes << " MB\n";
+
+  auto begin = std::chrono::high_resolution_clock::now();
+  Dataset reference = CSVTools::readCSVFromFile(filename, true, true);
+  auto end = std::chrono::high_resolution_clock::now();
+  const double referenceSeconds = std::chrono::duration<double>(end - begin).count();
+
+  begin = std::chrono::high_resolution_clock::now();
+  Dataset dataset = ParallelDatasetReader::readCSVFromFile(filename, true, true);
+  end = std::chrono::high_resolution_clock::now();
+  const double parallelSeconds = std::chrono::duration<double>(end - begin).count();
+
+  double maxDifference = 0.0;
+
+  for (size_t i = 0; i < reference.getData().getSize(); i++) {
+    maxDifference =
+        std::max(maxDifference, std::abs(reference.getData()[i] - dataset.getData()[i]));
+  }
+
+  std::cout << "CSVTools:              " << referenceSeconds << " s ("
+            << megabytes / referenceSeconds << " MB/s)\n";
+  std::cout << "ParallelDatasetReader: " << parallelSeconds << " s ("
+            << megabytes / parallelSeconds << " MB/s)\n";
+  std::cout << "speedup: " << referenceSeconds / parallelSeconds
+            << ", max. difference: " << maxDifference << "\n";
+
+  std::remove(filename.c_str());
+  return 0;
+}
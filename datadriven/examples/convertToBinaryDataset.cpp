@@ -0,0 +1,48 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/BinaryDatasetFile.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using sgpp::datadriven::BinaryDatasetFile;
+
+/**
+ * Converts a CSV or ARFF file into the binary dataset format, which can be read by the
+ * BinaryFileSampleProvider (file type "bin" in the data source configuration).
+ *
+ * usage: convertToBinaryDataset input.(csv|arff) output.bin [float32] [noTargets]
+ */
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    std::cout << "usage: " << argv[0] << " input.(csv|arff) output.bin [float32] [noTargets]\n";
+    return EXIT_FAILURE;
+  }
+
+  bool singlePrecision = false;
+  bool hasTargets = true;
+
+  for (int i = 3; i < argc; i++) {
+    const std::string option = argv[i];
+
+    if (option == "float32") {
+      singlePrecision = true;
+    } else if (option == "noTargets") {
+      hasTargets = false;
+    } else {
+      std::cout << "unknown option " << option << "\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  BinaryDatasetFile::convert(argv[1], argv[2], hasTargets, singlePrecision);
+
+  BinaryDatasetFile file(argv[2]);
+  std::cout << "wrote " << file.getNumberInstances() << " instances of dimension "
+            << file.getDimension() << " to " << argv[2] << "\n";
+  return EXIT_SUCCESS;
+}
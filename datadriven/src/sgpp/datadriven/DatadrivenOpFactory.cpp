@@ -87,6 +87,7 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationTestPrewavelet.hpp>
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalSIMD/OperationMultiEvalSIMD.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
 
 #ifdef __AVX__
@@ -432,6 +433,21 @@ base::OperationMultipleEval* createOperationMultipleEval(
   }
 
   // can now assume that MPI type is NONE
+  if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::SIMD &&
+      (configuration.getType() == sgpp::datadriven::OperationMultipleEvalType::DEFAULT ||
+       configuration.getType() == sgpp::datadriven::OperationMultipleEvalType::STREAMING)) {
+    if (grid.getType() == base::GridType::Linear ||
+        grid.getType() == base::GridType::LinearL0Boundary ||
+        grid.getType() == base::GridType::LinearBoundary ||
+        grid.getType() == base::GridType::LinearTruncatedBoundary ||
+        grid.getType() == base::GridType::ModLinear) {
+      return new datadriven::OperationMultiEvalSIMD(grid, dataset);
+    }
+
+    throw base::factory_exception(
+        "Error creating function: SIMD kernels are only available for linear grids");
+  }
+
   if (configuration.getType() == sgpp::datadriven::OperationMultipleEvalType::DEFAULT) {
     return createOperationMultipleEval(grid, dataset);
   }
@@ -440,7 +456,8 @@ base::OperationMultipleEval* createOperationMultipleEval(
     if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT ||
         configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
-        return new datadriven::OperationMultiEvalStreaming(grid, dataset);
+        return new datadriven::OperationMultiEvalStreaming(grid, dataset,
+                                                           configuration.getPlan());
       }
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::OCLMP) {
 #ifdef USE_OCL
@@ -571,5 +588,15 @@ datadriven::OperationCovariance* createOperationCovariance(base::Grid& grid) {
   return new datadriven::OperationCovariance(grid);
 }
 
+datadriven::OperationCreateGraph* createOperationCreateGraph(base::DataMatrix& dataset, size_t k) {
+  return new datadriven::OperationCreateGraph(dataset, k);
+}
+
+datadriven::OperationPruneGraph* createOperationPruneGraph(
+    base::Grid& grid, base::DataVector& alpha, base::DataMatrix& data, double threshold, size_t k,
+    datadriven::OperationMultipleEvalConfiguration configuration) {
+  return new datadriven::OperationPruneGraph(grid, alpha, data, threshold, k, configuration);
+}
+
 }  // namespace op_factory
 }  // namespace sgpp
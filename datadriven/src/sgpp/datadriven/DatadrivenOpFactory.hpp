@@ -19,6 +19,8 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationRosenblattTransformation.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformation.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationCovariance.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationCreateGraph.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationPruneGraph.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
 
@@ -241,5 +243,34 @@ datadriven::OperationLimitFunctionValueRange* createOperationLimitFunctionValueR
  */
 datadriven::OperationCovariance* createOperationCovariance(base::Grid& grid);
 
+/**
+ * Factory method, returning an OperationCreateGraph, which creates the k nearest neighbor graph
+ * of a dataset on the CPU.
+ * Note: object has to be freed after use.
+ *
+ * @param dataset data points (one per row)
+ * @param k number of neighbors per data point
+ * @return Pointer to the new OperationCreateGraph object
+ */
+datadriven::OperationCreateGraph* createOperationCreateGraph(base::DataMatrix& dataset, size_t k);
+
+/**
+ * Factory method, returning an OperationPruneGraph, which removes the nodes and edges of a
+ * k nearest neighbor graph in regions of low density on the CPU.
+ * Note: object has to be freed after use.
+ *
+ * @param grid Grid of the density
+ * @param alpha coefficients of the density
+ * @param data data points of the graph (one per row)
+ * @param threshold minimal density of nodes and edge midpoints
+ * @param k number of neighbors per data point
+ * @param configuration configuration of the OperationMultipleEval used to evaluate the density
+ * @return Pointer to the new OperationPruneGraph object
+ */
+datadriven::OperationPruneGraph* createOperationPruneGraph(
+    base::Grid& grid, base::DataVector& alpha, base::DataMatrix& data, double threshold, size_t k,
+    datadriven::OperationMultipleEvalConfiguration configuration =
+        datadriven::OperationMultipleEvalConfiguration());
+
 }  // namespace op_factory
 }  // namespace sgpp
@@ -50,6 +50,39 @@ void DBMatDMSChol::solve(sgpp::base::DataMatrix& decompMatrix, sgpp::base::DataV
   // std::cout << alpha.toString() << std::endl;
 }
 
+void DBMatDMSChol::solve(const double* decompMatrix, size_t size, sgpp::base::DataVector& alpha,
+                         const sgpp::base::DataVector& b) const {
+  if ((alpha.getSize() != size) || (b.getSize() != size)) {
+    throw sgpp::base::data_exception("DBMatDMSChol::solve : vector sizes do not match the factor");
+  }
+
+  // Forward Substitution: L y = b
+  sgpp::base::DataVector y(size);
+
+  for (size_t i = 0; i < size; i++) {
+    const double* row = decompMatrix + i * size;
+    double sum = b[i];
+
+    for (size_t j = 0; j < i; j++) {
+      sum -= row[j] * y[j];
+    }
+
+    y[i] = sum / row[i];
+  }
+
+  // Backward Substitution: L' alpha = y
+  for (size_t k = size; k > 0; k--) {
+    const size_t i = k - 1;
+    double sum = y[i];
+
+    for (size_t j = i + 1; j < size; j++) {
+      sum -= decompMatrix[j * size + i] * alpha[j];
+    }
+
+    alpha[i] = sum / decompMatrix[i * size + i];
+  }
+}
+
 void DBMatDMSChol::solveParallel(DataMatrixDistributed& decompMatrix, DataVectorDistributed& x,
                                  double lambda_old, double lambda_new) const {
 #ifdef USE_SCALAPACK
@@ -36,6 +36,19 @@ class DBMatDMSChol : public DBMatDecompMatrixSolver {
   virtual void solve(sgpp::base::DataMatrix& decompMatrix, sgpp::base::DataVector& alpha,
                      const sgpp::base::DataVector& b, double lambda_old, double lambda_new) const;
 
+  /**
+   * Solves a system of equations with a read-only cholesky factor, e.g. one that is mapped
+   * from a file in the binary offline format (see DBMatOfflineFile). As the factor is not
+   * modified, the regularization parameter the factor has been computed for is used.
+   *
+   * @param decompMatrix the LL' lower triangular cholesky factor (row-major, size x size)
+   * @param size number of rows (and columns) of the factor
+   * @param alpha the vector of unknowns (the result is stored there)
+   * @param b the right hand vector of the equation system
+   */
+  void solve(const double* decompMatrix, size_t size, sgpp::base::DataVector& alpha,
+             const sgpp::base::DataVector& b) const;
+
   /**
    * Parallel (distributed) version of solve.
    * @param decompMatrix the LL' lower triangular cholesky factor
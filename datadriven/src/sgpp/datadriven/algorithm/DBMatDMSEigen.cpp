@@ -48,6 +48,30 @@ void DBMatDMSEigen::solve(sgpp::base::DataMatrix& eigenVectors,
   gsl_vector_free(res);
 }
 
+void DBMatDMSEigen::solve(const double* eigenDecomposition, size_t n,
+                          sgpp::base::DataVector& alpha, const sgpp::base::DataVector& rhs,
+                          double lambda) const {
+  gsl_matrix_const_view q = gsl_matrix_const_view_array(eigenDecomposition, n, n);
+  gsl_vector_const_view b = gsl_vector_const_view_array(rhs.getPointer(), n);
+  const double* eigenValues = eigenDecomposition + n * n;
+  gsl_vector* res = gsl_vector_alloc(n);
+
+  // Compute Q^T * b
+  gsl_blas_dgemv(CblasTrans, 1., &q.matrix, &b.vector, 0., res);
+
+  // Compute D^(-1) * Q^T * b (with D = E + lambda * I) without touching the eigenvalues
+  for (size_t i = 0; i < n; i++) {
+    gsl_vector_set(res, i, gsl_vector_get(res, i) / (eigenValues[i] + lambda));
+  }
+
+  alpha.resizeZero(n);
+  gsl_vector_view alphaView = gsl_vector_view_array(alpha.getPointer(), n);
+
+  // Compute Q * D^(-1) * Q^T * b
+  gsl_blas_dgemv(CblasNoTrans, 1., &q.matrix, res, 0., &alphaView.vector);
+  gsl_vector_free(res);
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
 
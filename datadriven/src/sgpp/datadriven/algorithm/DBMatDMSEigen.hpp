@@ -40,6 +40,20 @@ class DBMatDMSEigen : public DBMatDecompMatrixSolver {
   void solve(sgpp::base::DataMatrix& eigenVectors,
              sgpp::base::DataVector& eigenValues, sgpp::base::DataVector& alpha,
              sgpp::base::DataVector& rhs, double lambda);
+
+  /**
+   * Solves a system of equations with a read-only eigen decomposition, e.g. one that is mapped
+   * from a file in the binary offline format (see DBMatOfflineFile).
+   *
+   * @param eigenDecomposition the eigendecomposed left hand side (row-major, (n+1) x n, the
+   * eigenvectors in rows 0...n-1 and the eigenvalues in row n)
+   * @param n number of eigenvalues
+   * @param alpha the vector of unknowns (the result is stored there)
+   * @param rhs the right hand vector of the equation system
+   * @param lambda the regularization parameter
+   */
+  void solve(const double* eigenDecomposition, size_t n, sgpp::base::DataVector& alpha,
+             const sgpp::base::DataVector& rhs, double lambda) const;
 };
 
 }  // namespace datadriven
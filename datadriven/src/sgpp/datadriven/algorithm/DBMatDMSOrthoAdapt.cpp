@@ -23,6 +23,12 @@ namespace datadriven {
 void DBMatDMSOrthoAdapt::solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMatrix& Q,
                                sgpp::base::DataMatrix& B, sgpp::base::DataVector& b,
                                sgpp::base::DataVector& alpha) {
+  solve(T_inv.getPointer(), Q.getPointer(), Q.getNrows(), B, b, alpha);
+}
+
+void DBMatDMSOrthoAdapt::solve(const double* T_inv, const double* Q, size_t size,
+                               sgpp::base::DataMatrix& B, sgpp::base::DataVector& b,
+                               sgpp::base::DataVector& alpha) {
 #ifdef USE_GSL
   // assert dimensions
   bool prior_refined = (B.getNcols() > 1);  // if B.getNcols <= 1, then no refining yet
@@ -45,17 +51,16 @@ void DBMatDMSOrthoAdapt::solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMa
    */
 
   // creating gsl_matrix_views to be able to use BLAS operations
-  gsl_matrix_view q_view = gsl_matrix_view_array(Q.getPointer(), Q.getNrows(), Q.getNcols());
-  gsl_matrix_view t_inv_view =
-      gsl_matrix_view_array(T_inv.getPointer(), T_inv.getNrows(), T_inv.getNcols());
+  gsl_matrix_const_view q_view = gsl_matrix_const_view_array(Q, size, size);
+  gsl_matrix_const_view t_inv_view = gsl_matrix_const_view_array(T_inv, size, size);
   gsl_matrix_view b_matrix_view = gsl_matrix_view_array(B.getPointer(), B.getNrows(), B.getNcols());
 
-  gsl_vector_view b_vector_view_cut = gsl_vector_view_array(b.getPointer(), Q.getNrows());
+  gsl_vector_view b_vector_view_cut = gsl_vector_view_array(b.getPointer(), size);
   gsl_vector_view b_vector_view = gsl_vector_view_array(b.getPointer(), b.getSize());
-  gsl_vector_view alpha_view_cut = gsl_vector_view_array(alpha.getPointer(), Q.getNrows());
+  gsl_vector_view alpha_view_cut = gsl_vector_view_array(alpha.getPointer(), size);
   gsl_vector_view alpha_view = gsl_vector_view_array(alpha.getPointer(), alpha.getSize());
 
-  gsl_vector* interim2 = gsl_vector_alloc(Q.getNrows());
+  gsl_vector* interim2 = gsl_vector_alloc(size);
 
   // calculating Q^t * b
   gsl_blas_dgemv(CblasTrans, 1.0, &q_view.matrix, &b_vector_view_cut.vector, 0.0,
@@ -68,7 +73,7 @@ void DBMatDMSOrthoAdapt::solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMa
   gsl_blas_dgemv(CblasNoTrans, 1.0, &q_view.matrix, interim2, 0.0, &alpha_view_cut.vector);
 
   // if B should not be considered
-  if (!prior_refined || B.getNcols() == Q.getNcols()) {
+  if (!prior_refined || B.getNcols() == size) {
     if (interim2->size != alpha.getSize()) {
       throw sgpp::base::algorithm_exception(
           "In DBMatDMSOrthoAdapt::solve: vector alpha does not match Q * T^{-1} * Q^t * b");
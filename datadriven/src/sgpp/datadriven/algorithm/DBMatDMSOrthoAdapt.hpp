@@ -40,6 +40,22 @@ class DBMatDMSOrthoAdapt : public DBMatDecompMatrixSolver {
   void solve(sgpp::base::DataMatrix& T_inv, sgpp::base::DataMatrix& Q, sgpp::base::DataMatrix& B,
              sgpp::base::DataVector& b, sgpp::base::DataVector& alpha);
 
+  /**
+   * Solves the system with read-only matrices T_inv and Q, e.g. ones that are mapped from a
+   * file in the binary offline format (see DBMatOfflineFile).
+   * The computation done: alpha = Q*T_inv*Q^t*b + B*b
+   *
+   * @param T_inv Inverse of a tridiagonal matrix (row-major, size x size)
+   * @param Q     Orthogonal matrix, part of hessenberg_decomp of the lhs matrix
+   *              (row-major, size x size)
+   * @param size  Number of rows (and columns) of T_inv and Q
+   * @param B     Storage of the online objects refined/coarsened points
+   * @param b     The right side of the system
+   * @param alpha The solution vector of the system, computed values go there
+   */
+  void solve(const double* T_inv, const double* Q, size_t size, sgpp::base::DataMatrix& B,
+             sgpp::base::DataVector& b, sgpp::base::DataVector& alpha);
+
   /**
    * Parallel (distributed) version of solve.
    *
@@ -12,6 +12,7 @@
 #include <sgpp/base/tools/json/json_exception.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 
 #include <algorithm>
 #include <string>
@@ -117,6 +118,20 @@ void DBMatDatabase::putDataMatrix(sgpp::base::GeneralGridConfiguration& gridConf
   }
 }
 
+void DBMatDatabase::putDataMatrix(const std::string& filepath, bool overwriteEntry) {
+  // only the header of the file is read
+  DBMatOfflineFile file(filepath);
+  sgpp::base::GeneralGridConfiguration gridConfig = file.getGridConfiguration();
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig =
+      file.getRegularizationConfiguration();
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = file.getDecompositionType();
+
+  putDataMatrix(gridConfig, adaptivityConfig, regularizationConfig, densityEstimationConfig,
+                filepath, overwriteEntry);
+}
+
 bool DBMatDatabase::gridConfigurationMatches(json::DictNode *node,
       sgpp::base::GeneralGridConfiguration& gridConfig, size_t entry_num) {
   // Check if grid general type matches
@@ -73,6 +73,16 @@ class DBMatDatabase{
       sgpp::datadriven::DensityEstimationConfiguration& densityEstimationConfig,
       std::string filepath, bool overwriteEntry = false);
 
+  /**
+   * Puts the filepath of a matrix decomposition stored in the binary offline format (see
+   * DBMatOffline::storeBinary) in the database. The configuration is read from the header of
+   * the file.
+   * @param filepath the path where the matrix decomposition is located at
+   * @param overwriteEntry replaces existing entries with the same configuration if and only if
+   * this parameter is set
+   */
+  void putDataMatrix(const std::string& filepath, bool overwriteEntry = false);
+
 
  private:
   /**
@@ -29,6 +29,7 @@
 #include <iomanip>
 #include <list>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
@@ -53,6 +54,7 @@ DBMatOffline::DBMatOffline(const DBMatOffline& rhs)
     : lhsMatrix(rhs.lhsMatrix),
       isConstructed(rhs.isConstructed),
       isDecomposed(rhs.isDecomposed),
+      mappedFile(rhs.mappedFile),
       interactions(rhs.interactions) {}
 
 DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs) {
@@ -62,6 +64,7 @@ DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs)
   lhsMatrix = rhs.lhsMatrix;
   isConstructed = rhs.isConstructed;
   isDecomposed = rhs.isDecomposed;
+  mappedFile = rhs.mappedFile;
   interactions = rhs.interactions;
   return *this;
 }
@@ -76,12 +79,21 @@ DBMatOffline::DBMatOffline(const std::string& filepath)
 
 DataMatrix& DBMatOffline::getDecomposedMatrix() {
   if (isDecomposed) {
+    releaseMappedFile();
     return lhsMatrix;
   } else {
     throw data_exception("Matrix was not decomposed yet");
   }
 }
 
+size_t DBMatOffline::getDecomposedMatrixNcols() const {
+  if (!isDecomposed) {
+    throw data_exception("Matrix was not decomposed yet");
+  }
+
+  return (mappedFile != nullptr) ? mappedFile->getNcols(0) : lhsMatrix.getNcols();
+}
+
 DataMatrixDistributed& DBMatOffline::getDecomposedMatrixDistributed() {
 #ifdef USE_SCALAPACK
   if (isDecomposed) {
@@ -98,6 +110,7 @@ void DBMatOffline::syncDistributedDecomposition(std::shared_ptr<BlacsProcessGrid
                                                 const ParallelConfiguration& parallelConfig) {
 #ifdef USE_SCALAPACK
   if (isDecomposed) {
+    releaseMappedFile();
     lhsDistributed = DataMatrixDistributed::fromSharedData(
         lhsMatrix.data(), processGrid, lhsMatrix.getNrows(), lhsMatrix.getNcols(),
         parallelConfig.rowBlockSize_, parallelConfig.columnBlockSize_);
@@ -134,6 +147,8 @@ void DBMatOffline::store(const std::string& fileName) {
     return;
   }
 
+  releaseMappedFile();
+
   // Write configuration
   std::ofstream outputFile(fileName, std::ofstream::out);
 
@@ -171,8 +186,57 @@ void DBMatOffline::store(const std::string& fileName) {
 #endif /* USE_GSL */
 }
 
+void DBMatOffline::storeBinary(const std::string& fileName,
+                               const sgpp::base::GeneralGridConfiguration& gridConfig,
+                               const RegularizationConfiguration& regularizationConfig) {
+  if (!isDecomposed) {
+    throw algorithm_exception("Matrix not decomposed yet");
+  } else if (getDecompositionType() == MatrixDecompositionType::LU) {
+    throw algorithm_exception(
+        "DBMatOffline: LU decompositions cannot be stored in the binary offline format");
+  }
+
+  releaseMappedFile();
+  DBMatOfflineFile::write(fileName, getDecompositionType(), gridConfig, regularizationConfig,
+                          interactions, getStoredMatrices());
+}
+
+void DBMatOffline::loadBinary(std::shared_ptr<const DBMatOfflineFile> file, bool verifyChecksum) {
+  if (file->getDecompositionType() != getDecompositionType()) {
+    throw algorithm_exception("DBMatOffline: decomposition type of the file does not match");
+  } else if (file->getNumberOfMatrices() != getStoredMatrices().size()) {
+    throw data_exception("DBMatOffline: binary offline object has a wrong number of matrices");
+  } else if (verifyChecksum && !file->verifyChecksum()) {
+    throw data_exception("DBMatOffline: checksum of the binary offline object does not match");
+  }
+
+  // the matrices stay in the file until they are accessed for writing
+  mappedFile = std::move(file);
+  interactions = mappedFile->getInteractions();
+  isConstructed = true;
+  isDecomposed = true;
+}
+
+void DBMatOffline::releaseMappedFile() {
+  if (mappedFile != nullptr) {
+    restoreMatrices(*mappedFile);
+    mappedFile.reset();
+  }
+}
+
+std::vector<const DataMatrix*> DBMatOffline::getStoredMatrices() const { return {&lhsMatrix}; }
+
+void DBMatOffline::restoreMatrices(const DBMatOfflineFile& file) {
+  if (file.getNumberOfMatrices() != 1) {
+    throw data_exception("DBMatOffline: binary offline object has to contain one matrix");
+  }
+
+  file.copyMatrix(0, lhsMatrix);
+}
+
 void DBMatOffline::printMatrix() {
   if (isDecomposed) {
+    releaseMappedFile();
     std::cout << "Size: " << lhsMatrix.getNrows() << " , " << lhsMatrix.getNcols() << "\n"
               << lhsMatrix.toString();
   } else {
@@ -221,9 +285,14 @@ void sgpp::datadriven::DBMatOffline::parseInter(
   std::cout << interactions.size() << std::endl;
 }
 
-size_t DBMatOffline::getGridSize() { return lhsMatrix.getNrows(); }
+size_t DBMatOffline::getGridSize() {
+  return (mappedFile != nullptr) ? mappedFile->getNrows(0) : lhsMatrix.getNrows();
+}
 
-sgpp::base::DataMatrix& DBMatOffline::getLhsMatrix_ONLY_FOR_TESTING() { return this->lhsMatrix; }
+sgpp::base::DataMatrix& DBMatOffline::getLhsMatrix_ONLY_FOR_TESTING() {
+  releaseMappedFile();
+  return this->lhsMatrix;
+}
 
 }  // namespace datadriven
 }  // namespace sgpp
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
 #include <sgpp/datadriven/configuration/ParallelConfiguration.hpp>
 #include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
@@ -86,11 +87,27 @@ class DBMatOffline {
 
   /**
    * Get a reference to the decomposed matrix. Throws if matrix has not yet been decomposed.
+   * If the decomposition is mapped from a binary offline file (see loadBinary()), it is copied
+   * and the file is released, as the caller may modify it.
    *
    * @return decomposed matrix
    */
   DataMatrix& getDecomposedMatrix();
 
+  /**
+   * Returns the number of columns of the decomposed matrix without copying a mapped
+   * decomposition. Throws if matrix has not yet been decomposed.
+   *
+   * @return number of columns of the decomposed matrix
+   */
+  size_t getDecomposedMatrixNcols() const;
+
+  /**
+   * @return the binary offline file the decomposition is mapped from or nullptr if the
+   * decomposition is held in memory
+   */
+  const DBMatOfflineFile* getMappedFile() const { return mappedFile.get(); }
+
   /**
    * Get a reference to the distributed decomposed matrix. Throws if matrix has not yet been
    * decomposed. In order to return valid data, syncDistributedDecomposition() has to be called if
@@ -148,6 +165,29 @@ class DBMatOffline {
    */
   virtual void store(const std::string& fileName);
 
+  /**
+   * Serialize the DBMatOffline Object in the binary offline format (see DBMatOfflineFile).
+   * In contrast to store(), the file contains the configuration the decomposition is based on
+   * and can be memory-mapped. Does not require GSL.
+   * @param fileName path where to store the file.
+   * @param gridConfig configuration of the grid the decomposition is based on
+   * @param regularizationConfig configuration of the regularization
+   */
+  void storeBinary(const std::string& fileName,
+                   const sgpp::base::GeneralGridConfiguration& gridConfig,
+                   const RegularizationConfiguration& regularizationConfig);
+
+  /**
+   * Restores the decomposition from a file in the binary offline format. The decomposition type
+   * of the file has to match the one of this object.
+   * The matrices are not copied: the object shares the mapped file and the online objects solve
+   * on the mapped matrices. The matrices are only copied by the first access that may modify
+   * them (e.g. getDecomposedMatrix() or a refinement).
+   * @param file the mapped file
+   * @param verifyChecksum whether the checksum of the file should be checked
+   */
+  void loadBinary(std::shared_ptr<const DBMatOfflineFile> file, bool verifyChecksum = true);
+
   /**
    * Returns the dimensionality of the quadratic lhs matrix (i.e. the number of rows)
    * @return the grid size
@@ -169,6 +209,9 @@ class DBMatOffline {
   // distributed lhs, only initialized in ScaLAPACK version
   DataMatrixDistributed lhsDistributed;
 
+  // binary offline file the decomposition is mapped from (nullptr if it is held in lhsMatrix)
+  std::shared_ptr<const DBMatOfflineFile> mappedFile;
+
  public:
   // vector of interactions (if size() == 0: a regular SG is created)
   std::vector<std::vector<size_t>> interactions;
@@ -181,6 +224,26 @@ class DBMatOffline {
    */
   void parseInter(const std::string& fileName,
                   std::vector<std::vector<size_t>>& interactions) const;
+
+  /**
+   * Returns the matrices that represent the decomposition in the binary offline format.
+   * Override if more matrices have to be stored.
+   * @return the matrices to store
+   */
+  virtual std::vector<const DataMatrix*> getStoredMatrices() const;
+
+  /**
+   * Copies the matrices stored by getStoredMatrices() from a file in the binary offline format.
+   * Override if more matrices have to be restored.
+   * @param file the mapped file
+   */
+  virtual void restoreMatrices(const DBMatOfflineFile& file);
+
+  /**
+   * Copies the matrices of a mapped decomposition (see loadBinary()) into this object and
+   * releases the file. Has to be called before the matrices are accessed directly.
+   */
+  void releaseMappedFile();
 };
 
 }  // namespace datadriven
@@ -86,6 +86,7 @@ void DBMatOfflineChol::choleskyModification(Grid& grid, datadriven::DensityEstim
                                             size_t newPoints, std::list<size_t> deletedPoints,
                                             double lambda) {
 #ifdef USE_GSL
+  releaseMappedFile();
 
   // Start coarsening
   // If list 'deletedPoints' is not empty, grid points got removed
@@ -64,6 +64,8 @@ void DBMatOfflineDenseIChol::decomposeMatrix(RegularizationConfiguration& regula
 void DBMatOfflineDenseIChol::choleskyModification(Grid& grid,
     datadriven::DensityEstimationConfiguration& densityEstimationConfig, size_t newPoints,
     std::list<size_t> deletedPoints, double lambda) {
+  releaseMappedFile();
+
   if (newPoints > 0) {
     //    auto begin = std::chrono::high_resolution_clock::now();
 
@@ -15,10 +15,12 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineDenseIChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineEigen.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineLU.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -79,6 +81,20 @@ DBMatOffline* DBMatOfflineFactory::buildOfflineObject(
 }
 
 DBMatOffline* DBMatOfflineFactory::buildFromFile(const std::string& fileName) {
+  // files in the binary offline format describe themselves
+  if (DBMatOfflineFile::isBinaryFile(fileName)) {
+    auto file = std::make_shared<const DBMatOfflineFile>(fileName);
+    sgpp::base::AdaptivityConfiguration adaptivityConfig;
+    DensityEstimationConfiguration densityEstimationConfig;
+    densityEstimationConfig.decomposition_ = file->getDecompositionType();
+
+    std::unique_ptr<DBMatOffline> offline(buildOfflineObject(
+        file->getGridConfiguration(), adaptivityConfig, file->getRegularizationConfiguration(),
+        densityEstimationConfig));
+    offline->loadBinary(file);
+    return offline.release();
+  }
+
 #ifdef USE_GSL
   std::ifstream file(fileName, std::istream::in);
 
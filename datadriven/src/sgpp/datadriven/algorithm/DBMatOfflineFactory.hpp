@@ -39,6 +39,9 @@ DBMatOffline* buildOfflineObject(
 
 /**
  * Read a serialized DBMatOffline object and construct a new object with the information.
+ * Both the text format of DBMatOffline::store and the binary offline format of
+ * DBMatOffline::storeBinary are supported, binary files stay mapped (see
+ * DBMatOffline::loadBinary).
  * @param fname Path to the serialized DBMatOffline object.
  * @return new instance of DBMatOffline implementor owned by caller.
  */
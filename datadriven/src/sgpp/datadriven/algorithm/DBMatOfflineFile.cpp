@@ -0,0 +1,385 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::data_exception;
+using sgpp::base::file_exception;
+
+namespace {
+
+/// magic number at the beginning of every file
+const char MAGIC[8] = {'S', 'G', 'P', 'P', 'D', 'B', 'M', 'T'};
+/// written in the byte order of the writing machine to detect foreign files
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+/// alignment of the sections
+const uint64_t SECTION_ALIGNMENT = 64;
+/// offset basis of the 64 bit FNV-1a hash
+const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+/// prime of the 64 bit FNV-1a hash
+const uint64_t FNV_PRIME = 1099511628211ULL;
+
+/**
+ * Fixed-size header at the beginning of every file.
+ */
+struct BinaryOfflineHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  int32_t decompositionType;
+  int32_t generalGridType;
+  int32_t gridType;
+  int32_t regularizationType;
+  uint64_t dimension;
+  int64_t level;
+  double lambda;
+  double l1Ratio;
+  double exponentBase;
+  /// interactions are stored as number of terms followed by (size, dimensions...) per term
+  uint64_t interactionsOffset;
+  uint64_t interactionsSize;
+  uint64_t numberOfMatrices;
+  uint64_t nrows[DBMatOfflineFile::MAX_MATRICES];
+  uint64_t ncols[DBMatOfflineFile::MAX_MATRICES];
+  uint64_t matrixOffset[DBMatOfflineFile::MAX_MATRICES];
+  uint64_t fileSize;
+  /// FNV-1a hash of all bytes behind the (aligned) header
+  uint64_t checksum;
+};
+
+/**
+ * Grid configuration that is not part of the header, stored at the first aligned offset behind
+ * the header since version 2 and followed by the level vector of the grid.
+ */
+struct BinaryOfflineGridSection {
+  uint64_t maxDegree;
+  int64_t boundaryLevel;
+  double t;
+  uint64_t levelVectorSize;
+};
+
+/// offset of the grid section (version 2 and later)
+const uint64_t GRID_SECTION_OFFSET =
+    (sizeof(BinaryOfflineHeader) + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+
+inline uint64_t alignOffset(uint64_t offset) {
+  return (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+}
+
+inline uint64_t updateChecksum(uint64_t hash, const char* bytes, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    hash ^= static_cast<unsigned char>(bytes[i]);
+    hash *= FNV_PRIME;
+  }
+
+  return hash;
+}
+
+/**
+ * Writes the sections of a file and hashes everything written.
+ */
+class ChecksumWriter {
+ public:
+  ChecksumWriter(std::ofstream& fout, uint64_t position)
+      : fout(fout), position(position), hash(FNV_OFFSET_BASIS) {}
+
+  void write(const char* bytes, size_t size) {
+    fout.write(bytes, static_cast<std::streamsize>(size));
+    hash = updateChecksum(hash, bytes, size);
+    position += size;
+  }
+
+  void padTo(uint64_t offset) {
+    static const char zeros[SECTION_ALIGNMENT] = {};
+    write(zeros, static_cast<size_t>(offset - position));
+  }
+
+  uint64_t getChecksum() const { return hash; }
+
+ private:
+  std::ofstream& fout;
+  uint64_t position;
+  uint64_t hash;
+};
+
+}  // namespace
+
+const uint32_t DBMatOfflineFile::FORMAT_VERSION;
+const size_t DBMatOfflineFile::MAX_MATRICES;
+
+void DBMatOfflineFile::write(const std::string& fileName,
+                             MatrixDecompositionType decompositionType,
+                             const sgpp::base::GeneralGridConfiguration& gridConfig,
+                             const RegularizationConfiguration& regularizationConfig,
+                             const std::vector<std::vector<size_t>>& interactions,
+                             const std::vector<const sgpp::base::DataMatrix*>& matrices) {
+  if (matrices.size() > MAX_MATRICES) {
+    throw data_exception("DBMatOfflineFile::write : too many matrices");
+  } else if (decompositionType == MatrixDecompositionType::LU) {
+    // the permutation of the LU decomposition is not a matrix of doubles
+    throw data_exception(
+        "DBMatOfflineFile::write : LU decompositions cannot be stored in the binary offline format");
+  }
+
+  std::vector<uint64_t> interactionData;
+  interactionData.push_back(interactions.size());
+
+  for (const std::vector<size_t>& term : interactions) {
+    interactionData.push_back(term.size());
+    interactionData.insert(interactionData.end(), term.begin(), term.end());
+  }
+
+  BinaryOfflineGridSection gridSection;
+  std::memset(&gridSection, 0, sizeof(gridSection));
+  gridSection.maxDegree = gridConfig.maxDegree_;
+  gridSection.boundaryLevel = gridConfig.boundaryLevel_;
+  gridSection.t = gridConfig.t_;
+  gridSection.levelVectorSize = gridConfig.levelVector_.size();
+  const std::vector<uint64_t> levelVector(gridConfig.levelVector_.begin(),
+                                          gridConfig.levelVector_.end());
+
+  BinaryOfflineHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = FORMAT_VERSION;
+  header.byteOrderMark = BYTE_ORDER_MARK;
+  header.decompositionType = static_cast<int32_t>(decompositionType);
+  header.generalGridType = static_cast<int32_t>(gridConfig.generalType_);
+  header.gridType = static_cast<int32_t>(gridConfig.type_);
+  header.regularizationType = static_cast<int32_t>(regularizationConfig.type_);
+  header.dimension = gridConfig.dim_;
+  header.level = gridConfig.level_;
+  header.lambda = regularizationConfig.lambda_;
+  header.l1Ratio = regularizationConfig.l1Ratio_;
+  header.exponentBase = regularizationConfig.exponentBase_;
+  header.interactionsOffset = alignOffset(GRID_SECTION_OFFSET + sizeof(BinaryOfflineGridSection) +
+                                          levelVector.size() * sizeof(uint64_t));
+  header.interactionsSize = interactionData.size();
+  header.numberOfMatrices = matrices.size();
+  header.fileSize = header.interactionsOffset + interactionData.size() * sizeof(uint64_t);
+
+  for (size_t i = 0; i < matrices.size(); i++) {
+    header.nrows[i] = matrices[i]->getNrows();
+    header.ncols[i] = matrices[i]->getNcols();
+    header.matrixOffset[i] = alignOffset(header.fileSize);
+    header.fileSize = header.matrixOffset[i] + header.nrows[i] * header.ncols[i] * sizeof(double);
+  }
+
+  std::ofstream fout(fileName.c_str(), std::ios::binary);
+
+  if (!fout) {
+    throw file_exception("DBMatOfflineFile::write : unable to open file for write access");
+  }
+
+  // the header is written again as soon as the checksum is known
+  fout.write(reinterpret_cast<const char*>(&header), sizeof(BinaryOfflineHeader));
+
+  ChecksumWriter writer(fout, sizeof(BinaryOfflineHeader));
+  writer.padTo(GRID_SECTION_OFFSET);
+  writer.write(reinterpret_cast<const char*>(&gridSection), sizeof(BinaryOfflineGridSection));
+  writer.write(reinterpret_cast<const char*>(levelVector.data()),
+               levelVector.size() * sizeof(uint64_t));
+  writer.padTo(header.interactionsOffset);
+  writer.write(reinterpret_cast<const char*>(interactionData.data()),
+               interactionData.size() * sizeof(uint64_t));
+
+  for (size_t i = 0; i < matrices.size(); i++) {
+    writer.padTo(header.matrixOffset[i]);
+    writer.write(reinterpret_cast<const char*>(matrices[i]->getPointer()),
+                 matrices[i]->getSize() * sizeof(double));
+  }
+
+  header.checksum = writer.getChecksum();
+  fout.seekp(0);
+  fout.write(reinterpret_cast<const char*>(&header), sizeof(BinaryOfflineHeader));
+
+  if (!fout) {
+    throw file_exception("DBMatOfflineFile::write : error while writing the file");
+  }
+}
+
+bool DBMatOfflineFile::isBinaryFile(const std::string& fileName) {
+  std::ifstream fin(fileName.c_str(), std::ios::binary);
+  char magic[sizeof(MAGIC)];
+
+  if (!fin || !fin.read(magic, sizeof(MAGIC))) {
+    return false;
+  }
+
+  return std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+DBMatOfflineFile::DBMatOfflineFile(const std::string& fileName)
+    : file(fileName),
+      decompositionType(MatrixDecompositionType::Chol),
+      gridConfig(),
+      regularizationConfig(),
+      interactions(),
+      numberOfMatrices(0),
+      nrows(),
+      ncols(),
+      matrices(),
+      checksum(0),
+      fileSize(0) {
+  if (file.getSize() < sizeof(BinaryOfflineHeader)) {
+    throw file_exception("DBMatOfflineFile : file is too small for a binary offline object");
+  }
+
+  parseHeader();
+}
+
+DBMatOfflineFile::~DBMatOfflineFile() {}
+
+void DBMatOfflineFile::parseHeader() {
+  const char* data = file.getData();
+  BinaryOfflineHeader header;
+  std::memcpy(&header, data, sizeof(BinaryOfflineHeader));
+
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    throw file_exception("DBMatOfflineFile : file is not a binary offline object");
+  } else if (header.byteOrderMark != BYTE_ORDER_MARK) {
+    throw file_exception(
+        "DBMatOfflineFile : binary offline object has been written with a different byte order");
+  } else if (header.version > FORMAT_VERSION) {
+    throw file_exception(
+        "DBMatOfflineFile : binary offline object has been written with a newer version");
+  } else if ((header.numberOfMatrices > MAX_MATRICES) ||
+             (header.decompositionType == static_cast<int32_t>(MatrixDecompositionType::LU))) {
+    throw file_exception("DBMatOfflineFile : binary offline object is corrupt");
+  }
+
+  // check that all sections lie inside of the file
+  bool valid = (header.fileSize <= file.getSize()) &&
+               (header.interactionsOffset >= sizeof(BinaryOfflineHeader)) &&
+               (header.interactionsSize >= 1) &&
+               (header.interactionsOffset + header.interactionsSize * sizeof(uint64_t) <=
+                header.fileSize) &&
+               (header.interactionsOffset % sizeof(uint64_t) == 0);
+
+  for (size_t i = 0; valid && (i < header.numberOfMatrices); i++) {
+    valid = (header.matrixOffset[i] % sizeof(double) == 0) &&
+            (header.matrixOffset[i] + header.nrows[i] * header.ncols[i] * sizeof(double) <=
+             header.fileSize);
+  }
+
+  // version 1 did not store the grid section
+  BinaryOfflineGridSection gridSection;
+  std::memset(&gridSection, 0, sizeof(gridSection));
+  gridSection.maxDegree = 1;
+
+  if (valid && (header.version >= 2)) {
+    valid = (GRID_SECTION_OFFSET + sizeof(BinaryOfflineGridSection) <= header.interactionsOffset);
+
+    if (valid) {
+      std::memcpy(&gridSection, data + GRID_SECTION_OFFSET, sizeof(BinaryOfflineGridSection));
+      valid = (GRID_SECTION_OFFSET + sizeof(BinaryOfflineGridSection) +
+                   gridSection.levelVectorSize * sizeof(uint64_t) <=
+               header.interactionsOffset);
+    }
+  }
+
+  if (!valid) {
+    throw file_exception("DBMatOfflineFile : binary offline object is truncated or corrupt");
+  }
+
+  // decode the interaction terms
+  const uint64_t* interactionData =
+      reinterpret_cast<const uint64_t*>(data + header.interactionsOffset);
+  const uint64_t numberOfTerms = interactionData[0];
+  size_t position = 1;
+
+  interactions.clear();
+
+  for (uint64_t t = 0; t < numberOfTerms; t++) {
+    if ((position >= header.interactionsSize) ||
+        (position + interactionData[position] >= header.interactionsSize)) {
+      throw file_exception("DBMatOfflineFile : binary offline object has corrupt interactions");
+    }
+
+    const uint64_t termSize = interactionData[position++];
+    interactions.emplace_back(interactionData + position, interactionData + position + termSize);
+    position += termSize;
+  }
+
+  decompositionType = static_cast<MatrixDecompositionType>(header.decompositionType);
+  gridConfig.generalType_ = static_cast<sgpp::base::GeneralGridType>(header.generalGridType);
+  gridConfig.type_ = static_cast<sgpp::base::GridType>(header.gridType);
+  gridConfig.dim_ = static_cast<size_t>(header.dimension);
+  gridConfig.level_ = static_cast<int>(header.level);
+  gridConfig.maxDegree_ = static_cast<size_t>(gridSection.maxDegree);
+  gridConfig.boundaryLevel_ = static_cast<sgpp::base::level_t>(gridSection.boundaryLevel);
+  gridConfig.t_ = gridSection.t;
+
+  const uint64_t* levelVector = reinterpret_cast<const uint64_t*>(
+      data + GRID_SECTION_OFFSET + sizeof(BinaryOfflineGridSection));
+  gridConfig.levelVector_.assign(levelVector, levelVector + gridSection.levelVectorSize);
+  regularizationConfig.type_ = static_cast<RegularizationType>(header.regularizationType);
+  regularizationConfig.lambda_ = header.lambda;
+  regularizationConfig.l1Ratio_ = header.l1Ratio;
+  regularizationConfig.exponentBase_ = header.exponentBase;
+
+  numberOfMatrices = static_cast<size_t>(header.numberOfMatrices);
+
+  for (size_t i = 0; i < numberOfMatrices; i++) {
+    nrows[i] = static_cast<size_t>(header.nrows[i]);
+    ncols[i] = static_cast<size_t>(header.ncols[i]);
+    matrices[i] = reinterpret_cast<const double*>(data + header.matrixOffset[i]);
+  }
+
+  checksum = header.checksum;
+  fileSize = static_cast<size_t>(header.fileSize);
+}
+
+size_t DBMatOfflineFile::getNrows(size_t i) const {
+  if (i >= numberOfMatrices) {
+    throw data_exception("DBMatOfflineFile::getNrows : matrix index out of range");
+  }
+
+  return nrows[i];
+}
+
+size_t DBMatOfflineFile::getNcols(size_t i) const {
+  if (i >= numberOfMatrices) {
+    throw data_exception("DBMatOfflineFile::getNcols : matrix index out of range");
+  }
+
+  return ncols[i];
+}
+
+const double* DBMatOfflineFile::getMatrix(size_t i) const {
+  if (i >= numberOfMatrices) {
+    throw data_exception("DBMatOfflineFile::getMatrix : matrix index out of range");
+  }
+
+  return matrices[i];
+}
+
+void DBMatOfflineFile::copyMatrix(size_t i, sgpp::base::DataMatrix& result) const {
+  if (i >= numberOfMatrices) {
+    throw data_exception("DBMatOfflineFile::copyMatrix : matrix index out of range");
+  }
+
+  result.resize(nrows[i], ncols[i]);
+  std::memcpy(result.getPointer(), matrices[i], nrows[i] * ncols[i] * sizeof(double));
+}
+
+bool DBMatOfflineFile::verifyChecksum() const {
+  return updateChecksum(FNV_OFFSET_BASIS, file.getData() + sizeof(BinaryOfflineHeader),
+                        fileSize - sizeof(BinaryOfflineHeader)) == checksum;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,182 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/MappedFile.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+#include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Read-only view of a decomposition of the offline phase stored in the binary offline format.
+ *
+ * In contrast to the text format of DBMatOffline::store, the file is self-describing (it
+ * contains the grid configuration, the regularization configuration, the decomposition
+ * type and the interactions) and the matrices are stored as raw row-major doubles that start at
+ * 64 byte aligned offsets. The file is memory-mapped, hence opening it is independent of the
+ * size of the decomposition and the matrices can be passed directly to the pointer-based solve
+ * methods of DBMatDMSChol, DBMatDMSEigen and DBMatDMSOrthoAdapt. Several processes mapping the
+ * same file share the same physical pages.
+ *
+ * The header contains a 64 bit FNV-1a checksum of everything behind the header, which is only
+ * computed on request (see verifyChecksum()) to keep opening the file cheap.
+ * All numbers are stored in the byte order of the writing machine, which is checked when the
+ * file is opened. LU decompositions are not supported, as their permutation is not a matrix.
+ */
+class DBMatOfflineFile {
+ public:
+  /// version of the binary offline format written by write() (version 1 lacks the grid section)
+  static const uint32_t FORMAT_VERSION = 2;
+  /// maximal number of matrices in one file
+  static const size_t MAX_MATRICES = 4;
+
+  /**
+   * Writes matrices of a decomposition in the binary offline format.
+   * Throws a data_exception for LU decompositions.
+   *
+   * @param fileName              name of the file
+   * @param decompositionType     type of the decomposition
+   * @param gridConfig            configuration of the grid the decomposition is based on
+   * @param regularizationConfig  configuration of the regularization
+   * @param interactions          interaction terms of the grid
+   * @param matrices              matrices to store (at most MAX_MATRICES)
+   */
+  static void write(const std::string& fileName, MatrixDecompositionType decompositionType,
+                    const sgpp::base::GeneralGridConfiguration& gridConfig,
+                    const RegularizationConfiguration& regularizationConfig,
+                    const std::vector<std::vector<size_t>>& interactions,
+                    const std::vector<const sgpp::base::DataMatrix*>& matrices);
+
+  /**
+   * Checks (by the magic number) whether a file is stored in the binary offline format.
+   *
+   * @param fileName  name of the file
+   * @return          true if the file can be opened and starts with the magic number
+   */
+  static bool isBinaryFile(const std::string& fileName);
+
+  /**
+   * Constructor, maps a file in the binary offline format into memory.
+   *
+   * @param fileName  name of the file
+   */
+  explicit DBMatOfflineFile(const std::string& fileName);
+
+  DBMatOfflineFile(const DBMatOfflineFile&) = delete;
+  DBMatOfflineFile& operator=(const DBMatOfflineFile&) = delete;
+
+  /**
+   * Destructor, unmaps the file
+   */
+  ~DBMatOfflineFile();
+
+  /**
+   * @return type of the stored decomposition
+   */
+  inline MatrixDecompositionType getDecompositionType() const { return decompositionType; }
+
+  /**
+   * @return configuration of the grid the decomposition is based on
+   * (the file name of file-based grids is not stored; files of version 1 only store general
+   * type, type, dimension and level)
+   */
+  inline const sgpp::base::GeneralGridConfiguration& getGridConfiguration() const {
+    return gridConfig;
+  }
+
+  /**
+   * @return configuration of the regularization
+   */
+  inline const RegularizationConfiguration& getRegularizationConfiguration() const {
+    return regularizationConfig;
+  }
+
+  /**
+   * @return interaction terms of the grid
+   */
+  inline const std::vector<std::vector<size_t>>& getInteractions() const { return interactions; }
+
+  /**
+   * @return number of stored matrices
+   */
+  inline size_t getNumberOfMatrices() const { return numberOfMatrices; }
+
+  /**
+   * @param i index of the matrix
+   * @return  number of rows of the matrix
+   */
+  size_t getNrows(size_t i) const;
+
+  /**
+   * @param i index of the matrix
+   * @return  number of columns of the matrix
+   */
+  size_t getNcols(size_t i) const;
+
+  /**
+   * @param i index of the matrix
+   * @return  entries of the matrix (row-major, points into the mapped file)
+   */
+  const double* getMatrix(size_t i) const;
+
+  /**
+   * Copies a matrix into a DataMatrix.
+   *
+   * @param i       index of the matrix
+   * @param result  DataMatrix that is resized and filled with the matrix
+   */
+  void copyMatrix(size_t i, sgpp::base::DataMatrix& result) const;
+
+  /**
+   * Computes the checksum of the file contents and compares it with the one of the header.
+   * This reads the whole file.
+   *
+   * @return true if the checksums match
+   */
+  bool verifyChecksum() const;
+
+ private:
+  /// the mapped file
+  sgpp::base::MappedFile file;
+
+  /// type of the stored decomposition
+  MatrixDecompositionType decompositionType;
+  /// configuration of the grid
+  sgpp::base::GeneralGridConfiguration gridConfig;
+  /// configuration of the regularization
+  RegularizationConfiguration regularizationConfig;
+  /// interaction terms of the grid
+  std::vector<std::vector<size_t>> interactions;
+  /// number of stored matrices
+  size_t numberOfMatrices;
+  /// number of rows of the stored matrices
+  size_t nrows[MAX_MATRICES];
+  /// number of columns of the stored matrices
+  size_t ncols[MAX_MATRICES];
+  /// entries of the stored matrices (point into the mapped file)
+  const double* matrices[MAX_MATRICES];
+  /// checksum of the header
+  uint64_t checksum;
+  /// size of the file according to its header (the checksum covers everything behind the header)
+  size_t fileSize;
+
+  /**
+   * Checks the header and sets the pointers to the matrices.
+   */
+  void parseHeader();
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
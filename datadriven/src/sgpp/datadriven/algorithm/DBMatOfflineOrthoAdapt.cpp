@@ -186,9 +186,25 @@ void DBMatOfflineOrthoAdapt::store(const std::string& fileName) {
 #endif /* USE_GSL */
 }
 
+std::vector<const DataMatrix*> DBMatOfflineOrthoAdapt::getStoredMatrices() const {
+  return {&lhsMatrix, &q_ortho_matrix_, &t_tridiag_inv_matrix_};
+}
+
+void DBMatOfflineOrthoAdapt::restoreMatrices(const DBMatOfflineFile& file) {
+  if (file.getNumberOfMatrices() != 3) {
+    throw sgpp::base::algorithm_exception(
+        "DBMatOfflineOrthoAdapt: binary offline object has to contain three matrices");
+  }
+
+  file.copyMatrix(0, lhsMatrix);
+  file.copyMatrix(1, q_ortho_matrix_);
+  file.copyMatrix(2, t_tridiag_inv_matrix_);
+}
+
 void DBMatOfflineOrthoAdapt::syncDistributedDecomposition(
     std::shared_ptr<BlacsProcessGrid> processGrid, const ParallelConfiguration& parallelConfig) {
 #ifdef USE_SCALAPACK
+  releaseMappedFile();
   q_ortho_matrix_distributed_ = DataMatrixDistributed::fromSharedData(
       q_ortho_matrix_.data(), processGrid, q_ortho_matrix_.getNrows(), q_ortho_matrix_.getNcols(),
       parallelConfig.rowBlockSize_, parallelConfig.columnBlockSize_);
@@ -9,6 +9,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -94,15 +95,33 @@ class DBMatOfflineOrthoAdapt : public DBMatOffline {
   void syncDistributedDecomposition(std::shared_ptr<BlacsProcessGrid> processGrid,
                                     const ParallelConfiguration& parallelConfig) override;
 
-  sgpp::base::DataMatrix& getQ() { return this->q_ortho_matrix_; }
+  sgpp::base::DataMatrix& getQ() {
+    releaseMappedFile();
+    return this->q_ortho_matrix_;
+  }
 
-  sgpp::base::DataMatrix& getTinv() { return this->t_tridiag_inv_matrix_; }
+  sgpp::base::DataMatrix& getTinv() {
+    releaseMappedFile();
+    return this->t_tridiag_inv_matrix_;
+  }
 
   DataMatrixDistributed& getQDistributed() { return this->q_ortho_matrix_distributed_; }
 
   DataMatrixDistributed& getTinvDistributed() { return this->t_tridiag_inv_matrix_distributed_; }
 
  protected:
+  /**
+   * Stores lhsMatrix, q_ortho_matrix_ and t_tridiag_inv_matrix_ (in this order)
+   * @return the matrices to store
+   */
+  std::vector<const DataMatrix*> getStoredMatrices() const override;
+
+  /**
+   * Restores lhsMatrix, q_ortho_matrix_ and t_tridiag_inv_matrix_
+   * @param file the mapped file
+   */
+  void restoreMatrices(const DBMatOfflineFile& file) override;
+
   sgpp::base::DataMatrix q_ortho_matrix_;        // orthogonal matrix of decomposition
   sgpp::base::DataMatrix t_tridiag_inv_matrix_;  // inverse of the tridiag matrix of decomposition
 
@@ -114,14 +114,14 @@ void DBMatOnlineDE::computeDensityFunction(DataVector& alpha, DataMatrix& m, Gri
 
   if (!localVectorsInitialized) {
     // init bsave and bTotalPoints only here, as they are not needed in the parallel version
-    bSave = DataVector(offlineObject.getDecomposedMatrix().getNcols(), 0.0);
-    bTotalPoints = DataVector(offlineObject.getDecomposedMatrix().getNcols(), 0.0);
+    bSave = DataVector(offlineObject.getDecomposedMatrixNcols(), 0.0);
+    bTotalPoints = DataVector(offlineObject.getDecomposedMatrixNcols(), 0.0);
 
     localVectorsInitialized = true;
   }
 
   if (m.getNrows() > 0) {
-    DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+    size_t lhsNcols = offlineObject.getDecomposedMatrixNcols();
 
     // in case OrthoAdapt, the current size is not lhs size, but B size
     bool use_B_size = false;
@@ -137,7 +137,7 @@ void DBMatOnlineDE::computeDensityFunction(DataVector& alpha, DataMatrix& m, Gri
     // Compute right hand side of the equation:
     size_t numberOfPoints = m.getNrows();
     totalPoints++;
-    DataVector b(use_B_size ? thisOrthoAdaptPtr->getB().getNcols() : lhsMatrix.getNcols());
+    DataVector b(use_B_size ? thisOrthoAdaptPtr->getB().getNcols() : lhsNcols);
     b.setAll(0);
     if (b.getSize() != grid.getSize()) {
       throw sgpp::base::algorithm_exception(
@@ -228,15 +228,15 @@ void DBMatOnlineDE::computeDensityFunctionParallel(
     // init bSaveDistributed and bTotalPointsDistributed only here, as they are not needed in the
     // local version
     bSaveDistributed = std::make_unique<DataVectorDistributed>(
-        processGrid, offlineObject.getDecomposedMatrix().getNcols(), parallelConfig.rowBlockSize_);
+        processGrid, offlineObject.getDecomposedMatrixNcols(), parallelConfig.rowBlockSize_);
     bTotalPointsDistributed = std::make_unique<DataVectorDistributed>(
-        processGrid, offlineObject.getDecomposedMatrix().getNcols(), parallelConfig.rowBlockSize_);
+        processGrid, offlineObject.getDecomposedMatrixNcols(), parallelConfig.rowBlockSize_);
 
     distributedVectorsInitialized = true;
   }
 
   if (m.getNrows() > 0) {
-    DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+    size_t lhsNcols = offlineObject.getDecomposedMatrixNcols();
 
     // in case OrthoAdapt, the current size is not lhs size, but B size
     bool use_B_size = false;
@@ -253,7 +253,7 @@ void DBMatOnlineDE::computeDensityFunctionParallel(
     size_t numberOfPoints = m.getNrows();
     totalPoints++;
 
-    size_t bSize = use_B_size ? thisOrthoAdaptPtr->getB().getNcols() : lhsMatrix.getNcols();
+    size_t bSize = use_B_size ? thisOrthoAdaptPtr->getB().getNcols() : lhsNcols;
 
     DataVectorDistributed b(processGrid, bSize, parallelConfig.rowBlockSize_);
     if (b.getGlobalRows() != grid.getSize()) {
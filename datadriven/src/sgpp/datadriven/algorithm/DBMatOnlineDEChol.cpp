@@ -30,6 +30,16 @@ DBMatOnlineDEChol::DBMatOnlineDEChol(DBMatOffline& offline, Grid& grid, double l
 void DBMatOnlineDEChol::solveSLE(DataVector& alpha, DataVector& b, Grid& grid,
                                  DensityEstimationConfiguration& densityEstimationConfig,
                                  bool do_cv) {
+  const DBMatOfflineFile* mappedFile = offlineObject.getMappedFile();
+
+  if ((mappedFile != nullptr) &&
+      (offlineObject.getDecompositionType() == MatrixDecompositionType::Chol)) {
+    // solve on the mapped factor without copying it
+    alpha.resizeZero(mappedFile->getNcols(0));
+    DBMatDMSChol().solve(mappedFile->getMatrix(0), alpha.getSize(), alpha, b);
+    return;
+  }
+
   DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
   alpha.resizeZero(lhsMatrix.getNcols());
 
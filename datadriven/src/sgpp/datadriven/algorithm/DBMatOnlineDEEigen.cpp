@@ -23,6 +23,15 @@ DBMatOnlineDEEigen::DBMatOnlineDEEigen(DBMatOffline& offline, Grid& grid, double
 
 void DBMatOnlineDEEigen::solveSLE(DataVector& alpha, DataVector& b, Grid& grid,
     DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
+  const DBMatOfflineFile* mappedFile = offlineObject.getMappedFile();
+
+  if (mappedFile != nullptr) {
+    // solve on the mapped eigen decomposition without copying it
+    alpha.resizeZero(mappedFile->getNcols(0));
+    DBMatDMSEigen().solve(mappedFile->getMatrix(0), alpha.getSize(), alpha, b, lambda);
+    return;
+  }
+
   DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
 
   // Solve the system:
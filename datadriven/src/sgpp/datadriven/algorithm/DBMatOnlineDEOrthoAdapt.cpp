@@ -90,7 +90,15 @@ void DBMatOnlineDEOrthoAdapt::solveSLE(DataVector& alpha, DataVector& b, Grid& g
   sgpp::datadriven::DBMatDMSOrthoAdapt* solver = new sgpp::datadriven::DBMatDMSOrthoAdapt();
   // solve the created system
   alpha.resizeZero(b.getSize());
-  solver->solve(offline->getTinv(), offline->getQ(), this->getB(), b, alpha);
+  const DBMatOfflineFile* mappedFile = offline->getMappedFile();
+
+  if (mappedFile != nullptr) {
+    // solve on the mapped matrices (lhs, Q, T_inv) without copying them
+    solver->solve(mappedFile->getMatrix(2), mappedFile->getMatrix(1), mappedFile->getNrows(1),
+                  this->getB(), b, alpha);
+  } else {
+    solver->solve(offline->getTinv(), offline->getQ(), this->getB(), b, alpha);
+  }
 
   free(solver);
 }
@@ -73,6 +73,31 @@ void DMSystemMatrix::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector&
   result.axpy(static_cast<double>(M) * this->lambda_, temptwo);
 }
 
+void DMSystemMatrix::multBlock(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) {
+  const size_t numVectors = alpha.getNcols();
+  size_t M = this->dataset_.getNrows();
+  sgpp::base::DataMatrix temp(M, numVectors);
+
+  std::unique_ptr<base::OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+  op->multBlock(alpha, temp);
+  op->multTransposeBlock(temp, result);
+
+  sgpp::base::DataMatrix temptwo(alpha.getNrows(), numVectors);
+  this->C->multBlock(alpha, temptwo);
+  temptwo.mult(static_cast<double>(M) * this->lambda_);
+  result.add(temptwo);
+}
+
+void DMSystemMatrix::getDiagonal(sgpp::base::DataVector& diagonal) {
+  const size_t M = this->dataset_.getNrows();
+  sgpp::base::DataVector regularizationDiagonal(diagonal.getSize());
+
+  this->B->getBBTDiagonal(diagonal);
+  this->C->getDiagonal(regularizationDiagonal);
+  diagonal.axpy(static_cast<double>(M) * this->lambda_, regularizationDiagonal);
+}
+
 void DMSystemMatrix::generateb(sgpp::base::DataVector& classes, sgpp::base::DataVector& b) {
   // this->B->multTranspose((*this->dataset_), classes, b);
   // this->B->multTranspose(classes, b);
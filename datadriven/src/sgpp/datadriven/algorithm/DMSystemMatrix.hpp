@@ -52,6 +52,24 @@ class DMSystemMatrix : public DMSystemMatrixBase {
 
   virtual void mult(base::DataVector& alpha, base::DataVector& result);
 
+  /**
+   * Applies the system matrix to multiple vectors at once, streaming the
+   * training data only once (see base::OperationMultipleEval::multBlock).
+   *
+   * @param alpha matrix whose columns are the vectors to be multiplied
+   * @param result matrix into which the results are stored (one column per vector)
+   */
+  virtual void multBlock(base::DataMatrix& alpha, base::DataMatrix& result);
+
+  /**
+   * Computes the diagonal of the system matrix from the diagonal of B B^T
+   * (see base::OperationMultipleEval::getBBTDiagonal) and the diagonal of the regularization
+   * operator (e.g., for solver::JacobiPreconditioner).
+   *
+   * @param diagonal vector with one entry per grid point, into which the diagonal is stored
+   */
+  virtual void getDiagonal(base::DataVector& diagonal);
+
   /**
    * Generates the right hand side of the classification equation
    *
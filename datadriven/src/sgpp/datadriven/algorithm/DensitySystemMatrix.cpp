@@ -47,6 +47,14 @@ void DensitySystemMatrix::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVe
   result.axpy(lambda, tmp);
 }
 
+void DensitySystemMatrix::getDiagonal(sgpp::base::DataVector& diagonal) {
+  base::DataVector tmp(diagonal.getSize());
+
+  A->getDiagonal(diagonal);
+  C->getDiagonal(tmp);
+  diagonal.axpy(lambda, tmp);
+}
+
 // Matrix-Multiplikation verwenden
 void DensitySystemMatrix::generateb(sgpp::base::DataVector& rhs) {
   sgpp::base::DataVector y(numSamples);
@@ -68,6 +68,14 @@ class DensitySystemMatrix : public base::OperationMatrix {
    */
   void mult(base::DataVector& alpha, base::DataVector& result);
 
+  /**
+   * Computes the diagonal of the system matrix from the diagonals of the mass matrix and of
+   * the regularization operator (e.g., for solver::JacobiPreconditioner).
+   *
+   * @param diagonal vector with one entry per grid point, into which the diagonal is stored
+   */
+  void getDiagonal(base::DataVector& diagonal) override;
+
   /**
    * Generates the right hand side of the classification equation
    *
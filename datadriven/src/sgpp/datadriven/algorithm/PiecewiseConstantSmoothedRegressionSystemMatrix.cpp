@@ -45,6 +45,14 @@ void PiecewiseConstantSmoothedRegressionSystemMatrix::mult(
   result.axpy(this->lambda, tmp);
 }
 
+void PiecewiseConstantSmoothedRegressionSystemMatrix::getDiagonal(base::DataVector& diagonal) {
+  base::DataVector tmp(diagonal.getSize());
+
+  this->A->getDiagonal(diagonal);
+  this->C->getDiagonal(tmp);
+  diagonal.axpy(this->lambda, tmp);
+}
+
 // Matrix-Multiplikation verwenden
 void PiecewiseConstantSmoothedRegressionSystemMatrix::generateb(
   base::DataVector& rhs) {
@@ -59,6 +59,14 @@ class PiecewiseConstantSmoothedRegressionSystemMatrix: public
    */
   void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * Computes the diagonal of the system matrix from the diagonals of the mass matrix and of
+   * the regularization operator (e.g., for solver::JacobiPreconditioner).
+   *
+   * @param diagonal vector with one entry per grid point, into which the diagonal is stored
+   */
+  void getDiagonal(sgpp::base::DataVector& diagonal) override;
+
   /**
    * Generates the right hand side of the classification equation
    *
@@ -38,7 +38,8 @@ KernelDensityEstimator::KernelDensityEstimator(KernelType kernelType,
       norm(0),
       cond(0),
       sumCondInv(1.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      evaluationTolerance(0.0) {
   initializeKernel(kernelType);
 }
 
@@ -51,7 +52,8 @@ KernelDensityEstimator::KernelDensityEstimator(
       norm(samplesVec.size()),
       cond(0.0),
       sumCondInv(0.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      evaluationTolerance(0.0) {
   initializeKernel(kernelType);
   initialize(samplesVec);
 }
@@ -64,7 +66,8 @@ KernelDensityEstimator::KernelDensityEstimator(base::DataMatrix& samples, Kernel
       norm(samples.getNcols()),
       cond(samples.getNrows()),
       sumCondInv(0.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      evaluationTolerance(0.0) {
   initializeKernel(kernelType);
   initialize(samples);
 }
@@ -78,6 +81,7 @@ KernelDensityEstimator::KernelDensityEstimator(const KernelDensityEstimator& kde
   cond = base::DataVector(kde.cond);
   sumCondInv = kde.sumCondInv;
   bandwidthOptimizationType = kde.bandwidthOptimizationType;
+  evaluationTolerance = kde.evaluationTolerance;
 
   initializeKernel(kde.kernel->getType());
 }
@@ -101,6 +105,7 @@ void KernelDensityEstimator::initializeKernel(KernelType kernelType) {
 void KernelDensityEstimator::initialize(base::DataMatrix& samples) {
   ndim = samples.getNcols();
   nsamples = samples.getNrows();
+  tree.reset();
 
   samples.transpose();
 
@@ -141,6 +146,7 @@ void KernelDensityEstimator::initialize(base::DataMatrix& samples) {
 
 void KernelDensityEstimator::initialize(std::vector<std::shared_ptr<base::DataVector>>& samples) {
   ndim = samples.size();
+  tree.reset();
 
   if (ndim > 0) {
     nsamples = samples[0]->getSize();
@@ -214,32 +220,64 @@ void KernelDensityEstimator::getBandwidths(base::DataVector& sigma) {
 }
 
 void KernelDensityEstimator::setBandwidths(const base::DataVector& sigma) {
+  tree.reset();
+
   for (size_t i = 0; i < sigma.getSize(); i++) {
     bandwidths[i] = sigma[i];
     norm[i] = kernel->norm() / bandwidths[i];
   }
 }
 
-void KernelDensityEstimator::pdf(base::DataMatrix& data, base::DataVector& res) {
-  // init variables
-  base::DataVector x(ndim);
+void KernelDensityEstimator::setEvaluationTolerance(double tolerance) {
+  evaluationTolerance = tolerance;
+}
+
+double KernelDensityEstimator::getEvaluationTolerance() { return evaluationTolerance; }
+
+void KernelDensityEstimator::prepareTree() {
+  if ((evaluationTolerance > 0.0) && (tree == nullptr)) {
+    tree.reset(new KernelDensityTree(samplesVec, bandwidths, cond));
+  }
+}
 
+void KernelDensityEstimator::pdf(base::DataMatrix& data, base::DataVector& res) {
   // resize result vector
   res.resize(data.getNrows());
   res.setAll(0.0);
 
+  // build the tree before the threads share it
+  prepareTree();
+
   // run over all data points
-  for (size_t idata = 0; idata < data.getNrows(); idata++) {
-    // copy samples
-    for (size_t idim = 0; idim < ndim; idim++) {
-      x[idim] = data.get(idata, idim);
-    }
+#pragma omp parallel
+  {
+    base::DataVector x(ndim);
 
-    res[idata] = pdf(x);
+#pragma omp for schedule(dynamic, 16)
+    for (size_t idata = 0; idata < data.getNrows(); idata++) {
+      // copy samples
+      for (size_t idim = 0; idim < ndim; idim++) {
+        x[idim] = data.get(idata, idim);
+      }
+
+      res[idata] = pdf(x);
+    }
   }
 }
 
 double KernelDensityEstimator::pdf(base::DataVector& x) {
+  if (evaluationTolerance > 0.0) {
+    prepareTree();
+
+    double normProduct = 1.0;
+
+    for (size_t idim = 0; idim < ndim; idim++) {
+      normProduct *= norm[idim];
+    }
+
+    return tree->eval(*kernel, x, evaluationTolerance) * normProduct * sumCondInv;
+  }
+
   // init variables
   double res = 0.0;
 
@@ -405,6 +443,7 @@ void KernelDensityEstimator::getConditionalizationFactor(base::DataVector& pcond
 
 void KernelDensityEstimator::setConditionalizationFactor(base::DataVector& pcond) {
   double sumCond = 0.0;
+  tree.reset();
 
   for (size_t isample = 0; isample < nsamples; isample++) {
     cond[isample] = pcond[isample];
@@ -8,11 +8,13 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/datadriven/application/DensityEstimator.hpp>
+#include <sgpp/datadriven/application/KernelDensityTree.hpp>
 
 #include <sgpp/optimization/function/scalar/ScalarFunction.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 #include <vector>
 #include <random>
 
@@ -94,6 +96,13 @@ class KernelDensityEstimator : public DensityEstimator {
   void cov(base::DataMatrix& cov, base::DataMatrix* bounds = nullptr) override;
 
   double pdf(base::DataVector& x) override;
+
+  /**
+   * Evaluates the density at all rows of points (in parallel if compiled with OpenMP).
+   *
+   * @param points  evaluation points (one per row)
+   * @param res     vector into which the values of the density are stored
+   */
   void pdf(base::DataMatrix& points, base::DataVector& res) override;
 
   double evalSubset(base::DataVector& x, std::vector<size_t> skipElements);
@@ -107,6 +116,19 @@ class KernelDensityEstimator : public DensityEstimator {
   void getBandwidths(base::DataVector& sigma);
   void setBandwidths(const base::DataVector& sigma);
 
+  /**
+   * Sets the tolerance for the evaluation of the density via pdf.
+   * If the tolerance is positive, the samples are organized in a kd-tree and the kernels of
+   * groups of samples which are far away from the evaluation point are approximated, such that
+   * the relative error of the density value does not exceed the tolerance
+   * (see KernelDensityTree). If the tolerance is zero (default), all kernels are
+   * evaluated directly.
+   *
+   * @param tolerance   maximal relative error of the density values
+   */
+  void setEvaluationTolerance(double tolerance);
+  double getEvaluationTolerance();
+
   std::shared_ptr<base::DataMatrix> getSamples() override;
   std::shared_ptr<base::DataVector> getSamples(size_t dim) override;
   void getSample(size_t isample, base::DataVector& sample);
@@ -119,6 +141,7 @@ class KernelDensityEstimator : public DensityEstimator {
 
  private:
   double evalKernel(base::DataVector& x, size_t i);
+  void prepareTree();
 
   /// samples
   std::vector<std::shared_ptr<base::DataVector>> samplesVec;
@@ -140,6 +163,12 @@ class KernelDensityEstimator : public DensityEstimator {
   /// bandwith optimization type
   BandwidthOptimizationType bandwidthOptimizationType;
 
+  /// maximal relative error of pdf, the kd-tree is only used if this is positive
+  double evaluationTolerance;
+  /// kd-tree over the samples (built lazily, reset whenever samples, bandwidths or
+  /// conditionalization factors change)
+  std::unique_ptr<KernelDensityTree> tree;
+
   void computeAndSetOptKDEbdwth();
   void computeNormalizationFactors();
 };
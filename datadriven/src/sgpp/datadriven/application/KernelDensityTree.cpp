@@ -0,0 +1,217 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/application/KernelDensityEstimator.hpp>
+#include <sgpp/datadriven/application/KernelDensityTree.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+KernelDensityTree::KernelDensityTree(std::vector<std::shared_ptr<base::DataVector>>& samplesVec,
+                                     const base::DataVector& bandwidths,
+                                     const base::DataVector& weights, size_t leafSize)
+    : dim(samplesVec.size()), leafSize(std::max(leafSize, static_cast<size_t>(1))) {
+  const size_t numSamples = (dim > 0) ? samplesVec[0]->getSize() : 0;
+
+  inverseBandwidths.resize(dim);
+
+  for (size_t idim = 0; idim < dim; idim++) {
+    inverseBandwidths[idim] = 1.0 / bandwidths[idim];
+  }
+
+  if (numSamples == 0) {
+    return;
+  }
+
+  std::vector<size_t> permutation(numSamples);
+  std::iota(permutation.begin(), permutation.end(), 0);
+
+  // create the root and split it recursively
+  nodes.push_back(Node{0, numSamples, 0, 0.0});
+  this->weights.resize(numSamples);
+
+  for (size_t isample = 0; isample < numSamples; isample++) {
+    this->weights[isample] = weights[isample];
+  }
+
+  build(0, 0, numSamples, permutation, samplesVec);
+
+  // store the scaled samples and the weights in tree order
+  points.resize(numSamples * dim);
+
+  for (size_t k = 0; k < numSamples; k++) {
+    this->weights[k] = weights[permutation[k]];
+
+    for (size_t idim = 0; idim < dim; idim++) {
+      points[k * dim + idim] = samplesVec[idim]->get(permutation[k]) * inverseBandwidths[idim];
+    }
+  }
+}
+
+void KernelDensityTree::build(size_t node, size_t begin, size_t end,
+                              std::vector<size_t>& permutation,
+                              std::vector<std::shared_ptr<base::DataVector>>& samplesVec) {
+  // bounding box and weight of the node (this->weights is still in the original order)
+  lowerCorners.resize(nodes.size() * dim);
+  upperCorners.resize(nodes.size() * dim);
+  double* lower = &lowerCorners[node * dim];
+  double* upper = &upperCorners[node * dim];
+  double weight = 0.0;
+
+  std::fill(lower, lower + dim, std::numeric_limits<double>::infinity());
+  std::fill(upper, upper + dim, -std::numeric_limits<double>::infinity());
+
+  for (size_t k = begin; k < end; k++) {
+    weight += weights[permutation[k]];
+
+    for (size_t idim = 0; idim < dim; idim++) {
+      const double value = samplesVec[idim]->get(permutation[k]) * inverseBandwidths[idim];
+      lower[idim] = std::min(lower[idim], value);
+      upper[idim] = std::max(upper[idim], value);
+    }
+  }
+
+  nodes[node].weight = weight;
+
+  if (end - begin <= leafSize) {
+    return;
+  }
+
+  // split at the median of the dimension with the largest extent
+  size_t splitDim = 0;
+
+  for (size_t idim = 1; idim < dim; idim++) {
+    if (upper[idim] - lower[idim] > upper[splitDim] - lower[splitDim]) {
+      splitDim = idim;
+    }
+  }
+
+  if (upper[splitDim] - lower[splitDim] <= 0.0) {
+    // all samples coincide
+    return;
+  }
+
+  const size_t middle = begin + (end - begin) / 2;
+  const base::DataVector& splitSamples = *samplesVec[splitDim];
+
+  std::nth_element(permutation.begin() + begin, permutation.begin() + middle,
+                   permutation.begin() + end, [&splitSamples](size_t i, size_t j) {
+                     return splitSamples[i] < splitSamples[j];
+                   });
+
+  const size_t left = nodes.size();
+  nodes[node].left = left;
+  nodes.push_back(Node{begin, middle, 0, 0.0});
+  nodes.push_back(Node{middle, end, 0, 0.0});
+
+  build(left, begin, middle, permutation, samplesVec);
+  build(left + 1, middle, end, permutation, samplesVec);
+}
+
+double KernelDensityTree::eval(Kernel& kernel, const base::DataVector& x,
+                               double tolerance) const {
+  if (nodes.empty() || (nodes[0].weight <= 0.0)) {
+    return 0.0;
+  }
+
+  Query query{kernel, std::vector<double>(dim), 0.0, 0.0, 0.0};
+
+  for (size_t idim = 0; idim < dim; idim++) {
+    query.x[idim] = x[idim] * inverseBandwidths[idim];
+  }
+
+  // the error of an approximated node with weight w may be at most
+  // tolerance * w / (total weight) * lowerBound, which sums up to tolerance * lowerBound
+  query.errorPerWeight = 2.0 * std::max(tolerance, 0.0) / nodes[0].weight;
+
+  double kernelMin, kernelMax;
+  computeKernelBounds(query, 0, kernelMin, kernelMax);
+  query.lowerBound = nodes[0].weight * kernelMin;
+
+  evalNode(query, 0, kernelMin, kernelMax);
+  return query.result;
+}
+
+void KernelDensityTree::computeKernelBounds(Query& query, size_t node, double& kernelMin,
+                                            double& kernelMax) const {
+  const double* lower = &lowerCorners[node * dim];
+  const double* upper = &upperCorners[node * dim];
+
+  kernelMin = 1.0;
+  kernelMax = 1.0;
+
+  for (size_t idim = 0; idim < dim; idim++) {
+    const double x = query.x[idim];
+    const double minDistance =
+        (x < lower[idim]) ? (lower[idim] - x) : ((x > upper[idim]) ? (x - upper[idim]) : 0.0);
+    const double maxDistance = std::max(x - lower[idim], upper[idim] - x);
+
+    kernelMax *= query.kernel.eval(minDistance);
+    kernelMin *= query.kernel.eval(maxDistance);
+  }
+}
+
+void KernelDensityTree::evalNode(Query& query, size_t node, double kernelMin,
+                                 double kernelMax) const {
+  const Node& current = nodes[node];
+
+  if (current.weight <= 0.0) {
+    return;
+  }
+
+  if (kernelMax - kernelMin <= query.errorPerWeight * query.lowerBound) {
+    // the kernel values of all samples are close enough, approximate them by their mean
+    query.result += 0.5 * current.weight * (kernelMin + kernelMax);
+    return;
+  }
+
+  if (current.left == 0) {
+    // leaf, evaluate all kernels directly
+    double sum = 0.0;
+
+    for (size_t k = current.begin; k < current.end; k++) {
+      const double* point = &points[k * dim];
+      double value = weights[k];
+
+      for (size_t idim = 0; (idim < dim) && (value != 0.0); idim++) {
+        value *= query.kernel.eval(query.x[idim] - point[idim]);
+      }
+
+      sum += value;
+    }
+
+    query.result += sum;
+    query.lowerBound += sum - current.weight * kernelMin;
+    return;
+  }
+
+  const size_t left = current.left;
+  const size_t right = left + 1;
+  double leftMin, leftMax, rightMin, rightMax;
+
+  computeKernelBounds(query, left, leftMin, leftMax);
+  computeKernelBounds(query, right, rightMin, rightMax);
+  query.lowerBound += nodes[left].weight * leftMin + nodes[right].weight * rightMin -
+                      current.weight * kernelMin;
+
+  // visit the closer child first to tighten the lower bound early
+  if (leftMax >= rightMax) {
+    evalNode(query, left, leftMin, leftMax);
+    evalNode(query, right, rightMin, rightMax);
+  } else {
+    evalNode(query, right, rightMin, rightMax);
+    evalNode(query, left, leftMin, leftMax);
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,107 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+class Kernel;
+
+/**
+ * kd-tree over the (bandwidth-scaled) samples of a kernel density estimator, which is used
+ * to evaluate weighted sums of product kernels
+ * \f$\sum_i w_i \prod_d K((x_d - x_{i,d}) / h_d)\f$
+ * with a bounded relative error.
+ *
+ * Every node of the tree stores the bounding box and the sum of the weights of its samples.
+ * From the bounding box, lower and upper bounds for the kernel values of all samples of the node
+ * are derived, which requires the 1d kernel to be symmetric and non-increasing in \f$|x|\f$
+ * (which holds for the Gaussian and the Epanechnikov kernel).
+ * The contribution of a node is approximated by the mean of both bounds if the resulting
+ * error is small compared to a running lower bound of the whole sum. This guarantees that the
+ * relative error of the result does not exceed the given tolerance.
+ */
+class KernelDensityTree {
+ public:
+  /**
+   * Builds the tree.
+   *
+   * @param samplesVec  samples stored dimension-wise (samplesVec[d][i] is the d-th coordinate
+   *                    of the i-th sample)
+   * @param bandwidths  bandwidths \f$h_d\f$ of the kernels
+   * @param weights     nonnegative weights \f$w_i\f$ of the samples
+   * @param leafSize    maximal number of samples per leaf
+   */
+  KernelDensityTree(std::vector<std::shared_ptr<base::DataVector>>& samplesVec,
+                    const base::DataVector& bandwidths, const base::DataVector& weights,
+                    size_t leafSize = 32);
+
+  /**
+   * Evaluates the weighted sum of the kernels (this method is thread-safe).
+   *
+   * @param kernel      1d kernel (symmetric and non-increasing in \f$|x|\f$)
+   * @param x           evaluation point
+   * @param tolerance   maximal relative error of the result
+   * @return            approximation of \f$\sum_i w_i \prod_d K((x_d - x_{i,d}) / h_d)\f$
+   */
+  double eval(Kernel& kernel, const base::DataVector& x, double tolerance) const;
+
+ protected:
+  /// node of the tree, the samples of the node are [begin, end) in points and weights
+  struct Node {
+    size_t begin;
+    size_t end;
+    /// index of the left child (the right child is left + 1), 0 for leaves
+    size_t left;
+    /// sum of the weights of the samples
+    double weight;
+  };
+
+  /// state of a single evaluation
+  struct Query {
+    Kernel& kernel;
+    /// scaled evaluation point
+    std::vector<double> x;
+    /// maximal error per unit weight relative to lowerBound
+    double errorPerWeight;
+    /// lower bound of the whole sum
+    double lowerBound;
+    /// (approximated) sum
+    double result;
+  };
+
+  void build(size_t node, size_t begin, size_t end, std::vector<size_t>& permutation,
+             std::vector<std::shared_ptr<base::DataVector>>& samplesVec);
+  void computeKernelBounds(Query& query, size_t node, double& kernelMin, double& kernelMax) const;
+  void evalNode(Query& query, size_t node, double kernelMin, double kernelMax) const;
+
+  /// dimensionality of the samples
+  size_t dim;
+  /// maximal number of samples per leaf
+  size_t leafSize;
+  /// inverse bandwidths
+  std::vector<double> inverseBandwidths;
+  /// scaled samples in tree order (row-major)
+  std::vector<double> points;
+  /// weights in tree order
+  std::vector<double> weights;
+  /// nodes, the root has index 0
+  std::vector<Node> nodes;
+  /// lower and upper corners of the bounding boxes of the nodes (row-major)
+  std::vector<double> lowerCorners;
+  std::vector<double> upperCorners;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
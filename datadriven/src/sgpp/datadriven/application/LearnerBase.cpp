@@ -21,6 +21,7 @@
 #include "sgpp/globaldef.hpp"
 #include "sgpp/solver/sle/BiCGStab.hpp"
 #include "sgpp/solver/sle/ConjugateGradients.hpp"
+#include "sgpp/solver/sle/PipelinedConjugateGradients.hpp"
 
 namespace sgpp {
 namespace datadriven {
@@ -171,6 +172,9 @@ LearnerTiming LearnerBase::train(sgpp::base::DataMatrix& trainDataset,
   } else if (SolverConfigRefine.type_ == sgpp::solver::SLESolverType::BiCGSTAB) {
     myCG = std::make_unique<sgpp::solver::BiCGStab>(SolverConfigRefine.maxIterations_,
                                                     SolverConfigRefine.eps_);
+  } else if (SolverConfigRefine.type_ == sgpp::solver::SLESolverType::PipelinedCG) {
+    myCG = std::make_unique<sgpp::solver::PipelinedConjugateGradients>(
+        SolverConfigRefine.maxIterations_, SolverConfigRefine.eps_);
   } else {
     throw base::application_exception(
         "LearnerBase::train: An unsupported SLE solver type was chosen!");
@@ -16,6 +16,7 @@
 
 #include <sgpp/solver/sle/ConjugateGradientsSP.hpp>
 #include <sgpp/solver/sle/BiCGStabSP.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradientsSP.hpp>
 
 #include <sgpp/datadriven/application/LearnerBaseSP.hpp>
 
@@ -186,6 +187,9 @@ LearnerTiming LearnerBaseSP::train(sgpp::base::DataMatrixSP& trainDataset,
                                                   SolverConfigRefine.eps_);
   } else if (SolverConfigRefine.type_ == sgpp::solver::SLESolverType::BiCGSTAB) {
     myCG = new sgpp::solver::BiCGStabSP(SolverConfigRefine.maxIterations_, SolverConfigRefine.eps_);
+  } else if (SolverConfigRefine.type_ == sgpp::solver::SLESolverType::PipelinedCG) {
+    myCG = new sgpp::solver::PipelinedConjugateGradientsSP(SolverConfigRefine.maxIterations_,
+                                                           SolverConfigRefine.eps_);
   } else {
     throw base::application_exception(
         "LearnerBaseSP::train: An unsupported SLE solver type was "
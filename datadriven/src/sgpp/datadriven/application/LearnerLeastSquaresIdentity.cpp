@@ -3,6 +3,7 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <algorithm>
 #include <utility>
 #include <string>
 #include <vector>
@@ -11,7 +12,10 @@
 #include "sgpp/datadriven/algorithm/SystemMatrixLeastSquaresIdentity.hpp"
 #include "sgpp/datadriven/tools/LearnerVectorizedPerformanceCalculator.hpp"
 #include "sgpp/datadriven/DatadrivenOpFactory.hpp"
+#include "sgpp/base/exception/application_exception.hpp"
 #include "sgpp/base/exception/factory_exception.hpp"
+#include "sgpp/base/tools/SGppStopwatch.hpp"
+#include "sgpp/solver/sle/MultiShiftConjugateGradients.hpp"
 #include "sgpp/globaldef.hpp"
 
 namespace sgpp {
@@ -34,7 +38,14 @@ std::unique_ptr<sgpp::datadriven::DMSystemMatrixBase> LearnerLeastSquaresIdentit
   std::unique_ptr<sgpp::datadriven::SystemMatrixLeastSquaresIdentity> systemMatrix =
       std::make_unique<sgpp::datadriven::SystemMatrixLeastSquaresIdentity>(*(this->grid),
                                                                            trainDataset, lambda);
-  systemMatrix->setImplementation(this->implementationConfiguration);
+
+  // the plan is bound to the dataset of the system matrix, hence it is only passed to its
+  // operation and not to the operations of predict
+  sgpp::datadriven::OperationMultipleEvalConfiguration systemConfiguration(
+      this->implementationConfiguration);
+  systemPlan = std::make_shared<sgpp::datadriven::OperationMultipleEvalPlan>();
+  systemConfiguration.setPlan(systemPlan);
+  systemMatrix->setImplementation(systemConfiguration);
   return std::unique_ptr<sgpp::datadriven::DMSystemMatrixBase>(systemMatrix.release());
 }
 
@@ -54,6 +65,12 @@ void LearnerLeastSquaresIdentity::postProcessing(const sgpp::base::DataMatrix& t
     std::cout << std::endl;
     std::cout << "Current GFlop/s: " << this->GFlop / this->execTime << std::endl;
     std::cout << "Current GByte/s: " << this->GByte / this->execTime << std::endl;
+
+    // only available if the operation supports evaluation plans
+    if ((systemPlan != nullptr) && (systemPlan->getNumComputations() > 0)) {
+      systemPlan->printStatistics(std::cout);
+    }
+
     std::cout << std::endl;
   }
 }
@@ -102,6 +119,90 @@ double LearnerLeastSquaresIdentity::testRegular(
   return stopTime;
 }
 
+std::vector<double> LearnerLeastSquaresIdentity::trainRegularizationPath(
+    sgpp::base::DataMatrix& trainDataset, sgpp::base::DataVector& classes,
+    sgpp::base::DataMatrix& validationDataset, sgpp::base::DataVector& validationClasses,
+    const sgpp::base::RegularGridConfiguration& GridConfig,
+    const sgpp::solver::SLESolverConfiguration& SolverConfig, const std::vector<double>& lambdas) {
+  if (trainDataset.getNrows() != classes.getSize()) {
+    throw base::application_exception(
+        "LearnerLeastSquaresIdentity::trainRegularizationPath: length of classes vector does "
+        "not match to dataset!");
+  }
+
+  if (validationDataset.getNrows() != validationClasses.getSize()) {
+    throw base::application_exception(
+        "LearnerLeastSquaresIdentity::trainRegularizationPath: length of validation classes "
+        "vector does not match to validation dataset!");
+  }
+
+  if (lambdas.empty()) {
+    throw base::application_exception(
+        "LearnerLeastSquaresIdentity::trainRegularizationPath: no regularization parameters "
+        "given!");
+  }
+
+  isTrained = false;
+  execTime = 0.0;
+  InitializeGrid(GridConfig);
+
+  sgpp::base::SGppStopwatch myStopwatch;
+  myStopwatch.start();
+
+  // B^T B + M * lambda * I is B^T B shifted by M * lambda
+  std::unique_ptr<sgpp::datadriven::DMSystemMatrixBase> DMSystem =
+      createDMSystem(trainDataset, 0.0);
+  sgpp::base::DataVector b(grid->getSize());
+  DMSystem->generateb(classes, b);
+
+  std::vector<double> shifts(lambdas.size());
+
+  for (size_t k = 0; k < lambdas.size(); k++) {
+    shifts[k] = static_cast<double>(trainDataset.getNrows()) * lambdas[k];
+  }
+
+  sgpp::solver::MultiShiftConjugateGradients solver(SolverConfig.maxIterations_,
+                                                    SolverConfig.eps_);
+  sgpp::base::DataMatrix alphas;
+  solver.solve(*DMSystem, alphas, b, shifts, solverVerbose);
+
+  // evaluate all models on the validation data in one pass
+  std::unique_ptr<sgpp::base::OperationMultipleEval> MultEval(
+      sgpp::op_factory::createOperationMultipleEval(*(this->grid), validationDataset,
+                                                    this->implementationConfiguration));
+  sgpp::base::DataMatrix predictions;
+  MultEval->multBlock(alphas, predictions);
+
+  const size_t numValidation = validationClasses.getSize();
+  std::vector<double> errors(lambdas.size(), 0.0);
+  size_t bestIndex = 0;
+
+  for (size_t k = 0; k < lambdas.size(); k++) {
+    for (size_t i = 0; i < numValidation; i++) {
+      const double residual = predictions(i, k) - validationClasses[i];
+      errors[k] += residual * residual;
+    }
+
+    errors[k] /= static_cast<double>(std::max(numValidation, static_cast<size_t>(1)));
+
+    if (errors[k] < errors[bestIndex]) {
+      bestIndex = k;
+    }
+  }
+
+  alphas.getColumn(bestIndex, *alpha);
+  isTrained = true;
+  execTime = myStopwatch.stop();
+
+  if (isVerbose) {
+    std::cout << "Needed Iterations: " << solver.getNumberIterations() << std::endl;
+    std::cout << "Best lambda: " << lambdas[bestIndex] << " (MSE " << errors[bestIndex] << ")"
+              << std::endl;
+  }
+
+  return errors;
+}
+
 std::vector<std::pair<size_t, double> > LearnerLeastSquaresIdentity::getRefinementExecTimes() {
   return this->ExecTimeOnStep;
 }
@@ -8,9 +8,11 @@
 #include <sgpp/datadriven/application/LearnerBase.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalPlan.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 #include <utility>
 #include <string>
 #include <vector>
@@ -33,6 +35,9 @@ class LearnerLeastSquaresIdentity : public sgpp::datadriven::LearnerBase {
 
   sgpp::datadriven::OperationMultipleEvalConfiguration implementationConfiguration;
 
+  // evaluation plan of the system matrix, kept across refinements and used for time measurements
+  std::shared_ptr<sgpp::datadriven::OperationMultipleEvalPlan> systemPlan;
+
  protected:
   std::unique_ptr<sgpp::datadriven::DMSystemMatrixBase> createDMSystem(
       sgpp::base::DataMatrix& trainDataset, double lambda) override;
@@ -66,6 +71,30 @@ class LearnerLeastSquaresIdentity : public sgpp::datadriven::LearnerBase {
   double testRegular(const sgpp::base::RegularGridConfiguration& GridConfig,
                      sgpp::base::DataMatrix& testDataset);
 
+  /**
+   * Learns the regression function on a regular grid for a whole sweep of regularization
+   * parameters at once. As the identity is used as regularization operator, all systems
+   * are solved in a single Krylov run (see solver::MultiShiftConjugateGradients), i.e.,
+   * the sweep costs about as much as a single solve. Afterwards, the learner uses the
+   * regularization parameter with the smallest mean squared error on the validation data.
+   *
+   * @param trainDataset training dataset
+   * @param classes classes corresponding to the training dataset
+   * @param validationDataset validation dataset
+   * @param validationClasses classes corresponding to the validation dataset
+   * @param GridConfig configuration of the regular grid
+   * @param SolverConfig configuration of the SLE solver (the solver type is ignored)
+   * @param lambdas regularization parameters
+   * @return mean squared errors on the validation data (one entry per
+   *         regularization parameter)
+   */
+  std::vector<double> trainRegularizationPath(
+      sgpp::base::DataMatrix& trainDataset, sgpp::base::DataVector& classes,
+      sgpp::base::DataMatrix& validationDataset, sgpp::base::DataVector& validationClasses,
+      const sgpp::base::RegularGridConfiguration& GridConfig,
+      const sgpp::solver::SLESolverConfiguration& SolverConfig,
+      const std::vector<double>& lambdas);
+
   std::vector<std::pair<size_t, double> > getRefinementExecTimes();
 
   void setImplementation(
@@ -22,6 +22,7 @@
 #include <cmath>
 #include <string>
 #include <algorithm>
+#include <vector>
 
 using sgpp::base::GridStorage;
 using sgpp::base::HashRefinement;
@@ -53,6 +54,8 @@ LearnerSGD::LearnerSGD(base::RegularGridConfiguration& gridConfig,
       batchData(nullptr),
       batchLabels(nullptr),
       batchError(base::DataVector(0)),
+      trainPredictions(base::DataVector(0)),
+      trainPredictionsAvg(base::DataVector(0)),
       gridConfig(gridConfig),
       adaptivityConfig(adaptivityConfig),
       lambda(lambda),
@@ -145,6 +148,21 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
   double beta_2 = 0.95;
   double epsilon = 1e-8;*/
 
+  // the predictions of the training data are only needed for the refinement monitor,
+  // they are updated incrementally in each step (only the basis functions whose
+  // coefficients changed are evaluated)
+  bool updateTrainPredictions = (monitor != nullptr) && (refNum > 0);
+  std::unique_ptr<base::OperationMultipleEval> trainEval;
+  std::vector<size_t> changedPoints;
+
+  if (updateTrainPredictions) {
+    trainEval.reset(op_factory::createOperationMultipleEval(*grid, trainData));
+    trainPredictions.resize(trainData.getNrows());
+    trainPredictionsAvg.resize(trainData.getNrows());
+    trainEval->mult(alpha, trainPredictions);
+    trainEval->mult(alphaAvg, trainPredictionsAvg);
+  }
+
   // counts total number of processed data points
   size_t processedPoints = 0;
   // main loop which performs the learning process
@@ -206,6 +224,20 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
       alpha.mult(1 - currentGamma * lambda);
       alpha.axpy(-currentGamma * residual, delta);
 
+      if (updateTrainPredictions) {
+        changedPoints.clear();
+
+        for (size_t i = 0; i < delta.getSize(); i++) {
+          if (delta[i] != 0.0) {
+            changedPoints.push_back(i);
+          }
+        }
+
+        trainPredictions.mult(1 - currentGamma * lambda);
+        delta.mult(-currentGamma * residual);
+        trainEval->multIncremental(delta, trainPredictions, changedPoints);
+      }
+
       // learning rate according to L. Bottou
       /*currentGamma =
           gamma *
@@ -230,11 +262,16 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
       alphaAvg.mult(1 - mu);
       alphaAvg.axpy(mu, alpha);
 
+      if (updateTrainPredictions) {
+        trainPredictionsAvg.mult(1 - mu);
+        trainPredictionsAvg.axpy(mu, trainPredictions);
+      }
+
       size_t refinementsNecessary = 0;
       if (refCnt < refNum && processedPoints > 0 && monitor) {
         // check if refinement should be performed
         currentBatchError = getError(*batchData, *batchLabels, "MSE");
-        currentTrainError = getError(trainData, trainLabels, "MSE");
+        currentTrainError = getError(trainLabels, trainPredictionsAvg, "MSE");
         monitor->pushToBuffer(1, currentBatchError, currentTrainError);
         refinementsNecessary = monitor->refinementsNecessary();
       }
@@ -266,8 +303,10 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
               threshold, numPoints);
           decorator.free_refine(gridStorage, indicator);
         }
+        // the new coefficients are zero, hence the predictions do not change
         alpha.resizeZero(grid->getSize());
         alphaAvg.resizeZero(grid->getSize());
+        trainEval.reset(op_factory::createOperationMultipleEval(*grid, trainData));
 
         // required for ADAM
         // m.resizeZero(grid->getSize());
@@ -287,6 +326,7 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
       }
 
       processedPoints++;
+      updateTrainPredictions = updateTrainPredictions && (refCnt < refNum);
     }
     cntDataPasses++;
   }
@@ -370,15 +410,22 @@ void LearnerSGD::storeResults(base::DataMatrix& testDataset) {
 double LearnerSGD::getError(sgpp::base::DataMatrix& data,
                             sgpp::base::DataVector& labels,
                             std::string errorType) {
-  size_t numData = data.getNrows();
-  sgpp::base::DataVector result(numData);
-  sgpp::base::DataVector error(numData);
-  error.setAll(0.0);
+  sgpp::base::DataVector result(data.getNrows());
 
   std::unique_ptr<base::OperationMultipleEval> opEval(
       op_factory::createOperationMultipleEval(*grid, data));
   opEval->mult(alphaAvg, result);
 
+  return getError(labels, result, errorType);
+}
+
+double LearnerSGD::getError(sgpp::base::DataVector& labels,
+                            sgpp::base::DataVector& result,
+                            std::string errorType) {
+  size_t numData = result.getSize();
+  sgpp::base::DataVector error(numData);
+  error.setAll(0.0);
+
   double res = -1.0;
   if (errorType == "MSE") {
     for (size_t i = 0; i < numData; i++) {
@@ -127,6 +127,17 @@ class LearnerSGD {
   double getError(sgpp::base::DataMatrix& data, sgpp::base::DataVector& labels,
                   std::string errorType);
 
+  /**
+   * Computes specified error type (e.g. MSE) of given predictions.
+   *
+   * @param labels The actual class labels
+   * @param result The predictions of the model
+   * @param errorType The type of the error measurement (MSE or Hinge loss)
+   * @return The error estimation
+   */
+  double getError(sgpp::base::DataVector& labels, sgpp::base::DataVector& result,
+                  std::string errorType);
+
   /**
    * Computes error contribution for each data point of the given
    * data set (required for predictive refinement indicator).
@@ -177,6 +188,10 @@ class LearnerSGD {
   base::DataMatrix* batchData;
   base::DataVector* batchLabels;
   base::DataVector batchError;
+  // predictions of alpha and alphaAvg for the training data
+  // (only up to date while the refinement monitor is used)
+  base::DataVector trainPredictions;
+  base::DataVector trainPredictionsAvg;
 
   base::RegularGridConfiguration gridConfig;
   base::AdaptivityConfiguration adaptivityConfig;
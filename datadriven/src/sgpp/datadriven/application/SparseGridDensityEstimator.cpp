@@ -15,6 +15,7 @@
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
 #include <sgpp/datadriven/algorithm/DensitySystemMatrix.hpp>
 #include <sgpp/solver/TypesSolver.hpp>
 #include <sgpp/base/tools/json/json_exception.hpp>
@@ -32,6 +33,7 @@
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -220,10 +222,12 @@ SparseGridDensityEstimatorConfiguration::stringToRegularizationType(
 
 sgpp::solver::SLESolverType SparseGridDensityEstimatorConfiguration::stringToSolverType(
     std::string& solverType) {
-  if (solverType.compare("CG")) {
+  if (solverType.compare("CG") == 0) {
     return sgpp::solver::SLESolverType::CG;
-  } else if (solverType.compare("BiCGSTAB")) {
+  } else if (solverType.compare("BiCGSTAB") == 0) {
     return sgpp::solver::SLESolverType::BiCGSTAB;
+  } else if (solverType.compare("PipelinedCG") == 0) {
+    return sgpp::solver::SLESolverType::PipelinedCG;
   } else {
     throw sgpp::base::application_exception("solver type is unknown");
   }
@@ -489,10 +493,19 @@ void SparseGridDensityEstimator::train(base::Grid& grid, base::DataVector& alpha
       std::cout << "# LearnerSGDE: Solving " << std::endl;
     }
 
-    solver::ConjugateGradients myCG(solverConfig.maxIterations_, solverConfig.eps_);
-    myCG.solve(*sMatrix, alpha, rhs, false, solverConfig.verbose_, solverConfig.threshold_);
+    std::unique_ptr<solver::ConjugateGradients> myCG;
 
-    if (myCG.getResiduum() > solverConfig.threshold_) {
+    if (solverConfig.type_ == solver::SLESolverType::PipelinedCG) {
+      myCG = std::make_unique<solver::PipelinedConjugateGradients>(solverConfig.maxIterations_,
+                                                                   solverConfig.eps_);
+    } else {
+      myCG = std::make_unique<solver::ConjugateGradients>(solverConfig.maxIterations_,
+                                                          solverConfig.eps_);
+    }
+
+    myCG->solve(*sMatrix, alpha, rhs, false, solverConfig.verbose_, solverConfig.threshold_);
+
+    if (myCG->getResiduum() > solverConfig.threshold_) {
       throw base::operation_exception("LearnerSGDE - train: conjugate gradients is not converged");
     }
 
@@ -546,7 +559,14 @@ double SparseGridDensityEstimator::computeResidual(base::Grid& grid, base::DataV
 }
 
 base::OperationMatrix* SparseGridDensityEstimator::computeLTwoDotProductMatrix(base::Grid& grid) {
-  return op_factory::createOperationLTwoDotProduct(grid);
+  if (grid.getType() == base::GridType::Bspline ||
+      grid.getType() == base::GridType::ModBspline ||
+      grid.getType() == base::GridType::BsplineClenshawCurtis ||
+      grid.getType() == base::GridType::ModBsplineClenshawCurtis) {
+    return op_factory::createOperationLTwoDotExplicitSparse(grid);
+  } else {
+    return op_factory::createOperationLTwoDotProduct(grid);
+  }
 }
 
 base::OperationMultipleEval* SparseGridDensityEstimator::computeMultipleEvalMatrix(
@@ -235,6 +235,8 @@ class SparseGridDensityEstimator : public datadriven::DensityEstimator {
 
   /**
    * generates the L^2 dot product matrix
+   * (for B-spline grids, the matrix is assembled once in symmetric sparse format,
+   * as the matrix-free operators compute all pairwise products in every application)
    * @param grid grid
    */
   base::OperationMatrix* computeLTwoDotProductMatrix(base::Grid& grid);
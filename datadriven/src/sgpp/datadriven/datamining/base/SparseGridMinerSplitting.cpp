@@ -71,12 +71,17 @@ double SparseGridMinerSplitting::learn(bool verbose) {
 
       // Evaluate the score on the training and validation data
       double scoreTrain = scorer->test(*fitter, *dataset);
-      double scoreVal = scorer->test(*fitter, *(dataSource->getValidationData()));
+      double scoreVal = scorer->testValidation(*fitter, *(dataSource->getValidationData()));
 
       if (verbose) {
+        double lower, upper;
+        scorer->getConfidenceInterval(lower, upper);
         std::ostringstream out;
         out << "Score on batch: " << scoreTrain << std::endl
             << "Score on validation data: " << scoreVal;
+        if (lower != upper) {
+          out << " (confidence interval [" << lower << ", " << upper << "])";
+        }
         print(out);
       }
 
@@ -91,7 +96,7 @@ double SparseGridMinerSplitting::learn(bool verbose) {
       }
     }
   }
-  return scorer->test(*fitter, *(dataSource->getValidationData()));
+  return scorer->testValidation(*fitter, *(dataSource->getValidationData()));
 }  // namespace datadriven
 }  // namespace datadriven
 }  // namespace sgpp
@@ -15,6 +15,7 @@
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceFileTypeParser.hpp>
@@ -79,6 +80,8 @@ DataSourceSplitting* DataSourceBuilder::splittingAssemble() const {
     sampleProvider = new ArffFileSampleProvider(shuffling);
   } else if (config.fileType == DataSourceFileType::CSV) {
     sampleProvider = new CSVFileSampleProvider(shuffling);
+  } else if (config.fileType == DataSourceFileType::BINARY) {
+    sampleProvider = new BinaryFileSampleProvider(shuffling);
   } else {
     data_exception("Unknown file type");
   }
@@ -117,6 +120,8 @@ DataSourceCrossValidation* DataSourceBuilder::crossValidationAssemble() const {
     sampleProvider = new ArffFileSampleProvider(crossValidationShuffling);
   } else if (config.fileType == DataSourceFileType::CSV) {
     sampleProvider = new CSVFileSampleProvider(crossValidationShuffling);
+  } else if (config.fileType == DataSourceFileType::BINARY) {
+    sampleProvider = new BinaryFileSampleProvider(crossValidationShuffling);
   } else {
     data_exception("Unknown file type");
   }
@@ -157,6 +157,8 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
     config.randomSeed =
         parseUInt(*dataSourceConfig, "randomSeed", defaults.randomSeed, "dataSource");
     config.epochs = parseUInt(*dataSourceConfig, "epochs", defaults.epochs, "dataSource");
+    config.prefetchDepth =
+        parseUInt(*dataSourceConfig, "prefetchDepth", defaults.prefetchDepth, "dataSource");
 
     // Parse info for test data
     config.testFilePath = parseString(*dataSourceConfig, "testFilePath",
@@ -213,6 +215,17 @@ bool DataMiningConfigParser::getScorerConfig(ScorerConfiguration &config,
       std::cout << "# Did not find scorer[metric]. Setting default value "
                 << ScorerMetricTypeParser::toString(defaults.metric) << "." << std::endl;
     }
+
+    config.cachePredictions =
+        parseBool(*scorerConfig, "cachePredictions", defaults.cachePredictions, "scorer");
+    config.incrementalUpdateThreshold =
+        parseDouble(*scorerConfig, "incrementalUpdateThreshold",
+                    defaults.incrementalUpdateThreshold, "scorer");
+    config.subsampleSize =
+        parseUInt(*scorerConfig, "subsampleSize", defaults.subsampleSize, "scorer");
+    config.randomSeed = parseInt(*scorerConfig, "randomSeed", defaults.randomSeed, "scorer");
+    config.confidenceLevel =
+        parseDouble(*scorerConfig, "confidenceLevel", defaults.confidenceLevel, "scorer");
   } else {
     std::cout << "# Could not find specification  of scorer. Falling Back to default values."
               << std::endl;
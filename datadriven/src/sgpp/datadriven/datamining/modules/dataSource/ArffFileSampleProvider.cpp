@@ -15,7 +15,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
-#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/ParallelDatasetReader.hpp>
 
 #include <string>
 #include <vector>
@@ -53,11 +53,11 @@ void ArffFileSampleProvider::readFile(const std::string& fileName,
                                       std::vector<size_t> readinColumns,
                                       std::vector<double> readinClasses) {
   try {
-    dataset = ARFFTools::readARFFFromFile(fileName, hasTargets, readinCutoff,
+    dataset = ParallelDatasetReader::readARFFFromFile(fileName, hasTargets, readinCutoff,
         readinColumns, readinClasses);
   } catch (...) {
-    // TODO(lettrich): catching all exceptions is bad design. Replace call to ARFFTools with
-    // exception safe implementation.
+    // TODO(lettrich): catching all exceptions is bad design. Replace call to
+    // ParallelDatasetReader with exception safe implementation.
     throw base::data_exception{"Failed to parse ARFF File."};
   }
 }
@@ -84,11 +84,11 @@ void ArffFileSampleProvider::readString(const std::string& input,
                                         std::vector<size_t> readinColumns,
                                         std::vector<double> readinClasses) {
   try {
-    dataset = ARFFTools::readARFFFromString(input, hasTargets, readinCutoff,
+    dataset = ParallelDatasetReader::readARFFFromString(input, hasTargets, readinCutoff,
         readinColumns, readinClasses);
   } catch (...) {
-    // TODO(lettrich): catching all exceptions is bad design. Replace call to ARFFTools with
-    // exception safe implementation.
+    // TODO(lettrich): catching all exceptions is bad design. Replace call to
+    // ParallelDatasetReader with exception safe implementation.
     throw base::data_exception{"Failed to parse ARFF data."};
   }
 }
@@ -0,0 +1,140 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * BinaryFileSampleProvider.cpp
+ */
+
+#include <sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/ParallelDatasetReader.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+BinaryFileSampleProvider::BinaryFileSampleProvider(DataShufflingFunctor *shuffling)
+    : shuffling{shuffling}, file{}, columns{}, instances{}, numSamples(0), counter(0) {}
+
+SampleProvider *BinaryFileSampleProvider::clone() const {
+  return dynamic_cast<SampleProvider *>(new BinaryFileSampleProvider{*this});
+}
+
+size_t BinaryFileSampleProvider::getDim() const {
+  if (file != nullptr) {
+    return columns.empty() ? file->getDimension() : columns.size();
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+size_t BinaryFileSampleProvider::getNumSamples() const {
+  if (file != nullptr) {
+    return numSamples;
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+void BinaryFileSampleProvider::readFile(const std::string &filePath, bool hasTargets,
+                                        size_t readinCutoff, std::vector<size_t> readinColumns,
+                                        std::vector<double> readinClasses) {
+  file = std::make_shared<const BinaryDatasetFile>(filePath);
+  selectSamples(hasTargets, readinCutoff, readinColumns, readinClasses);
+}
+
+void BinaryFileSampleProvider::readString(const std::string &input, bool hasTargets,
+                                          size_t readinCutoff, std::vector<size_t> readinColumns,
+                                          std::vector<double> readinClasses) {
+  file = std::make_shared<const BinaryDatasetFile>(input.data(), input.size());
+  selectSamples(hasTargets, readinCutoff, readinColumns, readinClasses);
+}
+
+void BinaryFileSampleProvider::selectSamples(bool hasTargets, size_t readinCutoff,
+                                             std::vector<size_t> &readinColumns,
+                                             std::vector<double> &readinClasses) {
+  if (hasTargets && !file->hasTargets()) {
+    file.reset();
+    throw base::data_exception{"Binary dataset does not contain targets."};
+  }
+
+  for (size_t column : readinColumns) {
+    if (column >= file->getDimension()) {
+      file.reset();
+      throw base::data_exception{"Selected column does not exist in the binary dataset."};
+    }
+  }
+
+  columns = readinColumns;
+  instances.clear();
+  counter = 0;
+
+  if (!hasTargets || readinClasses.empty()) {
+    numSamples = std::min(readinCutoff, file->getNumberInstances());
+    return;
+  }
+
+  // collect the instances with admissible targets, chunks without any admissible target are
+  // skipped with the chunk index
+  const size_t numberInstances = file->getNumberInstances();
+  const size_t chunkSize = file->getChunkSize() == 0 ? numberInstances : file->getChunkSize();
+
+  for (size_t begin = 0; begin < numberInstances && instances.size() < readinCutoff;
+       begin += chunkSize) {
+    if (!file->chunkMayContain(begin / chunkSize, readinClasses)) {
+      continue;
+    }
+
+    const size_t end = std::min(begin + chunkSize, numberInstances);
+
+    for (size_t i = begin; i < end && instances.size() < readinCutoff; i++) {
+      if (ParallelDatasetReader::isSelectedTarget(file->getTarget(i), readinClasses)) {
+        instances.push_back(i);
+      }
+    }
+  }
+
+  numSamples = instances.size();
+}
+
+Dataset *BinaryFileSampleProvider::getNextSamples(size_t howMany) {
+  if (file == nullptr) {
+    throw base::file_exception("No dataset loaded.");
+  }
+
+  const size_t size = counter + howMany <= numSamples ? howMany : numSamples - counter;
+  auto tmpDataset = std::make_unique<Dataset>(size, getDim());
+
+  // indices of the requested samples in the file
+  std::vector<size_t> batch(size);
+
+  for (size_t i = 0; i < size; ++i) {
+    size_t srcIdx = shuffling != nullptr ? (*shuffling)(counter + i, numSamples) : counter + i;
+    batch[i] = instances.empty() ? srcIdx : instances[srcIdx];
+  }
+
+  file->copyInstances(batch, columns, *tmpDataset);
+  counter = counter + size;
+
+  return tmpDataset.release();
+}
+
+Dataset *BinaryFileSampleProvider::getAllSamples() {
+  if (file != nullptr) {
+    return this->getNextSamples(numSamples);
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+void BinaryFileSampleProvider::reset() { counter = 0; }
+
+} /* namespace datadriven */
+} /* namespace sgpp */
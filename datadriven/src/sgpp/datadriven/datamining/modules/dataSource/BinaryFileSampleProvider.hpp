@@ -0,0 +1,127 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * BinaryFileSampleProvider.hpp
+ */
+
+#pragma once
+
+#include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetFile.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * BinaryFileSampleProvider streams samples from a file in the binary dataset format (see
+ * #sgpp::datadriven::BinaryDatasetFile, files can be created with BinaryDatasetFile::convert).
+ * In contrast to #sgpp::datadriven::CSVFileSampleProvider and
+ * #sgpp::datadriven::ArffFileSampleProvider, the dataset is neither parsed nor copied when the
+ * file is read: the file is memory-mapped and each call of #getNextSamples copies only the
+ * requested batch from the mapped columns into a new #sgpp::datadriven::Dataset.
+ */
+class BinaryFileSampleProvider : public FileSampleProvider {
+ public:
+  /**
+   * Default constructor
+   * @param shuffling functor to permute the training data indexes
+   */
+  explicit BinaryFileSampleProvider(DataShufflingFunctor *shuffling = nullptr);
+
+  /**
+   * Clone Pattern to allow copying of derived classes. The copy shares the mapped file.
+   * @return a Pointer to a new instance of #sgpp::datadriven::BinaryFileSampleProvider with
+   * copied state. Caller owns the new object.
+   */
+  SampleProvider *clone() const override;
+
+  Dataset *getNextSamples(size_t howMany) override;
+
+  Dataset *getAllSamples() override;
+
+  size_t getDim() const override;
+
+  size_t getNumSamples() const override;
+
+  /**
+   * Map an existing file in the binary dataset format into memory. Throws if file can not be
+   * opened or is not a binary dataset.
+   * @param filePath Path to an existing file.
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readFile(const std::string &filePath,
+                bool hasTargets,
+                size_t readinCutoff = -1,
+                std::vector<size_t> readinColumns = std::vector<size_t>(),
+                std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Copy the contents of a binary dataset (e.g. a decompressed file) into memory. Throws if the
+   * string is not a binary dataset.
+   * @param input string containing a dataset in the binary dataset format
+   * @param hasTargets whether the file has targest (i.e. supervised learning)
+   * @param readinCutoff see FileSampleProvider.hpp
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   */
+  void readString(const std::string &input,
+                  bool hasTargets,
+                  size_t readinCutoff = -1,
+                  std::vector<size_t> readinColumns = std::vector<size_t>(),
+                  std::vector<double> readinClasses = std::vector<double>()) override;
+
+  /**
+   * Resets the state of the sample provider (e.g. to start a new epoch)
+   */
+  void reset() override;
+
+ private:
+  /**
+   * Functor to shuffle the data (permute the indexes)
+   */
+  DataShufflingFunctor *shuffling;
+
+  /**
+   * The mapped file, shared between clones.
+   */
+  std::shared_ptr<const BinaryDatasetFile> file;
+
+  /**
+   * Columns (dimensions) of the file that are provided, empty for all columns.
+   */
+  std::vector<size_t> columns;
+
+  /**
+   * Indices of the instances of the file that are provided if only some classes are read in,
+   * empty if the first numSamples instances are provided.
+   */
+  std::vector<size_t> instances;
+
+  /**
+   * Number of provided samples.
+   */
+  size_t numSamples;
+
+  /**
+   * Indicates the index where #getNextSamples will start grabbing new samples in its next call.
+   */
+  size_t counter;
+
+  /**
+   * Helper member function for #readFile and #readString. Determines the provided columns and
+   * instances of the mapped file.
+   */
+  void selectSamples(bool hasTargets, size_t readinCutoff, std::vector<size_t> &readinColumns,
+                     std::vector<double> &readinClasses);
+};
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -15,7 +15,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
-#include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/ParallelDatasetReader.hpp>
 
 #include <string>
 #include <vector>
@@ -53,12 +53,12 @@ void CSVFileSampleProvider::readFile(const std::string& fileName,
                                      std::vector<size_t> readinColumns,
                                      std::vector<double> readinClasses) {
   try {
-    // call readCSV with skipfirstline set to true
-    dataset = CSVTools::readCSVFromFile(fileName, true, hasTargets, readinCutoff,
+    // read the CSV with skipfirstline set to true
+    dataset = ParallelDatasetReader::readCSVFromFile(fileName, true, hasTargets, readinCutoff,
         readinColumns, readinClasses);
   } catch (...) {
-    // TODO(lettrich): catching all exceptions is bad design. Replace call to CSVTools with
-    // exception safe implementation.
+    // TODO(lettrich): catching all exceptions is bad design. Replace call to
+    // ParallelDatasetReader with exception safe implementation.
     throw base::data_exception{"Failed to parse CSV File."};
   }
 }
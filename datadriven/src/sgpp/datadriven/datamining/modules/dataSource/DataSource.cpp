@@ -21,12 +21,19 @@
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 namespace sgpp {
 namespace datadriven {
 
 DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp)
-    : config(conf), currentIteration(0), sampleProvider(std::unique_ptr<SampleProvider>(sp)) {
+    : config(conf),
+      currentIteration(0),
+      sampleProvider(std::unique_ptr<SampleProvider>(sp)),
+      loadedBatches(0),
+      prefetchStopRequested(false),
+      prefetchFinished(false) {
   // if a file name was specified, we are reading from a file, so we need to open it.
   if (!this->config.filePath.empty()) {
     std::cout << "Read file " << config.filePath << std::endl;
@@ -39,21 +46,66 @@ DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp)
   dataTransformation = dataTrBuilder.buildTransformation(conf.dataTransformationConfig);
 }
 
+DataSource::~DataSource() { stopPrefetching(); }
+
 DataSourceIterator DataSource::begin() { return DataSourceIterator(*this, 0); }
 
 DataSourceIterator DataSource::end() { return DataSourceIterator(*this, config.numBatches); }
 
 Dataset* DataSource::getNextSamples() {
+  if (config.prefetchDepth == 0) {
+    currentIteration++;
+    return loadNextSamples();
+  }
+
+  std::unique_lock<std::mutex> lock(prefetchMutex);
+
+  // the prefetching thread is started lazily, such that the sample provider can be reset (and
+  // validation data can be drawn from it) before the first batch is requested
+  if (!prefetchThread.joinable()) {
+    prefetchStopRequested = false;
+    prefetchFinished = false;
+    prefetchThread = std::thread(&DataSource::prefetch, this);
+  }
+
+  prefetchCondition.wait(lock, [this]() { return !prefetchQueue.empty() || prefetchFinished; });
+
+  if (prefetchQueue.empty()) {
+    if (prefetchException) {
+      std::exception_ptr exception = prefetchException;
+      prefetchException = nullptr;
+      std::rethrow_exception(exception);
+    }
+
+    // the prefetching thread has finished after the last batch, continue synchronously
+    lock.unlock();
+    currentIteration++;
+    return loadNextSamples();
+  }
+
+  std::unique_ptr<Dataset> dataset = std::move(prefetchQueue.front());
+  prefetchQueue.pop_front();
+  currentIteration++;
+  lock.unlock();
+  prefetchCondition.notify_all();
+
+  return dataset.release();
+}
+
+Dataset* DataSource::loadNextSamples() {
   Dataset* dataset = nullptr;
 
   // only one iteration: we want all samples
   if (config.numBatches == 1 && config.batchSize == 0) {
-    currentIteration++;
+    loadedBatches++;
     dataset = sampleProvider->getAllSamples();
 
-    // Transform dataset if wanted
+    // Transform dataset if wanted (an exhausted provider must not reinitialize the
+    // transformation)
     if (!(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
-      dataTransformation->initialize(dataset, config.dataTransformationConfig);
+      if (dataset->getNumberInstances() > 0) {
+        dataTransformation->initialize(dataset, config.dataTransformationConfig);
+      }
       return dataTransformation->doTransformation(dataset);
     } else {
       return dataset;
@@ -61,10 +113,10 @@ Dataset* DataSource::getNextSamples() {
     // several iterations
   } else {
     dataset = sampleProvider->getNextSamples(config.batchSize);
-    currentIteration++;
+    loadedBatches++;
 
     // If data transformation wanted and first batch -> initialize transformation
-    if (currentIteration == 1 &&
+    if (loadedBatches == 1 &&
         !(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
       dataTransformation->initialize(dataset, config.dataTransformationConfig);
       return dataTransformation->doTransformation(dataset);
@@ -78,6 +130,72 @@ Dataset* DataSource::getNextSamples() {
   }
 }
 
+void DataSource::prefetch() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(prefetchMutex);
+      prefetchCondition.wait(lock, [this]() {
+        return prefetchStopRequested || prefetchQueue.size() < config.prefetchDepth;
+      });
+
+      if (prefetchStopRequested) {
+        return;
+      }
+    }
+
+    std::unique_ptr<Dataset> dataset;
+    std::exception_ptr exception = nullptr;
+
+    try {
+      dataset.reset(loadNextSamples());
+    } catch (...) {
+      exception = std::current_exception();
+    }
+
+    // an empty batch signals that the sample provider is exhausted, if all samples are requested
+    // at once, there is only one batch
+    const bool finished = (exception != nullptr) || (dataset->getNumberInstances() == 0) ||
+                          (config.numBatches == 1 && config.batchSize == 0);
+
+    {
+      std::lock_guard<std::mutex> lock(prefetchMutex);
+
+      if (exception != nullptr) {
+        prefetchException = exception;
+      } else {
+        prefetchQueue.push_back(std::move(dataset));
+      }
+
+      prefetchFinished = finished;
+    }
+
+    prefetchCondition.notify_all();
+
+    if (finished) {
+      return;
+    }
+  }
+}
+
+void DataSource::stopPrefetching() {
+  {
+    std::lock_guard<std::mutex> lock(prefetchMutex);
+    prefetchStopRequested = true;
+  }
+
+  prefetchCondition.notify_all();
+
+  if (prefetchThread.joinable()) {
+    prefetchThread.join();
+  }
+
+  std::lock_guard<std::mutex> lock(prefetchMutex);
+  prefetchQueue.clear();
+  prefetchException = nullptr;
+  prefetchStopRequested = false;
+  prefetchFinished = false;
+}
+
 const DataSourceConfig& DataSource::getConfig() const { return config; }
 
 size_t DataSource::getCurrentIteration() const { return currentIteration; }
@@ -17,7 +17,13 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace sgpp {
 namespace datadriven {
@@ -38,7 +44,10 @@ class DataSource {
    */
   DataSource(DataSourceConfig config, SampleProvider* sampleProvider);
 
-  virtual ~DataSource() = default;
+  /**
+   * Destructor, stops the prefetching thread (if any)
+   */
+  virtual ~DataSource();
 
   /**
    * Read only access to the configuration used by DataSource and underlying SampleProvider.
@@ -48,7 +57,9 @@ class DataSource {
 
   /**
    * Request data from the underlying SampleProvider as specified in the provided configuration
-   * object upon construction.
+   * object upon construction. If DataSourceConfig::prefetchDepth is positive, the batches are
+   * read and transformed by a background thread that stays up to prefetchDepth batches ahead of
+   * the caller, i.e. reading the next batch overlaps the processing of the current one.
    * @return #sgpp::datadriven::Dataset containing requested amount of samples (if available).
    */
   virtual Dataset* getNextSamples();
@@ -101,6 +112,64 @@ class DataSource {
    * pointer to DataTransformation to perform transformations on init.
    */
   DataTransformation* dataTransformation;
+
+  /**
+   * Stops the prefetching thread and discards all prefetched batches. Has to be called before
+   * the state of the sample provider is changed (e.g. when it is reset).
+   */
+  void stopPrefetching();
+
+ private:
+  /**
+   * number of batches that have been read from the sample provider (including prefetched ones).
+   */
+  size_t loadedBatches;
+
+  /**
+   * background thread reading batches if prefetching is enabled.
+   */
+  std::thread prefetchThread;
+
+  /**
+   * protects the members used for prefetching.
+   */
+  std::mutex prefetchMutex;
+
+  /**
+   * signals changes of the prefetch queue.
+   */
+  std::condition_variable prefetchCondition;
+
+  /**
+   * batches read by the prefetching thread that have not been requested yet.
+   */
+  std::deque<std::unique_ptr<Dataset>> prefetchQueue;
+
+  /**
+   * set to stop the prefetching thread.
+   */
+  bool prefetchStopRequested;
+
+  /**
+   * set by the prefetching thread after it has read the last (empty) batch or failed.
+   */
+  bool prefetchFinished;
+
+  /**
+   * exception thrown by the prefetching thread, rethrown by #getNextSamples.
+   */
+  std::exception_ptr prefetchException;
+
+  /**
+   * Reads the next batch from the sample provider and transforms it if wanted.
+   * @return the next batch, caller owns the object.
+   */
+  Dataset* loadNextSamples();
+
+  /**
+   * Main loop of the prefetching thread.
+   */
+  void prefetch();
 };
 
 } /* namespace datadriven */
@@ -22,7 +22,7 @@ namespace datadriven {
 /**
  * Supported file types for sgpp::datadriven::FileSampleProvider
  */
-enum class DataSourceFileType { NONE, ARFF, CSV };
+enum class DataSourceFileType { NONE, ARFF, CSV, BINARY };
 
 /**
  * Enumeration of all supported shuffling types used to permute samples in a dataset. An entry
@@ -81,6 +81,11 @@ struct DataSourceConfig {
    * The number of epochs to train on
    */
   size_t epochs = 1;
+  /**
+   * How many batches are read (and transformed) ahead by a background thread while the current
+   * batch is processed - if 0, batches are read on demand by the calling thread
+   */
+  size_t prefetchDepth = 0;
   /**
    * After how many (valid) lines of the sourcefile to stop reading
    */
@@ -34,6 +34,7 @@ Dataset* DataSourceCrossValidation::getValidationData() {
 }
 
 void DataSourceCrossValidation::reset() {
+  stopPrefetching();
   sampleProvider->reset();
 
   // Retrieve validation data again
@@ -43,6 +44,8 @@ void DataSourceCrossValidation::reset() {
 }
 
 void DataSourceCrossValidation::setFold(size_t foldIdx) {
+  // the prefetching thread must not read from the provider while the fold changes
+  stopPrefetching();
   shuffling->setFold(foldIdx);
 }
 
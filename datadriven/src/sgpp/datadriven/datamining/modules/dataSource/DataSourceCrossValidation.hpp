@@ -48,7 +48,9 @@ class DataSourceCrossValidation : public DataSource {
   Dataset *getValidationData() override;
 
   /**
-   * Sets the next fold idx to be used for cross validation
+   * Sets the next fold idx to be used for cross validation. A running prefetching thread is
+   * stopped, reset() has to be called before reading the validation data and the batches of the
+   * new fold.
    * @param foldIdx index of the fold
    */
   void setFold(size_t foldIdx);
@@ -22,6 +22,7 @@ DataSourceSplitting::DataSourceSplitting(const DataSourceConfig& config,
 Dataset *DataSourceSplitting::getValidationData() { return validationData; }
 
 void DataSourceSplitting::reset() {
+  stopPrefetching();
   sampleProvider->reset();
   // Retrieve new validation data
   delete validationData;
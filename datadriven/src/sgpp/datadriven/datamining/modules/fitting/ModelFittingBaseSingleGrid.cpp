@@ -36,6 +36,8 @@ DataVector& ModelFittingBaseSingleGrid::getSurpluses() {
   return alpha;
 }
 
+bool ModelFittingBaseSingleGrid::isSurplusExpansion() const { return false; }
+
 std::string ModelFittingBaseSingleGrid::storeFitter() {
   std::string output;
   output = output + "Grid: \n" + getGrid().serialize() + "\n";
@@ -85,6 +85,14 @@ class ModelFittingBaseSingleGrid : public ModelFittingBase {
    */
   DataVector& getSurpluses();
 
+  /**
+   * Whether evaluate() computes the plain sparse grid function given by getGrid() and
+   * getSurpluses(), i.e. whether the model is linear in the surpluses. Cached evaluations can
+   * then be updated by evaluating only the changed surpluses.
+   * @return true if the model is the expansion of the surpluses in the basis of the grid.
+   */
+  virtual bool isSurplusExpansion() const;
+
   /*
    * Get the grid and alphas of the current model
    * @return string with grid and alphas
@@ -126,11 +126,57 @@ void ModelFittingClassification::evaluate(DataMatrix& samples, DataVector& resul
   }
 #endif  // USE_SCALAPACK
 
+  if (models.size() == 0) {
+    std::string errorMessage = "Prediction impossible! No models were trained!";
+    throw application_exception(errorMessage.c_str());
+  }
+
+  // evaluate each class model on all samples at once instead of each sample separately
+  auto& learnerConfig = this->config->getLearnerConfig();
+  const size_t numSamples = samples.getNrows();
+  DataVector maxDensities(numSamples, 0.0);
+  DataVector classConditionalDensities(numSamples);
+  results.resize(numSamples);
+
+  // Pre compute the total number of instances
+  size_t numInstances = 0;
+  for (auto& p : classIdx) {
+    size_t idx = p.second;
+    numInstances += classNumberInstances[idx];
+  }
+
+  bool evaluatedModel = false;
+  for (auto& p : classIdx) {
+    double label = p.first;
+    size_t idx = p.second;
+    if (classNumberInstances[idx] == 0) {
+      // The model for this class was not trained -> no prediction possible for this model
+      continue;
+    }
+    models[idx]->evaluate(samples, classConditionalDensities);
+    double prior;
+    if (learnerConfig.usePrior) {
+      // Prior is realtive frequency of instances of this class
+      prior = static_cast<double>(classNumberInstances[idx]) / static_cast<double>(numInstances);
+    } else {
+      // Uniform prior
+      prior = 1.0;
+    }
+
 #pragma omp parallel for
-  for (size_t i = 0; i < samples.getNrows(); i++) {
-    DataVector tmp(samples.getNcols());
-    samples.getRow(i, tmp);
-    results.set(i, evaluate(tmp));
+    for (size_t i = 0; i < numSamples; i++) {
+      double density = prior * classConditionalDensities[i];
+
+      if (!evaluatedModel || density > maxDensities[i]) {
+        maxDensities[i] = density;
+        results[i] = label;
+      }
+    }
+    evaluatedModel = true;
+  }
+
+  if (!evaluatedModel) {
+    results.setAll(0.0);
   }
 }
 
@@ -58,6 +58,8 @@ void ModelFittingDensityEstimationCG::evaluate(DataMatrix& samples, DataVector&
   sgpp::op_factory::createOperationMultipleEval(*grid, samples)->eval(alpha, results);
 }
 
+bool ModelFittingDensityEstimationCG::isSurplusExpansion() const { return true; }
+
 void ModelFittingDensityEstimationCG::fit(Dataset& newDataset) {
   dataset = &newDataset;
   fit(newDataset.getData());
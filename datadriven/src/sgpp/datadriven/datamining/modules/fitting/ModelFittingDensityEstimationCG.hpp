@@ -100,6 +100,12 @@ class ModelFittingDensityEstimationCG : public ModelFittingDensityEstimation {
    */
   void evaluate(DataMatrix& samples, DataVector& results) override;
 
+  /**
+   * The model is evaluated as plain sparse grid function.
+   * @return true
+   */
+  bool isSurplusExpansion() const override;
+
   /**
    * Resets the state of the entire model
    */
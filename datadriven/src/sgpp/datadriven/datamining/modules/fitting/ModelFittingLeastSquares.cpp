@@ -13,6 +13,8 @@
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 
+#include <vector>
+
 // TODO(lettrich): allow different refinement types
 // TODO(lettrich): allow different refinement criteria
 
@@ -48,6 +50,8 @@ void ModelFittingLeastSquares::evaluate(DataMatrix &samples, DataVector &results
   opMultEval->eval(alpha, results);
 }
 
+bool ModelFittingLeastSquares::isSurplusExpansion() const { return true; }
+
 void ModelFittingLeastSquares::fit(Dataset &newDataset) {
   // clear model
   reset();
@@ -59,6 +63,8 @@ void ModelFittingLeastSquares::fit(Dataset &newDataset) {
   grid = std::unique_ptr<Grid>{buildGrid(config->getGridConfig())};
   // build surplus vector
   alpha = DataVector{grid->getSize()};
+  rhs.resize(0);
+  systemMatrix.reset();
 
   assembleSystemAndSolve(config->getSolverFinalConfig(), alpha);
 }
@@ -71,11 +77,25 @@ bool ModelFittingLeastSquares::refine() {
                                                  config->getRefinementConfig().threshold_);
       // refine grid
       auto noPoints = grid->getSize();
-      grid->getGenerator().refine(refinementFunctor);
+      std::vector<size_t> addedPoints;
+      grid->getGenerator().refine(refinementFunctor, &addedPoints);
       if (grid->getSize() > noPoints) {
         // Tell the SLE manager that the grid changed (for interal data structures)
+        if (systemMatrix != nullptr) {
+          systemMatrix->prepareGrid();
+        }
         alpha.resizeZero(grid->getSize());
 
+        // the right hand side only has to be computed for the new grid points
+        if (rhs.getSize() == noPoints) {
+          rhs.resizeZero(grid->getSize());
+          auto opMultEval = std::unique_ptr<base::OperationMultipleEval>{
+              op_factory::createOperationMultipleEval(*grid, dataset->getData())};
+          opMultEval->multTransposeIncremental(dataset->getTargets(), rhs, addedPoints);
+        } else {
+          rhs.resize(0);
+        }
+
         assembleSystemAndSolve(config->getSolverRefineConfig(), alpha);
         refinementsPerformed++;
         return true;
@@ -97,6 +117,8 @@ void ModelFittingLeastSquares::update(Dataset &newDataset) {
     reset();
     // reassign dataset
     dataset = &newDataset;
+    rhs.resize(0);
+    systemMatrix.reset();
     // create sytem matrix
     assembleSystemAndSolve(config->getSolverFinalConfig(), alpha);
   } else {
@@ -114,21 +136,28 @@ DMSystemMatrixBase *ModelFittingLeastSquares::buildSystemMatrix(
 }
 
 void ModelFittingLeastSquares::reset() {
+  // the system matrix refers to the grid
+  systemMatrix.reset();
   grid.reset();
   refinementsPerformed = 0;
+  rhs.resize(0);
 }
 
 void ModelFittingLeastSquares::assembleSystemAndSolve(const SLESolverConfiguration &solverConfig,
-                                                      DataVector &alpha) const {
-  auto systemMatrix = std::unique_ptr<DMSystemMatrixBase>(
-      buildSystemMatrix(*grid, dataset->getData(), config->getRegularizationConfig().lambda_,
-                        config->getMultipleEvalConfig()));
+                                                      DataVector &alpha) {
+  if (systemMatrix == nullptr) {
+    systemMatrix = std::unique_ptr<DMSystemMatrixBase>(
+        buildSystemMatrix(*grid, dataset->getData(), config->getRegularizationConfig().lambda_,
+                          config->getMultipleEvalConfig()));
+  }
 
-  DataVector b{grid->getSize()};
-  systemMatrix->generateb(dataset->getTargets(), b);
+  if (rhs.getSize() != grid->getSize()) {
+    rhs.resize(grid->getSize());
+    systemMatrix->generateb(dataset->getTargets(), rhs);
+  }
 
   reconfigureSolver(*solver, solverConfig);
-  solver->solve(*systemMatrix, alpha, b, true, verboseSolver, DEFAULT_RES_THRESHOLD);
+  solver->solve(*systemMatrix, alpha, rhs, true, verboseSolver, DEFAULT_RES_THRESHOLD);
 }
 }  // namespace datadriven
 }  // namespace sgpp
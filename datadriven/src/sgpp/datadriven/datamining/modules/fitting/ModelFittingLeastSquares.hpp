@@ -15,6 +15,8 @@
 #include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
 #include <sgpp/solver/SLESolver.hpp>
 
+#include <memory>
+
 using sgpp::solver::SLESolver;
 using sgpp::base::DataMatrix;
 using sgpp::base::Grid;
@@ -73,6 +75,12 @@ class ModelFittingLeastSquares : public ModelFittingBaseSingleGrid {
    */
   void evaluate(DataMatrix &samples, DataVector &results) override;
 
+  /**
+   * The model is evaluated as plain sparse grid function.
+   * @return true
+   */
+  bool isSurplusExpansion() const override;
+
   /**
    * Resets the state of the entire model
    */
@@ -84,6 +92,19 @@ class ModelFittingLeastSquares : public ModelFittingBaseSingleGrid {
    */
   size_t refinementsPerformed;
 
+  /**
+   * Right hand side of the system of linear equations (i.e. B^T * targets) for the current
+   * dataset and grid. After refinement, only the entries of the new grid points are computed.
+   * It is empty if it has to be computed from scratch.
+   */
+  DataVector rhs;
+
+  /**
+   * System matrix of the current dataset and grid. It is kept across refinements, such that the
+   * data structures of its OperationMultipleEval are only updated for the new grid points.
+   */
+  std::unique_ptr<DMSystemMatrixBase> systemMatrix;
+
   // TODO(lettrich): grid and train dataset as well as OperationMultipleEvalConfiguration should be
   // const.
   /**
@@ -95,12 +116,13 @@ class ModelFittingLeastSquares : public ModelFittingBaseSingleGrid {
 
   /**
    * based on the current dataset and grid, assemble a system of linear equations and solve for the
-   * hierarchical surplus vector alpha.
+   * hierarchical surplus vector alpha. The right hand side is only computed if it is not up to
+   * date.
    * @param solverConfig: Configuration of the SLESolver (refinement, or final solver).
    * @param alpha: Reference to a data vector where hierarchical surpluses will be stored into. Make
    * sure the vector size is equal to the amount of grid points.
    */
-  void assembleSystemAndSolve(const SLESolverConfiguration &solverConfig, DataVector &alpha) const;
+  void assembleSystemAndSolve(const SLESolverConfiguration &solverConfig, DataVector &alpha);
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
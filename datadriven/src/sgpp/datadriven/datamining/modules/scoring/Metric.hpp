@@ -80,6 +80,37 @@ class Metric {
    */
   virtual double measure(const DataVector &predictedValues,
                          const DataVector &trueValues) const = 0;
+
+  /**
+   * Quantify the difference between predicted values and actual values for each sample
+   * separately. The metric is the mean of these contributions (or their sum if isAdditive()
+   * returns true), scorers use them to estimate the variance of the metric on subsamples. The
+   * default implementation measures each sample on its own.
+   *
+   * @param predictedValues values calculated by the model for testing data
+   * @param trueValues actual values as taken from the dataset.
+   * @param contributions contribution of each sample, is resized to the number of samples
+   */
+  virtual void measurePointwise(const DataVector &predictedValues, const DataVector &trueValues,
+                                DataVector &contributions) const {
+    DataVector predicted(1);
+    DataVector actual(1);
+    contributions.resize(predictedValues.size());
+
+    for (size_t i = 0; i < predictedValues.size(); i++) {
+      predicted[0] = predictedValues[i];
+      actual[0] = (i < trueValues.size()) ? trueValues[i] : 0.0;
+      contributions[i] = measure(predicted, actual);
+    }
+  }
+
+  /**
+   * Whether the metric is the sum of the contributions of the samples instead of their mean,
+   * i.e. whether it grows with the number of samples.
+   *
+   * @return true if the metric is the sum of the pointwise contributions
+   */
+  virtual bool isAdditive() const { return false; }
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
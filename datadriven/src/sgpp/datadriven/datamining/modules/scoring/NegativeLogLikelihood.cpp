@@ -32,6 +32,8 @@ double NegativeLogLikelihood::measure(
   }
   return -ll;
 }
+
+bool NegativeLogLikelihood::isAdditive() const { return true; }
 } /* namespace datadriven */
 } /* namespace sgpp */
 
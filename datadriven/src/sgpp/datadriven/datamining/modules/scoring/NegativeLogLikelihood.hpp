@@ -38,6 +38,12 @@ class NegativeLogLikelihood : public Metric {
    * @return the negative log likelihood of the predicted probabilities
    */
   double measure(const DataVector &predictedValues, const DataVector &trueValues) const override;
+
+  /**
+   * The NLL is the sum of the contributions of the samples.
+   * @return true
+   */
+  bool isAdditive() const override;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -13,15 +13,64 @@
 #include "Scorer.hpp"
 
 #include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/exception/generation_exception.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBaseSingleGrid.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingDensityEstimationOnOffParallel.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <random>
 #include <vector>
 
 namespace sgpp {
 namespace datadriven {
 
-Scorer::Scorer(Metric* metric) : metric{std::unique_ptr<Metric>{metric}} {}
+namespace {
+/**
+ * Quantile of the standard normal distribution (bisection of the distribution function).
+ *
+ * @param p probability in (0, 1)
+ * @return x with P(X <= x) = p for a standard normal random variable X
+ */
+double normalQuantile(double p) {
+  double lower = -10.0;
+  double upper = 10.0;
+
+  for (size_t i = 0; i < 64; i++) {
+    const double mid = 0.5 * (lower + upper);
+
+    if (0.5 * std::erfc(-mid / std::sqrt(2.0)) < p) {
+      lower = mid;
+    } else {
+      upper = mid;
+    }
+  }
+
+  return 0.5 * (lower + upper);
+}
+}  // namespace
+
+Scorer::Scorer(Metric* metric) : Scorer(metric, ScorerConfiguration{}) {}
+
+Scorer::Scorer(Metric* metric, const ScorerConfiguration& config)
+    : metric{std::unique_ptr<Metric>{metric}},
+      config{config},
+      cachedDataset{nullptr},
+      cachedNumInstances{0},
+      subsampled{false},
+      subsampleData{},
+      subsampleTargets{},
+      cachedPredictions{},
+      cachedGrid{nullptr},
+      cachedSurpluses{},
+      lowerBound{0.0},
+      upperBound{0.0} {}
 
 double Scorer::test(ModelFittingBase& model, Dataset& testDataset) {
 #ifdef USE_SCALAPACK
@@ -35,6 +84,198 @@ double Scorer::test(ModelFittingBase& model, Dataset& testDataset) {
   return metric->measure(predictedValues, testDataset.getTargets());
 }
 
+double Scorer::testValidation(ModelFittingBase& model, Dataset& validationDataset) {
+  const size_t numInstances = validationDataset.getNumberInstances();
+  bool scoreAll = !config.cachePredictions &&
+                  ((config.subsampleSize == 0) || (config.subsampleSize >= numInstances));
+#ifdef USE_SCALAPACK
+  // the distributed evaluation has to be done by all processes
+  scoreAll = scoreAll || model.getFitterConfiguration().getParallelConfig().scalapackEnabled_;
+#endif
+  if (scoreAll) {
+    lowerBound = upperBound = test(model, validationDataset);
+    return lowerBound;
+  }
+
+  if ((&validationDataset != cachedDataset) || (numInstances != cachedNumInstances)) {
+    resetValidationCache(validationDataset);
+  }
+
+  DataMatrix& samples = subsampled ? subsampleData : validationDataset.getData();
+  DataVector& targets = subsampled ? subsampleTargets : validationDataset.getTargets();
+  updatePredictions(model, samples);
+
+  double score = metric->measure(cachedPredictions, targets);
+  lowerBound = upperBound = score;
+
+  if (subsampled && (samples.getNrows() > 1)) {
+    // normal approximation of the mean of the pointwise contributions, the finite population
+    // correction accounts for sampling without replacement
+    const double n = static_cast<double>(samples.getNrows());
+    const double total = static_cast<double>(numInstances);
+    DataVector contributions;
+    metric->measurePointwise(cachedPredictions, targets, contributions);
+    const double mean = contributions.sum() / n;
+    double variance = 0.0;
+
+    for (size_t i = 0; i < contributions.size(); i++) {
+      variance += (contributions[i] - mean) * (contributions[i] - mean);
+    }
+
+    variance /= n - 1.0;
+    double halfWidth = normalQuantile(0.5 + 0.5 * config.confidenceLevel) *
+                       std::sqrt(variance / n * (total - n) / (total - 1.0));
+
+    if (metric->isAdditive()) {
+      // extrapolate the sum to the whole validation set
+      score *= total / n;
+      halfWidth *= total;
+    }
+
+    lowerBound = score - halfWidth;
+    upperBound = score + halfWidth;
+  }
+
+  return score;
+}
+
+void Scorer::getConfidenceInterval(double& lower, double& upper) const {
+  lower = lowerBound;
+  upper = upperBound;
+}
+
+void Scorer::resetValidationCache(Dataset& validationDataset) {
+  const size_t numInstances = validationDataset.getNumberInstances();
+  cachedDataset = &validationDataset;
+  cachedNumInstances = numInstances;
+  cachedGrid.reset();
+  subsampled = (config.subsampleSize > 0) && (config.subsampleSize < numInstances);
+
+  if (!subsampled) {
+    subsampleData = DataMatrix{};
+    subsampleTargets = DataVector{};
+    return;
+  }
+
+  std::mt19937 generator(config.randomSeed == -1
+                             ? std::random_device{}()
+                             : static_cast<std::mt19937::result_type>(config.randomSeed));
+
+  // partial Fisher-Yates shuffle, the subsample is sorted to keep the original order
+  std::vector<size_t> indices(numInstances);
+  std::iota(indices.begin(), indices.end(), 0);
+
+  for (size_t i = 0; i < config.subsampleSize; i++) {
+    std::uniform_int_distribution<size_t> distribution(i, numInstances - 1);
+    std::swap(indices[i], indices[distribution(generator)]);
+  }
+
+  std::sort(indices.begin(), indices.begin() + config.subsampleSize);
+
+  DataMatrix& data = validationDataset.getData();
+  DataVector& targets = validationDataset.getTargets();
+  const size_t dim = data.getNcols();
+  subsampleData.resizeRowsCols(config.subsampleSize, dim);
+  subsampleTargets.resize(targets.size() == numInstances ? config.subsampleSize : 0);
+
+  for (size_t i = 0; i < config.subsampleSize; i++) {
+    std::copy(data.getPointer() + indices[i] * dim, data.getPointer() + (indices[i] + 1) * dim,
+              subsampleData.getPointer() + i * dim);
+
+    if (subsampleTargets.size() > 0) {
+      subsampleTargets[i] = targets[indices[i]];
+    }
+  }
+}
+
+void Scorer::updatePredictions(ModelFittingBase& model, DataMatrix& samples) {
+  const size_t numSamples = samples.getNrows();
+  auto singleGridModel =
+      config.cachePredictions ? dynamic_cast<ModelFittingBaseSingleGrid*>(&model) : nullptr;
+
+  if ((singleGridModel == nullptr) || !singleGridModel->isSurplusExpansion()) {
+    // no way to tell whether the model changed
+    cachedGrid.reset();
+    cachedPredictions.resize(numSamples);
+    model.evaluate(samples, cachedPredictions);
+    return;
+  }
+
+  Grid& grid = singleGridModel->getGrid();
+  DataVector& alpha = singleGridModel->getSurpluses();
+  base::HashGridStorage& storage = grid.getStorage();
+
+  // the cached predictions can be updated if the old grid points are unchanged (i.e. the grid
+  // was only refined), then only the changed surpluses have to be evaluated (not possible for
+  // stretched grids and prewavelets, their basis functions cannot be evaluated on their own)
+  const base::GridType gridType = grid.getType();
+  bool updatable = (gridType != base::GridType::LinearStretched) &&
+                   (gridType != base::GridType::LinearStretchedBoundary) &&
+                   (gridType != base::GridType::Prewavelet) && (cachedGrid != nullptr) &&
+                   (cachedGrid->getType() == gridType) &&
+                   (cachedGrid->getDimension() == grid.getDimension()) &&
+                   (cachedGrid->getSize() <= grid.getSize()) && (alpha.size() == grid.getSize()) &&
+                   (cachedPredictions.size() == numSamples);
+  std::vector<size_t> changedPoints;
+
+  if (updatable) {
+    base::HashGridStorage& cachedStorage = cachedGrid->getStorage();
+
+    for (size_t i = 0; i < cachedStorage.getSize(); i++) {
+      if (!cachedStorage.getPoint(i).equals(storage.getPoint(i))) {
+        updatable = false;
+        break;
+      }
+
+      if (alpha[i] != cachedSurpluses[i]) {
+        changedPoints.push_back(i);
+      }
+    }
+
+    for (size_t i = cachedStorage.getSize(); updatable && (i < storage.getSize()); i++) {
+      if (alpha[i] != 0.0) {
+        changedPoints.push_back(i);
+      }
+    }
+  }
+
+  const double maxChangedPoints =
+      config.incrementalUpdateThreshold * static_cast<double>(grid.getSize());
+
+  if (!updatable || (static_cast<double>(changedPoints.size()) > maxChangedPoints)) {
+    cachedPredictions.resize(numSamples);
+    model.evaluate(samples, cachedPredictions);
+  } else if (!changedPoints.empty()) {
+    // add the changes of the surpluses times the values of their basis functions
+    DataVector changedSurpluses(alpha.size(), 0.0);
+
+    for (size_t point : changedPoints) {
+      changedSurpluses[point] =
+          alpha[point] - ((point < cachedSurpluses.size()) ? cachedSurpluses[point] : 0.0);
+    }
+
+    std::unique_ptr<base::OperationMultipleEval> opEval(
+        op_factory::createOperationMultipleEval(grid, samples));
+    opEval->multIncremental(changedSurpluses, cachedPredictions, changedPoints);
+  }
+
+  // remember the state of the model
+  if (updatable) {
+    for (size_t i = cachedGrid->getSize(); i < storage.getSize(); i++) {
+      cachedGrid->getStorage().insert(storage.getPoint(i));
+    }
+  } else {
+    try {
+      cachedGrid.reset(grid.clone());
+    } catch (base::generation_exception&) {
+      // grid type cannot be copied, the model is evaluated completely next time
+      cachedGrid.reset();
+    }
+  }
+
+  cachedSurpluses = alpha;
+}
+
 double Scorer::testDistributed(ModelFittingBase& model, Dataset& testDataset) {
 #ifdef USE_SCALAPACK
   DataVector predictedValues{testDataset.getNumberInstances()};
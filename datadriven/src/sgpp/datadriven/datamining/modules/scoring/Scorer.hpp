@@ -14,6 +14,7 @@
 
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp>
 #include <sgpp/datadriven/datamining/modules/scoring/Metric.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/ScorerConfig.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
 #include <memory>
@@ -38,6 +39,16 @@ class Scorer {
    */
   explicit Scorer(Metric* metric);
 
+  /**
+   * Constructor
+   *
+   * @param metric  #sgpp::datadriven::Metric to to quantify approximation quality of a trained
+   * model. Scorer will take ownership of this object.
+   * @param config configuration of the scorer, defines how validation data is scored by
+   * testValidation()
+   */
+  Scorer(Metric* metric, const ScorerConfiguration& config);
+
   /**
    * Move constructor
    * @param rhs R-value reference to a scorer object to moved from.
@@ -72,6 +83,29 @@ class Scorer {
    */
   double test(ModelFittingBase& model, Dataset& testDataset);
 
+  /**
+   * evaluate the accuracy on a validation set that is scored repeatedly while the model is
+   * trained. Depending on the #sgpp::datadriven::ScorerConfiguration, the predictions are cached
+   * and only updated if the model changed (incrementally for changed surpluses if the model is a
+   * single sparse grid expansion) and the score is estimated on a fixed random subsample. The
+   * validation set must not be modified between calls, the cache is rebuilt if another dataset
+   * is passed.
+   *
+   * @param model model to be fitted based on the train dataset.
+   * @param validationDataset dataset used quantify accuracy using #sgpp::datadriven::Metric.
+   * @return accuracy of the fit (estimated on the subsample if subsampling is enabled).
+   */
+  double testValidation(ModelFittingBase& model, Dataset& validationDataset);
+
+  /**
+   * Get the confidence interval of the last score computed by testValidation(). Without
+   * subsampling, both bounds equal the score.
+   *
+   * @param lower lower bound of the confidence interval
+   * @param upper upper bound of the confidence interval
+   */
+  void getConfidenceInterval(double& lower, double& upper) const;
+
  private:
   /**
    * evaluate the accuracy on the test set using the #sgpp::datadriven::Metric.
@@ -83,10 +117,80 @@ class Scorer {
    */
   double testDistributed(ModelFittingBase& model, Dataset& testDataset);
 
+  /**
+   * Draw the scored samples of a new validation set and invalidate the cached predictions.
+   *
+   * @param validationDataset dataset scored by testValidation()
+   */
+  void resetValidationCache(Dataset& validationDataset);
+
+  /**
+   * Bring the cached predictions on the scored samples up to date with the model.
+   *
+   * @param model model to be evaluated
+   * @param samples scored samples
+   */
+  void updatePredictions(ModelFittingBase& model, DataMatrix& samples);
+
   /**
    * #sgpp::datadriven::Metric to be used to quantify accuracy of the fit.
    */
   std::unique_ptr<Metric> metric;
+
+  /**
+   * configuration of the validation scoring.
+   */
+  ScorerConfiguration config;
+
+  /**
+   * validation dataset the cache belongs to.
+   */
+  Dataset* cachedDataset;
+
+  /**
+   * number of instances of the cached validation dataset.
+   */
+  size_t cachedNumInstances;
+
+  /**
+   * whether only a subsample of the validation dataset is scored.
+   */
+  bool subsampled;
+
+  /**
+   * subsample of the validation samples (empty if all samples are scored).
+   */
+  DataMatrix subsampleData;
+
+  /**
+   * targets of the subsample of the validation samples.
+   */
+  DataVector subsampleTargets;
+
+  /**
+   * cached predictions of the model on the scored samples.
+   */
+  DataVector cachedPredictions;
+
+  /**
+   * copy of the grid the cached predictions were computed with (nullptr if they are invalid).
+   */
+  std::unique_ptr<Grid> cachedGrid;
+
+  /**
+   * surpluses the cached predictions were computed with.
+   */
+  DataVector cachedSurpluses;
+
+  /**
+   * lower bound of the confidence interval of the last score computed by testValidation().
+   */
+  double lowerBound;
+
+  /**
+   * upper bound of the confidence interval of the last score computed by testValidation().
+   */
+  double upperBound;
 };
 
 } /* namespace datadriven */
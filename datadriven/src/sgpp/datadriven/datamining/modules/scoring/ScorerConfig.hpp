@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace sgpp {
@@ -31,6 +33,30 @@ struct ScorerConfiguration {
    * Type of metric that should be used to calculate the accuracy of the fit.
    */
   ScorerMetricType metric = ScorerMetricType::accuracy;
+  /**
+   * Whether the predictions on the validation data are cached between scorings (see
+   * #sgpp::datadriven::Scorer::testValidation). The model is only evaluated again if it changed;
+   * if it is the expansion of a single sparse grid, only changed surpluses are evaluated.
+   */
+  bool cachePredictions = false;
+  /**
+   * Maximal fraction of changed surpluses for which cached predictions are updated
+   * incrementally, if more surpluses changed the model is evaluated completely
+   */
+  double incrementalUpdateThreshold = 0.05;
+  /**
+   * Number of validation samples in the fixed random subsample that is scored - 0 to score all
+   * samples
+   */
+  size_t subsampleSize = 0;
+  /**
+   * Seed for drawing the subsample (-1 for a random seed)
+   */
+  int64_t randomSeed = -1;
+  /**
+   * Confidence level of the confidence interval of subsampled scores
+   */
+  double confidenceLevel = 0.95;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
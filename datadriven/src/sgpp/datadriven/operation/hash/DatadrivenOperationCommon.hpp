@@ -33,11 +33,14 @@ enum class OperationMultipleEvalSubType {
   OCLMASKMP,
   OCLOPT,
   OCLUNIFIED,
-  CUDA
+  CUDA,
+  SIMD
 };
 
 enum class OperationMultipleEvalMPIType { NONE, MASTERSLAVE, HPX };
 
+class OperationMultipleEvalPlan;
+
 class OperationMultipleEvalConfiguration {
  private:
   OperationMultipleEvalType type = OperationMultipleEvalType::DEFAULT;
@@ -46,6 +49,9 @@ class OperationMultipleEvalConfiguration {
 
   std::shared_ptr<base::OperationConfiguration> parameters;
 
+  // optional - evaluation plan shared by all operations created with this configuration
+  std::shared_ptr<OperationMultipleEvalPlan> plan;
+
   // optional - can be set for easier reporting
   std::string name;
 
@@ -92,6 +98,17 @@ class OperationMultipleEvalConfiguration {
   std::shared_ptr<base::OperationConfiguration> getParameters() { return this->parameters; }
 
   std::string& getName() { return this->name; }
+
+  /**
+   * Sets an evaluation plan that is reused by operations created with this configuration (and
+   * its copies) that support it, e.g. to keep the prepared dataset across refinements and
+   * repeated calls of op_factory::createOperationMultipleEval for the same dataset.
+   *
+   * @param plan the evaluation plan (nullptr to let each operation create its own plan)
+   */
+  void setPlan(std::shared_ptr<OperationMultipleEvalPlan> plan) { this->plan = plan; }
+
+  std::shared_ptr<OperationMultipleEvalPlan> getPlan() { return this->plan; }
 };
 }  // namespace datadriven
 }  // namespace sgpp
@@ -0,0 +1,398 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalSIMD/OperationMultiEvalSIMD.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#if defined(__GNUC__)
+// GCC, Clang and ICC support generic vector types and per-function target options
+#define SGPP_SIMD_VECTOR_EXTENSIONS
+#define SGPP_SIMD_INLINE inline __attribute__((always_inline))
+#if defined(__x86_64__) || defined(__i386__)
+#define SGPP_SIMD_X86_DISPATCH
+#endif
+#else
+#define SGPP_SIMD_INLINE inline
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// widest vector (in doubles) of all kernels
+const size_t MAX_VECTOR_WIDTH = 8;
+/// the kernels process two vectors of data points at once
+const size_t UNROLLING = 2;
+/// the number of instances is padded to a multiple of this
+const size_t INSTANCE_PADDING = MAX_VECTOR_WIDTH * UNROLLING;
+/// number of data points per tile (multiple of INSTANCE_PADDING)
+const size_t DATA_TILE = 256;
+/// number of grid points per tile
+const size_t GRID_TILE = 256;
+
+#ifdef SGPP_SIMD_VECTOR_EXTENSIONS
+/**
+ * Vector of W doubles.
+ */
+template <size_t W>
+struct SIMDVector {
+  typedef double type __attribute__((vector_size(W * sizeof(double))));
+};
+
+typedef SIMDVector<2>::type DefaultVector;
+const size_t DEFAULT_VECTOR_WIDTH = 2;
+#else
+typedef double DefaultVector;
+const size_t DEFAULT_VECTOR_WIDTH = 1;
+#endif
+
+template <typename V, size_t W>
+SGPP_SIMD_INLINE bool isZero(const V& v) {
+  const double* lanes = reinterpret_cast<const double*>(&v);
+
+  for (size_t l = 0; l < W; l++) {
+    if (lanes[l] != 0.0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename V, size_t W>
+SGPP_SIMD_INLINE double horizontalSum(const V& v) {
+  const double* lanes = reinterpret_cast<const double*>(&v);
+  double sum = 0.0;
+
+  for (size_t l = 0; l < W; l++) {
+    sum += lanes[l];
+  }
+
+  return sum;
+}
+
+/**
+ * Evaluates the basis function of grid point j at the 2 * W data points starting at k.
+ * The evaluation is aborted as soon as the function vanishes at all data points.
+ */
+template <typename V, size_t W>
+SGPP_SIMD_INLINE void evalBasis(const SIMDKernelArguments& arguments, size_t j, size_t k,
+                                V& phi0, V& phi1) {
+  const V zero = V();
+  const double* coefficients = arguments.coefficients + 4 * arguments.dim * j;
+  const double* data = arguments.data + k;
+
+  phi0 = zero + 1.0;
+  phi1 = zero + 1.0;
+
+  for (size_t d = 0; d < arguments.dim; d++) {
+    V x0;
+    V x1;
+    std::memcpy(&x0, data, sizeof(V));
+    std::memcpy(&x1, data + W, sizeof(V));
+
+    const V left0 = coefficients[0] * x0 + coefficients[1];
+    const V left1 = coefficients[0] * x1 + coefficients[1];
+    const V right0 = coefficients[2] * x0 + coefficients[3];
+    const V right1 = coefficients[2] * x1 + coefficients[3];
+
+    V value0 = 1.0 - (left0 > right0 ? left0 : right0);
+    V value1 = 1.0 - (left1 > right1 ? left1 : right1);
+    value0 = value0 > zero ? value0 : zero;
+    value1 = value1 > zero ? value1 : zero;
+
+    phi0 *= value0;
+    phi1 *= value1;
+
+    // both factors are non-negative
+    if (isZero<V, W>(phi0 + phi1)) {
+      return;
+    }
+
+    coefficients += 4;
+    data += arguments.paddedInstances;
+  }
+}
+
+template <typename V, size_t W>
+SGPP_SIMD_INLINE void multKernel(const SIMDKernelArguments& arguments, const double* alpha,
+                                 double* result, size_t startIndexData, size_t endIndexData) {
+  for (size_t gridStart = 0; gridStart < arguments.gridSize; gridStart += GRID_TILE) {
+    const size_t gridEnd = std::min(gridStart + GRID_TILE, arguments.gridSize);
+
+    for (size_t k = startIndexData; k < endIndexData; k += UNROLLING * W) {
+      V sum0;
+      V sum1;
+      std::memcpy(&sum0, result + k, sizeof(V));
+      std::memcpy(&sum1, result + k + W, sizeof(V));
+
+      for (size_t j = gridStart; j < gridEnd; j++) {
+        V phi0;
+        V phi1;
+        evalBasis<V, W>(arguments, j, k, phi0, phi1);
+        sum0 += alpha[j] * phi0;
+        sum1 += alpha[j] * phi1;
+      }
+
+      std::memcpy(result + k, &sum0, sizeof(V));
+      std::memcpy(result + k + W, &sum1, sizeof(V));
+    }
+  }
+}
+
+template <typename V, size_t W>
+SGPP_SIMD_INLINE void multTransposeKernel(const SIMDKernelArguments& arguments,
+                                          const double* source, double* result,
+                                          size_t startIndexGrid, size_t endIndexGrid) {
+  for (size_t dataStart = 0; dataStart < arguments.paddedInstances; dataStart += DATA_TILE) {
+    const size_t dataEnd = std::min(dataStart + DATA_TILE, arguments.paddedInstances);
+
+    for (size_t j = startIndexGrid; j < endIndexGrid; j++) {
+      V sum0 = V();
+      V sum1 = V();
+
+      for (size_t k = dataStart; k < dataEnd; k += UNROLLING * W) {
+        V phi0;
+        V phi1;
+        evalBasis<V, W>(arguments, j, k, phi0, phi1);
+
+        V source0;
+        V source1;
+        std::memcpy(&source0, source + k, sizeof(V));
+        std::memcpy(&source1, source + k + W, sizeof(V));
+        sum0 += phi0 * source0;
+        sum1 += phi1 * source1;
+      }
+
+      result[j] += horizontalSum<V, W>(sum0 + sum1);
+    }
+  }
+}
+
+void multDefault(const SIMDKernelArguments& arguments, const double* alpha, double* result,
+                 size_t startIndexData, size_t endIndexData) {
+  multKernel<DefaultVector, DEFAULT_VECTOR_WIDTH>(arguments, alpha, result, startIndexData,
+                                                  endIndexData);
+}
+
+void multTransposeDefault(const SIMDKernelArguments& arguments, const double* source,
+                          double* result, size_t startIndexGrid, size_t endIndexGrid) {
+  multTransposeKernel<DefaultVector, DEFAULT_VECTOR_WIDTH>(arguments, source, result,
+                                                           startIndexGrid, endIndexGrid);
+}
+
+#ifdef SGPP_SIMD_X86_DISPATCH
+__attribute__((target("avx2,fma"))) void multAVX2(const SIMDKernelArguments& arguments,
+                                                  const double* alpha, double* result,
+                                                  size_t startIndexData, size_t endIndexData) {
+  multKernel<SIMDVector<4>::type, 4>(arguments, alpha, result, startIndexData, endIndexData);
+}
+
+__attribute__((target("avx2,fma"))) void multTransposeAVX2(const SIMDKernelArguments& arguments,
+                                                           const double* source, double* result,
+                                                           size_t startIndexGrid,
+                                                           size_t endIndexGrid) {
+  multTransposeKernel<SIMDVector<4>::type, 4>(arguments, source, result, startIndexGrid,
+                                              endIndexGrid);
+}
+
+__attribute__((target("avx512f"))) void multAVX512(const SIMDKernelArguments& arguments,
+                                                   const double* alpha, double* result,
+                                                   size_t startIndexData, size_t endIndexData) {
+  multKernel<SIMDVector<8>::type, 8>(arguments, alpha, result, startIndexData, endIndexData);
+}
+
+__attribute__((target("avx512f"))) void multTransposeAVX512(
+    const SIMDKernelArguments& arguments, const double* source, double* result,
+    size_t startIndexGrid, size_t endIndexGrid) {
+  multTransposeKernel<SIMDVector<8>::type, 8>(arguments, source, result, startIndexGrid,
+                                              endIndexGrid);
+}
+#endif
+
+}  // namespace
+
+OperationMultiEvalSIMD::OperationMultiEvalSIMD(base::Grid& grid, base::DataMatrix& dataset)
+    : OperationMultipleEval(grid, dataset),
+      preparedDataset(),
+      coefficients(),
+      gridSize(0),
+      multKernel(&multDefault),
+      multTransposeKernel(&multTransposeDefault),
+      instructionSet("generic"),
+      vectorWidth(DEFAULT_VECTOR_WIDTH),
+      myTimer(),
+      duration(-1.0) {
+  const base::GridType type = grid.getType();
+
+  if ((type != base::GridType::Linear) && (type != base::GridType::LinearL0Boundary) &&
+      (type != base::GridType::LinearBoundary) &&
+      (type != base::GridType::LinearTruncatedBoundary) && (type != base::GridType::ModLinear)) {
+    throw base::operation_exception(
+        "OperationMultiEvalSIMD: only linear, linear boundary and modified linear grids are "
+        "supported");
+  }
+
+#ifdef SGPP_SIMD_X86_DISPATCH
+  // select the widest instruction set supported by the CPU (and the operating system)
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx512f")) {
+    multKernel = &multAVX512;
+    multTransposeKernel = &multTransposeAVX512;
+    instructionSet = "AVX-512";
+    vectorWidth = 8;
+  } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    multKernel = &multAVX2;
+    multTransposeKernel = &multTransposeAVX2;
+    instructionSet = "AVX2";
+    vectorWidth = 4;
+  } else {
+    instructionSet = "SSE2";
+  }
+#endif
+
+  // transpose the dataset and pad it with zeros
+  const size_t numberInstances = dataset.getNrows();
+  const size_t dim = dataset.getNcols();
+  const size_t paddedInstances =
+      (numberInstances + INSTANCE_PADDING - 1) / INSTANCE_PADDING * INSTANCE_PADDING;
+  preparedDataset = base::DataMatrix(dim, paddedInstances, 0.0);
+
+  for (size_t k = 0; k < numberInstances; k++) {
+    for (size_t d = 0; d < dim; d++) {
+      preparedDataset.set(d, k, dataset.get(k, d));
+    }
+  }
+
+  this->prepare();
+}
+
+OperationMultiEvalSIMD::~OperationMultiEvalSIMD() {}
+
+void OperationMultiEvalSIMD::prepare() {
+  base::GridStorage& storage = grid.getStorage();
+  const base::GridType type = grid.getType();
+  const size_t dim = storage.getDimension();
+  gridSize = storage.getSize();
+  coefficients.resize(4 * dim * gridSize);
+
+  for (size_t j = 0; j < gridSize; j++) {
+    base::GridPoint& point = storage.getPoint(j);
+
+    for (size_t d = 0; d < dim; d++) {
+      const base::level_t l = point.getLevel(d);
+      const base::index_t i = point.getIndex(d);
+      const double hInv = static_cast<double>(static_cast<base::index_t>(1) << l);
+      const double index = static_cast<double>(i);
+      double* c = &coefficients[4 * (j * dim + d)];
+
+      if ((type == base::GridType::ModLinear) && (l == 1)) {
+        // constant function
+        c[0] = c[1] = c[2] = c[3] = 0.0;
+      } else if ((type == base::GridType::ModLinear) && (i == 1)) {
+        // left modified basis function 2 - hInv * x
+        c[0] = c[2] = hInv;
+        c[1] = c[3] = -1.0;
+      } else if ((type == base::GridType::ModLinear) &&
+                 (i == (static_cast<base::index_t>(1) << l) - 1)) {
+        // right modified basis function hInv * x - i + 1
+        c[0] = c[2] = -hInv;
+        c[1] = c[3] = index;
+      } else if ((l == 0) && (i == 0)) {
+        // left boundary function 1 - x
+        c[0] = c[2] = 1.0;
+        c[1] = c[3] = 0.0;
+      } else if (l == 0) {
+        // right boundary function x
+        c[0] = c[2] = -1.0;
+        c[1] = c[3] = 1.0;
+      } else {
+        // hat function 1 - |hInv * x - i|
+        c[0] = -hInv;
+        c[1] = index;
+        c[2] = hInv;
+        c[3] = -index;
+      }
+    }
+  }
+}
+
+SIMDKernelArguments OperationMultiEvalSIMD::getKernelArguments() const {
+  SIMDKernelArguments arguments;
+  arguments.data = preparedDataset.data();
+  arguments.paddedInstances = preparedDataset.getNcols();
+  arguments.coefficients = coefficients.data();
+  arguments.gridSize = gridSize;
+  arguments.dim = preparedDataset.getNrows();
+  return arguments;
+}
+
+void OperationMultiEvalSIMD::mult(base::DataVector& alpha, base::DataVector& result) {
+  myTimer.start();
+  const SIMDKernelArguments arguments = getKernelArguments();
+
+  if (alpha.getSize() != arguments.gridSize) {
+    throw base::operation_exception(
+        "OperationMultiEvalSIMD::mult: size of alpha does not match the grid (call prepare() "
+        "after changing the grid)");
+  }
+
+  base::DataVector paddedResult(arguments.paddedInstances, 0.0);
+  const size_t tiles = (arguments.paddedInstances + DATA_TILE - 1) / DATA_TILE;
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t tile = 0; tile < tiles; tile++) {
+    multKernel(arguments, alpha.data(), paddedResult.data(), tile * DATA_TILE,
+               std::min((tile + 1) * DATA_TILE, arguments.paddedInstances));
+  }
+
+  result.resize(dataset.getNrows());
+  std::copy(paddedResult.begin(), paddedResult.begin() + dataset.getNrows(), result.begin());
+  duration = myTimer.stop();
+}
+
+void OperationMultiEvalSIMD::multTranspose(base::DataVector& source, base::DataVector& result) {
+  myTimer.start();
+  const SIMDKernelArguments arguments = getKernelArguments();
+
+  if (source.getSize() != dataset.getNrows()) {
+    throw base::operation_exception(
+        "OperationMultiEvalSIMD::multTranspose: size of source does not match the dataset");
+  }
+
+  base::DataVector paddedSource(arguments.paddedInstances, 0.0);
+  std::copy(source.begin(), source.end(), paddedSource.begin());
+
+  result.resize(arguments.gridSize);
+  result.setAll(0.0);
+  const size_t tiles = (arguments.gridSize + GRID_TILE - 1) / GRID_TILE;
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t tile = 0; tile < tiles; tile++) {
+    multTransposeKernel(arguments, paddedSource.data(), result.data(), tile * GRID_TILE,
+                        std::min((tile + 1) * GRID_TILE, arguments.gridSize));
+  }
+
+  duration = myTimer.stop();
+}
+
+double OperationMultiEvalSIMD::getDuration() { return duration; }
+
+std::string OperationMultiEvalSIMD::getImplementationName() { return "SIMD"; }
+
+const std::string& OperationMultiEvalSIMD::getInstructionSet() const { return instructionSet; }
+
+size_t OperationMultiEvalSIMD::getVectorWidth() const { return vectorWidth; }
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,125 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Arguments of the SIMD evaluation kernels.
+ */
+struct SIMDKernelArguments {
+  /// transposed dataset, the coordinates of dimension d start at d * paddedInstances
+  const double* data;
+  /// number of instances including the padding
+  size_t paddedInstances;
+  /// four coefficients (cL, dL, cR, dR) per grid point and dimension
+  const double* coefficients;
+  /// number of grid points
+  size_t gridSize;
+  /// dimension
+  size_t dim;
+};
+
+/**
+ * Multiple evaluation of linear, modified linear and linear boundary grids with explicit SIMD
+ * kernels (OperationMultipleEvalSubType::SIMD).
+ *
+ * All supported one-dimensional basis functions are written as
+ * \f$\varphi(x) = \max(0, 1 - \max(c_L x + d_L, c_R x + d_R))\f$,
+ * e.g. \f$c_L = -2^l, d_L = i, c_R = 2^l, d_R = -i\f$ for the hat function and
+ * \f$c_L = c_R = d_L = d_R = 0\f$ for the constant function of the modified linear basis.
+ * Hence one branch-free kernel evaluates all grid types, processing as many data points at once
+ * as fit into a vector register. The kernel is compiled for SSE2, AVX2 and AVX-512 and the widest
+ * instruction set supported by the CPU is selected at runtime, i.e. the same binary runs with the
+ * best available kernel on every machine. On other architectures or compilers without vector
+ * extensions, a generic kernel is used.
+ *
+ * The data points and the grid points are processed in tiles that fit into the caches, and the
+ * evaluation of a grid point is aborted as soon as the basis function vanishes for all data
+ * points of a vector.
+ */
+class OperationMultiEvalSIMD : public base::OperationMultipleEval {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param grid    grid of type Linear, LinearL0Boundary, LinearBoundary,
+   *                LinearTruncatedBoundary or ModLinear
+   * @param dataset data points (one per row)
+   */
+  OperationMultiEvalSIMD(base::Grid& grid, base::DataMatrix& dataset);
+
+  ~OperationMultiEvalSIMD() override;
+
+  void mult(base::DataVector& alpha, base::DataVector& result) override;
+
+  void multTranspose(base::DataVector& source, base::DataVector& result) override;
+
+  /**
+   * Updates the coefficients of the basis functions after the grid has changed.
+   */
+  void prepare() override;
+
+  double getDuration() override;
+
+  std::string getImplementationName() override;
+
+  /**
+   * @return name of the instruction set of the selected kernel ("AVX-512", "AVX2", "SSE2" or
+   * "generic")
+   */
+  const std::string& getInstructionSet() const;
+
+  /**
+   * @return number of data points processed by one vector instruction of the selected kernel
+   */
+  size_t getVectorWidth() const;
+
+ private:
+  typedef void (*MultKernel)(const SIMDKernelArguments& arguments, const double* alpha,
+                             double* result, size_t startIndexData, size_t endIndexData);
+  typedef void (*MultTransposeKernel)(const SIMDKernelArguments& arguments,
+                                      const double* source, double* result,
+                                      size_t startIndexGrid, size_t endIndexGrid);
+
+  /// transposed and padded dataset
+  base::DataMatrix preparedDataset;
+  /// coefficients of the basis functions
+  base::DataVector coefficients;
+  /// number of grid points at the last call of prepare()
+  size_t gridSize;
+  /// selected kernel for mult
+  MultKernel multKernel;
+  /// selected kernel for multTranspose
+  MultTransposeKernel multTransposeKernel;
+  /// name of the selected instruction set
+  std::string instructionSet;
+  /// number of data points per vector of the selected kernel
+  size_t vectorWidth;
+  /// Timer object to handle time measurements
+  base::SGppStopwatch myTimer;
+  /// duration of the last operation
+  double duration;
+
+  /**
+   * @return kernel arguments for the current dataset and coefficients
+   */
+  SIMDKernelArguments getKernelArguments() const;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
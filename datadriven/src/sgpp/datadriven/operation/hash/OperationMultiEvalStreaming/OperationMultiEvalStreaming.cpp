@@ -10,25 +10,25 @@
 namespace sgpp {
 namespace datadriven {
 
-OperationMultiEvalStreaming::OperationMultiEvalStreaming(base::Grid& grid,
-                                                         base::DataMatrix& dataset)
+OperationMultiEvalStreaming::OperationMultiEvalStreaming(
+    base::Grid& grid, base::DataMatrix& dataset, std::shared_ptr<OperationMultipleEvalPlan> plan)
     : OperationMultipleEval(grid, dataset),
-      preparedDataset(dataset),
+      plan(plan),
+      privatePlan(false),
       myTimer_(sgpp::base::SGppStopwatch()),
       duration(-1.0) {
   this->storage = &grid.getStorage();
-  this->padDataset(this->preparedDataset);
-  this->preparedDataset.transpose();
 
-  // create the kernel specific data structures for the current grid
+  if ((this->plan == nullptr) || !this->plan->isCompatible(*this->storage, dataset)) {
+    this->plan = std::make_shared<OperationMultipleEvalPlan>();
+    privatePlan = true;
+  }
+
+  // create the kernel specific data structures for the current grid and dataset
   this->prepare();
 }
 
-OperationMultiEvalStreaming::~OperationMultiEvalStreaming() {
-  if (this->level_ != nullptr) delete this->level_;
-
-  if (this->index_ != nullptr) delete this->index_;
-}
+OperationMultiEvalStreaming::~OperationMultiEvalStreaming() {}
 
 void OperationMultiEvalStreaming::getPartitionSegment(size_t start, size_t end, size_t segmentCount,
                                                       size_t segmentNumber, size_t* segmentStart,
@@ -91,7 +91,7 @@ void OperationMultiEvalStreaming::mult(sgpp::base::DataVector& alpha,
 
   size_t originalSize = result.getSize();
 
-  result.resize(this->preparedDataset.getNcols());
+  result.resize(this->preparedDataset->getNcols());
 
   result.setAll(0.0);
 
@@ -99,14 +99,15 @@ void OperationMultiEvalStreaming::mult(sgpp::base::DataVector& alpha,
   {
     size_t start;
     size_t end;
-    getOpenMPPartitionSegment(0, this->preparedDataset.getNcols(), &start, &end,
+    getOpenMPPartitionSegment(0, this->preparedDataset->getNcols(), &start, &end,
                               getChunkDataPoints());
 
-    this->multImpl(level_, index_, &this->preparedDataset, alpha, result, 0, alpha.getSize(), start,
+    this->multImpl(level_, index_, this->preparedDataset, alpha, result, 0, alpha.getSize(), start,
                    end);
   }
   result.resize(originalSize);
   this->duration = this->myTimer_.stop();
+  this->plan->addComputeDuration(this->duration);
 }
 
 void OperationMultiEvalStreaming::multTranspose(sgpp::base::DataVector& source,
@@ -115,10 +116,10 @@ void OperationMultiEvalStreaming::multTranspose(sgpp::base::DataVector& source,
 
   size_t originalSize = source.getSize();
 
-  source.resize(this->preparedDataset.getNcols());
+  source.resize(this->preparedDataset->getNcols());
 
   // set padding area to zero
-  for (size_t i = originalSize; i < this->preparedDataset.getNcols(); i++) {
+  for (size_t i = originalSize; i < this->preparedDataset->getNcols(); i++) {
     source[i] = 0.0;
   }
 
@@ -131,49 +132,31 @@ void OperationMultiEvalStreaming::multTranspose(sgpp::base::DataVector& source,
 
     getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
 
-    this->multTransposeImpl(this->level_, this->index_, &this->preparedDataset, source, result,
-                            start, end, 0, this->preparedDataset.getNcols());
+    this->multTransposeImpl(this->level_, this->index_, this->preparedDataset, source, result,
+                            start, end, 0, this->preparedDataset->getNcols());
   }
   source.resize(originalSize);
   this->duration = this->myTimer_.stop();
+  this->plan->addComputeDuration(this->duration);
 }
 
-void OperationMultiEvalStreaming::recalculateLevelAndIndex() {
-  if (this->level_ != nullptr) delete this->level_;
-
-  if (this->index_ != nullptr) delete this->index_;
-
-  this->level_ = new sgpp::base::DataMatrix(this->storage->getSize(),
-                                            this->storage->getDimension());
-  this->index_ = new sgpp::base::DataMatrix(this->storage->getSize(),
-                                            this->storage->getDimension());
+double OperationMultiEvalStreaming::getDuration() { return this->duration; }
 
-  this->storage->getLevelIndexArraysForEval(*(this->level_), *(this->index_));
+std::shared_ptr<OperationMultipleEvalPlan> OperationMultiEvalStreaming::getPlan() {
+  return this->plan;
 }
 
-size_t OperationMultiEvalStreaming::padDataset(sgpp::base::DataMatrix& dataset) {
-  size_t vecWidth = this->getChunkDataPoints();
-
-  // Assure that data has a even number of instances -> padding might be needed
-  size_t remainder = dataset.getNrows() % vecWidth;
-  size_t loopCount = vecWidth - remainder;
-
-  if (loopCount != vecWidth) {
-    sgpp::base::DataVector lastRow(dataset.getNcols());
-    size_t oldSize = dataset.getNrows();
-    dataset.getRow(dataset.getNrows() - 1, lastRow);
-    dataset.resize(dataset.getNrows() + loopCount);
-
-    for (size_t i = 0; i < loopCount; i++) {
-      dataset.setRow(oldSize + i, lastRow);
-    }
+void OperationMultiEvalStreaming::prepare() {
+  if (privatePlan) {
+    this->plan->invalidate();
   }
 
-  return dataset.getNrows();
+  // pads the dataset and transposes it (only if the plan doesn't contain it yet)
+  this->preparedDataset = &this->plan->prepareDataset(this->dataset, this->getChunkDataPoints());
+  // only the levels and indices of new grid points are computed after refinement
+  this->plan->prepareGrid(*this->storage);
+  this->level_ = &this->plan->getLevel();
+  this->index_ = &this->plan->getIndex();
 }
-
-double OperationMultiEvalStreaming::getDuration() { return this->duration; }
-
-void OperationMultiEvalStreaming::prepare() { this->recalculateLevelAndIndex(); }
 }  // namespace datadriven
 }  // namespace sgpp
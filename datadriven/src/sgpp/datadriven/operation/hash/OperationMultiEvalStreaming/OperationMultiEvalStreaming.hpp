@@ -10,8 +10,11 @@
 #include "sgpp/base/exception/operation_exception.hpp"
 #include "sgpp/base/operation/hash/OperationMultipleEval.hpp"
 #include "sgpp/base/tools/SGppStopwatch.hpp"
+#include "sgpp/datadriven/operation/hash/OperationMultipleEvalPlan.hpp"
 #include "sgpp/globaldef.hpp"
 
+#include <memory>
+
 #ifndef STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH
 // #define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 24
 #define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 96
@@ -22,10 +25,15 @@ namespace datadriven {
 
 class OperationMultiEvalStreaming : public base::OperationMultipleEval {
  protected:
-  sgpp::base::DataMatrix preparedDataset;
-  /// Member to store the sparse grid's levels for better vectorization
+  /// Evaluation plan that holds the prepared dataset and the levels and indices
+  std::shared_ptr<OperationMultipleEvalPlan> plan;
+  /// Whether the plan was created by the operation (it is rebuilt in every prepare())
+  bool privatePlan;
+  /// Padded and transposed dataset (stored in the plan)
+  sgpp::base::DataMatrix* preparedDataset = nullptr;
+  /// Member to store the sparse grid's levels for better vectorization (stored in the plan)
   sgpp::base::DataMatrix* level_ = nullptr;
-  /// Member to store the sparse grid's indices for better vectorization
+  /// Member to store the sparse grid's indices for better vectorization (stored in the plan)
   sgpp::base::DataMatrix* index_ = nullptr;
   /// Timer object to handle time measurements
   sgpp::base::SGppStopwatch myTimer_;
@@ -35,7 +43,16 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
   double duration;
 
  public:
-  OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset);
+  /**
+   * Constructor.
+   *
+   * @param grid the sparse grid
+   * @param dataset the data points (one per row)
+   * @param plan evaluation plan that is reused if it is unused or was prepared for the grid and
+   *        the dataset, otherwise (or if it is a nullptr) the operation creates its own plan
+   */
+  OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset,
+                              std::shared_ptr<OperationMultipleEvalPlan> plan = nullptr);
 
   ~OperationMultiEvalStreaming();
 
@@ -51,12 +68,15 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   double getDuration() override;
 
+  /**
+   * @return evaluation plan of the operation (e.g. for time measurements)
+   */
+  std::shared_ptr<OperationMultipleEvalPlan> getPlan();
+
  private:
   void getPartitionSegment(size_t start, size_t end, size_t segmentCount, size_t segmentNumber,
                            size_t* segmentStart, size_t* segmentEnd, size_t blockSize);
 
-  size_t padDataset(sgpp::base::DataMatrix& dataset);
-
   void getOpenMPPartitionSegment(size_t start, size_t end, size_t* segmentStart, size_t* segmentEnd,
                                  size_t blocksize);
 
@@ -71,8 +91,6 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
                          sgpp::base::DataVector& result, const size_t start_index_grid,
                          const size_t end_index_grid, const size_t start_index_data,
                          const size_t end_index_data);
-
-  void recalculateLevelAndIndex();
 };
 
 }  // namespace datadriven
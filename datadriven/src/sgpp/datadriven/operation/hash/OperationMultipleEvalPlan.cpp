@@ -0,0 +1,189 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalPlan.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <ostream>
+
+namespace sgpp {
+namespace datadriven {
+
+OperationMultipleEvalPlan::OperationMultipleEvalPlan()
+    : preparedDataset(0, 0),
+      level(0, 0),
+      index(0, 0),
+      dataset(nullptr),
+      numDataPoints(0),
+      dataDimension(0),
+      blockSize(0),
+      storage(nullptr),
+      gridVersion(0),
+      gridLayoutVersion(0),
+      numGridPoints(0),
+      prepareDuration(0.0),
+      computeDuration(0.0),
+      numDatasetPreparations(0),
+      numGridPreparations(0),
+      numIncrementalGridPreparations(0),
+      numComputations(0) {}
+
+base::DataMatrix& OperationMultipleEvalPlan::prepareDataset(base::DataMatrix& dataset,
+                                                            size_t blockSize) {
+  if ((this->dataset != nullptr) && (this->dataset != &dataset)) {
+    throw base::operation_exception(
+        "OperationMultipleEvalPlan::prepareDataset: The plan was prepared for another dataset.");
+  }
+
+  if ((this->dataset == &dataset) && (numDataPoints == dataset.getNrows()) &&
+      (dataDimension == dataset.getNcols()) && (this->blockSize == blockSize)) {
+    return preparedDataset;
+  }
+
+  timer.start();
+  preparedDataset = dataset;
+
+  // Assure that data has a even number of instances -> padding might be needed
+  size_t remainder = preparedDataset.getNrows() % blockSize;
+
+  if (remainder != 0) {
+    base::DataVector lastRow(preparedDataset.getNcols());
+    size_t oldSize = preparedDataset.getNrows();
+    preparedDataset.getRow(oldSize - 1, lastRow);
+    preparedDataset.resizeRows(oldSize + blockSize - remainder);
+
+    for (size_t i = oldSize; i < preparedDataset.getNrows(); i++) {
+      preparedDataset.setRow(i, lastRow);
+    }
+  }
+
+  preparedDataset.transpose();
+
+  this->dataset = &dataset;
+  numDataPoints = dataset.getNrows();
+  dataDimension = dataset.getNcols();
+  this->blockSize = blockSize;
+  numDatasetPreparations++;
+  prepareDuration += timer.stop();
+  return preparedDataset;
+}
+
+void OperationMultipleEvalPlan::prepareGrid(base::GridStorage& storage) {
+  if ((this->storage != nullptr) && (this->storage != &storage)) {
+    throw base::operation_exception(
+        "OperationMultipleEvalPlan::prepareGrid: The plan was prepared for another grid.");
+  }
+
+  const size_t gridSize = storage.getSize();
+  const size_t dim = storage.getDimension();
+
+  if ((this->storage == &storage) && (gridVersion == storage.getVersion())) {
+    return;
+  }
+
+  timer.start();
+
+  if ((this->storage == &storage) && (gridLayoutVersion == storage.getLayoutVersion()) &&
+      (level.getNcols() == dim) && (numGridPoints <= gridSize)) {
+    // grid points were only appended (e.g. by refinement), only their levels and indices are
+    // missing
+    level.resizeRows(gridSize);
+    index.resizeRows(gridSize);
+    fillLevelIndex(storage, numGridPoints, gridSize);
+    numIncrementalGridPreparations++;
+  } else {
+    level.resizeRowsCols(gridSize, dim);
+    index.resizeRowsCols(gridSize, dim);
+    fillLevelIndex(storage, 0, gridSize);
+    numGridPreparations++;
+  }
+
+  this->storage = &storage;
+  gridVersion = storage.getVersion();
+  gridLayoutVersion = storage.getLayoutVersion();
+  numGridPoints = gridSize;
+  prepareDuration += timer.stop();
+}
+
+bool OperationMultipleEvalPlan::isCompatible(const base::GridStorage& storage,
+                                             const base::DataMatrix& dataset) const {
+  return ((this->storage == nullptr) || (this->storage == &storage)) &&
+         ((this->dataset == nullptr) || (this->dataset == &dataset));
+}
+
+void OperationMultipleEvalPlan::invalidate() {
+  preparedDataset.resizeRowsCols(0, 0);
+  level.resizeRowsCols(0, 0);
+  index.resizeRowsCols(0, 0);
+  numDataPoints = 0;
+  dataDimension = 0;
+  blockSize = 0;
+  gridVersion = 0;
+  gridLayoutVersion = 0;
+  numGridPoints = 0;
+}
+
+base::DataMatrix& OperationMultipleEvalPlan::getLevel() { return level; }
+
+base::DataMatrix& OperationMultipleEvalPlan::getIndex() { return index; }
+
+void OperationMultipleEvalPlan::addComputeDuration(double duration) {
+  computeDuration += duration;
+  numComputations++;
+}
+
+double OperationMultipleEvalPlan::getPrepareDuration() const { return prepareDuration; }
+
+double OperationMultipleEvalPlan::getComputeDuration() const { return computeDuration; }
+
+size_t OperationMultipleEvalPlan::getNumDatasetPreparations() const {
+  return numDatasetPreparations;
+}
+
+size_t OperationMultipleEvalPlan::getNumGridPreparations() const { return numGridPreparations; }
+
+size_t OperationMultipleEvalPlan::getNumIncrementalGridPreparations() const {
+  return numIncrementalGridPreparations;
+}
+
+size_t OperationMultipleEvalPlan::getNumComputations() const { return numComputations; }
+
+void OperationMultipleEvalPlan::resetStatistics() {
+  prepareDuration = 0.0;
+  computeDuration = 0.0;
+  numDatasetPreparations = 0;
+  numGridPreparations = 0;
+  numIncrementalGridPreparations = 0;
+  numComputations = 0;
+}
+
+void OperationMultipleEvalPlan::printStatistics(std::ostream& stream) const {
+  stream << "prepare time: " << prepareDuration << "s (dataset: " << numDatasetPreparations
+         << ", grid: " << numGridPreparations
+         << ", incremental grid: " << numIncrementalGridPreparations << ")" << std::endl;
+  stream << "compute time: " << computeDuration << "s (evaluations: " << numComputations << ")"
+         << std::endl;
+}
+
+void OperationMultipleEvalPlan::fillLevelIndex(base::GridStorage& gridStorage, size_t begin,
+                                               size_t end) {
+  const size_t dim = gridStorage.getDimension();
+
+  for (size_t i = begin; i < end; i++) {
+    base::GridPoint& point = gridStorage.getPoint(i);
+
+    for (size_t d = 0; d < dim; d++) {
+      level.set(i, d, static_cast<double>(1 << point.getLevel(d)));
+      index.set(i, d, static_cast<double>(point.getIndex(d)));
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,184 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <ostream>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Evaluation plan of an OperationMultipleEval for a pair of grid and dataset, i.e. the data
+ * structures that are built in prepare(): the padded and transposed dataset and the level and
+ * index arrays of the grid points (see base::GridStorage::getLevelIndexArraysForEval).
+ *
+ * A plan can be shared (see OperationMultipleEvalConfiguration::setPlan) to keep these data
+ * structures across solver iterations, refinements and repeated calls of
+ * op_factory::createOperationMultipleEval. A plan is bound to the grid and the dataset it was
+ * prepared for first, as all operations sharing it use the same arrays; operations for other grids
+ * or datasets create their own plans.
+ *
+ * Changes of the grid are detected with the versions of the grid storage
+ * (see base::GridStorage::getVersion): after refinement, only the level and index arrays of the
+ * new grid points are computed (refinement appends grid points to the storage), after other
+ * changes (e.g. coarsening) the arrays are rebuilt. Changes of the values of the dataset or of
+ * grid points through references are not detected, in this case invalidate() has to be called.
+ * Operations that create their own plan rebuild it in every prepare().
+ *
+ * Additionally, the plan measures the time spent preparing the data structures and the time
+ * spent in the evaluations of the operations using it.
+ */
+class OperationMultipleEvalPlan {
+ public:
+  OperationMultipleEvalPlan();
+
+  /**
+   * Returns the transposed dataset (one data point per column), the number of data points is
+   * padded to a multiple of the block size by repeating the last data point. It is only rebuilt
+   * if the size of the dataset or the block size changed or after invalidate().
+   * Throws an operation_exception if the plan was prepared for another dataset.
+   *
+   * @param dataset dataset (one data point per row)
+   * @param blockSize number of data points processed together by the kernel
+   * @return padded and transposed dataset
+   */
+  base::DataMatrix& prepareDataset(base::DataMatrix& dataset, size_t blockSize);
+
+  /**
+   * Updates the level and index arrays to the current grid (only if the grid changed).
+   * Throws an operation_exception if the plan was prepared for another grid.
+   *
+   * @param storage storage of the grid
+   */
+  void prepareGrid(base::GridStorage& storage);
+
+  /**
+   * @param storage storage of the grid
+   * @param dataset dataset (one data point per row)
+   * @return whether the plan is unused or was prepared for the given grid and dataset
+   */
+  bool isCompatible(const base::GridStorage& storage, const base::DataMatrix& dataset) const;
+
+  /**
+   * Discards all data structures, they are rebuilt when the operations using the plan are
+   * prepared again (see base::OperationMultipleEval::prepare). The plan stays bound to its grid
+   * and dataset.
+   */
+  void invalidate();
+
+  /**
+   * @return levels of the grid points (one grid point per row, stored as 2^level)
+   */
+  base::DataMatrix& getLevel();
+
+  /**
+   * @return indices of the grid points (one grid point per row)
+   */
+  base::DataMatrix& getIndex();
+
+  /**
+   * Adds the duration of an evaluation (mult or multTranspose) using the plan.
+   *
+   * @param duration duration in seconds
+   */
+  void addComputeDuration(double duration);
+
+  /**
+   * @return accumulated time in seconds spent preparing the dataset and the grid
+   */
+  double getPrepareDuration() const;
+
+  /**
+   * @return accumulated time in seconds of the evaluations
+   */
+  double getComputeDuration() const;
+
+  /**
+   * @return number of times the dataset was prepared
+   */
+  size_t getNumDatasetPreparations() const;
+
+  /**
+   * @return number of times the level and index arrays were built completely
+   */
+  size_t getNumGridPreparations() const;
+
+  /**
+   * @return number of times the level and index arrays were updated for new grid points only
+   */
+  size_t getNumIncrementalGridPreparations() const;
+
+  /**
+   * @return number of evaluations
+   */
+  size_t getNumComputations() const;
+
+  /**
+   * Resets the time measurements and counters.
+   */
+  void resetStatistics();
+
+  /**
+   * Prints the time measurements and counters.
+   *
+   * @param stream output stream
+   */
+  void printStatistics(std::ostream& stream) const;
+
+ protected:
+  /// transposed and padded dataset
+  base::DataMatrix preparedDataset;
+  /// levels of the grid points
+  base::DataMatrix level;
+  /// indices of the grid points
+  base::DataMatrix index;
+
+  /// dataset the plan was prepared for (only used for identification)
+  const base::DataMatrix* dataset;
+  /// number of data points of the dataset
+  size_t numDataPoints;
+  /// dimension of the dataset
+  size_t dataDimension;
+  /// block size the dataset was padded to
+  size_t blockSize;
+
+  /// grid storage the plan was prepared for (only used for identification)
+  const base::GridStorage* storage;
+  /// version of the grid storage the level and index arrays belong to
+  uint64_t gridVersion;
+  /// layout version of the grid storage the level and index arrays belong to
+  uint64_t gridLayoutVersion;
+  /// number of grid points in the level and index arrays
+  size_t numGridPoints;
+
+  /// timer of the preparations
+  base::SGppStopwatch timer;
+  double prepareDuration;
+  double computeDuration;
+  size_t numDatasetPreparations;
+  size_t numGridPreparations;
+  size_t numIncrementalGridPreparations;
+  size_t numComputations;
+
+  /**
+   * Stores the levels and indices of the given grid points.
+   *
+   * @param gridStorage storage of the grid
+   * @param begin sequence number of the first grid point
+   * @param end sequence number after the last grid point
+   */
+  void fillLevelIndex(base::GridStorage& gridStorage, size_t begin, size_t end);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
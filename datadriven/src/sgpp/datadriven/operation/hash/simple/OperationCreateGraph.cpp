@@ -0,0 +1,198 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/OperationCreateGraph.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+/// number of query points which are processed together
+const size_t QUERY_BLOCK_SIZE = 64;
+/// number of data points whose distances to a block of query points are computed together
+const size_t DATA_BLOCK_SIZE = 256;
+}  // namespace
+
+OperationCreateGraph::OperationCreateGraph(base::DataMatrix& dataset, size_t k)
+    : dataset(dataset), k(k) {
+  if ((k == 0) || (k >= dataset.getNrows())) {
+    throw base::operation_exception(
+        "OperationCreateGraph::OperationCreateGraph : k has to be positive and smaller than "
+        "the number of data points");
+  }
+}
+
+OperationCreateGraph::~OperationCreateGraph() {}
+
+void OperationCreateGraph::createGraph(std::vector<int>& graph, size_t startid,
+                                       size_t chunksize) {
+  const size_t numPoints = dataset.getNrows();
+  const size_t dim = dataset.getNcols();
+
+  if (startid > numPoints) {
+    throw base::operation_exception("OperationCreateGraph::createGraph : invalid chunk");
+  }
+
+  if (chunksize == 0) {
+    chunksize = numPoints - startid;
+  }
+
+  if (startid + chunksize > numPoints) {
+    throw base::operation_exception("OperationCreateGraph::createGraph : invalid chunk");
+  }
+
+  graph.resize(chunksize * k);
+
+  const double* data = dataset.getPointer();
+  const size_t numQueryBlocks = (chunksize + QUERY_BLOCK_SIZE - 1) / QUERY_BLOCK_SIZE;
+
+#pragma omp parallel
+  {
+    std::vector<double> distances(QUERY_BLOCK_SIZE * DATA_BLOCK_SIZE);
+    std::vector<double> bestDistances(QUERY_BLOCK_SIZE * k);
+    std::vector<int> bestIndices(QUERY_BLOCK_SIZE * k);
+
+#pragma omp for schedule(dynamic)
+    for (size_t queryBlock = 0; queryBlock < numQueryBlocks; queryBlock++) {
+      const size_t queryBegin = startid + queryBlock * QUERY_BLOCK_SIZE;
+      const size_t queryEnd = std::min(queryBegin + QUERY_BLOCK_SIZE, startid + chunksize);
+      const size_t numQueries = queryEnd - queryBegin;
+
+      std::fill(bestDistances.begin(), bestDistances.end(),
+                std::numeric_limits<double>::infinity());
+      std::fill(bestIndices.begin(), bestIndices.end(), -1);
+
+      for (size_t dataBegin = 0; dataBegin < numPoints; dataBegin += DATA_BLOCK_SIZE) {
+        const size_t dataEnd = std::min(dataBegin + DATA_BLOCK_SIZE, numPoints);
+        const size_t numData = dataEnd - dataBegin;
+
+        // squared distances of the block (kept separate from the selection to be vectorizable)
+        for (size_t q = 0; q < numQueries; q++) {
+          const double* x = data + (queryBegin + q) * dim;
+          double* distance = &distances[q * DATA_BLOCK_SIZE];
+
+          for (size_t j = 0; j < numData; j++) {
+            const double* y = data + (dataBegin + j) * dim;
+            double sum = 0.0;
+
+            for (size_t t = 0; t < dim; t++) {
+              const double diff = x[t] - y[t];
+              sum += diff * diff;
+            }
+
+            distance[j] = sum;
+          }
+        }
+
+        // insert the candidates into the sorted lists of the k nearest neighbors
+        for (size_t q = 0; q < numQueries; q++) {
+          const double* distance = &distances[q * DATA_BLOCK_SIZE];
+          double* best = &bestDistances[q * k];
+          int* indices = &bestIndices[q * k];
+
+          for (size_t j = 0; j < numData; j++) {
+            if ((distance[j] >= best[k - 1]) || (dataBegin + j == queryBegin + q)) {
+              continue;
+            }
+
+            size_t pos = k - 1;
+
+            while ((pos > 0) && (best[pos - 1] > distance[j])) {
+              best[pos] = best[pos - 1];
+              indices[pos] = indices[pos - 1];
+              pos--;
+            }
+
+            best[pos] = distance[j];
+            indices[pos] = static_cast<int>(dataBegin + j);
+          }
+        }
+      }
+
+      for (size_t q = 0; q < numQueries; q++) {
+        std::copy(&bestIndices[q * k], &bestIndices[(q + 1) * k],
+                  graph.begin() + (queryBegin - startid + q) * k);
+      }
+    }
+  }
+}
+
+std::vector<size_t> OperationCreateGraph::findClusters(const std::vector<int>& graph, size_t k) {
+  const size_t numPoints = graph.size() / k;
+
+  // union-find, the root of each component is its smallest node
+  std::vector<size_t> parent(numPoints);
+  std::iota(parent.begin(), parent.end(), 0);
+  std::vector<bool> connected(numPoints, false);
+
+  auto find = [&parent](size_t node) {
+    while (parent[node] != node) {
+      parent[node] = parent[parent[node]];
+      node = parent[node];
+    }
+
+    return node;
+  };
+
+  for (size_t node = 0; node < numPoints; node++) {
+    if (graph[node * k] == -1) {
+      continue;
+    }
+
+    for (size_t i = node * k; i < (node + 1) * k; i++) {
+      if (graph[i] < 0) {
+        continue;
+      }
+
+      const size_t neighbor = static_cast<size_t>(graph[i]);
+
+      if (graph[neighbor * k] == -1) {
+        continue;
+      }
+
+      connected[node] = true;
+      connected[neighbor] = true;
+
+      const size_t root1 = find(node);
+      const size_t root2 = find(neighbor);
+
+      if (root1 < root2) {
+        parent[root2] = root1;
+      } else {
+        parent[root1] = root2;
+      }
+    }
+  }
+
+  std::vector<size_t> clusters(numPoints, 0);
+  std::vector<size_t> labels(numPoints, 0);
+  size_t numClusters = 0;
+
+  for (size_t node = 0; node < numPoints; node++) {
+    if (connected[node]) {
+      const size_t root = find(node);
+
+      if (labels[root] == 0) {
+        labels[root] = ++numClusters;
+      }
+
+      clusters[node] = labels[root];
+    }
+  }
+
+  return clusters;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
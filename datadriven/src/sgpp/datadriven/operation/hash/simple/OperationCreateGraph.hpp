@@ -0,0 +1,72 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONCREATEGRAPH_HPP_
+#define OPERATIONCREATEGRAPH_HPP_
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Creates the k nearest neighbor graph of a dataset on the CPU, this is the counterpart of
+ * DensityOCLMultiPlatform::OperationCreateGraphOCL.
+ *
+ * The graph is stored in the same format as by the OpenCL operations: the entries
+ * i * k, ..., (i + 1) * k - 1 contain the indices of the k nearest neighbors of the i-th data
+ * point (sorted by increasing distance), -2 marks a removed edge and -1 in the first entry
+ * marks a removed node (see OperationPruneGraph).
+ */
+class OperationCreateGraph {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param dataset   data points (one per row), has to outlive the operation
+   * @param k         number of neighbors per data point
+   */
+  OperationCreateGraph(base::DataMatrix& dataset, size_t k);
+
+  virtual ~OperationCreateGraph();
+
+  /**
+   * Computes the k nearest neighbors of a chunk of the data points.
+   * The distances are computed by brute force in blocks of data points which fit into the
+   * cache, the blocks of query points are distributed over the OpenMP threads.
+   *
+   * @param graph     graph of the chunk, is resized to chunksize * k
+   * @param startid   index of the first data point of the chunk
+   * @param chunksize number of data points of the chunk (0 for all remaining points)
+   */
+  void createGraph(std::vector<int>& graph, size_t startid = 0, size_t chunksize = 0);
+
+  /**
+   * Assigns a cluster index to each data point using the connected components of a (pruned)
+   * graph, edges are treated as undirected.
+   * Removed nodes and nodes without remaining edges get the index 0, the clusters are
+   * numbered 1, 2, ... in the order of their first data point.
+   *
+   * @param graph     graph of all data points
+   * @param k         number of neighbors per data point
+   * @return          cluster index of each data point
+   */
+  static std::vector<size_t> findClusters(const std::vector<int>& graph, size_t k);
+
+ protected:
+  /// data points
+  base::DataMatrix& dataset;
+  /// number of neighbors
+  size_t k;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* OPERATIONCREATEGRAPH_HPP_ */
@@ -0,0 +1,112 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/OperationPruneGraph.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+/// number of data points whose evaluation points are evaluated together (limits the memory)
+const size_t PRUNE_BLOCK_SIZE = 8192;
+}  // namespace
+
+OperationPruneGraph::OperationPruneGraph(base::Grid& grid, base::DataVector& alpha,
+                                         base::DataMatrix& data, double threshold, size_t k,
+                                         OperationMultipleEvalConfiguration configuration)
+    : grid(grid),
+      alpha(alpha),
+      data(data),
+      threshold(threshold),
+      k(k),
+      configuration(configuration) {}
+
+OperationPruneGraph::~OperationPruneGraph() {}
+
+void OperationPruneGraph::pruneGraph(std::vector<int>& graph, size_t startid, size_t chunksize) {
+  const size_t numPoints = data.getNrows();
+  const size_t dim = data.getNcols();
+
+  if (chunksize == 0) {
+    chunksize = (startid < numPoints) ? (numPoints - startid) : 0;
+  }
+
+  if ((startid + chunksize > numPoints) || (graph.size() < chunksize * k)) {
+    throw base::operation_exception("OperationPruneGraph::pruneGraph : invalid chunk");
+  }
+
+  const size_t pointsPerNode = k + 1;
+  base::DataMatrix evalPoints;
+  base::DataVector values;
+
+  for (size_t blockBegin = 0; blockBegin < chunksize; blockBegin += PRUNE_BLOCK_SIZE) {
+    const size_t blockEnd = std::min(blockBegin + PRUNE_BLOCK_SIZE, chunksize);
+    const size_t numNodes = blockEnd - blockBegin;
+
+    // row (i * (k + 1)) contains the i-th data point of the block,
+    // row (i * (k + 1) + 1 + j) the midpoint of its j-th edge
+    evalPoints.resizeRowsCols(numNodes * pointsPerNode, dim);
+    values.resize(numNodes * pointsPerNode);
+
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < numNodes; i++) {
+      const size_t node = startid + blockBegin + i;
+      const double* x = data.getPointer() + node * dim;
+      double* row = evalPoints.getPointer() + i * pointsPerNode * dim;
+
+      std::copy(x, x + dim, row);
+
+      for (size_t j = 0; j < k; j++) {
+        const int neighbor = graph[(blockBegin + i) * k + j];
+        double* midpoint = row + (j + 1) * dim;
+
+        if (neighbor < 0) {
+          // removed edge, the value is not used
+          std::copy(x, x + dim, midpoint);
+          continue;
+        }
+
+        const double* y = data.getPointer() + static_cast<size_t>(neighbor) * dim;
+
+        for (size_t t = 0; t < dim; t++) {
+          midpoint[t] = y[t] + (x[t] - y[t]) * 0.5;
+        }
+      }
+    }
+
+    std::unique_ptr<base::OperationMultipleEval> opEval(
+        op_factory::createOperationMultipleEval(grid, evalPoints, configuration));
+    opEval->mult(alpha, values);
+
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < numNodes; i++) {
+      int* edges = &graph[(blockBegin + i) * k];
+
+      if (values[i * pointsPerNode] < threshold) {
+        std::fill(edges, edges + k, -1);
+        continue;
+      }
+
+      for (size_t j = 0; j < k; j++) {
+        if ((edges[j] >= 0) && (values[i * pointsPerNode + 1 + j] < threshold)) {
+          edges[j] = -2;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
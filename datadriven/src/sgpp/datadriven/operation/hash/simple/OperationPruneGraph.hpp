@@ -0,0 +1,78 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONPRUNEGRAPH_HPP_
+#define OPERATIONPRUNEGRAPH_HPP_
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Removes the nodes and edges of a k nearest neighbor graph (see OperationCreateGraph) which lie
+ * in regions of low density on the CPU, this is the counterpart of
+ * DensityOCLMultiPlatform::OperationPruneGraphOCL.
+ *
+ * The density is given by a sparse grid function and evaluated with an OperationMultipleEval
+ * (created by op_factory::createOperationMultipleEval with the given configuration) at the
+ * data points and at the midpoints of the edges. An edge whose midpoint has a density below
+ * the threshold is marked with -2, all edges of a data point with a density below the
+ * threshold are marked with -1.
+ */
+class OperationPruneGraph {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param grid            sparse grid of the density
+   * @param alpha           coefficients of the density
+   * @param data            data points of the graph (one per row)
+   * @param threshold       minimal density of nodes and edge midpoints
+   * @param k               number of neighbors per data point
+   * @param configuration   configuration of the OperationMultipleEval
+   */
+  OperationPruneGraph(
+      base::Grid& grid, base::DataVector& alpha, base::DataMatrix& data, double threshold,
+      size_t k,
+      OperationMultipleEvalConfiguration configuration = OperationMultipleEvalConfiguration());
+
+  virtual ~OperationPruneGraph();
+
+  /**
+   * Prunes the graph of a chunk of the data points.
+   *
+   * @param graph     graph of the chunk (chunksize * k entries)
+   * @param startid   index of the first data point of the chunk
+   * @param chunksize number of data points of the chunk (0 for all remaining points)
+   */
+  void pruneGraph(std::vector<int>& graph, size_t startid = 0, size_t chunksize = 0);
+
+ protected:
+  /// sparse grid of the density
+  base::Grid& grid;
+  /// coefficients of the density
+  base::DataVector& alpha;
+  /// data points
+  base::DataMatrix& data;
+  /// minimal density
+  double threshold;
+  /// number of neighbors
+  size_t k;
+  /// configuration of the OperationMultipleEval
+  OperationMultipleEvalConfiguration configuration;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* OPERATIONPRUNEGRAPH_HPP_ */
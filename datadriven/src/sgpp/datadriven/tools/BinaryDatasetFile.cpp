@@ -0,0 +1,374 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/BinaryDatasetFile.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/ParallelDatasetReader.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::data_exception;
+using sgpp::base::file_exception;
+
+namespace {
+
+/// magic number at the beginning of every file
+const char MAGIC[8] = {'S', 'G', 'P', 'P', 'D', 'S', 'E', 'T'};
+/// written in the byte order of the writing machine to detect foreign files
+const uint32_t BYTE_ORDER_MARK = 0x01020304;
+/// alignment of the sections
+const uint64_t SECTION_ALIGNMENT = 64;
+/// value type of columns stored as float64
+const uint32_t VALUE_TYPE_FLOAT64 = 0;
+/// value type of columns stored as float32
+const uint32_t VALUE_TYPE_FLOAT32 = 1;
+
+/**
+ * Fixed-size header at the beginning of every file.
+ */
+struct BinaryDatasetHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint32_t valueType;
+  uint32_t hasTargets;
+  uint64_t numberInstances;
+  uint64_t dimension;
+  /// column d starts at columnsOffset + d * columnStride
+  uint64_t columnsOffset;
+  uint64_t columnStride;
+  uint64_t targetsOffset;
+  /// zero if there is no chunk index
+  uint64_t chunkSize;
+  /// the chunk index stores (smallest target, largest target) per chunk
+  uint64_t chunkIndexOffset;
+  uint64_t fileSize;
+};
+
+inline uint64_t alignOffset(uint64_t offset) {
+  return (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+}
+
+inline void padTo(std::ofstream& fout, uint64_t& position, uint64_t offset) {
+  static const char zeros[SECTION_ALIGNMENT] = {};
+  fout.write(zeros, static_cast<std::streamsize>(offset - position));
+  position = offset;
+}
+
+template <typename T>
+void writeColumn(std::ofstream& fout, const base::DataMatrix& data, size_t d) {
+  std::vector<T> values(data.getNrows());
+
+  for (size_t i = 0; i < data.getNrows(); i++) {
+    values[i] = static_cast<T>(data.get(i, d));
+  }
+
+  fout.write(reinterpret_cast<const char*>(values.data()),
+             static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+template <typename T>
+void copyColumn(const T* column, const std::vector<size_t>& instances, double* result,
+                size_t resultCols) {
+  for (size_t i = 0; i < instances.size(); i++) {
+    result[i * resultCols] = static_cast<double>(column[instances[i]]);
+  }
+}
+
+}  // namespace
+
+const uint32_t BinaryDatasetFile::FORMAT_VERSION;
+const size_t BinaryDatasetFile::DEFAULT_CHUNK_SIZE;
+
+void BinaryDatasetFile::write(const Dataset& dataset, const std::string& filename,
+                              bool hasTargets, bool singlePrecision, size_t chunkSize) {
+  const base::DataMatrix& data = dataset.getData();
+  const base::DataVector& targets = dataset.getTargets();
+  const uint64_t numberInstances = data.getNrows();
+  const uint64_t valueSize = singlePrecision ? sizeof(float) : sizeof(double);
+
+  if (hasTargets && targets.getSize() != numberInstances) {
+    throw data_exception("BinaryDatasetFile::write : number of targets does not match");
+  }
+
+  if (!hasTargets) {
+    chunkSize = 0;
+  }
+
+  BinaryDatasetHeader header;
+  std::memset(&header, 0, sizeof(BinaryDatasetHeader));
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = FORMAT_VERSION;
+  header.byteOrderMark = BYTE_ORDER_MARK;
+  header.valueType = singlePrecision ? VALUE_TYPE_FLOAT32 : VALUE_TYPE_FLOAT64;
+  header.hasTargets = hasTargets ? 1 : 0;
+  header.numberInstances = numberInstances;
+  header.dimension = data.getNcols();
+  header.columnsOffset = alignOffset(sizeof(BinaryDatasetHeader));
+  header.columnStride = alignOffset(numberInstances * valueSize);
+  header.targetsOffset = header.columnsOffset + header.dimension * header.columnStride;
+  header.chunkSize = chunkSize;
+  header.chunkIndexOffset =
+      header.targetsOffset + (hasTargets ? alignOffset(numberInstances * sizeof(double)) : 0);
+
+  const uint64_t numberOfChunks =
+      (chunkSize == 0) ? 0 : (numberInstances + chunkSize - 1) / chunkSize;
+  header.fileSize = header.chunkIndexOffset + 2 * numberOfChunks * sizeof(double);
+
+  std::ofstream fout(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if (!fout) {
+    throw file_exception("BinaryDatasetFile::write : unable to open file for write access");
+  }
+
+  uint64_t position = sizeof(BinaryDatasetHeader);
+  fout.write(reinterpret_cast<const char*>(&header), sizeof(BinaryDatasetHeader));
+
+  for (size_t d = 0; d < header.dimension; d++) {
+    padTo(fout, position, header.columnsOffset + d * header.columnStride);
+
+    if (singlePrecision) {
+      writeColumn<float>(fout, data, d);
+    } else {
+      writeColumn<double>(fout, data, d);
+    }
+
+    position += numberInstances * valueSize;
+  }
+
+  if (hasTargets) {
+    padTo(fout, position, header.targetsOffset);
+    fout.write(reinterpret_cast<const char*>(targets.data()),
+               static_cast<std::streamsize>(numberInstances * sizeof(double)));
+    position += numberInstances * sizeof(double);
+
+    padTo(fout, position, header.chunkIndexOffset);
+
+    for (uint64_t chunk = 0; chunk < numberOfChunks; chunk++) {
+      const size_t begin = chunk * chunkSize;
+      const size_t end = std::min(begin + chunkSize, static_cast<size_t>(numberInstances));
+      const auto range = std::minmax_element(targets.data() + begin, targets.data() + end);
+      const double bounds[2] = {*range.first, *range.second};
+      fout.write(reinterpret_cast<const char*>(bounds), sizeof(bounds));
+      position += sizeof(bounds);
+    }
+  }
+
+  padTo(fout, position, header.fileSize);
+
+  if (!fout) {
+    throw file_exception("BinaryDatasetFile::write : error while writing the file");
+  }
+}
+
+void BinaryDatasetFile::convert(const std::string& inputFilename,
+                                const std::string& outputFilename, bool hasTargets,
+                                bool singlePrecision, size_t chunkSize) {
+  std::string extension = inputFilename.substr(inputFilename.find_last_of('.') + 1);
+  std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+  if (extension == "arff") {
+    write(ParallelDatasetReader::readARFFFromFile(inputFilename, hasTargets), outputFilename,
+          hasTargets, singlePrecision, chunkSize);
+  } else if (extension == "csv") {
+    write(ParallelDatasetReader::readCSVFromFile(inputFilename, true, hasTargets),
+          outputFilename, hasTargets, singlePrecision, chunkSize);
+  } else {
+    throw data_exception("BinaryDatasetFile::convert : input has to be a CSV or ARFF file");
+  }
+}
+
+bool BinaryDatasetFile::isBinaryFile(const std::string& filename) {
+  std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
+  char magic[sizeof(MAGIC)];
+
+  if (!fin.read(magic, sizeof(MAGIC))) {
+    return false;
+  }
+
+  return std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+BinaryDatasetFile::BinaryDatasetFile(const std::string& filename)
+    : file(new base::MappedFile(filename)),
+      buffer(),
+      data(file->getData()),
+      dataSize(file->getSize()),
+      numberInstances(0),
+      dimension(0),
+      singlePrecision(false),
+      columnsOffset(0),
+      columnStride(0),
+      targets(nullptr),
+      chunkSize(0),
+      chunkIndex(nullptr) {
+  if (dataSize < sizeof(BinaryDatasetHeader)) {
+    throw file_exception("BinaryDatasetFile : file is too small for a binary dataset");
+  }
+
+  parseHeader();
+}
+
+BinaryDatasetFile::BinaryDatasetFile(const char* content, size_t size)
+    : file(),
+      buffer(),
+      data(nullptr),
+      dataSize(size),
+      numberInstances(0),
+      dimension(0),
+      singlePrecision(false),
+      columnsOffset(0),
+      columnStride(0),
+      targets(nullptr),
+      chunkSize(0),
+      chunkIndex(nullptr) {
+  if (dataSize < sizeof(BinaryDatasetHeader)) {
+    throw file_exception("BinaryDatasetFile : content is too small for a binary dataset");
+  }
+
+  // new[] returns suitably aligned memory for the double sections
+  buffer.reset(new char[dataSize]);
+  std::memcpy(buffer.get(), content, dataSize);
+  data = buffer.get();
+
+  parseHeader();
+}
+
+BinaryDatasetFile::~BinaryDatasetFile() {}
+
+void BinaryDatasetFile::parseHeader() {
+  BinaryDatasetHeader header;
+  std::memcpy(&header, data, sizeof(BinaryDatasetHeader));
+
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    throw file_exception("BinaryDatasetFile : file is not a binary dataset");
+  } else if (header.byteOrderMark != BYTE_ORDER_MARK) {
+    throw file_exception("BinaryDatasetFile : binary dataset has been written with a different "
+                         "byte order");
+  } else if (header.version > FORMAT_VERSION) {
+    throw file_exception("BinaryDatasetFile : binary dataset has been written by a newer version");
+  } else if ((header.valueType != VALUE_TYPE_FLOAT64) &&
+             (header.valueType != VALUE_TYPE_FLOAT32)) {
+    throw file_exception("BinaryDatasetFile : unknown value type");
+  } else if (header.fileSize > dataSize) {
+    throw file_exception("BinaryDatasetFile : file is truncated");
+  }
+
+  const uint64_t valueSize =
+      (header.valueType == VALUE_TYPE_FLOAT32) ? sizeof(float) : sizeof(double);
+  const uint64_t numberOfChunks =
+      (header.chunkSize == 0)
+          ? 0
+          : (header.numberInstances + header.chunkSize - 1) / header.chunkSize;
+
+  // every section has to lie within the file (checked without overflows) and be aligned
+  const bool validColumns =
+      (header.columnStride >= header.numberInstances * valueSize) &&
+      (header.numberInstances <= header.fileSize / valueSize) &&
+      (header.columnsOffset >= sizeof(BinaryDatasetHeader)) &&
+      (header.columnsOffset <= header.fileSize) &&
+      ((header.dimension == 0) || (header.columnStride == 0) ||
+       (header.dimension <= (header.fileSize - header.columnsOffset) / header.columnStride)) &&
+      (header.columnsOffset % SECTION_ALIGNMENT == 0) &&
+      (header.columnStride % SECTION_ALIGNMENT == 0);
+  const bool validTargets =
+      (header.hasTargets == 0) ||
+      ((header.targetsOffset % SECTION_ALIGNMENT == 0) &&
+       (header.targetsOffset <= header.fileSize) &&
+       (header.numberInstances <= (header.fileSize - header.targetsOffset) / sizeof(double)));
+  const bool validChunkIndex =
+      (numberOfChunks == 0) ||
+      ((header.hasTargets != 0) && (header.chunkIndexOffset % SECTION_ALIGNMENT == 0) &&
+       (header.chunkIndexOffset <= header.fileSize) &&
+       (numberOfChunks <= (header.fileSize - header.chunkIndexOffset) / (2 * sizeof(double))));
+
+  if (!validColumns || !validTargets || !validChunkIndex) {
+    throw file_exception("BinaryDatasetFile : invalid section table");
+  }
+
+  numberInstances = static_cast<size_t>(header.numberInstances);
+  dimension = static_cast<size_t>(header.dimension);
+  singlePrecision = (header.valueType == VALUE_TYPE_FLOAT32);
+  columnsOffset = static_cast<size_t>(header.columnsOffset);
+  columnStride = static_cast<size_t>(header.columnStride);
+  targets = (header.hasTargets != 0)
+                ? reinterpret_cast<const double*>(data + header.targetsOffset)
+                : nullptr;
+  chunkSize = static_cast<size_t>(header.chunkSize);
+  chunkIndex = (numberOfChunks != 0)
+                   ? reinterpret_cast<const double*>(data + header.chunkIndexOffset)
+                   : nullptr;
+}
+
+bool BinaryDatasetFile::chunkMayContain(size_t chunk,
+                                        const std::vector<double>& selectedTargets) const {
+  if (chunkIndex == nullptr) {
+    return true;
+  }
+
+  const double minTarget = chunkIndex[2 * chunk];
+  const double maxTarget = chunkIndex[2 * chunk + 1];
+
+  // same tolerance as ParallelDatasetReader::isSelectedTarget
+  for (double target : selectedTargets) {
+    if ((target > minTarget - 0.001) && (target < maxTarget + 0.001)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void BinaryDatasetFile::copyInstances(const std::vector<size_t>& instances,
+                                      const std::vector<size_t>& selectedCols,
+                                      Dataset& result) const {
+  const size_t resultCols = selectedCols.empty() ? dimension : selectedCols.size();
+
+  if ((result.getNumberInstances() != instances.size()) ||
+      (result.getDimension() != resultCols)) {
+    throw data_exception("BinaryDatasetFile::copyInstances : dataset has the wrong size");
+  }
+
+  double* resultData = result.getData().data();
+
+  // the columns are contiguous in the file, hence copying column by column reads sequentially
+  // for consecutive instances
+  for (size_t j = 0; j < resultCols; j++) {
+    const size_t d = selectedCols.empty() ? j : selectedCols[j];
+
+    if (d >= dimension) {
+      throw data_exception("BinaryDatasetFile::copyInstances : selected column does not exist");
+    }
+
+    const char* column = data + columnsOffset + d * columnStride;
+
+    if (singlePrecision) {
+      copyColumn(reinterpret_cast<const float*>(column), instances, resultData + j, resultCols);
+    } else {
+      copyColumn(reinterpret_cast<const double*>(column), instances, resultData + j, resultCols);
+    }
+  }
+
+  if (targets != nullptr) {
+    base::DataVector& resultTargets = result.getTargets();
+
+    for (size_t i = 0; i < instances.size(); i++) {
+      resultTargets[i] = targets[instances[i]];
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,192 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BINARYDATASETFILE_HPP
+#define BINARYDATASETFILE_HPP
+
+#include <sgpp/base/tools/MappedFile.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Read-only view of a dataset stored in the binary columnar dataset format.
+ *
+ * The file consists of a fixed-size header followed by one section per dimension and, if the
+ * dataset has targets, a section with the targets. Each section starts at a 64 byte aligned
+ * offset and contains the values of one column for all instances, stored as float64 or (to halve
+ * the file size) float32. Targets are always stored as float64. Optionally, the file contains a
+ * chunk index that stores the smallest and largest target of every chunk of consecutive
+ * instances, which allows to skip whole chunks when only some classes are read.
+ *
+ * The file is memory-mapped, hence opening it does not depend on the size of the dataset and
+ * instances are only read (and converted to double) when they are copied into a Dataset.
+ * All numbers are stored in the byte order of the writing machine, which is checked when the
+ * file is opened.
+ */
+class BinaryDatasetFile {
+ public:
+  /// version of the binary dataset format written by write()
+  static const uint32_t FORMAT_VERSION = 1;
+  /// default number of instances per chunk of the chunk index
+  static const size_t DEFAULT_CHUNK_SIZE = 4096;
+
+  /**
+   * Writes a dataset in the binary dataset format.
+   *
+   * @param dataset         dataset to write
+   * @param filename        name of the file
+   * @param hasTargets      whether the targets of the dataset should be stored
+   * @param singlePrecision whether the values are stored as float32 instead of float64
+   * @param chunkSize       number of instances per chunk of the chunk index (0 for no index)
+   */
+  static void write(const Dataset& dataset, const std::string& filename, bool hasTargets = true,
+                    bool singlePrecision = false, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+  /**
+   * Converts a CSV file (with a header line, see CSVFileSampleProvider) or an ARFF file into the
+   * binary dataset format. The type of the input is determined by its extension.
+   *
+   * @param inputFilename   name of the CSV or ARFF file
+   * @param outputFilename  name of the binary file
+   * @param hasTargets      whether the last column of the input contains targets
+   * @param singlePrecision whether the values are stored as float32 instead of float64
+   * @param chunkSize       number of instances per chunk of the chunk index (0 for no index)
+   */
+  static void convert(const std::string& inputFilename, const std::string& outputFilename,
+                      bool hasTargets = true, bool singlePrecision = false,
+                      size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+  /**
+   * Checks (by the magic number) whether a file is stored in the binary dataset format.
+   *
+   * @param filename  name of the file
+   * @return          true if the file can be opened and starts with the magic number
+   */
+  static bool isBinaryFile(const std::string& filename);
+
+  /**
+   * Constructor, maps a file in the binary dataset format into memory.
+   *
+   * @param filename  name of the file
+   */
+  explicit BinaryDatasetFile(const std::string& filename);
+
+  /**
+   * Constructor, copies the contents of a file in the binary dataset format (e.g. after
+   * decompressing it) into memory.
+   *
+   * @param content  begin of the contents
+   * @param size     size of the contents in bytes
+   */
+  BinaryDatasetFile(const char* content, size_t size);
+
+  BinaryDatasetFile(const BinaryDatasetFile&) = delete;
+  BinaryDatasetFile& operator=(const BinaryDatasetFile&) = delete;
+
+  /**
+   * Destructor, unmaps the file
+   */
+  ~BinaryDatasetFile();
+
+  /**
+   * @return number of stored instances
+   */
+  inline size_t getNumberInstances() const { return numberInstances; }
+
+  /**
+   * @return dimension of the stored instances
+   */
+  inline size_t getDimension() const { return dimension; }
+
+  /**
+   * @return whether the file contains targets
+   */
+  inline bool hasTargets() const { return targets != nullptr; }
+
+  /**
+   * @return whether the values are stored as float32
+   */
+  inline bool isSinglePrecision() const { return singlePrecision; }
+
+  /**
+   * @return number of instances per chunk of the chunk index (0 if there is no index)
+   */
+  inline size_t getChunkSize() const { return chunkSize; }
+
+  /**
+   * @param i index of the instance
+   * @return  target of the instance
+   */
+  inline double getTarget(size_t i) const { return targets[i]; }
+
+  /**
+   * Checks with the chunk index whether a chunk of instances may contain one of the given
+   * targets (with the tolerance of ParallelDatasetReader::isSelectedTarget). Without a chunk
+   * index (or without targets) every chunk may contain every target.
+   *
+   * @param chunk            index of the chunk (instances chunk * getChunkSize() and following)
+   * @param selectedTargets  targets to look for
+   * @return                 false if no instance of the chunk has one of the targets
+   */
+  bool chunkMayContain(size_t chunk, const std::vector<double>& selectedTargets) const;
+
+  /**
+   * Copies instances into a dataset.
+   *
+   * @param instances      indices of the instances, the i-th index is written to the i-th row
+   * @param selectedCols   columns which are copied, in this order (all if empty)
+   * @param result         dataset of size instances.size() times the number of (selected)
+   *                       columns; its targets are set if the file contains targets
+   */
+  void copyInstances(const std::vector<size_t>& instances, const std::vector<size_t>& selectedCols,
+                     Dataset& result) const;
+
+ private:
+  /// the mapped file (nullptr if the contents have been copied into buffer)
+  std::unique_ptr<base::MappedFile> file;
+  /// copy of the contents (if they have not been mapped)
+  std::unique_ptr<char[]> buffer;
+  /// begin of the contents
+  const char* data;
+  /// size of the contents in bytes
+  size_t dataSize;
+
+  /// number of stored instances
+  size_t numberInstances;
+  /// dimension of the stored instances
+  size_t dimension;
+  /// whether the values are stored as float32
+  bool singlePrecision;
+  /// offset of the first column in bytes
+  size_t columnsOffset;
+  /// distance between two columns in bytes
+  size_t columnStride;
+  /// targets (point into the mapped file, nullptr if there are none)
+  const double* targets;
+  /// number of instances per chunk of the chunk index
+  size_t chunkSize;
+  /// smallest and largest target per chunk (point into the mapped file, nullptr if none)
+  const double* chunkIndex;
+
+  /**
+   * Checks the header and sets the pointers to the sections.
+   */
+  void parseHeader();
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* BINARYDATASETFILE_HPP */
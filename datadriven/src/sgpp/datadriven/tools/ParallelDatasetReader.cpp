@@ -0,0 +1,402 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/ParallelDatasetReader.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/tools/MappedFile.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <clocale>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::file_exception;
+
+namespace {
+
+/// minimal number of bytes per chunk (smaller files are not split)
+const size_t MIN_CHUNK_BYTES = 1 << 16;
+/// number of chunks per thread (for load balancing)
+const size_t CHUNKS_PER_THREAD = 4;
+
+/// powers of ten that are exactly representable as double
+const double EXACT_POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                      1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                      1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/**
+ * @return end of the line that starts at pos (position of '\n' or end)
+ */
+inline const char* findLineEnd(const char* pos, const char* end) {
+  const void* newline = std::memchr(pos, '\n', static_cast<size_t>(end - pos));
+  return (newline == nullptr) ? end : static_cast<const char*>(newline);
+}
+
+/**
+ * Checks whether a line contains an instance and strips a trailing carriage return.
+ */
+inline bool isDataLine(const char* lineBegin, const char*& lineEnd, bool isARFF) {
+  if ((lineEnd > lineBegin) && (*(lineEnd - 1) == '\r')) {
+    lineEnd--;
+  }
+
+  if (lineEnd == lineBegin) {
+    return false;
+  }
+
+  // ARFF: we don't care about the attribute specification and comments
+  return !isARFF ||
+         ((std::memchr(lineBegin, '%', static_cast<size_t>(lineEnd - lineBegin)) == nullptr) &&
+          (std::memchr(lineBegin, '@', static_cast<size_t>(lineEnd - lineBegin)) == nullptr));
+}
+
+inline size_t countCommas(const char* lineBegin, const char* lineEnd) {
+  return static_cast<size_t>(std::count(lineBegin, lineEnd, ','));
+}
+
+inline bool startsWithIgnoringCase(const char* pos, const char* end, const char* word) {
+  for (; *word != '\0'; pos++, word++) {
+    if ((pos == end) || (std::tolower(static_cast<unsigned char>(*pos)) != *word)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+double ParallelDatasetReader::parseDouble(const char* begin, const char* end) {
+  const char* pos = begin;
+
+  while ((pos != end) && ((*pos == ' ') || (*pos == '\t') || (*pos == '\r') || (*pos == '\n') ||
+                          (*pos == '\v') || (*pos == '\f'))) {
+    pos++;
+  }
+
+  const char* numberBegin = pos;
+  bool negative = false;
+
+  if ((pos != end) && ((*pos == '-') || (*pos == '+'))) {
+    negative = (*pos == '-');
+    pos++;
+  }
+
+  if (startsWithIgnoringCase(pos, end, "inf")) {
+    return negative ? -std::numeric_limits<double>::infinity()
+                    : std::numeric_limits<double>::infinity();
+  } else if (startsWithIgnoringCase(pos, end, "nan")) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  uint64_t mantissa = 0;
+  int significantDigits = 0;
+  int exponent = 0;
+  bool hasDigits = false;
+  bool truncated = false;
+  bool inFraction = false;
+
+  for (; pos != end; pos++) {
+    if (*pos == '.' && !inFraction) {
+      inFraction = true;
+      continue;
+    } else if ((*pos < '0') || (*pos > '9')) {
+      break;
+    }
+
+    const unsigned digit = static_cast<unsigned>(*pos - '0');
+    hasDigits = true;
+
+    if ((mantissa == 0) && (digit == 0)) {
+      // leading zeros are not significant
+      exponent -= inFraction ? 1 : 0;
+    } else if (significantDigits < 19) {
+      mantissa = 10 * mantissa + digit;
+      significantDigits++;
+      exponent -= inFraction ? 1 : 0;
+    } else {
+      truncated = true;
+      exponent += inFraction ? 0 : 1;
+    }
+  }
+
+  if (!hasDigits) {
+    return 0.0;
+  }
+
+  if ((pos != end) && ((*pos == 'e') || (*pos == 'E'))) {
+    const char* exponentPos = pos + 1;
+    bool negativeExponent = false;
+
+    if ((exponentPos != end) && ((*exponentPos == '-') || (*exponentPos == '+'))) {
+      negativeExponent = (*exponentPos == '-');
+      exponentPos++;
+    }
+
+    if ((exponentPos != end) && (*exponentPos >= '0') && (*exponentPos <= '9')) {
+      int explicitExponent = 0;
+
+      for (; (exponentPos != end) && (*exponentPos >= '0') && (*exponentPos <= '9');
+           exponentPos++) {
+        // saturate, the result is zero or infinite anyway
+        explicitExponent = std::min(10 * explicitExponent + (*exponentPos - '0'), 100000);
+      }
+
+      exponent += negativeExponent ? -explicitExponent : explicitExponent;
+      pos = exponentPos;
+    }
+  }
+
+  if (mantissa == 0) {
+    return negative ? -0.0 : 0.0;
+  }
+
+  // the mantissa and the power of ten are exact, hence a single multiplication or division
+  // is correctly rounded
+  if (!truncated && (significantDigits <= 15) && (exponent >= -22) && (exponent <= 22)) {
+    double value = static_cast<double>(mantissa);
+    value = (exponent < 0) ? value / EXACT_POWERS_OF_TEN[-exponent]
+                           : value * EXACT_POWERS_OF_TEN[exponent];
+    return negative ? -value : value;
+  }
+
+  // rare case: fall back to strtod, which rounds correctly and returns +-inf on overflow
+  // (in contrast to the stream extraction, which saturates to the largest finite value);
+  // the decimal point is replaced by the one of the current locale
+  std::string number(numberBegin, pos);
+  const char decimalPoint = *std::localeconv()->decimal_point;
+  std::replace(number.begin(), number.end(), '.', decimalPoint);
+
+  errno = 0;
+  const double value = std::strtod(number.c_str(), nullptr);
+
+  if ((errno == ERANGE) && (std::fabs(value) > 1.0)) {
+    return negative ? -std::numeric_limits<double>::infinity()
+                    : std::numeric_limits<double>::infinity();
+  }
+
+  return value;
+}
+
+bool ParallelDatasetReader::isSelectedTarget(double target,
+                                             const std::vector<double>& selectedTargets) {
+  if (selectedTargets.empty()) {
+    return true;
+  }
+
+  for (double selectedTarget : selectedTargets) {
+    if (std::fabs(target - selectedTarget) < 0.001) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+Dataset ParallelDatasetReader::readCSVFromFile(const std::string& filename, bool skipFirstLine,
+                                               bool hasTargets, size_t instanceCutoff,
+                                               std::vector<size_t> selectedCols,
+                                               std::vector<double> selectedTargets) {
+  base::MappedFile file(filename, base::MappedFile::AccessPattern::Sequential);
+  return parse(file.begin(), file.end(), false, skipFirstLine, hasTargets, instanceCutoff,
+               selectedCols, selectedTargets);
+}
+
+Dataset ParallelDatasetReader::readARFFFromFile(const std::string& filename, bool hasTargets,
+                                                size_t instanceCutoff,
+                                                std::vector<size_t> selectedCols,
+                                                std::vector<double> selectedTargets) {
+  base::MappedFile file(filename, base::MappedFile::AccessPattern::Sequential);
+  return parse(file.begin(), file.end(), true, false, hasTargets, instanceCutoff, selectedCols,
+               selectedTargets);
+}
+
+Dataset ParallelDatasetReader::readARFFFromString(const std::string& content, bool hasTargets,
+                                                  size_t instanceCutoff,
+                                                  std::vector<size_t> selectedCols,
+                                                  std::vector<double> selectedTargets) {
+  return parse(content.data(), content.data() + content.size(), true, false, hasTargets,
+               instanceCutoff, selectedCols, selectedTargets);
+}
+
+Dataset ParallelDatasetReader::parse(const char* begin, const char* end, bool isARFF,
+                                     bool skipFirstLine, bool hasTargets, size_t instanceCutoff,
+                                     const std::vector<size_t>& selectedCols,
+                                     const std::vector<double>& selectedTargets) {
+  if ((begin != end) && skipFirstLine) {
+    begin = std::min(findLineEnd(begin, end) + 1, end);
+  }
+
+  // the first instance line determines the number of columns
+  size_t numberOfCommas = 0;
+  bool foundDataLine = false;
+
+  for (const char* pos = begin; (pos < end) && !foundDataLine;) {
+    const char* lineEnd = findLineEnd(pos, end);
+    const char* next = lineEnd + 1;
+
+    if (isDataLine(pos, lineEnd, isARFF)) {
+      numberOfCommas = countCommas(pos, lineEnd);
+      foundDataLine = true;
+    }
+
+    pos = next;
+  }
+
+  const size_t maxDim = foundDataLine ? (numberOfCommas + (hasTargets ? 0 : 1)) : 0;
+  size_t dimension = maxDim;
+
+  if (!selectedCols.empty()) {
+    if (*std::max_element(selectedCols.begin(), selectedCols.end()) >= maxDim) {
+      throw file_exception("ParallelDatasetReader: invalid column selection");
+    }
+
+    dimension = selectedCols.size();
+  }
+
+  // split the data into chunks at line boundaries
+  size_t numberOfThreads = 1;
+#ifdef _OPENMP
+  numberOfThreads = static_cast<size_t>(omp_get_max_threads());
+#endif
+  const size_t bytes = static_cast<size_t>(end - begin);
+  const size_t numberOfChunks = std::max(
+      static_cast<size_t>(1), std::min(bytes / MIN_CHUNK_BYTES, CHUNKS_PER_THREAD * numberOfThreads));
+  std::vector<const char*> chunkBegin(numberOfChunks + 1, end);
+  chunkBegin[0] = begin;
+
+  for (size_t k = 1; k < numberOfChunks; k++) {
+    const char* pos = std::max(begin + k * (bytes / numberOfChunks), chunkBegin[k - 1]);
+    chunkBegin[k] = (pos == begin) ? begin : std::min(findLineEnd(pos - 1, end) + 1, end);
+  }
+
+  // first pass: count the admissible instances of each chunk
+  std::vector<size_t> chunkInstances(numberOfChunks, 0);
+  bool columnsMissing = false;
+  const bool filterTargets = hasTargets && !selectedTargets.empty();
+
+#pragma omp parallel for schedule(dynamic) reduction(|| : columnsMissing)
+  for (size_t k = 0; k < numberOfChunks; k++) {
+    size_t count = 0;
+
+    for (const char* pos = chunkBegin[k]; pos < chunkBegin[k + 1];) {
+      const char* lineEnd = findLineEnd(pos, end);
+      const char* next = lineEnd + 1;
+
+      if (isDataLine(pos, lineEnd, isARFF)) {
+        if (countCommas(pos, lineEnd) != numberOfCommas) {
+          columnsMissing = true;
+          break;
+        }
+
+        if (filterTargets) {
+          const char* lastComma = pos;
+
+          for (const char* c = lineEnd; c > pos; c--) {
+            if (*(c - 1) == ',') {
+              lastComma = c;
+              break;
+            }
+          }
+
+          count += isSelectedTarget(parseDouble(lastComma, lineEnd), selectedTargets) ? 1 : 0;
+        } else {
+          count++;
+        }
+      }
+
+      pos = next;
+    }
+
+    chunkInstances[k] = count;
+  }
+
+  if (columnsMissing) {
+    throw file_exception("ParallelDatasetReader: Columns missing in line");
+  }
+
+  // row index of the first instance of each chunk
+  std::vector<size_t> chunkFirstRow(numberOfChunks + 1, 0);
+
+  for (size_t k = 0; k < numberOfChunks; k++) {
+    chunkFirstRow[k + 1] = chunkFirstRow[k] + chunkInstances[k];
+  }
+
+  const size_t numberInstances = std::min(chunkFirstRow[numberOfChunks], instanceCutoff);
+  Dataset dataset(numberInstances, dimension);
+  double* data = dataset.getData().getPointer();
+  double* targets = dataset.getTargets().getPointer();
+
+  // second pass: parse the instances directly into their rows
+#pragma omp parallel
+  {
+    std::vector<double> rowEntries(numberOfCommas + 1);
+
+#pragma omp for schedule(dynamic)
+    for (size_t k = 0; k < numberOfChunks; k++) {
+      size_t row = chunkFirstRow[k];
+
+      for (const char* pos = chunkBegin[k]; (pos < chunkBegin[k + 1]) && (row < numberInstances);) {
+        const char* lineEnd = findLineEnd(pos, end);
+        const char* next = lineEnd + 1;
+
+        if (isDataLine(pos, lineEnd, isARFF)) {
+          const char* fieldBegin = pos;
+
+          for (size_t i = 0; i <= numberOfCommas; i++) {
+            const char* fieldEnd = static_cast<const char*>(
+                std::memchr(fieldBegin, ',', static_cast<size_t>(lineEnd - fieldBegin)));
+            fieldEnd = (fieldEnd == nullptr) ? lineEnd : fieldEnd;
+            rowEntries[i] = parseDouble(fieldBegin, fieldEnd);
+            fieldBegin = std::min(fieldEnd + 1, lineEnd);
+          }
+
+          if (hasTargets && !isSelectedTarget(rowEntries[numberOfCommas], selectedTargets)) {
+            pos = next;
+            continue;
+          }
+
+          double* destination = data + row * dimension;
+
+          if (selectedCols.empty()) {
+            std::copy(rowEntries.begin(), rowEntries.begin() + dimension, destination);
+          } else {
+            for (size_t i = 0; i < dimension; i++) {
+              destination[i] = rowEntries[selectedCols[i]];
+            }
+          }
+
+          if (hasTargets) {
+            targets[row] = rowEntries[numberOfCommas];
+          }
+
+          row++;
+        }
+
+        pos = next;
+      }
+    }
+  }
+
+  return dataset;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,127 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PARALLELDATASETREADER_HPP
+#define PARALLELDATASETREADER_HPP
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * High-throughput reader for CSV and ARFF files.
+ *
+ * Produces the same datasets as CSVTools::readCSVFromFile and ARFFTools::readARFFFromFile,
+ * but the file is memory-mapped and split into chunks at line boundaries which are parsed in
+ * parallel (with OpenMP). Each file is scanned twice: the first pass counts the admissible
+ * instances per chunk, the second pass writes the values of each chunk directly into the rows
+ * of the preallocated Dataset that follow from the counts of the preceding chunks.
+ *
+ * Numbers are converted by a locale-independent parser, which is exact for decimal numbers
+ * with up to 15 significant digits and falls back to a (classic locale) stream for all others.
+ * Like atof, a value that does not start with a number (e.g. a nominal ARFF attribute) is
+ * read as zero.
+ */
+class ParallelDatasetReader {
+ public:
+  /**
+   * Reads a CSV file. See CSVTools::readCSV for the parameters.
+   *
+   * @param filename name of the file
+   * @param skipFirstLine whether to skip the first line (e.g. a header line)
+   * @param hasTargets whether the last column contains targets
+   * @param instanceCutoff maximal number of instances to read
+   * @param selectedCols columns which are written to the DataMatrix (all if empty)
+   * @param selectedTargets admissible targets (all if empty)
+   * @return CSV as Dataset
+   */
+  static Dataset readCSVFromFile(const std::string& filename, bool skipFirstLine = false,
+                                 bool hasTargets = true, size_t instanceCutoff = -1,
+                                 std::vector<size_t> selectedCols = std::vector<size_t>(),
+                                 std::vector<double> selectedTargets = std::vector<double>());
+
+  /**
+   * Reads an ARFF file. See ARFFTools::readARFF for the parameters.
+   *
+   * @param filename name of the file
+   * @param hasTargets whether the last column contains targets
+   * @param instanceCutoff maximal number of instances to read
+   * @param selectedCols columns which are written to the DataMatrix (all if empty)
+   * @param selectedTargets admissible targets (all if empty)
+   * @return ARFF as Dataset
+   */
+  static Dataset readARFFFromFile(const std::string& filename, bool hasTargets = true,
+                                  size_t instanceCutoff = -1,
+                                  std::vector<size_t> selectedCols = std::vector<size_t>(),
+                                  std::vector<double> selectedTargets = std::vector<double>());
+
+  /**
+   * Reads ARFF data from a string. See ARFFTools::readARFF for the parameters.
+   *
+   * @param content ARFF data
+   * @param hasTargets whether the last column contains targets
+   * @param instanceCutoff maximal number of instances to read
+   * @param selectedCols columns which are written to the DataMatrix (all if empty)
+   * @param selectedTargets admissible targets (all if empty)
+   * @return ARFF as Dataset
+   */
+  static Dataset readARFFFromString(const std::string& content, bool hasTargets = true,
+                                    size_t instanceCutoff = -1,
+                                    std::vector<size_t> selectedCols = std::vector<size_t>(),
+                                    std::vector<double> selectedTargets = std::vector<double>());
+
+  /**
+   * Converts the beginning of a character range to a double, independent of the locale.
+   * Leading blanks are skipped, a decimal number with optional sign, fraction and exponent
+   * as well as "inf" and "nan" are recognized. Numbers that are too large in magnitude are
+   * converted to +-inf, too small numbers to zero (as by strtod).
+   *
+   * @param begin begin of the characters
+   * @param end end of the characters
+   * @return the value (zero if the range does not start with a number)
+   */
+  static double parseDouble(const char* begin, const char* end);
+
+  /**
+   * Checks whether a target is admissible. Like in CSVTools and ARFFTools, targets are
+   * compared with a tolerance of 0.001.
+   *
+   * @param target the target of an instance
+   * @param selectedTargets admissible targets (all if empty)
+   * @return whether the target is admissible
+   */
+  static bool isSelectedTarget(double target, const std::vector<double>& selectedTargets);
+
+ private:
+  /**
+   * Parses a buffer of CSV or ARFF data.
+   *
+   * @param begin begin of the data
+   * @param end end of the data
+   * @param isARFF whether lines containing '%' or '@' should be skipped
+   * @param skipFirstLine whether the first line should be skipped
+   * @param hasTargets whether the last column contains targets
+   * @param instanceCutoff maximal number of instances to read
+   * @param selectedCols columns which are written to the DataMatrix (all if empty)
+   * @param selectedTargets admissible targets (all if empty)
+   * @return the dataset
+   */
+  static Dataset parse(const char* begin, const char* end, bool isARFF, bool skipFirstLine,
+                       bool hasTargets, size_t instanceCutoff,
+                       const std::vector<size_t>& selectedCols,
+                       const std::vector<double>& selectedTargets);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* PARALLELDATASETREADER_HPP */
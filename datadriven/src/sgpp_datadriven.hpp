@@ -61,6 +61,7 @@
 
 #include <sgpp/datadriven/application/DensityEstimator.hpp>
 #include <sgpp/datadriven/application/KernelDensityEstimator.hpp>
+#include <sgpp/datadriven/application/KernelDensityTree.hpp>
 #include <sgpp/datadriven/application/SparseGridDensityEstimator.hpp>
 
 #include <sgpp/datadriven/application/ClassificationLearner.hpp>
@@ -89,6 +90,7 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationTest.hpp>
 
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetFile.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalScalapack/OperationMultipleEvalDistributed.hpp>
@@ -111,6 +113,9 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationMakePositive.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationMakePositiveCandidateSetAlgorithm.hpp>
 
+#include <sgpp/datadriven/operation/hash/simple/OperationCreateGraph.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationPruneGraph.hpp>
+
 #include <sgpp/datadriven/tools/TypesDatadriven.hpp>
 
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
@@ -146,6 +151,7 @@
 #include <sgpp/datadriven/datamining/configuration/SLESolverTypeParser.hpp>
 #include <sgpp/datadriven/datamining/configuration/CombiConfigurator.hpp>
 
+#include <sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSource.hpp>
@@ -113,6 +113,11 @@ BOOST_AUTO_TEST_CASE(testScorerConfig) {
 
   BOOST_CHECK_EQUAL(hasConfig, true);
   BOOST_CHECK_EQUAL(static_cast<int>(config.metric), static_cast<int>(ScorerMetricType::mse));
+  BOOST_CHECK_EQUAL(config.cachePredictions, true);
+  BOOST_CHECK_EQUAL(config.subsampleSize, 1000);
+  BOOST_CHECK_EQUAL(config.randomSeed, 42);
+  BOOST_CHECK_CLOSE(config.confidenceLevel, 0.99, 1e-12);
+  BOOST_CHECK_CLOSE(config.incrementalUpdateThreshold, defaults.incrementalUpdateThreshold, 1e-12);
 }
 
 BOOST_AUTO_TEST_CASE(testFitterTypeConfig) {
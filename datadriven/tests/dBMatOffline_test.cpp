@@ -13,10 +13,13 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDMSChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineEigen.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFile.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineLU.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 #include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
@@ -253,6 +256,179 @@ BOOST_AUTO_TEST_CASE(testReadWriteLU) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testReadWriteBinaryCholesky) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 3;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.1;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::Chol;
+
+  sgpp::datadriven::GridFactory gridFactory;
+  std::unique_ptr<sgpp::base::Grid> grid = std::unique_ptr<sgpp::base::Grid>{
+    gridFactory.createGrid(gridConfig, std::vector<std::vector <size_t>>())
+  };
+
+  auto offline = std::unique_ptr<sgpp::datadriven::DBMatOffline>{
+      sgpp::datadriven::DBMatOfflineFactory::buildOfflineObject(gridConfig,
+                                                                adaptivityConfig,
+                                                                regularizationConfig,
+                                                                densityEstimationConfig)};
+  offline->buildMatrix(grid.get(), regularizationConfig);
+  offline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
+
+  std::string filename = "test_binary.dbmat";
+  offline->storeBinary(filename, gridConfig, regularizationConfig);
+  BOOST_CHECK(sgpp::datadriven::DBMatOfflineFile::isBinaryFile(filename));
+
+  auto newOffline = std::unique_ptr<sgpp::datadriven::DBMatOffline>{
+      sgpp::datadriven::DBMatOfflineFactory::buildFromFile(filename)};
+
+  // the decomposition stays mapped until it is accessed for writing
+  BOOST_CHECK(newOffline->getMappedFile() != nullptr);
+  BOOST_CHECK_EQUAL(newOffline->getDecomposedMatrixNcols(), grid->getSize());
+
+  /**
+   * Check matrices
+   */
+  auto& oldMatrix = offline->getDecomposedMatrix();
+  auto& newMatrix = newOffline->getDecomposedMatrix();
+  BOOST_CHECK(newOffline->getMappedFile() == nullptr);
+
+  BOOST_CHECK(newOffline->getDecompositionType() ==
+              sgpp::datadriven::MatrixDecompositionType::Chol);
+  BOOST_CHECK_EQUAL(oldMatrix.getSize(), newMatrix.getSize());
+
+  for (size_t i = 0; i < newMatrix.getSize(); i++) {
+    BOOST_CHECK_EQUAL(newMatrix[i], oldMatrix[i]);
+  }
+
+  /**
+   * Check the header and solving on the mapped factor
+   */
+  {
+    sgpp::datadriven::DBMatOfflineFile file(filename);
+    BOOST_CHECK(file.verifyChecksum());
+    BOOST_CHECK_EQUAL(file.getGridConfiguration().dim_, gridConfig.dim_);
+    BOOST_CHECK_EQUAL(file.getGridConfiguration().level_, gridConfig.level_);
+    BOOST_CHECK_EQUAL(file.getGridConfiguration().maxDegree_, gridConfig.maxDegree_);
+    BOOST_CHECK_EQUAL(file.getGridConfiguration().boundaryLevel_, gridConfig.boundaryLevel_);
+    BOOST_CHECK_EQUAL(file.getRegularizationConfiguration().lambda_, regularizationConfig.lambda_);
+
+    size_t size = oldMatrix.getNcols();
+    sgpp::base::DataVector b(size);
+    for (size_t i = 0; i < size; i++) {
+      b[i] = 1.0 + static_cast<double>(i % 3);
+    }
+
+    sgpp::base::DataVector alpha(size);
+    sgpp::base::DataVector alphaMapped(size);
+    sgpp::datadriven::DBMatDMSChol solver;
+    solver.solve(oldMatrix, alpha, b, regularizationConfig.lambda_, regularizationConfig.lambda_);
+    solver.solve(file.getMatrix(0), size, alphaMapped, b);
+
+    for (size_t i = 0; i < size; i++) {
+      BOOST_CHECK_CLOSE(alphaMapped[i], alpha[i], 1e-10);
+    }
+  }
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testReadWriteBinaryOrthoAdapt) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 3;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.1;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::OrthoAdapt;
+
+  sgpp::datadriven::GridFactory gridFactory;
+  std::unique_ptr<sgpp::base::Grid> grid = std::unique_ptr<sgpp::base::Grid>{
+    gridFactory.createGrid(gridConfig, std::vector<std::vector <size_t>>())
+  };
+
+  auto offline = std::unique_ptr<sgpp::datadriven::DBMatOffline>{
+      sgpp::datadriven::DBMatOfflineFactory::buildOfflineObject(gridConfig,
+                                                                adaptivityConfig,
+                                                                regularizationConfig,
+                                                                densityEstimationConfig)};
+  offline->buildMatrix(grid.get(), regularizationConfig);
+  offline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
+
+  std::string filename = "test_binary.dbmat";
+  offline->storeBinary(filename, gridConfig, regularizationConfig);
+  auto newOffline = std::unique_ptr<sgpp::datadriven::DBMatOffline>{
+      sgpp::datadriven::DBMatOfflineFactory::buildFromFile(filename)};
+  std::remove(filename.c_str());
+
+  /**
+   * Check matrices
+   */
+  auto child = static_cast<sgpp::datadriven::DBMatOfflineOrthoAdapt*>(&*offline);
+  auto newChild = static_cast<sgpp::datadriven::DBMatOfflineOrthoAdapt*>(&*newOffline);
+
+  BOOST_CHECK_EQUAL(child->getQ().getSize(), newChild->getQ().getSize());
+  BOOST_CHECK_EQUAL(child->getTinv().getSize(), newChild->getTinv().getSize());
+
+  for (size_t i = 0; i < newChild->getQ().getSize(); i++) {
+    BOOST_CHECK_EQUAL(newChild->getQ()[i], child->getQ()[i]);
+  }
+
+  for (size_t i = 0; i < newChild->getTinv().getSize(); i++) {
+    BOOST_CHECK_EQUAL(newChild->getTinv()[i], child->getTinv()[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testWriteBinaryLURejected) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 2;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig;
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.1;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::LU;
+
+  sgpp::datadriven::GridFactory gridFactory;
+  std::unique_ptr<sgpp::base::Grid> grid = std::unique_ptr<sgpp::base::Grid>{
+    gridFactory.createGrid(gridConfig, std::vector<std::vector <size_t>>())
+  };
+
+  auto offline = std::unique_ptr<sgpp::datadriven::DBMatOffline>{
+      sgpp::datadriven::DBMatOfflineFactory::buildOfflineObject(gridConfig,
+                                                                adaptivityConfig,
+                                                                regularizationConfig,
+                                                                densityEstimationConfig)};
+  offline->buildMatrix(grid.get(), regularizationConfig);
+  offline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
+
+  // the permutation of the LU decomposition cannot be stored, hence nothing is written
+  std::string filename = "test_binary_lu.dbmat";
+  BOOST_CHECK_THROW(offline->storeBinary(filename, gridConfig, regularizationConfig),
+                    sgpp::base::algorithm_exception);
+  BOOST_CHECK(!sgpp::datadriven::DBMatOfflineFile::isBinaryFile(filename));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif /* USE_GSL */
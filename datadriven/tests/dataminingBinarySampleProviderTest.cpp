@@ -0,0 +1,143 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/BinaryFileSampleProvider.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/BinaryDatasetFile.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::ARFFTools;
+using sgpp::datadriven::BinaryDatasetFile;
+using sgpp::datadriven::BinaryFileSampleProvider;
+using sgpp::datadriven::Dataset;
+
+BOOST_AUTO_TEST_SUITE(dataminingBinarySampleProviderTest)
+
+const std::string datasetPath = "datadriven/datasets/liver/liver-disorders_normalized.arff";
+const std::string binaryPath = "dataminingBinarySampleProviderTest.bin";
+
+BOOST_AUTO_TEST_CASE(binaryTestConvertAndRead) {
+  Dataset expected = ARFFTools::readARFFFromFile(datasetPath, true);
+  BinaryDatasetFile::convert(datasetPath, binaryPath);
+  BOOST_CHECK(BinaryDatasetFile::isBinaryFile(binaryPath));
+  BOOST_CHECK(!BinaryDatasetFile::isBinaryFile(datasetPath));
+
+  BinaryFileSampleProvider sampleProvider;
+  sampleProvider.readFile(binaryPath, true);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), expected.getNumberInstances());
+  BOOST_CHECK_EQUAL(sampleProvider.getDim(), expected.getDimension());
+
+  // read in batches, the last one is smaller
+  const size_t batchSize = 100;
+  size_t offset = 0;
+
+  while (offset < expected.getNumberInstances()) {
+    std::unique_ptr<Dataset> batch{sampleProvider.getNextSamples(batchSize)};
+    BOOST_REQUIRE_GT(batch->getNumberInstances(), 0);
+
+    for (size_t i = 0; i < batch->getNumberInstances(); i++) {
+      for (size_t d = 0; d < expected.getDimension(); d++) {
+        BOOST_CHECK_EQUAL(batch->getData().get(i, d), expected.getData().get(offset + i, d));
+      }
+
+      BOOST_CHECK_EQUAL(batch->getTargets()[i], expected.getTargets()[offset + i]);
+    }
+
+    offset += batch->getNumberInstances();
+  }
+
+  BOOST_CHECK_EQUAL(offset, expected.getNumberInstances());
+  std::unique_ptr<Dataset> empty{sampleProvider.getNextSamples(batchSize)};
+  BOOST_CHECK_EQUAL(empty->getNumberInstances(), 0);
+
+  sampleProvider.reset();
+  std::unique_ptr<Dataset> all{sampleProvider.getAllSamples()};
+  BOOST_CHECK_EQUAL(all->getNumberInstances(), expected.getNumberInstances());
+
+  std::remove(binaryPath.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(binaryTestSelection) {
+  std::vector<size_t> selectedCols = {4, 1};
+  std::vector<double> selectedTargets = {1.0};
+  Dataset expected =
+      ARFFTools::readARFFFromFile(datasetPath, true, 70, selectedCols, selectedTargets);
+
+  // single precision and a small chunk index
+  BinaryDatasetFile::write(ARFFTools::readARFFFromFile(datasetPath, true), binaryPath, true, true,
+                           7);
+
+  BinaryFileSampleProvider sampleProvider;
+  sampleProvider.readFile(binaryPath, true, 70, selectedCols, selectedTargets);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), expected.getNumberInstances());
+  BOOST_CHECK_EQUAL(sampleProvider.getDim(), selectedCols.size());
+
+  std::unique_ptr<Dataset> all{sampleProvider.getAllSamples()};
+  BOOST_REQUIRE_EQUAL(all->getNumberInstances(), expected.getNumberInstances());
+
+  for (size_t i = 0; i < expected.getNumberInstances(); i++) {
+    for (size_t d = 0; d < selectedCols.size(); d++) {
+      BOOST_CHECK_CLOSE(all->getData().get(i, d), expected.getData().get(i, d), 1e-5);
+    }
+
+    BOOST_CHECK_EQUAL(all->getTargets()[i], 1.0);
+  }
+
+  // targets are compared with the same tolerance as by ARFFTools
+  selectedTargets = {1.0004};
+  sampleProvider.readFile(binaryPath, true, 70, selectedCols, selectedTargets);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), expected.getNumberInstances());
+
+  // a target that does not occur
+  selectedTargets = {3.0};
+  sampleProvider.readFile(binaryPath, true, -1, std::vector<size_t>(), selectedTargets);
+  BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), 0);
+
+  std::remove(binaryPath.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(binaryTestReadString) {
+  Dataset expected = ARFFTools::readARFFFromFile(datasetPath, true);
+  BinaryDatasetFile::write(expected, binaryPath, true, false, 0);
+
+  std::ifstream fin(binaryPath.c_str(), std::ios::binary);
+  const std::string content{std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>()};
+
+  BinaryFileSampleProvider sampleProvider;
+  sampleProvider.readString(content, true);
+  std::unique_ptr<Dataset> all{sampleProvider.getAllSamples()};
+  BOOST_REQUIRE_EQUAL(all->getNumberInstances(), expected.getNumberInstances());
+
+  for (size_t i = 0; i < expected.getData().getSize(); i++) {
+    BOOST_CHECK_EQUAL(all->getData()[i], expected.getData()[i]);
+  }
+
+  // truncated content and missing targets
+  BOOST_CHECK_THROW(sampleProvider.readString(content.substr(0, content.size() / 2), true),
+                    sgpp::base::file_exception);
+  BinaryDatasetFile::write(expected, binaryPath, false);
+  BOOST_CHECK_THROW(sampleProvider.readFile(binaryPath, true), sgpp::base::data_exception);
+
+  std::remove(binaryPath.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,159 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/configuration/CrossvalidationConfiguration.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceSplitting.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorSequential.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::datadriven::ArffFileSampleProvider;
+using sgpp::datadriven::CrossvalidationConfiguration;
+using sgpp::datadriven::DataShufflingFunctorCrossValidation;
+using sgpp::datadriven::DataShufflingFunctorSequential;
+using sgpp::datadriven::DataSourceConfig;
+using sgpp::datadriven::DataSourceCrossValidation;
+using sgpp::datadriven::DataSourceSplitting;
+using sgpp::datadriven::Dataset;
+
+namespace {
+
+/**
+ * Reads all batches of several epochs and concatenates their targets and data.
+ */
+std::vector<double> readEpochs(size_t prefetchDepth, size_t epochs, size_t& numberBatches) {
+  DataSourceConfig config;
+  config.filePath = "datadriven/datasets/liver/liver-disorders_normalized.arff";
+  config.batchSize = 16;
+  config.numBatches = 100;
+  config.validationPortion = 0.2;
+  config.prefetchDepth = prefetchDepth;
+
+  DataSourceSplitting dataSource(config, new ArffFileSampleProvider());
+  std::vector<double> values;
+  numberBatches = 0;
+
+  for (size_t epoch = 0; epoch < epochs; epoch++) {
+    dataSource.reset();
+    Dataset* validationData = dataSource.getValidationData();
+    values.insert(values.end(), validationData->getTargets().begin(),
+                  validationData->getTargets().end());
+
+    while (true) {
+      std::unique_ptr<Dataset> dataset(dataSource.getNextSamples());
+
+      if (dataset->getNumberInstances() == 0) {
+        break;
+      }
+
+      values.insert(values.end(), dataset->getData().begin(), dataset->getData().end());
+      values.insert(values.end(), dataset->getTargets().begin(), dataset->getTargets().end());
+      numberBatches++;
+    }
+  }
+
+  // stop in the middle of an epoch to check that the prefetching thread is shut down
+  dataSource.reset();
+  std::unique_ptr<Dataset> dataset(dataSource.getNextSamples());
+  BOOST_CHECK_EQUAL(dataset->getNumberInstances(), config.batchSize);
+
+  return values;
+}
+
+/**
+ * Reads the validation data and the first batches of every fold (as
+ * SparseGridMinerCrossValidation does, the data source is reset after selecting the fold).
+ */
+std::vector<double> readFolds(size_t prefetchDepth) {
+  DataSourceConfig config;
+  config.filePath = "datadriven/datasets/liver/liver-disorders_normalized.arff";
+  config.batchSize = 16;
+  config.numBatches = 100;
+  config.prefetchDepth = prefetchDepth;
+
+  CrossvalidationConfiguration crossValidationConfig;
+  crossValidationConfig.kfold_ = 3;
+  DataShufflingFunctorSequential sequentialShuffling;
+  DataShufflingFunctorCrossValidation shuffling(crossValidationConfig, &sequentialShuffling);
+  DataSourceCrossValidation dataSource(config, crossValidationConfig, &shuffling,
+                                       new ArffFileSampleProvider(&shuffling));
+  std::vector<double> values;
+
+  for (size_t fold = 0; fold < crossValidationConfig.kfold_; fold++) {
+    dataSource.setFold(fold);
+    dataSource.reset();
+    Dataset* validationData = dataSource.getValidationData();
+    values.insert(values.end(), validationData->getTargets().begin(),
+                  validationData->getTargets().end());
+
+    // stop after a few batches, i.e., the next fold has to start from the beginning
+    for (size_t batch = 0; batch < 3; batch++) {
+      std::unique_ptr<Dataset> dataset(dataSource.getNextSamples());
+      values.insert(values.end(), dataset->getTargets().begin(), dataset->getTargets().end());
+    }
+  }
+
+  return values;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(dataminingDataSourcePrefetchTest)
+
+BOOST_AUTO_TEST_CASE(testPrefetchMatchesSynchronous) {
+  size_t expectedBatches = 0;
+  const std::vector<double> expected = readEpochs(0, 2, expectedBatches);
+  BOOST_CHECK_GT(expectedBatches, 10);
+
+  for (size_t prefetchDepth : {1, 3}) {
+    size_t numberBatches = 0;
+    const std::vector<double> actual = readEpochs(prefetchDepth, 2, numberBatches);
+    BOOST_CHECK_EQUAL(numberBatches, expectedBatches);
+    BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), actual.begin(), actual.end());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPrefetchCrossValidationFolds) {
+  const std::vector<double> expected = readFolds(0);
+  const std::vector<double> actual = readFolds(2);
+  BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), actual.begin(), actual.end());
+}
+
+BOOST_AUTO_TEST_CASE(testPrefetchAllSamples) {
+  // all samples are requested at once, i.e. there is only one batch to prefetch
+  DataSourceConfig config;
+  config.filePath = "datadriven/datasets/liver/liver-disorders_normalized.arff";
+  config.batchSize = 0;
+  config.numBatches = 1;
+  config.validationPortion = 0.2;
+
+  DataSourceSplitting synchronousSource(config, new ArffFileSampleProvider());
+  config.prefetchDepth = 2;
+  DataSourceSplitting prefetchingSource(config, new ArffFileSampleProvider());
+
+  synchronousSource.reset();
+  prefetchingSource.reset();
+  std::unique_ptr<Dataset> expected(synchronousSource.getNextSamples());
+  std::unique_ptr<Dataset> actual(prefetchingSource.getNextSamples());
+  BOOST_CHECK_GT(actual->getNumberInstances(), 0);
+  BOOST_CHECK_EQUAL_COLLECTIONS(expected->getTargets().begin(), expected->getTargets().end(),
+                                actual->getTargets().begin(), actual->getTargets().end());
+  BOOST_CHECK_EQUAL(prefetchingSource.getCurrentIteration(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,194 @@
+/* Copyright (C) 2008-today The SG++ project
+ * This file is part of the SG++ project. For conditions of distribution and
+ * use, please see the copyright notice provided with SG++ or at
+ * sgpp.sparsegrids.org
+ *
+ * dataminingScorerTest.cpp
+ */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBaseSingleGrid.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/MSE.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/NegativeLogLikelihood.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/Scorer.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/ScorerConfig.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::MSE;
+using sgpp::datadriven::ModelFittingBaseSingleGrid;
+using sgpp::datadriven::NegativeLogLikelihood;
+using sgpp::datadriven::Scorer;
+using sgpp::datadriven::ScorerConfiguration;
+
+namespace {
+
+/**
+ * Sparse grid function with given surpluses that counts its (complete) evaluations.
+ */
+class SurplusExpansionModel : public ModelFittingBaseSingleGrid {
+ public:
+  SurplusExpansionModel() : numEvaluations{0} {
+    grid.reset(Grid::createLinearGrid(2));
+    grid->getGenerator().regular(4);
+    alpha = DataVector{grid->getSize()};
+
+    for (size_t i = 0; i < alpha.size(); i++) {
+      alpha[i] = 1.0 + 0.5 * std::sin(static_cast<double>(i));
+    }
+  }
+
+  void fit(Dataset& dataset) override {}
+
+  bool refine() override {
+    sgpp::base::SurplusRefinementFunctor functor(alpha, 3);
+    grid->getGenerator().refine(functor);
+    alpha.resizeZero(grid->getSize());
+    return true;
+  }
+
+  void update(Dataset& dataset) override {}
+
+  double evaluate(const DataVector& sample) override {
+    throw sgpp::base::not_implemented_exception("not needed");
+  }
+
+  void evaluate(DataMatrix& samples, DataVector& results) override {
+    numEvaluations++;
+    std::unique_ptr<sgpp::base::OperationMultipleEval> opEval(
+        sgpp::op_factory::createOperationMultipleEval(*grid, samples));
+    opEval->mult(alpha, results);
+  }
+
+  void reset() override {}
+
+  bool isSurplusExpansion() const override { return true; }
+
+  size_t numEvaluations;
+};
+
+Dataset createDataset(size_t numInstances) {
+  Dataset dataset{numInstances, 2};
+  std::mt19937 generator(17);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t i = 0; i < numInstances; i++) {
+    const double x = distribution(generator);
+    const double y = distribution(generator);
+    dataset.getData().set(i, 0, x);
+    dataset.getData().set(i, 1, y);
+    dataset.getTargets()[i] = std::sin(3.0 * x) * y;
+  }
+
+  return dataset;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(dataminingScorerTest)
+
+BOOST_AUTO_TEST_CASE(testCachedValidationScore) {
+  Dataset validation = createDataset(2000);
+  SurplusExpansionModel model;
+
+  ScorerConfiguration config;
+  config.cachePredictions = true;
+  config.incrementalUpdateThreshold = 0.2;
+  Scorer scorer{new MSE{}, config};
+  Scorer reference{new MSE{}};
+
+  // first scoring evaluates the model
+  double score = scorer.testValidation(model, validation);
+  BOOST_CHECK_EQUAL(model.numEvaluations, 1);
+  BOOST_CHECK_CLOSE(score, reference.test(model, validation), 1e-10);
+
+  // unchanged model
+  model.numEvaluations = 0;
+  BOOST_CHECK_EQUAL(scorer.testValidation(model, validation), score);
+  BOOST_CHECK_EQUAL(model.numEvaluations, 0);
+
+  // single changed surplus
+  model.getSurpluses()[3] += 0.25;
+  score = scorer.testValidation(model, validation);
+  BOOST_CHECK_EQUAL(model.numEvaluations, 0);
+  BOOST_CHECK_CLOSE(score, reference.test(model, validation), 1e-10);
+
+  // refined grid, only the new points get surpluses
+  const size_t oldSize = model.getGrid().getSize();
+  model.refine();
+  BOOST_REQUIRE_GT(model.getGrid().getSize(), oldSize);
+
+  for (size_t i = oldSize; i < model.getGrid().getSize(); i++) {
+    model.getSurpluses()[i] = 0.1;
+  }
+
+  model.numEvaluations = 0;
+  score = scorer.testValidation(model, validation);
+  BOOST_CHECK_EQUAL(model.numEvaluations, 0);
+  BOOST_CHECK_CLOSE(score, reference.test(model, validation), 1e-10);
+
+  // all surpluses changed
+  model.getSurpluses().mult(0.5);
+  model.numEvaluations = 0;
+  score = scorer.testValidation(model, validation);
+  BOOST_CHECK_EQUAL(model.numEvaluations, 1);
+  BOOST_CHECK_CLOSE(score, reference.test(model, validation), 1e-10);
+
+  double lower, upper;
+  scorer.getConfidenceInterval(lower, upper);
+  BOOST_CHECK_EQUAL(lower, score);
+  BOOST_CHECK_EQUAL(upper, score);
+}
+
+BOOST_AUTO_TEST_CASE(testSubsampledValidationScore) {
+  Dataset validation = createDataset(20000);
+  SurplusExpansionModel model;
+
+  ScorerConfiguration config;
+  config.subsampleSize = 2000;
+  config.randomSeed = 42;
+  config.confidenceLevel = 0.99;
+
+  // mean based metric
+  Scorer scorerMSE{new MSE{}, config};
+  Scorer referenceMSE{new MSE{}};
+  double score = scorerMSE.testValidation(model, validation);
+  double exactScore = referenceMSE.test(model, validation);
+  double lower, upper;
+  scorerMSE.getConfidenceInterval(lower, upper);
+  BOOST_CHECK_LT(lower, score);
+  BOOST_CHECK_GT(upper, score);
+  BOOST_CHECK_LE(lower, exactScore);
+  BOOST_CHECK_GE(upper, exactScore);
+
+  // the subsample is fixed
+  BOOST_CHECK_EQUAL(scorerMSE.testValidation(model, validation), score);
+
+  // additive metric, the score is extrapolated to the whole validation set
+  Scorer scorerNLL{new NegativeLogLikelihood{}, config};
+  Scorer referenceNLL{new NegativeLogLikelihood{}};
+  score = scorerNLL.testValidation(model, validation);
+  exactScore = referenceNLL.test(model, validation);
+  scorerNLL.getConfidenceInterval(lower, upper);
+  BOOST_CHECK_LE(lower, exactScore);
+  BOOST_CHECK_GE(upper, exactScore);
+  BOOST_CHECK_CLOSE(score, exactScore, 5.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,154 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/ParallelDatasetReader.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using sgpp::datadriven::ARFFTools;
+using sgpp::datadriven::CSVTools;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::ParallelDatasetReader;
+
+namespace {
+
+void checkDatasetsEqual(Dataset& expected, Dataset& actual, bool hasTargets) {
+  BOOST_REQUIRE_EQUAL(expected.getNumberInstances(), actual.getNumberInstances());
+  BOOST_REQUIRE_EQUAL(expected.getDimension(), actual.getDimension());
+
+  for (size_t i = 0; i < expected.getData().getSize(); i++) {
+    BOOST_CHECK_EQUAL(expected.getData()[i], actual.getData()[i]);
+  }
+
+  if (hasTargets) {
+    for (size_t i = 0; i < expected.getNumberInstances(); i++) {
+      BOOST_CHECK_EQUAL(expected.getTargets()[i], actual.getTargets()[i]);
+    }
+  }
+}
+
+/**
+ * Writes a CSV file that is large enough to be split into several chunks.
+ */
+void writeRandomCSV(const std::string& filename, size_t numberInstances) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1e3, 1e3);
+  std::ofstream fout(filename.c_str());
+
+  fout << "x0,x1,x2,x3,class\n";
+
+  for (size_t i = 0; i < numberInstances; i++) {
+    fout << std::setprecision(static_cast<int>(6 + i % 12)) << distribution(generator) << ","
+         << std::scientific << distribution(generator) * 1e-9 << std::defaultfloat << ","
+         << static_cast<int>(distribution(generator)) << "," << std::setprecision(17)
+         << distribution(generator) << "," << ((i % 3 == 0) ? "-1" : "1")
+         << ((i % 7 == 0) ? "\r\n" : "\n");
+
+    if (i % 1000 == 0) {
+      fout << "\n";
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(parallelDatasetReaderTest)
+
+BOOST_AUTO_TEST_CASE(testParseDouble) {
+  const std::vector<std::string> numbers = {
+      "0",           "-0.0",       "1",        "+1.5",        "  -2.25",      "3.14159265358979",
+      "1e10",        "1E-10",      "-4.5e+3",  ".5",          "7.",           "0.000123456789",
+      "123456789012345678901234", "0.1234567890123456789", "1e-320", "2.2250738585072014e-308",
+      "1.7976931348623157e308",    "12abc",    "9.75e",       "1.5e+"};
+
+  for (const std::string& number : numbers) {
+    const double expected = std::strtod(number.c_str(), nullptr);
+    const double actual = ParallelDatasetReader::parseDouble(number.data(),
+                                                             number.data() + number.size());
+    BOOST_CHECK_EQUAL(expected, actual);
+  }
+
+  // out of range numbers are +-inf or zero instead of the largest finite value
+  const std::string overflow = "1e400";
+  const std::string negativeOverflow = "-123456789012345678901234e300";
+  const std::string underflow = "1e-400";
+  BOOST_CHECK_EQUAL(
+      ParallelDatasetReader::parseDouble(overflow.data(), overflow.data() + overflow.size()),
+      std::numeric_limits<double>::infinity());
+  BOOST_CHECK_EQUAL(ParallelDatasetReader::parseDouble(
+                        negativeOverflow.data(), negativeOverflow.data() + negativeOverflow.size()),
+                    -std::numeric_limits<double>::infinity());
+  BOOST_CHECK_EQUAL(
+      ParallelDatasetReader::parseDouble(underflow.data(), underflow.data() + underflow.size()),
+      0.0);
+
+  const std::string nominal = "Iris-setosa";
+  BOOST_CHECK_EQUAL(
+      ParallelDatasetReader::parseDouble(nominal.data(), nominal.data() + nominal.size()), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(testReadCSV) {
+  const std::string filename = "parallelDatasetReaderTest.csv";
+  writeRandomCSV(filename, 20000);
+
+  Dataset expected = CSVTools::readCSVFromFile(filename, true, true);
+  Dataset actual = ParallelDatasetReader::readCSVFromFile(filename, true, true);
+  checkDatasetsEqual(expected, actual, true);
+
+  // column selection, target filter and cutoff
+  std::vector<size_t> selectedCols = {3, 0};
+  std::vector<double> selectedTargets = {-1.0};
+  expected = CSVTools::readCSVFromFile(filename, true, true, 5000, selectedCols, selectedTargets);
+  actual = ParallelDatasetReader::readCSVFromFile(filename, true, true, 5000, selectedCols,
+                                                  selectedTargets);
+  checkDatasetsEqual(expected, actual, true);
+
+  // no targets
+  expected = CSVTools::readCSVFromFile(filename, true, false);
+  actual = ParallelDatasetReader::readCSVFromFile(filename, true, false);
+  checkDatasetsEqual(expected, actual, false);
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testReadARFF) {
+  const std::string datasetPath = "datadriven/datasets/liver/liver-disorders_normalized.arff";
+
+  Dataset expected = ARFFTools::readARFFFromFile(datasetPath, true);
+  Dataset actual = ParallelDatasetReader::readARFFFromFile(datasetPath, true);
+  checkDatasetsEqual(expected, actual, true);
+
+  std::vector<double> selectedTargets = {1.0};
+  expected = ARFFTools::readARFFFromFile(datasetPath, true, 50, std::vector<size_t>(),
+                                         selectedTargets);
+  actual = ParallelDatasetReader::readARFFFromFile(datasetPath, true, 50, std::vector<size_t>(),
+                                                   selectedTargets);
+  checkDatasetsEqual(expected, actual, true);
+}
+
+BOOST_AUTO_TEST_CASE(testMissingColumns) {
+  const std::string content = "@RELATION test\n@DATA\n0.1,0.2,1\n0.3,1\n";
+  BOOST_CHECK_THROW(ParallelDatasetReader::readARFFFromString(content, true),
+                    sgpp::base::file_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,199 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalPlan.hpp>
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridPoint;
+using sgpp::base::GridStorage;
+using sgpp::base::OperationMultipleEval;
+using sgpp::datadriven::OperationMultiEvalStreaming;
+using sgpp::datadriven::OperationMultipleEvalConfiguration;
+using sgpp::datadriven::OperationMultipleEvalPlan;
+
+namespace {
+
+DataMatrix createDataset(size_t numDataPoints, size_t dim) {
+  DataMatrix dataset(numDataPoints, dim);
+  std::mt19937 generator(23);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t i = 0; i < numDataPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset(i, d) = distribution(generator);
+    }
+  }
+
+  return dataset;
+}
+
+void checkMult(Grid& grid, DataMatrix& dataset, OperationMultipleEval& op) {
+  DataVector alpha(grid.getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = std::sin(static_cast<double>(i));
+  }
+
+  DataVector source(dataset.getNrows());
+
+  for (size_t i = 0; i < source.getSize(); i++) {
+    source[i] = std::cos(static_cast<double>(i));
+  }
+
+  // the naive kernel does not require the grid to contain the hierarchical ancestors
+  std::unique_ptr<OperationMultipleEval> opReference(
+      sgpp::op_factory::createOperationMultipleEvalNaive(grid, dataset));
+  DataVector result(dataset.getNrows());
+  DataVector resultReference(dataset.getNrows());
+  op.mult(alpha, result);
+  opReference->mult(alpha, resultReference);
+
+  for (size_t i = 0; i < result.getSize(); i++) {
+    BOOST_CHECK_SMALL(result[i] - resultReference[i], 1e-10);
+  }
+
+  DataVector resultTranspose(grid.getSize());
+  DataVector resultTransposeReference(grid.getSize());
+  op.multTranspose(source, resultTranspose);
+  opReference->multTranspose(source, resultTransposeReference);
+
+  for (size_t i = 0; i < resultTranspose.getSize(); i++) {
+    BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeReference[i], 1e-10);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestStreamingPlan)
+
+BOOST_AUTO_TEST_CASE(ReusePlan) {
+  const size_t dim = 3;
+  // not a multiple of the block size, i.e. the dataset is padded
+  DataMatrix dataset = createDataset(1001, dim);
+  DataMatrix otherDataset = createDataset(100, dim);
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(3);
+
+  auto plan = std::make_shared<OperationMultipleEvalPlan>();
+  OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+  configuration.setPlan(plan);
+
+  std::unique_ptr<OperationMultiEvalStreaming> op(dynamic_cast<OperationMultiEvalStreaming*>(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration)));
+  BOOST_REQUIRE(op != nullptr);
+  checkMult(*grid, dataset, *op);
+  BOOST_CHECK_EQUAL(plan->getNumDatasetPreparations(), 1);
+  BOOST_CHECK_EQUAL(plan->getNumGridPreparations(), 1);
+  BOOST_CHECK_EQUAL(plan->getNumComputations(), 2);
+  BOOST_CHECK_GE(plan->getComputeDuration(), 0.0);
+
+  // refinement only computes the levels and indices of the new grid points
+  DataVector refinementAlpha(grid->getSize());
+
+  for (size_t i = 0; i < refinementAlpha.getSize(); i++) {
+    refinementAlpha[i] = static_cast<double>(i % 7);
+  }
+
+  sgpp::base::SurplusRefinementFunctor functor(refinementAlpha, 5);
+  grid->getGenerator().refine(functor);
+  op->prepare();
+  checkMult(*grid, dataset, *op);
+  BOOST_CHECK_EQUAL(plan->getNumDatasetPreparations(), 1);
+  BOOST_CHECK_EQUAL(plan->getNumGridPreparations(), 1);
+  BOOST_CHECK_EQUAL(plan->getNumIncrementalGridPreparations(), 1);
+
+  // a new operation for the same dataset reuses the plan
+  op.reset(dynamic_cast<OperationMultiEvalStreaming*>(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration)));
+  checkMult(*grid, dataset, *op);
+  BOOST_CHECK_EQUAL(plan->getNumDatasetPreparations(), 1);
+  BOOST_CHECK_EQUAL(plan->getNumGridPreparations(), 1);
+  BOOST_CHECK_EQUAL(plan->getNumIncrementalGridPreparations(), 1);
+  BOOST_CHECK_EQUAL(plan->getNumComputations(), 6);
+
+  // an operation for another dataset uses its own plan
+  std::unique_ptr<OperationMultipleEval> otherOp(
+      sgpp::op_factory::createOperationMultipleEval(*grid, otherDataset, configuration));
+  checkMult(*grid, otherDataset, *otherOp);
+  BOOST_CHECK(dynamic_cast<OperationMultiEvalStreaming&>(*otherOp).getPlan() != plan);
+  BOOST_CHECK_EQUAL(plan->getNumDatasetPreparations(), 1);
+  BOOST_CHECK_EQUAL(plan->getNumComputations(), 6);
+
+  // grid changes that keep the number of grid points are detected
+  GridStorage& storage = grid->getStorage();
+  GridPoint point(storage.getPoint(storage.getSize() - 1));
+  storage.deleteLast();
+  point.set(0, 10, 1);
+  storage.insert(point);
+  op->prepare();
+  checkMult(*grid, dataset, *op);
+  BOOST_CHECK_EQUAL(plan->getNumGridPreparations(), 2);
+  BOOST_CHECK_EQUAL(plan->getNumIncrementalGridPreparations(), 1);
+
+  // an operation for another grid uses its own plan, the operations sharing the plan stay valid
+  std::unique_ptr<Grid> otherGrid(Grid::createLinearGrid(dim));
+  otherGrid->getGenerator().regular(2);
+  std::unique_ptr<OperationMultipleEval> otherGridOp(
+      sgpp::op_factory::createOperationMultipleEval(*otherGrid, dataset, configuration));
+  checkMult(*otherGrid, dataset, *otherGridOp);
+  BOOST_CHECK(dynamic_cast<OperationMultiEvalStreaming&>(*otherGridOp).getPlan() != plan);
+  BOOST_CHECK_THROW(plan->prepareGrid(otherGrid->getStorage()), sgpp::base::operation_exception);
+  BOOST_CHECK_THROW(plan->prepareDataset(otherDataset, op->getChunkDataPoints()),
+                    sgpp::base::operation_exception);
+  checkMult(*grid, dataset, *op);
+  BOOST_CHECK_EQUAL(plan->getNumGridPreparations(), 2);
+
+  // invalidated plans are rebuilt
+  plan->invalidate();
+  plan->resetStatistics();
+  op->prepare();
+  checkMult(*grid, dataset, *op);
+  BOOST_CHECK_EQUAL(plan->getNumDatasetPreparations(), 1);
+  BOOST_CHECK_EQUAL(plan->getNumGridPreparations(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(PrivatePlan) {
+  const size_t dim = 2;
+  DataMatrix dataset = createDataset(100, dim);
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(3);
+
+  // operations without a shared plan rebuild their plan in every prepare()
+  OperationMultiEvalStreaming op(*grid, dataset);
+  checkMult(*grid, dataset, op);
+
+  for (size_t i = 0; i < dataset.getNrows(); i++) {
+    dataset(i, 0) = 1.0 - dataset(i, 0);
+  }
+
+  op.prepare();
+  checkMult(*grid, dataset, op);
+  BOOST_CHECK_EQUAL(op.getPlan()->getNumDatasetPreparations(), 2);
+  BOOST_CHECK_EQUAL(op.getPlan()->getNumGridPreparations(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
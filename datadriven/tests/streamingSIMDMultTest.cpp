@@ -0,0 +1,58 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+
+#define BOOST_TEST_DYN_LINK
+#include <zlib.h>
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "sgpp/base/operation/hash/OperationMultipleEval.hpp"
+#include "sgpp/datadriven/DatadrivenOpFactory.hpp"
+#include "sgpp/globaldef.hpp"
+#include "test_datadrivenCommon.hpp"
+
+namespace TestStreamingSIMDMultFixture {
+struct FilesNamesAndErrorFixture {
+  FilesNamesAndErrorFixture() {}
+  ~FilesNamesAndErrorFixture() {}
+
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDouble = {
+      std::tuple<std::string, double>(
+        "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-24),
+      std::tuple<std::string, double>(
+        "datadriven/datasets/friedman/friedman1_10d_2000.arff.gz", 1E-21)};
+
+  uint32_t level = 5;
+
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration =
+      sgpp::datadriven::OperationMultipleEvalConfiguration(
+          sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+          sgpp::datadriven::OperationMultipleEvalSubType::SIMD);
+};
+}  // namespace TestStreamingSIMDMultFixture
+
+BOOST_FIXTURE_TEST_SUITE(TestStreamingSIMDMult,
+                         TestStreamingSIMDMultFixture::FilesNamesAndErrorFixture)
+
+BOOST_AUTO_TEST_CASE(Linear) {
+  compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::Linear, level, configuration);
+}
+
+BOOST_AUTO_TEST_CASE(ModLinear) {
+  compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::ModLinear, level, configuration);
+}
+
+BOOST_AUTO_TEST_CASE(LinearBoundary) {
+  compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::LinearBoundary, level, configuration);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
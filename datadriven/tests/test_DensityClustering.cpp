@@ -0,0 +1,121 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationCreateGraph.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationPruneGraph.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename T>
+std::vector<T> readValues(const std::string& fileName) {
+  std::vector<T> values;
+  std::ifstream in(fileName);
+
+  if (!in) {
+    BOOST_THROW_EXCEPTION(std::runtime_error(fileName + " is missing!"));
+  }
+
+  T value;
+
+  while (in >> value) {
+    values.push_back(value);
+  }
+
+  return values;
+}
+
+const char DATASET_PATH[] = "datadriven/datasets/clustering_test_data/";
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestDensityClustering)
+
+BOOST_AUTO_TEST_CASE(KNNGraph) {
+  std::vector<int> graphOptimal =
+      readValues<int>(std::string(DATASET_PATH) + "graph_erg_dim2_depth11.txt");
+
+  sgpp::datadriven::Dataset data = sgpp::datadriven::ARFFTools::readARFFFromFile(
+      std::string(DATASET_PATH) + "clustering_testdataset_dim2.arff", false);
+  sgpp::base::DataMatrix& dataset = data.getData();
+
+  const size_t k = 8;
+  std::unique_ptr<sgpp::datadriven::OperationCreateGraph> opGraph(
+      sgpp::op_factory::createOperationCreateGraph(dataset, k));
+
+  std::vector<int> graph;
+  opGraph->createGraph(graph);
+  BOOST_REQUIRE_EQUAL(graph.size(), graphOptimal.size());
+
+  // the neighbors are sorted by distance, the reference graph is not
+  for (size_t i = 0; i < dataset.getNrows(); i++) {
+    std::vector<int> neighbors(graph.begin() + i * k, graph.begin() + (i + 1) * k);
+    std::vector<int> neighborsOptimal(graphOptimal.begin() + i * k,
+                                      graphOptimal.begin() + (i + 1) * k);
+    std::sort(neighbors.begin(), neighbors.end());
+    std::sort(neighborsOptimal.begin(), neighborsOptimal.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(neighbors.begin(), neighbors.end(), neighborsOptimal.begin(),
+                                  neighborsOptimal.end());
+  }
+
+  // chunks have to yield the same graph
+  const size_t startid = 1000;
+  const size_t chunksize = 777;
+  std::vector<int> chunk;
+  opGraph->createGraph(chunk, startid, chunksize);
+  BOOST_CHECK_EQUAL_COLLECTIONS(chunk.begin(), chunk.end(), graph.begin() + startid * k,
+                                graph.begin() + (startid + chunksize) * k);
+}
+
+BOOST_AUTO_TEST_CASE(KNNPruneGraph) {
+  std::vector<int> graph =
+      readValues<int>(std::string(DATASET_PATH) + "graph_erg_dim2_depth11.txt");
+  std::vector<int> graphOptimal =
+      readValues<int>(std::string(DATASET_PATH) + "graph_pruned_erg_dim2_depth11.txt");
+  std::vector<double> alphaValues =
+      readValues<double>(std::string(DATASET_PATH) + "alpha_erg_dim2_depth11.txt");
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(11);
+  BOOST_REQUIRE_EQUAL(alphaValues.size(), grid->getSize());
+  sgpp::base::DataVector alpha(alphaValues);
+
+  sgpp::datadriven::Dataset data = sgpp::datadriven::ARFFTools::readARFFFromFile(
+      std::string(DATASET_PATH) + "clustering_testdataset_dim2.arff", false);
+  sgpp::base::DataMatrix& dataset = data.getData();
+
+  std::unique_ptr<sgpp::datadriven::OperationPruneGraph> opPrune(
+      sgpp::op_factory::createOperationPruneGraph(*grid, alpha, dataset, 0.2, 8));
+  opPrune->pruneGraph(graph);
+  BOOST_CHECK_EQUAL_COLLECTIONS(graph.begin(), graph.end(), graphOptimal.begin(),
+                                graphOptimal.end());
+}
+
+BOOST_AUTO_TEST_CASE(KNNClusterSearch) {
+  std::vector<int> graph =
+      readValues<int>(std::string(DATASET_PATH) + "graph_pruned_erg_dim2_depth11.txt");
+  std::vector<size_t> clustersOptimal =
+      readValues<size_t>(std::string(DATASET_PATH) + "cluster_erg.txt");
+
+  std::vector<size_t> clusters = sgpp::datadriven::OperationCreateGraph::findClusters(graph, 8);
+  BOOST_CHECK_EQUAL_COLLECTIONS(clusters.begin(), clusters.end(), clustersOptimal.begin(),
+                                clustersOptimal.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,98 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/application/KernelDensityEstimator.hpp>
+
+#include <cmath>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::BandwidthOptimizationType;
+using sgpp::datadriven::KernelDensityEstimator;
+using sgpp::datadriven::KernelType;
+
+namespace {
+
+void testTreeEvaluation(KernelType kernelType, double tolerance) {
+  const size_t numDims = 3;
+  const size_t numSamples = 2000;
+  const size_t numPoints = 200;
+
+  std::mt19937_64 generator(1234);
+  std::normal_distribution<double> normal(0.5, 0.15);
+  std::uniform_real_distribution<double> uniform(-0.2, 1.2);
+
+  DataMatrix samples(numSamples, numDims);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    for (size_t j = 0; j < numDims; j++) {
+      // two clusters to get a non-trivial tree
+      samples.set(i, j, normal(generator) * ((i % 2 == 0) ? 1.0 : 0.3) + ((j == 0) ? 0.1 : 0.0));
+    }
+  }
+
+  DataMatrix points(numPoints, numDims);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    for (size_t j = 0; j < numDims; j++) {
+      points.set(i, j, uniform(generator));
+    }
+  }
+
+  KernelDensityEstimator kde(samples, kernelType, BandwidthOptimizationType::SILVERMANSRULE);
+  DataVector exact;
+  kde.pdf(points, exact);
+
+  kde.setEvaluationTolerance(tolerance);
+  BOOST_CHECK_EQUAL(kde.getEvaluationTolerance(), tolerance);
+
+  DataVector approximated;
+  kde.pdf(points, approximated);
+
+  DataVector x(numDims);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    BOOST_CHECK_LE(std::abs(approximated[i] - exact[i]), tolerance * exact[i] + 1e-14);
+
+    points.getRow(i, x);
+    BOOST_CHECK_EQUAL(kde.pdf(x), approximated[i]);
+  }
+
+  // the tree has to be rebuilt when the conditionalization factors change
+  DataVector pcond(numSamples);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    pcond[i] = (i % 3 == 0) ? 2.0 : 0.5;
+  }
+
+  kde.setConditionalizationFactor(pcond);
+  kde.pdf(points, approximated);
+  kde.setEvaluationTolerance(0.0);
+  kde.pdf(points, exact);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    BOOST_CHECK_LE(std::abs(approximated[i] - exact[i]), tolerance * exact[i] + 1e-14);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testKernelDensityEstimator)
+
+BOOST_AUTO_TEST_CASE(testTreeEvaluationGaussian) {
+  testTreeEvaluation(KernelType::GAUSSIAN, 1e-3);
+}
+
+BOOST_AUTO_TEST_CASE(testTreeEvaluationEpanechnikov) {
+  testTreeEvaluation(KernelType::EPANECHNIKOV, 1e-3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,117 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/application/LearnerLeastSquaresIdentity.hpp>
+#include <sgpp/solver/TypesSolver.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::LearnerLeastSquaresIdentity;
+
+namespace {
+
+void createDataset(size_t numInstances, std::mt19937& generator, DataMatrix& data,
+                   DataVector& targets) {
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  std::normal_distribution<double> noise(0.0, 0.05);
+  data.resizeRowsCols(numInstances, 2);
+  targets.resize(numInstances);
+
+  for (size_t i = 0; i < numInstances; i++) {
+    const double x = distribution(generator);
+    const double y = distribution(generator);
+    data.set(i, 0, x);
+    data.set(i, 1, y);
+    targets[i] = std::sin(3.0 * x) * y + noise(generator);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestLearnerLeastSquaresIdentity)
+
+BOOST_AUTO_TEST_CASE(testRegularizationPath) {
+  std::mt19937 generator(42);
+  DataMatrix trainData;
+  DataVector trainTargets;
+  DataMatrix validationData;
+  DataVector validationTargets;
+  createDataset(400, generator, trainData, trainTargets);
+  createDataset(150, generator, validationData, validationTargets);
+
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = 2;
+  gridConfig.level_ = 4;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+
+  sgpp::solver::SLESolverConfiguration solverConfig;
+  solverConfig.type_ = sgpp::solver::SLESolverType::CG;
+  solverConfig.eps_ = 1e-12;
+  solverConfig.maxIterations_ = 2000;
+  solverConfig.threshold_ = -1.0;
+  solverConfig.verbose_ = false;
+
+  const std::vector<double> lambdas = {1e-6, 1e-4, 1e-2, 1.0};
+
+  LearnerLeastSquaresIdentity pathLearner(true, false);
+  std::vector<double> errors =
+      pathLearner.trainRegularizationPath(trainData, trainTargets, validationData,
+                                          validationTargets, gridConfig, solverConfig, lambdas);
+  BOOST_REQUIRE_EQUAL(errors.size(), lambdas.size());
+
+  // every regularization parameter has to give the same model as an independent training
+  size_t bestIndex = 0;
+  DataVector bestAlpha;
+
+  for (size_t k = 0; k < lambdas.size(); k++) {
+    LearnerLeastSquaresIdentity learner(true, false);
+    learner.train(trainData, trainTargets, gridConfig, solverConfig, lambdas[k]);
+
+    DataVector predictions(validationData.getNrows());
+    learner.predict(validationData, predictions);
+    double error = 0.0;
+
+    for (size_t i = 0; i < predictions.getSize(); i++) {
+      error += (predictions[i] - validationTargets[i]) * (predictions[i] - validationTargets[i]);
+    }
+
+    error /= static_cast<double>(predictions.getSize());
+    BOOST_CHECK_CLOSE(errors[k], error, 1e-4);
+
+    if (errors[k] < errors[bestIndex]) {
+      bestIndex = k;
+    }
+
+    if (bestIndex == k) {
+      bestAlpha = learner.getAlpha();
+    }
+  }
+
+  // the path learner keeps the model with the smallest validation error
+  DataVector& alpha = pathLearner.getAlpha();
+  BOOST_REQUIRE_EQUAL(alpha.getSize(), bestAlpha.getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    BOOST_CHECK_SMALL(alpha[i] - bestAlpha[i], 1e-6);
+  }
+
+  BOOST_CHECK_THROW(pathLearner.trainRegularizationPath(trainData, trainTargets, validationData,
+                                                        validationTargets, gridConfig,
+                                                        solverConfig, std::vector<double>()),
+                    sgpp::base::application_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -225,6 +225,8 @@ double compareToReference(sgpp::base::GridType gridType, const std::string& file
     grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(dim));
   } else if (gridType == sgpp::base::GridType::ModLinear) {
     grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(dim));
+  } else if (gridType == sgpp::base::GridType::LinearBoundary) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearBoundaryGrid(dim));
   }
 
   sgpp::base::GridStorage& gridStorage = grid->getStorage();
@@ -303,6 +305,8 @@ double compareToReferenceTranspose(
     grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(dim));
   } else if (gridType == sgpp::base::GridType::ModLinear) {
     grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(dim));
+  } else if (gridType == sgpp::base::GridType::LinearBoundary) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearBoundaryGrid(dim));
   }
 
   sgpp::base::GridStorage& gridStorage = grid->getStorage();
@@ -11,6 +11,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/optimization/function/scalar/ScalarFunction.hpp>
 
@@ -46,7 +47,7 @@ class InterpolantScalarFunction : public ScalarFunction {
   InterpolantScalarFunction(base::Grid& grid, const base::DataVector& alpha)
       : ScalarFunction(grid.getDimension()),
         grid(grid),
-        opEval(op_factory::createOperationEvalNaive(grid)),
+        opEval(createOperation(grid)),
         alpha(alpha) {}
 
   /**
@@ -88,6 +89,20 @@ class InterpolantScalarFunction : public ScalarFunction {
   void setAlpha(const base::DataVector& alpha) { this->alpha = alpha; }
 
  protected:
+  /**
+   * @param grid  sparse grid
+   * @return      operation that only evaluates the basis functions whose support contains
+   *              the evaluation point or, if the grid type does not support this,
+   *              the naive operation
+   */
+  static base::OperationEval* createOperation(base::Grid& grid) {
+    try {
+      return op_factory::createOperationEval(grid);
+    } catch (const base::factory_exception&) {
+      return op_factory::createOperationEvalNaive(grid);
+    }
+  }
+
   /// sparse grid
   base::Grid& grid;
   /// pointer to evaluation operation
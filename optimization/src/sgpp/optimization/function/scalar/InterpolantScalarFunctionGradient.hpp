@@ -10,6 +10,7 @@
 
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/optimization/function/scalar/ScalarFunctionGradient.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
@@ -35,7 +36,7 @@ class InterpolantScalarFunctionGradient : public ScalarFunctionGradient {
   InterpolantScalarFunctionGradient(base::Grid& grid, const base::DataVector& alpha)
       : ScalarFunctionGradient(grid.getDimension()),
         grid(grid),
-        opEvalGradient(op_factory::createOperationEvalGradientNaive(grid)),
+        opEvalGradient(createOperation(grid)),
         alpha(alpha) {}
 
   /**
@@ -80,6 +81,20 @@ class InterpolantScalarFunctionGradient : public ScalarFunctionGradient {
   void setAlpha(const base::DataVector& alpha) { this->alpha = alpha; }
 
  protected:
+  /**
+   * @param grid  sparse grid
+   * @return      operation that only evaluates the basis functions whose support contains
+   *              the evaluation point or, if the grid type does not support this,
+   *              the naive operation
+   */
+  static base::OperationEvalGradient* createOperation(base::Grid& grid) {
+    try {
+      return op_factory::createOperationEvalGradient(grid);
+    } catch (const base::factory_exception&) {
+      return op_factory::createOperationEvalGradientNaive(grid);
+    }
+  }
+
   /// sparse grid
   base::Grid& grid;
   /// pointer to evaluation operation
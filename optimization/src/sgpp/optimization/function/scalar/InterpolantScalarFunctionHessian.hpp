@@ -11,6 +11,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/optimization/function/scalar/ScalarFunctionHessian.hpp>
 #include <sgpp/base/operation/hash/OperationEvalHessian.hpp>
@@ -36,7 +37,7 @@ class InterpolantScalarFunctionHessian : public ScalarFunctionHessian {
   InterpolantScalarFunctionHessian(base::Grid& grid, const base::DataVector& alpha)
       : ScalarFunctionHessian(grid.getDimension()),
         grid(grid),
-        opEvalHessian(op_factory::createOperationEvalHessianNaive(grid)),
+        opEvalHessian(createOperation(grid)),
         alpha(alpha) {}
 
   /**
@@ -84,6 +85,20 @@ class InterpolantScalarFunctionHessian : public ScalarFunctionHessian {
   void setAlpha(const base::DataVector& alpha) { this->alpha = alpha; }
 
  protected:
+  /**
+   * @param grid  sparse grid
+   * @return      operation that only evaluates the basis functions whose support contains
+   *              the evaluation point or, if the grid type does not support this,
+   *              the naive operation
+   */
+  static base::OperationEvalHessian* createOperation(base::Grid& grid) {
+    try {
+      return op_factory::createOperationEvalHessian(grid);
+    } catch (const base::factory_exception&) {
+      return op_factory::createOperationEvalHessianNaive(grid);
+    }
+  }
+
   /// sparse grid
   base::Grid& grid;
   /// pointer to evaluation operation
@@ -12,6 +12,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/optimization/function/vector/VectorFunction.hpp>
 
@@ -48,7 +49,7 @@ class InterpolantVectorFunction : public VectorFunction {
   InterpolantVectorFunction(base::Grid& grid, const base::DataMatrix& alpha)
       : VectorFunction(grid.getDimension(), alpha.getNcols()),
         grid(grid),
-        opEval(op_factory::createOperationEvalNaive(grid)),
+        opEval(createOperation(grid)),
         alpha(alpha) {}
 
   /**
@@ -91,6 +92,20 @@ class InterpolantVectorFunction : public VectorFunction {
   void setAlpha(const base::DataMatrix& alpha) { this->alpha = alpha; }
 
  protected:
+  /**
+   * @param grid  sparse grid
+   * @return      operation that only evaluates the basis functions whose support contains
+   *              the evaluation point or, if the grid type does not support this,
+   *              the naive operation
+   */
+  static base::OperationEval* createOperation(base::Grid& grid) {
+    try {
+      return op_factory::createOperationEval(grid);
+    } catch (const base::factory_exception&) {
+      return op_factory::createOperationEvalNaive(grid);
+    }
+  }
+
   /// sparse grid
   base::Grid& grid;
   /// pointer to evaluation operation
@@ -12,6 +12,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/optimization/function/vector/VectorFunctionGradient.hpp>
 
@@ -40,7 +41,7 @@ class InterpolantVectorFunctionGradient : public VectorFunctionGradient {
   InterpolantVectorFunctionGradient(base::Grid& grid, const base::DataMatrix& alpha)
       : VectorFunctionGradient(grid.getDimension(), alpha.getNcols()),
         grid(grid),
-        opEvalGradient(op_factory::createOperationEvalGradientNaive(grid)),
+        opEvalGradient(createOperation(grid)),
         alpha(alpha) {}
 
   /**
@@ -87,6 +88,20 @@ class InterpolantVectorFunctionGradient : public VectorFunctionGradient {
   void setAlpha(const base::DataMatrix& alpha) { this->alpha = alpha; }
 
  protected:
+  /**
+   * @param grid  sparse grid
+   * @return      operation that only evaluates the basis functions whose support contains
+   *              the evaluation point or, if the grid type does not support this,
+   *              the naive operation
+   */
+  static base::OperationEvalGradient* createOperation(base::Grid& grid) {
+    try {
+      return op_factory::createOperationEvalGradient(grid);
+    } catch (const base::factory_exception&) {
+      return op_factory::createOperationEvalGradientNaive(grid);
+    }
+  }
+
   /// sparse grid
   base::Grid& grid;
   /// pointer to evaluation operation
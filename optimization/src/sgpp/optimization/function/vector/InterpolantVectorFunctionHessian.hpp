@@ -12,6 +12,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/optimization/function/vector/VectorFunctionHessian.hpp>
 
@@ -41,7 +42,7 @@ class InterpolantVectorFunctionHessian : public VectorFunctionHessian {
   InterpolantVectorFunctionHessian(base::Grid& grid, const base::DataMatrix& alpha)
       : VectorFunctionHessian(grid.getDimension(), alpha.getNcols()),
         grid(grid),
-        opEvalHessian(op_factory::createOperationEvalHessianNaive(grid)),
+        opEvalHessian(createOperation(grid)),
         alpha(alpha) {}
 
   /**
@@ -92,6 +93,20 @@ class InterpolantVectorFunctionHessian : public VectorFunctionHessian {
   void setAlpha(const base::DataMatrix& alpha) { this->alpha = alpha; }
 
  protected:
+  /**
+   * @param grid  sparse grid
+   * @return      operation that only evaluates the basis functions whose support contains
+   *              the evaluation point or, if the grid type does not support this,
+   *              the naive operation
+   */
+  static base::OperationEvalHessian* createOperation(base::Grid& grid) {
+    try {
+      return op_factory::createOperationEvalHessian(grid);
+    } catch (const base::factory_exception&) {
+      return op_factory::createOperationEvalHessianNaive(grid);
+    }
+  }
+
   /// sparse grid
   base::Grid& grid;
   /// pointer to evaluation operation
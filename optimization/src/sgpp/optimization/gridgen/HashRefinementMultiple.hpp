@@ -77,7 +77,7 @@ class HashRefinementMultiple : public base::HashRefinement {
       childIndex = sourceIndex;
       childLevel = sourceLevel;
 
-      while (storage.isContaining(point)) {
+      while (containsGridpoint(storage, point)) {
         childIndex *= 2;
         childLevel++;
         point.set(t, childLevel, childIndex - 1);
@@ -85,7 +85,7 @@ class HashRefinementMultiple : public base::HashRefinement {
 
       point.setLeaf(true);
       // instead of "createGridpoint(storage, index);"
-      storage.insert(point);
+      insertGridpoint(storage, point);
       point.set(t, sourceLevel, sourceIndex);
     }
 
@@ -96,7 +96,7 @@ class HashRefinementMultiple : public base::HashRefinement {
       childIndex = sourceIndex;
       childLevel = sourceLevel;
 
-      while (storage.isContaining(point)) {
+      while (containsGridpoint(storage, point)) {
         childIndex *= 2;
         childLevel++;
         point.set(t, childLevel, childIndex + 1);
@@ -104,7 +104,7 @@ class HashRefinementMultiple : public base::HashRefinement {
 
       point.setLeaf(true);
       // instead of "createGridpoint(storage, index);"
-      storage.insert(point);
+      insertGridpoint(storage, point);
       point.set(t, sourceLevel, sourceIndex);
     }
   }
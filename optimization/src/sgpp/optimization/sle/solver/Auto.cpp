@@ -106,17 +106,15 @@ bool Auto::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const {
     size_t nrows = 0;
     size_t nnz = 0;
     size_t inc = static_cast<size_t>(ESTIMATE_NNZ_ROWS_SAMPLE_SIZE * static_cast<double>(n)) + 1;
+    std::vector<size_t> columns;
+    std::vector<double> values;
 
     Printer::getInstance().printStatusUpdate("estimating sparsity pattern");
 
     for (size_t i = 0; i < n; i += inc) {
       nrows++;
-
-      for (size_t j = 0; j < n; j++) {
-        if (system.isMatrixEntryNonZero(i, j)) {
-          nnz++;
-        }
-      }
+      system.getMatrixRow(i, columns, values);
+      nnz += columns.size();
     }
 
     // calculate estimate ratio nonzero entries
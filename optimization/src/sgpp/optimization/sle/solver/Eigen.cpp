@@ -16,6 +16,7 @@
 #include <cstddef>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -89,21 +90,25 @@ bool Eigen::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const {
 
 #endif /* _OPENMP */
 
+    std::vector<size_t> columns;
+    std::vector<double> values;
+
 // copy system matrix to Eigen matrix object
 #pragma omp for ordered schedule(dynamic)
 
     for (size_t i = 0; i < n; i++) {
-      for (size_t j = 0; j < n; j++) {
-        A(i, j) = system2->getMatrixEntry(i, j);
+      // only the nonzero entries have to be copied (A is initialized with zeros)
+      system2->getMatrixRow(i, columns, values);
 
-        // count nonzero entries
-        // (not necessary, you can also remove that if you like)
-        if (A(i, j) != 0) {
-#pragma omp atomic
-          nnz++;
-        }
+      for (size_t k = 0; k < columns.size(); k++) {
+        A(i, columns[k]) = values[k];
       }
 
+      // count nonzero entries
+      // (not necessary, you can also remove that if you like)
+#pragma omp atomic
+      nnz += columns.size();
+
       // status message
       if (i % 100 == 0) {
 #pragma omp ordered
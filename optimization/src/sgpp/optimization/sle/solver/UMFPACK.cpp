@@ -93,22 +93,24 @@ bool UMFPACK::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const
 
 #endif /* _OPENMP */
 
+    std::vector<size_t> columns;
+    std::vector<double> values;
+
 // get indices and values of nonzero entries
 #pragma omp for ordered schedule(dynamic)
 
     for (uint32_t i = 0; i < n; i++) {
-      for (uint32_t j = 0; j < n; j++) {
-        double entry = system2->getMatrixEntry(i, j);
+      system2->getMatrixRow(i, columns, values);
 
-        if (entry != 0) {
 #pragma omp critical
-          {
-            Ti.push_back(i);
-            Tj.push_back(j);
-            Tx.push_back(entry);
-            nnz++;
-          }
+      {
+        for (size_t k = 0; k < columns.size(); k++) {
+          Ti.push_back(i);
+          Tj.push_back(static_cast<uint32_t>(columns[k]));
+          Tx.push_back(values[k]);
         }
+
+        nnz += columns.size();
       }
 
       // status message
@@ -8,6 +8,8 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <sgpp/base/algorithm/AlgorithmLocalSupportEvaluation.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/optimization/sle/system/CloneableSLE.hpp>
@@ -40,16 +42,23 @@
 #include <sgpp/base/grid/type/ModFundamentalSplineGrid.hpp>
 #include <sgpp/base/grid/type/NakBsplineBoundaryCombigridGrid.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
 
 /**
  * Linear system of the hierarchization in a sparse grid.
+ *
+ * The rows of the matrix are enumerated in \f$\mathcal{O}(\text{nnz})\f$ by visiting only
+ * the basis functions whose support contains the corresponding grid point
+ * (see base::AlgorithmLocalSupportEvaluation), such that the sparse solvers
+ * do not have to probe all \f$n^2\f$ entries.
  */
 class HierarchisationSLE : public CloneableSLE {
  public:
@@ -71,7 +80,11 @@ class HierarchisationSLE : public CloneableSLE {
    *                          grid points according to gridStorage)
    */
   HierarchisationSLE(base::Grid& grid, base::GridStorage& gridStorage)
-      : CloneableSLE(), grid(grid), gridStorage(gridStorage), basisType(INVALID) {
+      : CloneableSLE(),
+        grid(grid),
+        gridStorage(gridStorage),
+        basisType(INVALID),
+        point(gridStorage.getDimension()) {
     // initialize the correct basis (according to the grid)
     if (grid.getType() == base::GridType::Bspline) {
       bsplineBasis = std::unique_ptr<base::SBsplineBase>(
@@ -164,6 +177,89 @@ class HierarchisationSLE : public CloneableSLE {
     return evalBasisFunctionAtGridPoint(j, i);
   }
 
+  /**
+   * Retrieve the non-zero entries of a matrix row, i.e., the values of the basis functions
+   * whose support contains the i-th grid point.
+   *
+   * @param       i       row index
+   * @param[out]  columns column indices of the non-zero entries of the i-th row
+   *                      (in ascending order)
+   * @param[out]  values  corresponding matrix entries
+   */
+  void getMatrixRow(size_t i, std::vector<size_t>& columns, std::vector<double>& values) override {
+    if (!supportEnumerator) {
+      createSupportEnumerator();
+    }
+
+    const base::GridPoint& gp = gridStorage[i];
+
+    for (size_t t = 0; t < gridStorage.getDimension(); t++) {
+      // the not-a-knot B-splines are evaluated at the (non-unit) coordinates
+      point[t] = (basisType == NAK_BSPLINEBOUNDARY_COMBIGRID) ? gridStorage.getCoordinate(gp, t)
+                                                               : gridStorage.getUnitCoordinate(gp, t);
+    }
+
+    supportEnumerator->getAffectedBasisFunctions(point, candidates);
+    std::sort(candidates.begin(), candidates.end());
+
+    columns.clear();
+    values.clear();
+
+    for (size_t j : candidates) {
+      // evaluate in the same way as getMatrixEntry to obtain the exact same pattern
+      const double entry = evalBasisFunctionAtGridPoint(j, i);
+
+      if (entry != 0.0) {
+        columns.push_back(j);
+        values.push_back(entry);
+      }
+    }
+  }
+
+  /**
+   * Multiply the matrix with a vector in \f$\mathcal{O}(\text{nnz})\f$.
+   *
+   * @param       x   vector to be multiplied
+   * @param[out]  y   \f$y = Ax\f$
+   */
+  void matrixVectorMultiplication(const base::DataVector& x, base::DataVector& y) override {
+    const size_t n = getDimension();
+    std::vector<size_t> columns;
+    std::vector<double> values;
+
+    y.resize(n);
+
+    for (size_t i = 0; i < n; i++) {
+      getMatrixRow(i, columns, values);
+      double result = 0.0;
+
+      for (size_t k = 0; k < columns.size(); k++) {
+        result += values[k] * x[columns[k]];
+      }
+
+      y[i] = result;
+    }
+  }
+
+  /**
+   * Count all non-zero entries in \f$\mathcal{O}(\text{nnz})\f$.
+   *
+   * @return number of non-zero entries
+   */
+  size_t countNNZ() override {
+    const size_t n = getDimension();
+    std::vector<size_t> columns;
+    std::vector<double> values;
+    size_t nnz = 0;
+
+    for (size_t i = 0; i < n; i++) {
+      getMatrixRow(i, columns, values);
+      nnz += columns.size();
+    }
+
+    return nnz;
+  }
+
   /**
    * @return          sparse grid
    */
@@ -222,6 +318,62 @@ class HierarchisationSLE : public CloneableSLE {
   /// not-a-knot B-spline Boundary basis
   std::unique_ptr<base::SNakBsplineBoundaryCombigridBase> nakBsplineBoundaryCombigridBasis;
 
+  /**
+   * Determines the basis functions whose support contains a point
+   * (type-erased wrapper around base::AlgorithmLocalSupportEvaluation).
+   */
+  class SupportEnumerator {
+   public:
+    /**
+     * Destructor.
+     */
+    virtual ~SupportEnumerator() {}
+
+    /**
+     * @param       point           point in the unit cube
+     * @param[out]  sequenceNumbers sequence numbers of the basis functions
+     *                              whose support contains the point
+     */
+    virtual void getAffectedBasisFunctions(const base::DataVector& point,
+                                           std::vector<size_t>& sequenceNumbers) = 0;
+  };
+
+  /**
+   * SupportEnumerator for a specific one-dimensional basis.
+   */
+  template <class BASIS>
+  class LocalSupportEnumerator : public SupportEnumerator {
+   public:
+    /**
+     * Constructor.
+     *
+     * @param storage         storage of the sparse grid
+     * @param basis           one-dimensional basis
+     * @param supportRadius   radius of the support of the interior basis functions
+     *                        in multiples of the mesh width
+     * @param clenshawCurtis  whether the grid points are Clenshaw-Curtis points
+     */
+    LocalSupportEnumerator(base::GridStorage& storage, BASIS& basis, double supportRadius,
+                           bool clenshawCurtis = false)
+        : algorithm(storage, basis, supportRadius, clenshawCurtis) {}
+
+    /**
+     * @param       point           point in the unit cube
+     * @param[out]  sequenceNumbers sequence numbers of the basis functions
+     *                              whose support contains the point
+     */
+    void getAffectedBasisFunctions(const base::DataVector& point,
+                                   std::vector<size_t>& sequenceNumbers) override {
+      algorithm.getAffectedBasisFunctions(point, 0, sequenceNumbers, factors);
+    }
+
+   protected:
+    /// algorithm for determining the affected basis functions
+    base::AlgorithmLocalSupportEvaluation<BASIS> algorithm;
+    /// 1D factors of the affected basis functions (not used)
+    std::vector<double> factors;
+  };
+
   /// type of grid/basis functions
   enum {
     INVALID,
@@ -243,6 +395,83 @@ class HierarchisationSLE : public CloneableSLE {
     NAK_BSPLINEBOUNDARY_COMBIGRID
   } basisType;
 
+  /// enumerator of the non-zero entries of the rows (created on first use)
+  std::unique_ptr<SupportEnumerator> supportEnumerator;
+  /// grid point of the current row (temporary vector)
+  base::DataVector point;
+  /// candidate columns of the current row (temporary vector)
+  std::vector<size_t> candidates;
+
+  /**
+   * Creates the enumerator of the non-zero entries of the rows according to the basis.
+   */
+  void createSupportEnumerator() {
+    // radius of the B-spline support in multiples of the mesh width
+    auto bsplineRadius = [](size_t degree) { return static_cast<double>(degree + 1) / 2.0; };
+    // wavelets are cut off at distance two mesh widths from their center
+    const double waveletRadius = 2.0;
+    // hat functions are supported on the interval between the two hierarchical neighbors
+    const double linearRadius = 1.0;
+
+    if (basisType == BSPLINE) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SBsplineBase>(
+          gridStorage, *bsplineBasis, bsplineRadius(bsplineBasis->getDegree())));
+    } else if (basisType == BSPLINE_BOUNDARY) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SBsplineBoundaryBase>(
+          gridStorage, *bsplineBoundaryBasis, bsplineRadius(bsplineBoundaryBasis->getDegree())));
+    } else if (basisType == BSPLINE_CLENSHAW_CURTIS) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SBsplineClenshawCurtisBase>(
+          gridStorage, *bsplineClenshawCurtisBasis,
+          bsplineRadius(bsplineClenshawCurtisBasis->getDegree()), true));
+    } else if (basisType == BSPLINE_MODIFIED) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SBsplineModifiedBase>(
+          gridStorage, *modBsplineBasis, bsplineRadius(modBsplineBasis->getDegree())));
+    } else if (basisType == BSPLINE_MODIFIED_CLENSHAW_CURTIS) {
+      supportEnumerator.reset(
+          new LocalSupportEnumerator<base::SBsplineModifiedClenshawCurtisBase>(
+              gridStorage, *modBsplineClenshawCurtisBasis,
+              bsplineRadius(modBsplineClenshawCurtisBasis->getDegree()), true));
+    } else if (basisType == FUNDAMENTAL_SPLINE) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SFundamentalSplineBase>(
+          gridStorage, *fundamentalSplineBasis, fundamentalSplineBasis->getSupportRadius()));
+    } else if (basisType == FUNDAMENTAL_SPLINE_MODIFIED) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SFundamentalSplineModifiedBase>(
+          gridStorage, *modFundamentalSplineBasis,
+          modFundamentalSplineBasis->getSupportRadius()));
+    } else if (basisType == LINEAR) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SLinearBase>(
+          gridStorage, *linearBasis, linearRadius));
+    } else if (basisType == LINEAR_BOUNDARY) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SLinearBoundaryBase>(
+          gridStorage, *linearL0BoundaryBasis, linearRadius));
+    } else if (basisType == LINEAR_CLENSHAW_CURTIS) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SLinearClenshawCurtisBase>(
+          gridStorage, *linearClenshawCurtisBasis, linearRadius, true));
+    } else if (basisType == LINEAR_CLENSHAW_CURTIS_BOUNDARY) {
+      supportEnumerator.reset(
+          new LocalSupportEnumerator<base::SLinearClenshawCurtisBoundaryBase>(
+              gridStorage, *linearClenshawCurtisBoundaryBasis, linearRadius, true));
+    } else if (basisType == LINEAR_MODIFIED) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SLinearModifiedBase>(
+          gridStorage, *modLinearBasis, linearRadius));
+    } else if (basisType == WAVELET) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SWaveletBase>(
+          gridStorage, *waveletBasis, waveletRadius));
+    } else if (basisType == WAVELET_BOUNDARY) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SWaveletBoundaryBase>(
+          gridStorage, *waveletBoundaryBasis, waveletRadius));
+    } else if (basisType == WAVELET_MODIFIED) {
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SWaveletModifiedBase>(
+          gridStorage, *modWaveletBasis, waveletRadius));
+    } else if (basisType == NAK_BSPLINEBOUNDARY_COMBIGRID) {
+      // the not-a-knot B-splines near the boundary are supported on up to
+      // degree mesh widths away from their center
+      supportEnumerator.reset(new LocalSupportEnumerator<base::SNakBsplineBoundaryCombigridBase>(
+          gridStorage, *nakBsplineBoundaryCombigridBasis,
+          static_cast<double>(nakBsplineBoundaryCombigridBasis->getDegree())));
+    }
+  }
+
   /**
    * @param basisI    basis function index
    * @param pointJ    grid point index
@@ -10,6 +10,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <cstddef>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -48,6 +49,32 @@ class SLE {
    */
   virtual double getMatrixEntry(size_t i, size_t j) = 0;
 
+  /**
+   * Retrieve the non-zero entries of a matrix row.
+   * Standard implementation with \f$\mathcal{O}(n)\f$ calls of getMatrixEntry().
+   * Systems that know their sparsity pattern should override this method,
+   * as the solvers assemble the matrix row by row.
+   *
+   * @param       i       row index
+   * @param[out]  columns column indices of the non-zero entries of the i-th row
+   *                      (in ascending order)
+   * @param[out]  values  corresponding matrix entries
+   */
+  virtual void getMatrixRow(size_t i, std::vector<size_t>& columns, std::vector<double>& values) {
+    const size_t n = getDimension();
+    columns.clear();
+    values.clear();
+
+    for (size_t j = 0; j < n; j++) {
+      const double entry = getMatrixEntry(i, j);
+
+      if (entry != 0.0) {
+        columns.push_back(j);
+        values.push_back(entry);
+      }
+    }
+  }
+
   /**
    * Multiply the matrix with a vector.
    * Standard implementation with \f$\mathcal{O}(n^2)\f$ scalar
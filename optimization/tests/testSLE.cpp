@@ -6,6 +6,8 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/optimization/function/scalar/InterpolantScalarFunction.hpp>
 #include <sgpp/optimization/sle/solver/Armadillo.hpp>
 #include <sgpp/optimization/sle/solver/Auto.hpp>
@@ -35,8 +37,8 @@ using sgpp::optimization::SLE;
 void testSLESystem(SLE& system, const sgpp::base::DataVector& x,
                    const sgpp::base::DataVector& b,
                    sgpp::base::DataMatrix& A) {
-  // Test sgpp::optimization::SLE::getMatrixEntry, isMatrixEntryNonZero and
-  // matrixVectorMultiplication. Returns system matrix as pysgpp.DataMatrix.
+  // Test sgpp::optimization::SLE::getMatrixEntry, isMatrixEntryNonZero, getMatrixRow,
+  // countNNZ and matrixVectorMultiplication. Returns system matrix as pysgpp.DataMatrix.
   const size_t n = x.getSize();
   BOOST_CHECK_EQUAL(system.getDimension(), n);
   A.resize(n, n);
@@ -54,6 +56,31 @@ void testSLESystem(SLE& system, const sgpp::base::DataVector& x,
     }
   }
 
+  // test getMatrixRow and countNNZ
+  std::vector<size_t> columns;
+  std::vector<double> values;
+  size_t nnz = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    system.getMatrixRow(i, columns, values);
+    BOOST_CHECK_EQUAL(columns.size(), values.size());
+    size_t k = 0;
+
+    for (size_t j = 0; j < n; j++) {
+      if (A(i, j) != 0.0) {
+        BOOST_REQUIRE_LT(k, columns.size());
+        BOOST_CHECK_EQUAL(columns[k], j);
+        BOOST_CHECK_EQUAL(values[k], A(i, j));
+        k++;
+      }
+    }
+
+    BOOST_CHECK_EQUAL(k, columns.size());
+    nnz += k;
+  }
+
+  BOOST_CHECK_EQUAL(system.countNNZ(), nnz);
+
   // A*x calculated by sgpp::optimization
   sgpp::base::DataVector Ax2(0);
   system.matrixVectorMultiplication(x, Ax2);
@@ -272,3 +299,117 @@ BOOST_AUTO_TEST_CASE(TestHierarchisationSLE) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestHierarchisationSLEUnidirectional) {
+  // Test sgpp::base::AlgorithmUnidirectionalHierarchisation (used by
+  // sgpp::op_factory::createOperationHierarchisation for B-spline grids)
+  // against sgpp::optimization::HierarchisationSLE.
+  Printer::getInstance().setVerbosity(-1);
+
+  const size_t d = 2;
+  const size_t l = 4;
+
+  sgpp::optimization::sle_solver::Auto solver;
+  ExampleFunction f;
+
+  for (size_t p = 1; p <= 5; p += 2) {
+    std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineGrid(d, p)));
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModBsplineGrid(d, p)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createNakBsplineBoundaryCombigridGrid(d, p)));
+
+    for (auto& grid : grids) {
+      sgpp::base::DataVector functionValues(0);
+      createSampleGrid(*grid, l, f, functionValues);
+
+      // refine adaptively such that the poles are not complete
+      sgpp::base::GridStorage& gridStorage = grid->getStorage();
+      sgpp::base::SurplusRefinementFunctor refinementFunctor(functionValues, 3);
+      grid->getGenerator().refine(refinementFunctor);
+
+      const size_t n = gridStorage.getSize();
+      sgpp::base::DataVector x(d);
+      functionValues.resize(n);
+
+      for (size_t i = 0; i < n; i++) {
+        x = gridStorage.getCoordinates(gridStorage[i]);
+        functionValues[i] = f.eval(x);
+      }
+
+      // solve hierarchization system
+      HierarchisationSLE system(*grid);
+      sgpp::base::DataVector alpha(0);
+      BOOST_CHECK(solver.solve(system, functionValues, alpha));
+
+      // hierarchize with operation
+      std::unique_ptr<sgpp::base::OperationHierarchisation> op(
+          sgpp::op_factory::createOperationHierarchisation(*grid));
+      sgpp::base::DataVector alpha2(functionValues);
+      op->doHierarchisation(alpha2);
+
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_SMALL(alpha[i] - alpha2[i], 1e-8);
+      }
+
+      // dehierarchize with operation
+      op->doDehierarchisation(alpha2);
+
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_SMALL(functionValues[i] - alpha2[i], 1e-10);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestHierarchisationSLEMatrixRows) {
+  // Test the sparse row enumeration of sgpp::optimization::HierarchisationSLE
+  // (basis functions whose support contains the grid point) against probing all entries
+  // on adaptively refined grids.
+  const size_t d = 2;
+  const size_t l = 4;
+
+  ExampleFunction f;
+
+  for (size_t p = 1; p <= 5; p += 2) {
+    std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+    createSupportedGrids(d, p, grids);
+    grids.push_back(
+        std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearClenshawCurtisGrid(d)));
+    grids.push_back(std::unique_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createNakBsplineBoundaryCombigridGrid(d, p)));
+
+    for (auto& grid : grids) {
+      sgpp::base::DataVector functionValues(0);
+      createSampleGrid(*grid, l, f, functionValues);
+
+      // refine adaptively to obtain an irregular pattern
+      sgpp::base::SurplusRefinementFunctor refinementFunctor(functionValues, 3);
+      grid->getGenerator().refine(refinementFunctor);
+
+      HierarchisationSLE system(*grid);
+      const size_t n = system.getDimension();
+      std::vector<size_t> columns;
+      std::vector<double> values;
+
+      for (size_t i = 0; i < n; i++) {
+        system.getMatrixRow(i, columns, values);
+        size_t k = 0;
+
+        for (size_t j = 0; j < n; j++) {
+          const double Aij = system.getMatrixEntry(i, j);
+
+          if (Aij != 0.0) {
+            BOOST_REQUIRE_LT(k, columns.size());
+            BOOST_CHECK_EQUAL(columns[k], j);
+            BOOST_CHECK_EQUAL(values[k], Aij);
+            k++;
+          }
+        }
+
+        BOOST_CHECK_EQUAL(k, columns.size());
+      }
+    }
+  }
+}
@@ -15,6 +15,8 @@
     sgpp::base::Grid& grid);
 %newobject sgpp::op_factory::createOperationLTwoDotExplicit(
     sgpp::base::DataMatrix* m, sgpp::base::Grid& grid);
+%newobject sgpp::op_factory::createOperationLTwoDotExplicitSparse(
+    sgpp::base::Grid& grid);
 %newobject sgpp::op_factory::createOperationLaplaceEnhanced(
     sgpp::base::Grid& grid);
 %newobject sgpp::op_factory::createOperationLaplaceEnhanced(
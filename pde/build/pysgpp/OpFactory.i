@@ -19,6 +19,8 @@
     sgpp::base::Grid& grid);
 %newobject sgpp::op_factory::createOperationLTwoDotExplicit(
     sgpp::base::DataMatrix* m, sgpp::base::Grid& grid);
+%newobject sgpp::op_factory::createOperationLTwoDotExplicitSparse(
+    sgpp::base::Grid& grid);
 %newobject sgpp::op_factory::createOperationLaplaceEnhanced(
     sgpp::base::Grid& grid);
 %newobject sgpp::op_factory::createOperationLaplaceEnhanced(
@@ -0,0 +1,141 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystemParallelOMP.hpp>
+#include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::pde::HeatEquationParabolicPDESolverSystemParallelOMP;
+using sgpp::pde::UpDownOneOpDim;
+
+/**
+ * Heat equation system with the former application of the Laplacian: every dimension is
+ * computed by a task into a temporary vector, which is added to the result under a lock.
+ */
+class LockedHeatEquationSystem : public HeatEquationParabolicPDESolverSystemParallelOMP {
+ public:
+  LockedHeatEquationSystem(Grid& grid, DataVector& alpha, double a, double timestepSize)
+      : HeatEquationParabolicPDESolverSystemParallelOMP(grid, alpha, a, timestepSize, "ImEul") {}
+
+ protected:
+  void applyLOperatorInner(DataVector& alpha, DataVector& result) override {
+    result.setAll(0.0);
+
+    DataVector temp(alpha.getSize());
+    temp.setAll(0.0);
+
+    std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
+    size_t nDims = algoDims.size();
+#ifdef _OPENMP
+    omp_lock_t Mutex;
+    omp_init_lock(&Mutex);
+#endif
+
+    for (size_t i = 0; i < nDims; i++) {
+#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
+      {
+        DataVector myResult(result.getSize());
+
+        reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceInner)
+            ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
+
+#ifdef _OPENMP
+        omp_set_lock(&Mutex);
+#endif
+        temp.add(myResult);
+#ifdef _OPENMP
+        omp_unset_lock(&Mutex);
+#endif
+      }
+    }
+
+#pragma omp taskwait
+
+#ifdef _OPENMP
+    omp_destroy_lock(&Mutex);
+#endif
+
+    result.axpy((-1.0) * this->a, temp);
+  }
+};
+
+/**
+ * Applies the system matrix (implicit Euler) several times and returns the average runtime.
+ */
+double measure(HeatEquationParabolicPDESolverSystemParallelOMP& system, DataVector& alpha,
+               DataVector& result, size_t repetitions) {
+  auto begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t r = 0; r < repetitions; r++) {
+    system.mult(alpha, result);
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(end - begin).count() / static_cast<double>(repetitions);
+}
+
+int main(int argc, char** argv) {
+  const size_t dim = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 8;
+  const size_t level = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 5;
+  const size_t repetitions = (argc > 3) ? std::strtoul(argv[3], nullptr, 10) : 3;
+  int maxThreads = 1;
+#ifdef _OPENMP
+  maxThreads = omp_get_max_threads();
+#endif
+
+  std::unique_ptr<Grid> grid(Grid::createLinearBoundaryGrid(dim));
+  grid->getGenerator().regular(level);
+  DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = std::sin(static_cast<double>(i));
+  }
+
+  LockedHeatEquationSystem lockedSystem(*grid, alpha, 1.0, 0.01);
+  HeatEquationParabolicPDESolverSystemParallelOMP bufferedSystem(*grid, alpha, 1.0, 0.01, "ImEul");
+  DataVector innerAlpha(*bufferedSystem.getGridCoefficientsForCG());
+  DataVector lockedResult(innerAlpha.getSize());
+  DataVector bufferedResult(innerAlpha.getSize());
+
+  std::cout << "Heat equation system (implicit Euler), dim " << dim << ", level " << level << ", "
+            << innerAlpha.getSize() << " inner grid points\n";
+  std::cout << "threads locked[s] buffered[s] speedup maxDifference\n";
+
+  for (int threads = 1; threads <= maxThreads; threads *= 2) {
+#ifdef _OPENMP
+    omp_set_num_threads(threads);
+#endif
+    // warm up, the buffered system allocates its buffers in the first application
+    bufferedSystem.mult(innerAlpha, bufferedResult);
+
+    const double lockedTime = measure(lockedSystem, innerAlpha, lockedResult, repetitions);
+    const double bufferedTime = measure(bufferedSystem, innerAlpha, bufferedResult, repetitions);
+    double maxDifference = 0.0;
+
+    for (size_t i = 0; i < innerAlpha.getSize(); i++) {
+      maxDifference = std::max(maxDifference, std::abs(lockedResult[i] - bufferedResult[i]));
+    }
+
+    std::cout << threads << " " << lockedTime << " " << bufferedTime << " "
+              << lockedTime / bufferedTime << " " << maxDifference << std::endl;
+  }
+
+  return 0;
+}
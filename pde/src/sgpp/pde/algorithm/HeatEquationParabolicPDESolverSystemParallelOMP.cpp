@@ -17,6 +17,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <vector>
 #include <string>
 
@@ -88,46 +89,8 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixComplete(
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorComplete(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-  temp.setAll(0.0);
-
-  std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
-  size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
-
-  // Apply Laplace, parallel in Dimensions
-  for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
-    {
-      sgpp::base::DataVector myResult(result.getSize());
-
-      /// discuss methods in order to avoid this cast
-      reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceBound)
-          ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
-
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
-    }
-  }
-
-#pragma omp taskwait
-
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
-
-  result.axpy((-1.0) * this->a, temp);
+  applyLOperatorParallel(this->OpLaplaceBound, this->LaplaceBuffersBound,
+                         this->LaplaceScratchBound, alpha, result);
 }
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixInner(
@@ -143,46 +106,86 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixInner(
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorInner(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-  temp.setAll(0.0);
+  applyLOperatorParallel(this->OpLaplaceInner, this->LaplaceBuffersInner,
+                         this->LaplaceScratchInner, alpha, result);
+}
 
+void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorParallel(
+    sgpp::base::OperationMatrix* OpLaplace, std::vector<sgpp::base::DataVector>& buffers,
+    std::vector<sgpp::base::DataVector>& scratch, sgpp::base::DataVector& alpha,
+    sgpp::base::DataVector& result) {
+  const size_t size = result.getSize();
   std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
   size_t nDims = algoDims.size();
+  size_t nThreads = 1;
 #ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
+  nThreads = static_cast<size_t>(omp_get_num_threads());
 #endif
 
+  if (buffers.size() < nThreads) {
+    buffers.resize(nThreads);
+    scratch.resize(nThreads);
+  }
+
   // Apply Laplace, parallel in Dimensions
   for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
+#pragma omp task firstprivate(i) shared(alpha, buffers, scratch, algoDims)
     {
-      sgpp::base::DataVector myResult(result.getSize());
-
-      /// discuss methods in order to avoid this cast
-      reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceInner)
-          ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
-
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
+      size_t threadId = 0;
 #ifdef _OPENMP
-      omp_unset_lock(&Mutex);
+      threadId = static_cast<size_t>(omp_get_thread_num());
 #endif
+      // the task is tied, i.e., it is executed by this thread until it is finished, and the
+      // thread cannot start another dimension while this one is suspended
+      sgpp::base::DataVector& buffer = buffers[threadId];
+
+      if (buffer.getSize() != size) {
+        buffer.resize(size);
+        buffer.setAll(0.0);
+      }
+
+      /// discuss methods in order to avoid this cast
+      reinterpret_cast<UpDownOneOpDim*>(OpLaplace)
+          ->multAddParallelBuildingBlock(alpha, buffer, algoDims[i], scratch[threadId]);
     }
   }
 
 #pragma omp taskwait
 
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
+  // sum up the buffers (parallel in chunks of grid points)
+  std::vector<sgpp::base::DataVector*> usedBuffers;
 
-  result.axpy((-1.0) * this->a, temp);
+  for (sgpp::base::DataVector& buffer : buffers) {
+    if (buffer.getSize() == size) {
+      usedBuffers.push_back(&buffer);
+    }
+  }
+
+  const size_t chunkSize = std::max(size / (4 * nThreads) + 1, static_cast<size_t>(4096));
+
+  for (size_t start = 0; start < size; start += chunkSize) {
+#pragma omp task firstprivate(start) shared(usedBuffers, result)
+    {
+      const size_t end = std::min(start + chunkSize, size);
+
+      for (size_t j = start; j < end; j++) {
+        result[j] = 0.0;
+      }
+
+      for (sgpp::base::DataVector* buffer : usedBuffers) {
+        for (size_t j = start; j < end; j++) {
+          result[j] += (*buffer)[j];
+          (*buffer)[j] = 0.0;
+        }
+      }
+
+      for (size_t j = start; j < end; j++) {
+        result[j] *= (-1.0) * this->a;
+      }
+    }
+  }
+
+#pragma omp taskwait
 }
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::finishTimestep() {
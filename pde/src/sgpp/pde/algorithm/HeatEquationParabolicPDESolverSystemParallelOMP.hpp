@@ -13,6 +13,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace pde {
@@ -34,6 +35,14 @@ class HeatEquationParabolicPDESolverSystemParallelOMP
   sgpp::base::OperationMatrix* OpLaplaceInner;
   /// the LTwoDotProduct Operation (Mass Matrix), on inner grid
   sgpp::base::OperationMatrix* OpMassInner;
+  /// accumulation buffers (one per thread) of the Laplace Operation on boundary grid
+  std::vector<sgpp::base::DataVector> LaplaceBuffersBound;
+  /// accumulation buffers (one per thread) of the Laplace Operation on inner grid
+  std::vector<sgpp::base::DataVector> LaplaceBuffersInner;
+  /// scratch vectors (one per thread) for the up/downs of the Laplace Operation on boundary grid
+  std::vector<sgpp::base::DataVector> LaplaceScratchBound;
+  /// scratch vectors (one per thread) for the up/downs of the Laplace Operation on inner grid
+  std::vector<sgpp::base::DataVector> LaplaceScratchInner;
 
   void applyMassMatrixComplete(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
@@ -43,6 +52,25 @@ class HeatEquationParabolicPDESolverSystemParallelOMP
 
   void applyLOperatorInner(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * Applies the Laplace Operation scaled by -a, parallel in the dimensions.
+   * The up/downs of the dimensions are executed as tasks, which compute their results in the
+   * scratch vector of the executing thread and add them to its accumulation buffer.
+   * Afterwards, the buffers are summed up in parallel for chunks of grid points and reset to
+   * zero, hence no locking is needed. The buffers and scratch vectors are reused in the
+   * following timesteps, i.e., no vectors are allocated per dimension.
+   *
+   * @param OpLaplace the Laplace Operation (has to be an UpDownOneOpDim)
+   * @param buffers accumulation buffers of OpLaplace
+   * @param scratch scratch vectors for the up/downs of OpLaplace
+   * @param alpha the coefficients
+   * @param result vector to store the results in
+   */
+  void applyLOperatorParallel(sgpp::base::OperationMatrix* OpLaplace,
+                              std::vector<sgpp::base::DataVector>& buffers,
+                              std::vector<sgpp::base::DataVector>& scratch,
+                              sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
+
  public:
   /**
    * Std-Constructor
@@ -62,18 +62,37 @@ void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                                size_t operationDim) {
   result.setAll(0.0);
 
+  this->multAddParallelBuildingBlock(alpha, result, operationDim);
+}
+
+void UpDownOneOpDim::multAddParallelBuildingBlock(sgpp::base::DataVector& alpha,
+                                                  sgpp::base::DataVector& result,
+                                                  size_t operationDim) {
   sgpp::base::DataVector beta(result.getSize());
 
-  if (this->coefs != NULL) {
-    if (this->coefs->get(operationDim) != 0.0) {
-      this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDim);
+  this->multAddParallelBuildingBlock(alpha, result, operationDim, beta);
+}
 
-      result.axpy(this->coefs->get(operationDim), beta);
-    }
-  } else {
-    this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDim);
+void UpDownOneOpDim::multAddParallelBuildingBlock(sgpp::base::DataVector& alpha,
+                                                  sgpp::base::DataVector& result,
+                                                  size_t operationDim,
+                                                  sgpp::base::DataVector& scratch) {
+  if ((this->coefs != NULL) && (this->coefs->get(operationDim) == 0.0)) {
+    return;
+  }
+
+  // the up/down adds to its result in some dimensions, hence it has to start from zero
+  if (scratch.getSize() != result.getSize()) {
+    scratch.resize(result.getSize());
+  }
 
-    result.add(beta);
+  scratch.setAll(0.0);
+  this->updown(alpha, scratch, this->numAlgoDims_ - 1, operationDim);
+
+  if (this->coefs != NULL) {
+    result.axpy(this->coefs->get(operationDim), scratch);
+  } else {
+    result.add(scratch);
   }
 }
 
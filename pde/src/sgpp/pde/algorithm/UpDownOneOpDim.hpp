@@ -74,6 +74,32 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
   void multParallelBuildingBlock(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                                  size_t operationDim);
 
+  /**
+   * Same as multParallelBuildingBlock, but the up/down for the special dimension is added to
+   * result instead of overwriting it. The addition is done after the up/down has finished and
+   * contains no task scheduling point, i.e., tied tasks that are executed by the same thread
+   * may accumulate into the same vector without further synchronization.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to which the results are added
+   * @param operationDim Dimension in which the special operator is applied
+   */
+  void multAddParallelBuildingBlock(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                                    size_t operationDim);
+
+  /**
+   * Same as multAddParallelBuildingBlock, but the up/down is computed in the given scratch
+   * vector instead of a temporary one, i.e., callers can reuse the scratch vector (e.g., one per
+   * thread) for all dimensions and applications of the operator.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to which the results are added
+   * @param operationDim Dimension in which the special operator is applied
+   * @param scratch vector that is overwritten, it is resized to the size of result if necessary
+   */
+  void multAddParallelBuildingBlock(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                                    size_t operationDim, sgpp::base::DataVector& scratch);
+
  protected:
   typedef sgpp::base::GridStorage::grid_iterator grid_iterator;
 
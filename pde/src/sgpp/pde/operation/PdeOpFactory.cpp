@@ -272,6 +272,23 @@ base::OperationMatrix* createOperationLTwoDotExplicit(base::DataMatrix* m, base:
   }
 }
 
+base::OperationMatrix* createOperationLTwoDotExplicitSparse(base::Grid& grid) {
+  if (grid.getType() == base::GridType::Linear) {
+    return new pde::OperationMatrixLTwoDotExplicitLinear(&grid, true);
+  } else if (grid.getType() == base::GridType::Bspline) {
+    return new pde::OperationMatrixLTwoDotExplicitBspline(&grid, true);
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    return new pde::OperationMatrixLTwoDotExplicitModBspline(&grid, true);
+  } else if (grid.getType() == base::GridType::BsplineClenshawCurtis) {
+    return new pde::OperationMatrixLTwoDotExplicitBsplineClenshawCurtis(&grid, true);
+  } else if (grid.getType() == base::GridType::ModBsplineClenshawCurtis) {
+    return new pde::OperationMatrixLTwoDotExplicitModBsplineClenshawCurtis(&grid, true);
+  } else {
+    throw base::factory_exception(
+        "OperationLTwoDotExplicitSparse is not implemented for this grid type.");
+  }
+}
+
 base::OperationMatrix* createOperationLaplaceEnhanced(base::Grid& grid) {
   if (grid.getType() == base::GridType::Linear) {
     return new pde::OperationLaplaceEnhancedLinear(&grid.getStorage());
@@ -89,6 +89,19 @@ base::OperationMatrix* createOperationLTwoDotExplicit(base::Grid& grid);
 base::OperationMatrix* createOperationLTwoDotExplicit(
     base::DataMatrix* m, base::Grid& grid);
 
+/**
+ * Factory method, returning an OperationLTwoDotExplicit (OperationMatrix) for the grid at hand,
+ * which stores only the nonzero entries of the upper triangle of the matrix
+ * (see base::DataMatrixSymmetricSparse).
+ * Only supported for Linear, Bspline, ModBspline, BsplineClenshawCurtis and
+ * ModBsplineClenshawCurtis grids.
+ * Note: object has to be freed after use.
+ *
+ * @param grid Grid which is to be used
+ * @return Pointer to the new OperationMatrix object for the Grid grid
+ */
+base::OperationMatrix* createOperationLTwoDotExplicitSparse(base::Grid& grid);
+
 /**
  * Factory method, returning an OperationLaplace (OperationMatrix) for the grid at hand.
  * Note: object has to be freed after use.
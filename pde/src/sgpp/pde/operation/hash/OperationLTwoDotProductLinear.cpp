@@ -20,6 +20,21 @@ OperationLTwoDotProductLinear::OperationLTwoDotProductLinear(sgpp::base::GridSto
 
 OperationLTwoDotProductLinear::~OperationLTwoDotProductLinear() {}
 
+void OperationLTwoDotProductLinear::getDiagonal(sgpp::base::DataVector& diagonal) {
+#pragma omp parallel for
+  for (size_t k = 0; k < diagonal.getSize(); k++) {
+    const sgpp::base::GridPoint& point = this->storage->getPoint(k);
+    double value = 1.0;
+
+    for (size_t dim : this->algoDims) {
+      value *= 2.0 / 3.0 /
+               static_cast<double>(static_cast<sgpp::base::index_t>(1) << point.getLevel(dim));
+    }
+
+    diagonal[k] = value;
+  }
+}
+
 void OperationLTwoDotProductLinear::up(sgpp::base::DataVector& alpha,
                                        sgpp::base::DataVector& result, size_t dim) {
   // phi * phi
@@ -21,6 +21,24 @@ OperationLTwoDotProductLinearBoundary::OperationLTwoDotProductLinearBoundary(
 
 OperationLTwoDotProductLinearBoundary::~OperationLTwoDotProductLinearBoundary() {}
 
+void OperationLTwoDotProductLinearBoundary::getDiagonal(sgpp::base::DataVector& diagonal) {
+#pragma omp parallel for
+  for (size_t k = 0; k < diagonal.getSize(); k++) {
+    const sgpp::base::GridPoint& point = this->storage->getPoint(k);
+    double value = 1.0;
+
+    for (size_t dim : this->algoDims) {
+      const sgpp::base::level_t l = point.getLevel(dim);
+      const double h = 1.0 / static_cast<double>(static_cast<sgpp::base::index_t>(1) << l);
+
+      // the boundary basis functions 1 - x and x of level 0 have the integral 1/3
+      value *= (l == 0) ? (1.0 / 3.0) : (2.0 / 3.0 * h);
+    }
+
+    diagonal[k] = value;
+  }
+}
+
 void OperationLTwoDotProductLinearBoundary::up(sgpp::base::DataVector& alpha,
                                                sgpp::base::DataVector& result, size_t dim) {
   // phi * phi
@@ -31,6 +31,14 @@ class OperationLTwoDotProductLinearBoundary : public StdUpDown {
    */
   virtual ~OperationLTwoDotProductLinearBoundary();
 
+  /**
+   * Computes the diagonal of the mass matrix, i.e., the products of the one-dimensional
+   * integrals \f$\int_0^1 \phi_{l,i}(x)^2 dx\f$ in the algorithmic dimensions.
+   *
+   * @param diagonal DataVector with one entry per grid point, into which the diagonal is stored
+   */
+  void getDiagonal(sgpp::base::DataVector& diagonal) override;
+
  protected:
   /**
    * Up-step in dimension <i>dim</i> for \f$(\phi_i(x),\phi_j(x))_{L_2}\f$.
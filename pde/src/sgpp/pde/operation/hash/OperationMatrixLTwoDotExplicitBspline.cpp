@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitBspline.hpp>
+#include <sgpp/pde/operation/hash/SymmetricAssembly.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/grid/type/BsplineGrid.hpp>
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
@@ -21,19 +22,25 @@ namespace pde {
 
 OperationMatrixLTwoDotExplicitBspline::OperationMatrixLTwoDotExplicitBspline(
     sgpp::base::DataMatrix* m, sgpp::base::Grid* grid)
-    : ownsMatrix_(false) {
+    : sparseM_(nullptr), ownsMatrix_(false) {
   m_ = m;
   buildMatrix(grid);
 }
 
-OperationMatrixLTwoDotExplicitBspline::OperationMatrixLTwoDotExplicitBspline(sgpp::base::Grid* grid)
-    : ownsMatrix_(true) {
-  m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
+OperationMatrixLTwoDotExplicitBspline::OperationMatrixLTwoDotExplicitBspline(
+    sgpp::base::Grid* grid, bool useSparseStorage)
+    : sparseM_(nullptr), ownsMatrix_(true) {
+  if (useSparseStorage) {
+    m_ = nullptr;
+    sparseM_ = new sgpp::base::DataMatrixSymmetricSparse(grid->getSize());
+  } else {
+    m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
+  }
+
   buildMatrix(grid);
 }
 
 void OperationMatrixLTwoDotExplicitBspline::buildMatrix(sgpp::base::Grid* grid) {
-  size_t gridSize = grid->getSize();
   size_t gridDim = grid->getDimension();
   const size_t p = dynamic_cast<sgpp::base::BsplineGrid*>(grid)->getDegree();
   const size_t pp1h = (p + 1) >> 1;  // (p + 1) / 2
@@ -47,70 +54,87 @@ void OperationMatrixLTwoDotExplicitBspline::buildMatrix(sgpp::base::Grid* grid)
   sgpp::base::GaussLegendreQuadRule1D& gauss = sgpp::base::GaussLegendreQuadRule1D::getInstance();
   gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
 
-  for (size_t i = 0; i < gridSize; i++) {
-    for (size_t j = i; j < gridSize; j++) {
-      double res = 1.;
-
-      for (size_t k = 0; k < gridDim; k++) {
-        const sgpp::base::level_t lik = storage[i].getLevel(k);
-        const sgpp::base::level_t ljk = storage[j].getLevel(k);
-        const sgpp::base::index_t iik = storage[i].getIndex(k);
-        const sgpp::base::index_t ijk = storage[j].getIndex(k);
-        const sgpp::base::index_t hInvik = 1 << lik;
-        const sgpp::base::index_t hInvjk = 1 << ljk;
-        const double hik = 1.0 / static_cast<double>(hInvik);
-        const double hjk = 1.0 / static_cast<double>(hInvjk);
-
-        if (std::max((static_cast<double>(iik) - pp1hDbl) * hik,
-                     (static_cast<double>(ijk) - pp1hDbl) * hjk) >=
-            std::min((static_cast<double>(iik) + pp1hDbl) * hik,
-                     (static_cast<double>(ijk) + pp1hDbl) * hjk)) {
-          // Ansatz functions do not not overlap:
-          res = 0.;
-          break;
+  auto entry = [&](size_t i, size_t j) {
+    double res = 1.;
+
+    for (size_t k = 0; k < gridDim; k++) {
+      const sgpp::base::level_t lik = storage[i].getLevel(k);
+      const sgpp::base::level_t ljk = storage[j].getLevel(k);
+      const sgpp::base::index_t iik = storage[i].getIndex(k);
+      const sgpp::base::index_t ijk = storage[j].getIndex(k);
+      const sgpp::base::index_t hInvik = 1 << lik;
+      const sgpp::base::index_t hInvjk = 1 << ljk;
+      const double hik = 1.0 / static_cast<double>(hInvik);
+      const double hjk = 1.0 / static_cast<double>(hInvjk);
+
+      if (std::max((static_cast<double>(iik) - pp1hDbl) * hik,
+                   (static_cast<double>(ijk) - pp1hDbl) * hjk) >=
+          std::min((static_cast<double>(iik) + pp1hDbl) * hik,
+                   (static_cast<double>(ijk) + pp1hDbl) * hjk)) {
+        // Ansatz functions do not not overlap:
+        res = 0.;
+        break;
+      } else {
+        double temp_res = 0.0;
+
+        // Use formula for different overlapping ansatz functions:
+        double offset;
+        double scaling;
+        size_t start;
+        size_t stop;
+
+        if (lik >= ljk) {
+          offset = (static_cast<double>(iik) - pp1hDbl) * hik;
+          scaling = hik;
+          start = ((iik > pp1h) ? 0 : (pp1h - iik));
+          stop = std::min(p, hInvik + pp1h - iik - 1);
         } else {
-          double temp_res = 0.0;
-
-          // Use formula for different overlapping ansatz functions:
-          double offset;
-          double scaling;
-          size_t start;
-          size_t stop;
-
-          if (lik >= ljk) {
-            offset = (static_cast<double>(iik) - pp1hDbl) * hik;
-            scaling = hik;
-            start = ((iik > pp1h) ? 0 : (pp1h - iik));
-            stop = std::min(p, hInvik + pp1h - iik - 1);
-          } else {
-            offset = (static_cast<double>(ijk) - pp1hDbl) * hjk;
-            scaling = hjk;
-            start = ((ijk > pp1h) ? 0 : (pp1h - ijk));
-            stop = std::min(p, hInvjk + pp1h - ijk - 1);
-          }
+          offset = (static_cast<double>(ijk) - pp1hDbl) * hjk;
+          scaling = hjk;
+          start = ((ijk > pp1h) ? 0 : (pp1h - ijk));
+          stop = std::min(p, hInvjk + pp1h - ijk - 1);
+        }
 
-          for (size_t n = start; n <= stop; n++) {
-            for (size_t c = 0; c < quadOrder; c++) {
-              const double x = offset + scaling * (coordinates[c] + static_cast<double>(n));
-              temp_res += weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x);
-            }
+        for (size_t n = start; n <= stop; n++) {
+          for (size_t c = 0; c < quadOrder; c++) {
+            const double x = offset + scaling * (coordinates[c] + static_cast<double>(n));
+            temp_res += weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x);
           }
-          res *= scaling * temp_res;
         }
+        res *= scaling * temp_res;
       }
-
-      m_->set(i, j, res);
-      m_->set(j, i, res);
     }
+
+    return res;
+  };
+
+  const double supportRadius = static_cast<double>(p + 1) / 2.0;
+
+  if (sparseM_ != nullptr) {
+    assembleSymmetricSparse(storage, supportRadius, false, entry, *sparseM_);
+  } else {
+    assembleSymmetricDense(storage, supportRadius, false, entry, *m_);
   }
 }
 
 OperationMatrixLTwoDotExplicitBspline::~OperationMatrixLTwoDotExplicitBspline() {
-  if (ownsMatrix_) delete m_;
+  if (ownsMatrix_) {
+    delete m_;
+    delete sparseM_;
+  }
 }
 
 void OperationMatrixLTwoDotExplicitBspline::mult(sgpp::base::DataVector& alpha,
                                                  sgpp::base::DataVector& result) {
+  if (sparseM_ != nullptr) {
+    if (alpha.getSize() != sparseM_->getSize() || result.getSize() != sparseM_->getSize()) {
+      throw sgpp::base::data_exception("Dimensions do not match!");
+    }
+
+    sparseM_->mult(alpha, result);
+    return;
+  }
+
   size_t nrows = m_->getNrows();
   size_t ncols = m_->getNcols();
 
@@ -135,5 +159,11 @@ void OperationMatrixLTwoDotExplicitBspline::mult(sgpp::base::DataVector& alpha,
   }
 }
 
+void OperationMatrixLTwoDotExplicitBspline::getDiagonal(sgpp::base::DataVector& diagonal) {
+  for (size_t i = 0; i < diagonal.getSize(); i++) {
+    diagonal[i] = (sparseM_ != nullptr) ? sparseM_->get(i, i) : m_->get(i, i);
+  }
+}
+
 }  // namespace pde
 }  // namespace sgpp
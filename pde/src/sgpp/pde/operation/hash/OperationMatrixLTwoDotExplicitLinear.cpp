@@ -6,6 +6,7 @@
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitLinear.hpp>
+#include <sgpp/pde/operation/hash/SymmetricAssembly.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -17,33 +18,69 @@
 namespace sgpp {
 namespace pde {
 
-OperationMatrixLTwoDotExplicitLinear::OperationMatrixLTwoDotExplicitLinear() : ownsMatrix_(false) {
+OperationMatrixLTwoDotExplicitLinear::OperationMatrixLTwoDotExplicitLinear()
+    : sparseM_(nullptr), ownsMatrix_(false) {
   m_ = nullptr;
 }
 
 OperationMatrixLTwoDotExplicitLinear::OperationMatrixLTwoDotExplicitLinear(
     sgpp::base::DataMatrix* m, sgpp::base::Grid* grid)
-    : ownsMatrix_(false) {
+    : sparseM_(nullptr), ownsMatrix_(false) {
   m_ = m;
   buildMatrix(grid);
 }
 
-OperationMatrixLTwoDotExplicitLinear::OperationMatrixLTwoDotExplicitLinear(sgpp::base::Grid* grid)
-    : ownsMatrix_(true) {
-  m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
+OperationMatrixLTwoDotExplicitLinear::OperationMatrixLTwoDotExplicitLinear(sgpp::base::Grid* grid,
+                                                                           bool useSparseStorage)
+    : sparseM_(nullptr), ownsMatrix_(true) {
+  if (useSparseStorage) {
+    m_ = nullptr;
+    sparseM_ = new sgpp::base::DataMatrixSymmetricSparse(grid->getSize());
+  } else {
+    m_ = new sgpp::base::DataMatrix(grid->getSize(), grid->getSize());
+  }
+
   buildMatrix(grid);
 }
 
 void OperationMatrixLTwoDotExplicitLinear::buildMatrix(sgpp::base::Grid* grid) {
-  this->buildMatrixWithBounds(this->m_, grid);
+  size_t gridSize = grid->getSize();
+  size_t gridDim = grid->getDimension();
+
+  sgpp::base::DataMatrix level(gridSize, gridDim);
+  sgpp::base::DataMatrix index(gridSize, gridDim);
+
+  grid->getStorage().getLevelIndexArraysForEval(level, index);
+
+  auto entry = [&level, &index, gridDim](size_t i, size_t j) {
+    return computeEntry(level, index, gridDim, i, j);
+  };
+
+  if (sparseM_ != nullptr) {
+    assembleSymmetricSparse(grid->getStorage(), 1.0, false, entry, *sparseM_);
+  } else {
+    assembleSymmetricDense(grid->getStorage(), 1.0, false, entry, *m_);
+  }
 }
 
 OperationMatrixLTwoDotExplicitLinear::~OperationMatrixLTwoDotExplicitLinear() {
-  if (ownsMatrix_) delete m_;
+  if (ownsMatrix_) {
+    delete m_;
+    delete sparseM_;
+  }
 }
 
 void OperationMatrixLTwoDotExplicitLinear::mult(sgpp::base::DataVector& alpha,
                                                 sgpp::base::DataVector& result) {
+  if (sparseM_ != nullptr) {
+    if (alpha.getSize() != sparseM_->getSize() || result.getSize() != sparseM_->getSize()) {
+      throw sgpp::base::data_exception("Dimensions do not match!");
+    }
+
+    sparseM_->mult(alpha, result);
+    return;
+  }
+
   size_t nrows = m_->getNrows();
   size_t ncols = m_->getNcols();
 
@@ -68,5 +105,11 @@ void OperationMatrixLTwoDotExplicitLinear::mult(sgpp::base::DataVector& alpha,
   }
 }
 
+void OperationMatrixLTwoDotExplicitLinear::getDiagonal(sgpp::base::DataVector& diagonal) {
+  for (size_t i = 0; i < diagonal.getSize(); i++) {
+    diagonal[i] = (sparseM_ != nullptr) ? sparseM_->get(i, i) : m_->get(i, i);
+  }
+}
+
 }  // namespace pde
 }  // namespace sgpp
@@ -7,12 +7,14 @@
 #define OperationMatrixLTwoDotExplicitLinear_HPP_
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixSymmetricSparse.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
+#include <cmath>
 
 namespace sgpp {
 namespace pde {
@@ -41,8 +43,11 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
    * i.e. matrix is destroyed by the destructor of OperationMatrixLTwoDotExplicitLinearFullGrid
    *
    * @param grid the sparse grid
+   * @param useSparseStorage whether only the nonzero entries of the upper triangle are stored
+   *        (see base::DataMatrixSymmetricSparse) instead of the dense matrix
    */
-  explicit OperationMatrixLTwoDotExplicitLinear(sgpp::base::Grid* grid);
+  explicit OperationMatrixLTwoDotExplicitLinear(sgpp::base::Grid* grid,
+                                                bool useSparseStorage = false);
 
   /**
    * Destructor
@@ -57,6 +62,12 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
    */
   virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * @param diagonal DataVector with one entry per grid point, into which the diagonal
+   *        of the matrix is stored
+   */
+  virtual void getDiagonal(sgpp::base::DataVector& diagonal);
+
   /**
    * generalization of "buildMatrix" function, creates L2-dot-product matrix for specified bounds
    * @param mat matrix for storage of L2 producs
@@ -88,47 +99,8 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
       j_end = j_end == 0 ? gridSize : j_end;
 #pragma omp parallel for schedule(guided)
       for (size_t j = j_start; j < j_end; j++) {
-        double res = 1;
-
-        for (size_t k = 0; k < gridDim; k++) {
-          double lik = level.get(i, k);
-          double ljk = level.get(j, k);
-          double iik = index.get(i, k);
-          double ijk = index.get(j, k);
-
-          if (lik == ljk) {
-            if (iik == ijk) {
-              // Use formula for identical ansatz functions:
-              res *= 2 / lik / 3;
-            } else {
-              // Different index, but same level => ansatz functions do not overlap:
-              res = 0.;
-              break;
-            }
-          } else {
-            if (std::max((iik - 1) / lik, (ijk - 1) / ljk) >=
-                std::min((iik + 1) / lik, (ijk + 1) / ljk)) {
-              // Ansatz functions do not not overlap:
-              res = 0.;
-              break;
-            } else {
-              // Use formula for different overlapping ansatz functions:
-              if (lik > ljk) {  // Phi_i_k is the "smaller" ansatz function
-                double diff = (iik / lik) - (ijk / ljk);  // x_i_k - x_j_k
-                double temp_res = fabs(diff - (1 / lik)) + fabs(diff + (1 / lik)) - fabs(diff);
-                temp_res *= ljk;
-                temp_res = (1 - temp_res) / lik;
-                res *= temp_res;
-              } else {  // Phi_j_k is the "smaller" ansatz function
-                double diff = (ijk / ljk) - (iik / lik);  // x_j_k - x_i_k
-                double temp_res = fabs(diff - (1 / ljk)) + fabs(diff + (1 / ljk)) - fabs(diff);
-                temp_res *= lik;
-                temp_res = (1 - temp_res) / ljk;
-                res *= temp_res;
-              }
-            }
-          }
-        }
+        double res = computeEntry(level, index, gridDim, i, j);
+
         if (mat_quadratic) {
           mat->set(i, j, res);
           mat->set(j, i, res);
@@ -140,12 +112,71 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
   }
 
  private:
+  /**
+   * Computes the L2 product of two basis functions.
+   *
+   * @param level level arrays of the grid points
+   *        (see base::GridStorage::getLevelIndexArraysForEval)
+   * @param index index arrays of the grid points
+   * @param gridDim dimensionality of the grid
+   * @param i index of the first grid point
+   * @param j index of the second grid point
+   * @return \f$(\Phi_i,\Phi_j)_{L2}\f$
+   */
+  static inline double computeEntry(const sgpp::base::DataMatrix& level,
+                                    const sgpp::base::DataMatrix& index, size_t gridDim,
+                                    size_t i, size_t j) {
+    double res = 1;
+
+    for (size_t k = 0; k < gridDim; k++) {
+      double lik = level.get(i, k);
+      double ljk = level.get(j, k);
+      double iik = index.get(i, k);
+      double ijk = index.get(j, k);
+
+      if (lik == ljk) {
+        if (iik == ijk) {
+          // Use formula for identical ansatz functions:
+          res *= 2 / lik / 3;
+        } else {
+          // Different index, but same level => ansatz functions do not overlap:
+          return 0.;
+        }
+      } else {
+        if (std::max((iik - 1) / lik, (ijk - 1) / ljk) >=
+            std::min((iik + 1) / lik, (ijk + 1) / ljk)) {
+          // Ansatz functions do not not overlap:
+          return 0.;
+        } else {
+          // Use formula for different overlapping ansatz functions:
+          if (lik > ljk) {  // Phi_i_k is the "smaller" ansatz function
+            double diff = (iik / lik) - (ijk / ljk);  // x_i_k - x_j_k
+            double temp_res = fabs(diff - (1 / lik)) + fabs(diff + (1 / lik)) - fabs(diff);
+            temp_res *= ljk;
+            temp_res = (1 - temp_res) / lik;
+            res *= temp_res;
+          } else {  // Phi_j_k is the "smaller" ansatz function
+            double diff = (ijk / ljk) - (iik / lik);  // x_j_k - x_i_k
+            double temp_res = fabs(diff - (1 / ljk)) + fabs(diff + (1 / ljk)) - fabs(diff);
+            temp_res *= lik;
+            temp_res = (1 - temp_res) / ljk;
+            res *= temp_res;
+          }
+        }
+      }
+    }
+
+    return res;
+  }
+
   /**
    * This method is used by both constructors to build the matrix
    */
   void buildMatrix(sgpp::base::Grid* grid);
 
   sgpp::base::DataMatrix* m_;
+  /// matrix in symmetric sparse format (nullptr if the dense matrix m_ is used)
+  sgpp::base::DataMatrixSymmetricSparse* sparseM_;
   bool ownsMatrix_;
 };
 
@@ -7,6 +7,7 @@
 
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixSymmetricSparse.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -32,8 +33,11 @@ class OperationMatrixLTwoDotExplicitModBspline : public sgpp::base::OperationMat
    * i.e. matrix is destroyed by the destructor of OperationMatrixLTwoDotExplicitModBsplineFullGrid
    *
    * @param grid the sparse grid
+   * @param useSparseStorage whether only the nonzero entries of the upper triangle are stored
+   *        (see base::DataMatrixSymmetricSparse) instead of the dense matrix
    */
-  explicit OperationMatrixLTwoDotExplicitModBspline(sgpp::base::Grid* grid);
+  explicit OperationMatrixLTwoDotExplicitModBspline(sgpp::base::Grid* grid,
+                                                    bool useSparseStorage = false);
 
   /**
    * Destructor
@@ -48,6 +52,12 @@ class OperationMatrixLTwoDotExplicitModBspline : public sgpp::base::OperationMat
    */
   virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * @param diagonal DataVector with one entry per grid point, into which the diagonal
+   *        of the matrix is stored
+   */
+  virtual void getDiagonal(sgpp::base::DataVector& diagonal);
+
  private:
   /**
    * This method is used by both constructors to build the matrix
@@ -55,6 +65,8 @@ class OperationMatrixLTwoDotExplicitModBspline : public sgpp::base::OperationMat
   void buildMatrix(sgpp::base::Grid* grid);
 
   sgpp::base::DataMatrix* m_;
+  /// matrix in symmetric sparse format (nullptr if the dense matrix m_ is used)
+  sgpp::base::DataMatrixSymmetricSparse* sparseM_;
   bool ownsMatrix_;
 };
 
@@ -0,0 +1,234 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SYMMETRICASSEMBLY_HPP
+#define SYMMETRICASSEMBLY_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixSymmetricSparse.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/LevelIndexTypes.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Computes the upper triangular entries \f$a_{ij}\f$, \f$i \le j\f$, of a symmetric matrix
+ * whose entries vanish if the supports of the basis functions of the grid points \f$i\f$ and
+ * \f$j\f$ are disjoint (e.g., the mass matrix). Instead of visiting all pairs of grid points,
+ * the pairs whose supports may overlap are enumerated via the subspaces of the grid.
+ *
+ * In every dimension, the support of the basis function of level \f$l\f$ and index \f$i\f$
+ * has to be contained in \f$[x_{l,i-r}, x_{l,i+r}] \cap [0, 1]\f$, where \f$r\f$ is the support
+ * radius in multiples of the mesh width and \f$x_{l,i}\f$ is the \f$i\f$-th (equidistant or
+ * Clenshaw-Curtis) point of level \f$l\f$. For every grid point and every subspace, only the
+ * indices of the subspace whose supports may intersect the support of the grid point are
+ * enumerated in every dimension (plus the first and last index of every level, as modified
+ * basis functions at the boundary may have a larger support) and their tensor products are
+ * looked up in the storage.
+ *
+ * The rows are distributed over the threads, i.e., all entries of a row are passed to store
+ * by the same thread (in no particular order of the column index).
+ *
+ * @param storage         storage of the grid
+ * @param supportRadius   support radius of the basis functions in multiples of the mesh width
+ * @param clenshawCurtis  whether the grid points are Clenshaw-Curtis points
+ * @param entry           entry(i, j) returns \f$a_{ij}\f$ (has to be thread-safe)
+ * @param store           store(i, j, a_ij) is called for every enumerated entry
+ */
+template <class ENTRY, class STORE>
+void assembleSymmetricOverlapping(base::GridStorage& storage, double supportRadius,
+                                  bool clenshawCurtis, ENTRY& entry, STORE& store) {
+  const size_t size = storage.getSize();
+  const size_t dim = storage.getDimension();
+
+  // sorted indices per dimension and level and level vectors of the subspaces
+  std::vector<std::vector<std::vector<base::index_t>>> indices(dim);
+  std::set<std::vector<base::level_t>> subspaceSet;
+  std::vector<base::level_t> level(dim);
+
+  for (size_t k = 0; k < size; k++) {
+    const base::GridPoint& point = storage[k];
+
+    for (size_t t = 0; t < dim; t++) {
+      level[t] = point.getLevel(t);
+
+      if (indices[t].size() <= level[t]) {
+        indices[t].resize(level[t] + 1);
+      }
+
+      indices[t][level[t]].push_back(point.getIndex(t));
+    }
+
+    subspaceSet.insert(level);
+  }
+
+  for (size_t t = 0; t < dim; t++) {
+    for (std::vector<base::index_t>& indicesOfLevel : indices[t]) {
+      std::sort(indicesOfLevel.begin(), indicesOfLevel.end());
+      indicesOfLevel.erase(std::unique(indicesOfLevel.begin(), indicesOfLevel.end()),
+                           indicesOfLevel.end());
+    }
+  }
+
+  const std::vector<std::vector<base::level_t>> subspaces(subspaceSet.begin(), subspaceSet.end());
+
+  // coordinate of the (possibly non-integer) index i of level l, clamped to [0, 1]
+  auto toCoordinate = [clenshawCurtis](base::level_t l, double i) {
+    const double u = std::min(
+        std::max(i / static_cast<double>(static_cast<base::index_t>(1) << l), 0.0), 1.0);
+    return clenshawCurtis ? (1.0 - std::cos(M_PI * u)) / 2.0 : u;
+  };
+
+  // inverse of toCoordinate
+  auto toIndex = [clenshawCurtis](base::level_t l, double x) {
+    const double u = clenshawCurtis ? std::acos(1.0 - 2.0 * x) / M_PI : x;
+    return u * static_cast<double>(static_cast<base::index_t>(1) << l);
+  };
+
+#pragma omp parallel
+  {
+    base::GridPoint gridPoint(dim);
+    std::vector<double> left(dim);
+    std::vector<double> right(dim);
+    std::vector<std::vector<base::index_t>> candidates(dim);
+    std::vector<size_t> counters(dim);
+
+#pragma omp for schedule(dynamic, 16)
+    for (size_t i = 0; i < size; i++) {
+      const base::GridPoint& point = storage[i];
+
+      for (size_t t = 0; t < dim; t++) {
+        const base::level_t l = point.getLevel(t);
+        const double index = static_cast<double>(point.getIndex(t));
+        left[t] = toCoordinate(l, index - supportRadius);
+        right[t] = toCoordinate(l, index + supportRadius);
+      }
+
+      for (const std::vector<base::level_t>& subspace : subspaces) {
+        for (size_t t = 0; t < dim; t++) {
+          const std::vector<base::index_t>& indicesOfLevel = indices[t][subspace[t]];
+          std::vector<base::index_t>& candidatesOfLevel = candidates[t];
+          candidatesOfLevel.clear();
+
+          // one mesh width safety margin
+          const double lower = std::max(toIndex(subspace[t], left[t]) - supportRadius - 1.0, 0.0);
+          const double upper = toIndex(subspace[t], right[t]) + supportRadius + 1.0;
+
+          std::vector<base::index_t>::const_iterator first =
+              std::lower_bound(indicesOfLevel.begin(), indicesOfLevel.end(),
+                               static_cast<base::index_t>(std::ceil(lower)));
+          std::vector<base::index_t>::const_iterator last = std::upper_bound(
+              first, indicesOfLevel.end(), static_cast<base::index_t>(std::floor(upper)));
+
+          if (first != indicesOfLevel.begin()) {
+            candidatesOfLevel.push_back(indicesOfLevel.front());
+          }
+
+          candidatesOfLevel.insert(candidatesOfLevel.end(), first, last);
+
+          if (last != indicesOfLevel.end()) {
+            candidatesOfLevel.push_back(indicesOfLevel.back());
+          }
+        }
+
+        // iterate over the tensor product of the candidates
+        std::fill(counters.begin(), counters.end(), 0);
+
+        while (true) {
+          for (size_t t = 0; t < dim; t++) {
+            gridPoint.push(t, subspace[t], candidates[t][counters[t]]);
+          }
+
+          gridPoint.rehash();
+          const size_t j = storage.getSequenceNumber(gridPoint);
+
+          if (!storage.isInvalidSequenceNumber(j) && (j >= i)) {
+            store(i, j, entry(i, j));
+          }
+
+          size_t t = 0;
+
+          while ((t < dim) && (++counters[t] == candidates[t].size())) {
+            counters[t] = 0;
+            t++;
+          }
+
+          if (t == dim) {
+            break;
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Assembles a symmetric matrix into a dense matrix (see assembleSymmetricOverlapping),
+ * the entries of non-overlapping pairs are set to zero.
+ *
+ * @param storage         storage of the grid
+ * @param supportRadius   support radius of the basis functions in multiples of the mesh width
+ * @param clenshawCurtis  whether the grid points are Clenshaw-Curtis points
+ * @param entry           entry(i, j) returns \f$a_{ij}\f$ (has to be thread-safe)
+ * @param matrix          dense matrix of size at least size x size
+ */
+template <class ENTRY>
+void assembleSymmetricDense(base::GridStorage& storage, double supportRadius,
+                            bool clenshawCurtis, ENTRY& entry, base::DataMatrix& matrix) {
+  auto store = [&matrix](size_t i, size_t j, double value) {
+    matrix.set(i, j, value);
+    matrix.set(j, i, value);
+  };
+
+  matrix.setAll(0.0);
+  assembleSymmetricOverlapping(storage, supportRadius, clenshawCurtis, entry, store);
+}
+
+/**
+ * Assembles a symmetric matrix into a symmetric sparse matrix
+ * (see assembleSymmetricOverlapping), zero entries are not stored.
+ *
+ * @param storage         storage of the grid
+ * @param supportRadius   support radius of the basis functions in multiples of the mesh width
+ * @param clenshawCurtis  whether the grid points are Clenshaw-Curtis points
+ * @param entry           entry(i, j) returns \f$a_{ij}\f$ (has to be thread-safe)
+ * @param matrix          sparse matrix, is resized to size x size
+ */
+template <class ENTRY>
+void assembleSymmetricSparse(base::GridStorage& storage, double supportRadius,
+                             bool clenshawCurtis, ENTRY& entry,
+                             base::DataMatrixSymmetricSparse& matrix) {
+  const size_t size = storage.getSize();
+  std::vector<std::vector<std::pair<size_t, double>>> rows(size);
+  auto store = [&rows](size_t i, size_t j, double value) {
+    if (value != 0.0) {
+      rows[i].emplace_back(j, value);
+    }
+  };
+
+  assembleSymmetricOverlapping(storage, supportRadius, clenshawCurtis, entry, store);
+
+#pragma omp parallel for schedule(dynamic, 64)
+  for (size_t i = 0; i < size; i++) {
+    std::sort(rows[i].begin(), rows[i].end());
+  }
+
+  matrix.setRows(rows);
+}
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* SYMMETRICASSEMBLY_HPP */
@@ -10,6 +10,10 @@
 #include <sgpp_pde.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <vector>
+
 namespace sgpp {
 namespace pde {
 
@@ -502,6 +506,119 @@ BOOST_AUTO_TEST_CASE(testOperationMatrixLTwoDotExplicitBsplineClenshawCurtis) {
   delete opExplicit;
 }
 
+// test if the symmetric sparse storage equals the dense storage
+BOOST_AUTO_TEST_CASE(testOperationMatrixLTwoDotExplicitSparse) {
+  const size_t d = 3;
+  const size_t l = 3;
+  const size_t p = 3;
+  std::vector<sgpp::base::Grid*> grids = {
+      sgpp::base::Grid::createLinearGrid(d), sgpp::base::Grid::createBsplineGrid(d, p),
+      sgpp::base::Grid::createModBsplineGrid(d, p),
+      sgpp::base::Grid::createBsplineClenshawCurtisGrid(d, p),
+      sgpp::base::Grid::createModBsplineClenshawCurtisGrid(d, p)};
+
+  for (sgpp::base::Grid* grid : grids) {
+    grid->getGenerator().regular(l);
+
+    // adaptive grid, i.e., the subspaces are only partially filled
+    sgpp::base::DataVector refinementAlpha(grid->getSize());
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      refinementAlpha[i] = static_cast<double>(i % 5);
+    }
+
+    sgpp::base::SurplusRefinementFunctor functor(refinementAlpha, 10);
+    grid->getGenerator().refine(functor);
+
+    sgpp::base::OperationMatrix* opDense = sgpp::op_factory::createOperationLTwoDotExplicit(*grid);
+    sgpp::base::OperationMatrix* opSparse =
+        sgpp::op_factory::createOperationLTwoDotExplicitSparse(*grid);
+    sgpp::base::OperationMatrix* opImplicit =
+        sgpp::op_factory::createOperationLTwoDotProduct(*grid);
+    sgpp::base::DataVector alpha(grid->getSize());
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      alpha[i] = std::sin(static_cast<double>(i));
+    }
+
+    sgpp::base::DataVector resultDense(grid->getSize());
+    sgpp::base::DataVector resultSparse(grid->getSize());
+    sgpp::base::DataVector resultImplicit(grid->getSize());
+
+    opDense->mult(alpha, resultDense);
+    opSparse->mult(alpha, resultSparse);
+    opImplicit->mult(alpha, resultImplicit);
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      BOOST_CHECK_SMALL(resultDense.get(i) - resultSparse.get(i), 1e-12);
+      // there is no explicit-vs-implicit test case for ModBsplineClenshawCurtis grids above,
+      // the two operators don't agree for this grid type
+      if (grid->getType() != sgpp::base::GridType::ModBsplineClenshawCurtis) {
+        BOOST_CHECK_SMALL(resultDense.get(i) - resultImplicit.get(i), 1e-10);
+      }
+    }
+
+    // repeated multiplications reuse the buffers of the sparse matrix
+    opSparse->mult(alpha, resultSparse);
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      BOOST_CHECK_SMALL(resultDense.get(i) - resultSparse.get(i), 1e-12);
+    }
+
+    sgpp::base::DataVector diagonalDense(grid->getSize());
+    sgpp::base::DataVector diagonalSparse(grid->getSize());
+    opDense->getDiagonal(diagonalDense);
+    opSparse->getDiagonal(diagonalSparse);
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      BOOST_CHECK_GT(diagonalDense.get(i), 0.0);
+      BOOST_CHECK_SMALL(diagonalDense.get(i) - diagonalSparse.get(i), 1e-12);
+    }
+
+    delete opImplicit;
+    delete opSparse;
+    delete opDense;
+    delete grid;
+  }
+
+  // not implemented for other grid types
+  sgpp::base::Grid* grid(sgpp::base::Grid::createPolyGrid(d, p));
+  grid->getGenerator().regular(l);
+  BOOST_CHECK_THROW(sgpp::op_factory::createOperationLTwoDotExplicitSparse(*grid),
+                    sgpp::base::factory_exception);
+  delete grid;
+}
+
+// test the diagonal of the implicit operators against their multiplication with unit vectors
+BOOST_AUTO_TEST_CASE(testOperationLTwoDotProductDiagonal) {
+  const size_t d = 2;
+  const size_t l = 4;
+  std::vector<sgpp::base::Grid*> grids = {sgpp::base::Grid::createLinearGrid(d),
+                                          sgpp::base::Grid::createLinearBoundaryGrid(d),
+                                          sgpp::base::Grid::createLinearBoundaryGrid(d, 0)};
+
+  for (sgpp::base::Grid* grid : grids) {
+    grid->getGenerator().regular(l);
+    const size_t n = grid->getSize();
+
+    sgpp::base::OperationMatrix* op = sgpp::op_factory::createOperationLTwoDotProduct(*grid);
+    sgpp::base::DataVector diagonal(n);
+    sgpp::base::DataVector unitVector(n, 0.0);
+    sgpp::base::DataVector column(n);
+    op->getDiagonal(diagonal);
+
+    for (size_t i = 0; i < n; i++) {
+      unitVector[i] = 1.0;
+      op->mult(unitVector, column);
+      unitVector[i] = 0.0;
+      BOOST_CHECK_CLOSE(diagonal.get(i), column.get(i), 1e-10);
+    }
+
+    delete op;
+    delete grid;
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace pde
 }  // namespace sgpp
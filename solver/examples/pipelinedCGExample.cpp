@@ -0,0 +1,118 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/**
+ * \page example_pipelinedCGExample_cpp Pipelined Conjugate Gradients
+ * This example compares the runtime and the number of iterations of the conjugate gradients
+ * method and the pipelined conjugate gradients method (in double and single precision) for the
+ * five-point discretization of the Laplacian on a square, which is applied matrix-free.
+ * The size of the square and the number of repetitions can be passed as arguments.
+ */
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataVectorSP.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/operation/hash/OperationMatrixSP.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/ConjugateGradientsSP.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradientsSP.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+/**
+ * The system matrix is the five-point stencil on an n x n grid with homogeneous Dirichlet
+ * boundary conditions, applied without storing the matrix.
+ */
+template <class VECTOR, class OPERATION>
+class LaplaceStencil : public OPERATION {
+ public:
+  explicit LaplaceStencil(size_t n) : n(n) {}
+
+  void mult(VECTOR& alpha, VECTOR& result) override {
+    const auto* x = alpha.getPointer();
+    auto* y = result.getPointer();
+
+#pragma omp parallel for
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        const size_t k = i * n + j;
+        auto value = 4 * x[k];
+
+        if (i > 0) value -= x[k - n];
+        if (i + 1 < n) value -= x[k + n];
+        if (j > 0) value -= x[k - 1];
+        if (j + 1 < n) value -= x[k + 1];
+
+        y[k] = value;
+      }
+    }
+  }
+
+ private:
+  size_t n;
+};
+
+/**
+ * Solves the system a few times and prints the average runtime and the number of iterations.
+ */
+template <class SOLVER, class OPERATION, class VECTOR>
+void measure(const std::string& name, SOLVER& solver, OPERATION& op, VECTOR& b,
+             size_t repetitions) {
+  VECTOR alpha(b.getSize());
+  sgpp::base::SGppStopwatch stopwatch;
+  double duration = 0.0;
+
+  for (size_t r = 0; r < repetitions; r++) {
+    alpha.setAll(0.0);
+    stopwatch.start();
+    solver.solve(op, alpha, b, false, false);
+    duration += stopwatch.stop();
+  }
+
+  std::cout << name << ": " << duration / static_cast<double>(repetitions) << "s, "
+            << solver.getNumberIterations() << " iterations, residuum "
+            << solver.getResiduum() << std::endl;
+}
+
+int main(int argc, char** argv) {
+  const size_t n = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 500;
+  const size_t repetitions = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 3;
+  const size_t maxIterations = 100000;
+
+  std::cout << "grid: " << n << " x " << n << ", repetitions: " << repetitions << std::endl;
+
+  /**
+   * Double precision
+   */
+  LaplaceStencil<sgpp::base::DataVector, sgpp::base::OperationMatrix> op(n);
+  sgpp::base::DataVector b(n * n, 1.0);
+  sgpp::solver::ConjugateGradients cg(maxIterations, 1e-8);
+  sgpp::solver::PipelinedConjugateGradients pipelinedCG(maxIterations, 1e-8);
+  measure("CG                ", cg, op, b, repetitions);
+  measure("pipelined CG      ", pipelinedCG, op, b, repetitions);
+
+  /**
+   * Single precision (the attainable accuracy is limited by the condition number of the
+   * system, hence the tolerance is larger). The recurrences of the pipelined method lose
+   * accuracy faster than the ones of the classical method, such that it stagnates above the
+   * tolerance for large grids. Therefore, the comparison uses at most 100 x 100 points.
+   */
+  const size_t nSP = std::min(n, static_cast<size_t>(100));
+  std::cout << "grid (SP): " << nSP << " x " << nSP << std::endl;
+  LaplaceStencil<sgpp::base::DataVectorSP, sgpp::base::OperationMatrixSP> opSP(nSP);
+  sgpp::base::DataVectorSP bSP(nSP * nSP);
+  bSP.setAll(1.0f);
+  sgpp::solver::ConjugateGradientsSP cgSP(maxIterations, 1e-2f);
+  sgpp::solver::PipelinedConjugateGradientsSP pipelinedCGSP(maxIterations, 1e-2f);
+  measure("CG (SP)           ", cgSP, opSP, bSP, repetitions);
+  measure("pipelined CG (SP) ", pipelinedCGSP, opSP, bSP, repetitions);
+
+  return 0;
+}
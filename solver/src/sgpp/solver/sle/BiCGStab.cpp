@@ -11,7 +11,8 @@
 namespace sgpp {
 namespace solver {
 
-BiCGStab::BiCGStab(size_t imax, double epsilon) : SLESolver(imax, epsilon) {}
+BiCGStab::BiCGStab(size_t imax, double epsilon)
+    : SLESolver(imax, epsilon), preconditioner(nullptr) {}
 
 BiCGStab::~BiCGStab() {}
 
@@ -26,7 +27,8 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
   }
 
   // Calculate r0
-  sgpp::base::DataVector r(alpha.getSize());
+  r.resize(alpha.getSize());
+  r.setAll(0.0);
   SystemMatrix.mult(alpha, r);
   r.sub(b);
 
@@ -38,9 +40,9 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
   }
 
   // Choose r0 as r
-  sgpp::base::DataVector rZero(r);
+  rZero = r;
   // Set p as r0
-  sgpp::base::DataVector p(rZero);
+  p = rZero;
 
   double rho = rZero.dotProduct(r);
   double rho_new = 0.0;
@@ -49,18 +51,33 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
   double omega = 0.0;
   double beta = 0.0;
 
-  sgpp::base::DataVector s(alpha.getSize());
-  sgpp::base::DataVector v(alpha.getSize());
-  sgpp::base::DataVector w(alpha.getSize());
+  s.resize(alpha.getSize());
+  v.resize(alpha.getSize());
+  w.resize(alpha.getSize());
 
   s.setAll(0.0);
   v.setAll(0.0);
   w.setAll(0.0);
 
+  // without preconditioner, the preconditioned vectors are the vectors themselves
+  sgpp::base::DataVector& precondP = (preconditioner == nullptr) ? p : pHat;
+  sgpp::base::DataVector& precondW = (preconditioner == nullptr) ? w : wHat;
+
+  if (preconditioner != nullptr) {
+    pHat.resize(alpha.getSize());
+    wHat.resize(alpha.getSize());
+    pHat.setAll(0.0);
+    wHat.setAll(0.0);
+  }
+
   while (this->nIterations < this->nMaxIterations) {
-    // s  = Ap
+    // s  = A M^{-1} p
+    if (preconditioner != nullptr) {
+      preconditioner->mult(p, pHat);
+    }
+
     s.setAll(0.0);
-    SystemMatrix.mult(p, s);
+    SystemMatrix.mult(precondP, s);
 
     // std::cout << "s " << s.get(0) << " " << s.get(1)  << std::endl;
 
@@ -76,17 +93,21 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
     w = r;
     w.axpy((-1.0) * a, s);
 
-    // v = Aw
+    // v = A M^{-1} w
+    if (preconditioner != nullptr) {
+      preconditioner->mult(w, wHat);
+    }
+
     v.setAll(0.0);
-    SystemMatrix.mult(w, v);
+    SystemMatrix.mult(precondW, v);
 
     // std::cout << "v " << v.get(0) << " " << v.get(1)  << std::endl;
 
     omega = (v.dotProduct(w)) / (v.dotProduct(v));
 
-    // x = x - a*p - omega*w
-    alpha.axpy((-1.0) * a, p);
-    alpha.axpy((-1.0) * omega, w);
+    // x = x - a*M^{-1}p - omega*M^{-1}w
+    alpha.axpy((-1.0) * a, precondP);
+    alpha.axpy((-1.0) * omega, precondW);
 
     // r = r - a*s - omega*v
     r.axpy((-1.0) * a, s);
@@ -119,5 +140,11 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
   }
 }
 
+void BiCGStab::setPreconditioner(sgpp::base::OperationMatrix* preconditioner) {
+  this->preconditioner = preconditioner;
+}
+
+sgpp::base::OperationMatrix* BiCGStab::getPreconditioner() const { return preconditioner; }
+
 }  // namespace solver
 }  // namespace sgpp
@@ -17,6 +17,15 @@
 namespace sgpp {
 namespace solver {
 
+/**
+ * (Right-preconditioned) BiCGStab method.
+ *
+ * If a preconditioner \f$M^{-1}\f$ is set (see setPreconditioner()), the system
+ * \f$A M^{-1} y = b\f$, \f$x = M^{-1} y\f$ is solved, i.e., the residual used in the
+ * stopping criterion is the one of the original system.
+ * The temporary vectors are kept between calls of solve() and are only reallocated
+ * if the size of the system changes.
+ */
 class BiCGStab : public SLESolver {
  public:
   /**
@@ -40,6 +49,35 @@ class BiCGStab : public SLESolver {
   virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
                      sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
                      double max_threshold = -1.0);
+
+  /**
+   * Sets the preconditioner, i.e., the operation that applies an approximation of the
+   * inverse of the system matrix to a vector (e.g., JacobiPreconditioner,
+   * LevelScalingPreconditioner or BlockJacobiPreconditioner).
+   *
+   * @param preconditioner  preconditioner (not owned, has to outlive the solves),
+   *                        nullptr disables preconditioning (default)
+   */
+  void setPreconditioner(sgpp::base::OperationMatrix* preconditioner);
+
+  /**
+   * @return preconditioner (nullptr if none is set)
+   */
+  sgpp::base::OperationMatrix* getPreconditioner() const;
+
+ protected:
+  /// preconditioner (nullptr if none is set)
+  sgpp::base::OperationMatrix* preconditioner;
+  /// residual (reused between solves)
+  sgpp::base::DataVector r;
+  /// initial residual (reused between solves)
+  sgpp::base::DataVector rZero;
+  /// search direction (reused between solves)
+  sgpp::base::DataVector p;
+  /// temporary vectors (reused between solves)
+  sgpp::base::DataVector s, v, w;
+  /// preconditioned search direction and temporary vector (reused between solves)
+  sgpp::base::DataVector pHat, wHat;
 };
 
 }  // namespace solver
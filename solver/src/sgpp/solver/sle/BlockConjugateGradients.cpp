@@ -0,0 +1,298 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/BlockConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+namespace {
+
+/**
+ * Copies the given columns of a matrix into a new matrix.
+ *
+ * @param       source  matrix
+ * @param       columns indices of the columns to copy
+ * @param[out]  result  matrix with one column for every entry of columns
+ */
+void gatherColumns(const sgpp::base::DataMatrix& source, const std::vector<size_t>& columns,
+                   sgpp::base::DataMatrix& result) {
+  const size_t numRows = source.getNrows();
+  const size_t numColumns = columns.size();
+  result.resizeRowsCols(numRows, numColumns);
+
+  for (size_t i = 0; i < numRows; i++) {
+    for (size_t a = 0; a < numColumns; a++) {
+      result(i, a) = source(i, columns[a]);
+    }
+  }
+}
+
+/**
+ * Computes the dot products of corresponding columns of two matrices.
+ *
+ * @param       x       first matrix
+ * @param       y       second matrix (same size as x)
+ * @param       columns indices of the columns
+ * @param[out]  result  result[columns[a]] is set to the dot product of the columns[a]-th
+ *                      columns of x and y
+ */
+void columnDotProducts(const sgpp::base::DataMatrix& x, const sgpp::base::DataMatrix& y,
+                       const std::vector<size_t>& columns, std::vector<double>& result) {
+  const size_t numRows = x.getNrows();
+  const size_t numCols = x.getNcols();
+  const size_t numColumns = columns.size();
+  const double* const xPtr = x.getPointer();
+  const double* const yPtr = y.getPointer();
+
+  for (size_t c : columns) {
+    result[c] = 0.0;
+  }
+
+  // the rows are split among the threads, every thread sums up its rows for all columns
+#pragma omp parallel
+  {
+    std::vector<double> partialSums(numColumns, 0.0);
+
+#pragma omp for schedule(static)
+    for (size_t i = 0; i < numRows; i++) {
+      const double* const xRow = xPtr + i * numCols;
+      const double* const yRow = yPtr + i * numCols;
+
+      for (size_t a = 0; a < numColumns; a++) {
+        partialSums[a] += xRow[columns[a]] * yRow[columns[a]];
+      }
+    }
+
+#pragma omp critical
+    {
+      for (size_t a = 0; a < numColumns; a++) {
+        result[columns[a]] += partialSums[a];
+      }
+    }
+  }
+}
+
+}  // namespace
+
+BlockConjugateGradients::BlockConjugateGradients(size_t imax, double epsilon)
+    : ConjugateGradients(imax, epsilon) {}
+
+BlockConjugateGradients::~BlockConjugateGradients() {}
+
+void BlockConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                    sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& b,
+                                    bool reuse, bool verbose, double max_threshold) {
+  this->starting();
+
+  const size_t dim = b.getNrows();
+  const size_t numRHS = b.getNcols();
+
+  if (verbose == true) {
+    std::cout << "Starting Block Conjugated Gradients with " << numRHS << " right-hand sides"
+              << std::endl;
+  }
+
+  // needed for residuum calculation
+  const double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  const bool preconditioned = (preconditioner != nullptr);
+  // number off current iterations
+  this->nIterations = 0;
+
+  std::vector<double> deltaZero(numRHS, 0.0);
+  std::vector<double> rr(numRHS, 0.0);
+  std::vector<double> rho(numRHS, 0.0);
+  std::vector<double> rhoNew(numRHS, 0.0);
+  std::vector<size_t> activeColumns(numRHS);
+
+  for (size_t j = 0; j < numRHS; j++) {
+    activeColumns[j] = j;
+  }
+
+  // without preconditioner, the preconditioned residuals are the residuals
+  sgpp::base::DataMatrix& zRef = (preconditioned ? zBlock : rBlock);
+
+  rBlock = b;
+  alpha.resizeRowsCols(dim, numRHS);
+
+  if (reuse == true) {
+    columnDotProducts(b, b, activeColumns, deltaZero);
+
+    for (size_t j = 0; j < numRHS; j++) {
+      deltaZero[j] *= epsilonSquared;
+    }
+
+    // calculate the starting residuals
+    SystemMatrix.multBlock(alpha, tempBlock);
+    rBlock.sub(tempBlock);
+  } else {
+    // the starting residuals are the right-hand sides
+    alpha.setAll(0.0);
+  }
+
+  if (preconditioned) {
+    preconditioner->multBlock(rBlock, zBlock);
+  }
+
+  dBlock = zRef;
+  columnDotProducts(rBlock, zRef, activeColumns, rho);
+  columnDotProducts(rBlock, rBlock, activeColumns, rr);
+
+  if (reuse == false) {
+    for (size_t j = 0; j < numRHS; j++) {
+      deltaZero[j] = rr[j] * epsilonSquared;
+    }
+  }
+
+  activeColumns.erase(std::remove_if(activeColumns.begin(), activeColumns.end(),
+                                     [&](size_t j) {
+                                       return (rr[j] <= deltaZero[j]) || (rr[j] <= max_threshold);
+                                     }),
+                      activeColumns.end());
+
+  this->residuum = (numRHS > 0) ? (*std::max_element(deltaZero.begin(), deltaZero.end()) /
+                                   epsilonSquared)
+                                : 0.0;
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << this->residuum << std::endl;
+    std::cout << "Target norm:               " << this->residuum * epsilonSquared << std::endl;
+  }
+
+  std::vector<double> stepLengths;
+  std::vector<bool> breakdown;
+
+  while ((this->nIterations < this->nMaxIterations) && !activeColumns.empty()) {
+    const size_t numActive = activeColumns.size();
+
+    // apply the system matrix to all active search directions at once
+    gatherColumns(dBlock, activeColumns, dActive);
+    SystemMatrix.multBlock(dActive, qActive);
+
+    // calculate the step lengths
+    std::vector<size_t> compactColumns(numActive);
+    std::vector<double> dq(numActive, 0.0);
+
+    for (size_t a = 0; a < numActive; a++) {
+      compactColumns[a] = a;
+    }
+
+    columnDotProducts(dActive, qActive, compactColumns, dq);
+    stepLengths.assign(numActive, 0.0);
+    breakdown.assign(numActive, false);
+
+    for (size_t a = 0; a < numActive; a++) {
+      if (dq[a] == 0.0) {
+        breakdown[a] = true;
+      } else {
+        stepLengths[a] = rho[activeColumns[a]] / dq[a];
+      }
+    }
+
+    // update the solutions and the residuals
+    const bool replaceResiduals = (this->nIterations > 0) && ((this->nIterations % 50) == 0);
+
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < dim; i++) {
+      for (size_t a = 0; a < numActive; a++) {
+        const size_t c = activeColumns[a];
+        alpha(i, c) += stepLengths[a] * dActive(i, a);
+
+        if (!replaceResiduals) {
+          rBlock(i, c) -= stepLengths[a] * qActive(i, a);
+        }
+      }
+    }
+
+    if (replaceResiduals) {
+      // replace the recursively updated residuals by the true ones from time to time
+      gatherColumns(alpha, activeColumns, dActive);
+      SystemMatrix.multBlock(dActive, qActive);
+
+      for (size_t i = 0; i < dim; i++) {
+        for (size_t a = 0; a < numActive; a++) {
+          const size_t c = activeColumns[a];
+          rBlock(i, c) = b(i, c) - qActive(i, a);
+        }
+      }
+    }
+
+    if (preconditioned) {
+      gatherColumns(rBlock, activeColumns, tempBlock);
+      preconditioner->multBlock(tempBlock, qActive);
+
+      for (size_t i = 0; i < dim; i++) {
+        for (size_t a = 0; a < numActive; a++) {
+          zBlock(i, activeColumns[a]) = qActive(i, a);
+        }
+      }
+    }
+
+    columnDotProducts(rBlock, zRef, activeColumns, rhoNew);
+    columnDotProducts(rBlock, rBlock, activeColumns, rr);
+
+    // update the search directions
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < dim; i++) {
+      for (size_t c : activeColumns) {
+        dBlock(i, c) = zRef(i, c) + (rhoNew[c] / rho[c]) * dBlock(i, c);
+      }
+    }
+
+    for (size_t c : activeColumns) {
+      rho[c] = rhoNew[c];
+    }
+
+    // remove converged right-hand sides
+    std::vector<size_t> remainingColumns;
+
+    for (size_t a = 0; a < numActive; a++) {
+      const size_t c = activeColumns[a];
+
+      if (!breakdown[a] && (rr[c] > deltaZero[c]) && (rr[c] > max_threshold)) {
+        remainingColumns.push_back(c);
+      }
+    }
+
+    activeColumns.swap(remainingColumns);
+
+    this->residuum = *std::max_element(rr.begin(), rr.end());
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "delta: " << this->residuum << " (" << activeColumns.size()
+                << " right-hand sides not converged)" << std::endl;
+    }
+
+    this->nIterations++;
+  }
+
+  residuals.resize(numRHS);
+
+  for (size_t j = 0; j < numRHS; j++) {
+    residuals[j] = rr[j];
+  }
+
+  this->residuum = (numRHS > 0) ? *std::max_element(rr.begin(), rr.end()) : 0.0;
+  this->complete();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << this->residuum << std::endl;
+  }
+}
+
+const sgpp::base::DataVector& BlockConjugateGradients::getResiduals() const { return residuals; }
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,92 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BLOCKCONJUGATEGRADIENTS_HPP
+#define BLOCKCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * (Preconditioned) conjugate gradients method for systems with multiple right-hand sides
+ * \f$A X = B\f$, where the columns of \f$B\f$ are the right-hand sides.
+ *
+ * The CG recurrences of all right-hand sides are run simultaneously, i.e., in every
+ * iteration the system matrix (and the preconditioner) is applied to all search directions
+ * at once via base::OperationMatrix::multBlock. For system matrices whose cost is dominated
+ * by streaming the data (e.g., datadriven::DMSystemMatrix), this costs almost as much as a
+ * single matrix vector product. Each column uses its own step lengths and stopping criterion
+ * (the same as in ConjugateGradients), which results in the same iterates as solving the
+ * systems one after another (up to rounding). Converged columns are removed from the block.
+ */
+class BlockConjugateGradients : public ConjugateGradients {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param imax    maximum number of iterations
+   * @param epsilon relative tolerance of the residual (for every right-hand side)
+   */
+  BlockConjugateGradients(size_t imax, double epsilon);
+
+  /**
+   * Destructor.
+   */
+  ~BlockConjugateGradients() override;
+
+  using ConjugateGradients::solve;
+
+  /**
+   * Solves the system for multiple right-hand sides.
+   *
+   * @param SystemMatrix  system matrix
+   * @param alpha         solutions (one column per right-hand side), is resized if necessary
+   * @param b             right-hand sides (one column per right-hand side)
+   * @param reuse         whether the solutions stored in alpha at calling time
+   *                      should be used as starting values
+   * @param verbose       prints information during execution of the solver
+   * @param max_threshold additional abort criterion for the squared residual norms
+   */
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+             sgpp::base::DataMatrix& b, bool reuse = false, bool verbose = false,
+             double max_threshold = -1.0);
+
+  /**
+   * @return squared norms of the residuals of the last block solve (one entry per
+   *         right-hand side), getResiduum() returns their maximum
+   */
+  const sgpp::base::DataVector& getResiduals() const;
+
+ protected:
+  /// residuals (reused between solves)
+  sgpp::base::DataMatrix rBlock;
+  /// preconditioned residuals (reused between solves)
+  sgpp::base::DataMatrix zBlock;
+  /// search directions (reused between solves)
+  sgpp::base::DataMatrix dBlock;
+  /// search directions of the active right-hand sides (reused between solves)
+  sgpp::base::DataMatrix dActive;
+  /// matrix times search directions of the active right-hand sides (reused between solves)
+  sgpp::base::DataMatrix qActive;
+  /// temporary matrix (reused between solves)
+  sgpp::base::DataMatrix tempBlock;
+  /// squared residual norms of the last block solve
+  sgpp::base::DataVector residuals;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* BLOCKCONJUGATEGRADIENTS_HPP */
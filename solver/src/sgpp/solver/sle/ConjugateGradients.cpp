@@ -15,7 +15,8 @@
 namespace sgpp {
 namespace solver {
 
-ConjugateGradients::ConjugateGradients(size_t imax, double epsilon) : SLESolver(imax, epsilon) {}
+ConjugateGradients::ConjugateGradients(size_t imax, double epsilon)
+    : SLESolver(imax, epsilon), preconditioner(nullptr) {}
 
 ConjugateGradients::~ConjugateGradients() {}
 
@@ -33,14 +34,22 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
   // number off current iterations
   this->nIterations = 0;
 
-  // define temporal vectors
-  sgpp::base::DataVector temp(alpha.getSize());
-  sgpp::base::DataVector q(alpha.getSize());
-  sgpp::base::DataVector r(b);
+  // (re-)use temporal vectors (no reallocation if the size hasn't changed)
+  temp.resize(alpha.getSize());
+  q.resize(alpha.getSize());
+  z.resize(alpha.getSize());
+  temp.setAll(0.0);
+  q.setAll(0.0);
+  z.setAll(0.0);
+  r = b;
+
+  // without preconditioner, the preconditioned residual is the residual itself
+  sgpp::base::DataVector& precondR = (preconditioner == nullptr) ? r : z;
 
   double delta_0 = 0.0;
-  double delta_old = 0.0;
   double delta_new = 0.0;
+  double rho_old = 0.0;
+  double rho_new = 0.0;
   double beta = 0.0;
   double a = 0.0;
 
@@ -63,10 +72,14 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
 
   r.sub(temp);
 
-  sgpp::base::DataVector d(r);
+  if (preconditioner != nullptr) {
+    preconditioner->mult(r, z);
+  }
+
+  d = precondR;
 
-  delta_old = 0.0;
   delta_new = r.dotProduct(r);
+  rho_new = r.dotProduct(precondR);
 
   if (reuse == false) {
     delta_0 = delta_new * epsilonSquared;
@@ -101,8 +114,8 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
       break;
     }
 
-    // a = d_new / d.q
-    a = delta_new / d.dotProduct(q);
+    // a = rho_new / d.q
+    a = rho_new / dq;
 
     // x = x + a*d
     alpha.axpy(a, d);
@@ -118,10 +131,16 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
       r.axpy(-a, q);
     }
 
+    // z = M^{-1} r
+    if (preconditioner != nullptr) {
+      preconditioner->mult(r, z);
+    }
+
     // calculate new deltas and determine beta
-    delta_old = delta_new;
     delta_new = r.dotProduct(r);
-    beta = delta_new / delta_old;
+    rho_old = rho_new;
+    rho_new = r.dotProduct(precondR);
+    beta = rho_new / rho_old;
 
 #ifdef X86_MIC_SYMMETRIC
     MPI_Bcast(&delta_new, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
@@ -135,7 +154,7 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
     }
 
     d.mult(beta);
-    d.add(r);
+    d.add(precondR);
 
     this->nIterations++;
   }
@@ -150,6 +169,14 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
   }
 }
 
+void ConjugateGradients::setPreconditioner(sgpp::base::OperationMatrix* preconditioner) {
+  this->preconditioner = preconditioner;
+}
+
+sgpp::base::OperationMatrix* ConjugateGradients::getPreconditioner() const {
+  return preconditioner;
+}
+
 void ConjugateGradients::starting() {}
 
 void ConjugateGradients::calcStarting() {}
@@ -8,6 +8,7 @@
 
 #include <sgpp/solver/SLESolver.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -16,6 +17,15 @@
 namespace sgpp {
 namespace solver {
 
+/**
+ * (Preconditioned) conjugate gradients method.
+ *
+ * If a preconditioner \f$M^{-1}\f$ is set (see setPreconditioner()), the preconditioned
+ * method is used, whose convergence depends on the condition of \f$M^{-1} A\f$ instead of
+ * \f$A\f$. The stopping criterion is always based on the unpreconditioned residual.
+ * The temporary vectors are kept between calls of solve() and are only reallocated
+ * if the size of the system changes.
+ */
 class ConjugateGradients : public SLESolver {
  public:
   /**
@@ -32,6 +42,22 @@ class ConjugateGradients : public SLESolver {
                      sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
                      double max_threshold = -1.0);
 
+  /**
+   * Sets the preconditioner, i.e., the operation that applies an approximation of the
+   * inverse of the system matrix to a vector (e.g., JacobiPreconditioner,
+   * LevelScalingPreconditioner or BlockJacobiPreconditioner).
+   * The preconditioner has to be symmetric positive definite.
+   *
+   * @param preconditioner  preconditioner (not owned, has to outlive the solves),
+   *                        nullptr disables preconditioning (default)
+   */
+  void setPreconditioner(sgpp::base::OperationMatrix* preconditioner);
+
+  /**
+   * @return preconditioner (nullptr if none is set)
+   */
+  sgpp::base::OperationMatrix* getPreconditioner() const;
+
   // Define functions for observer pattern in python
 
   /**
@@ -54,6 +80,20 @@ class ConjugateGradients : public SLESolver {
    * function that signals the finish of the cg method (used in python)
    */
   virtual void complete();
+
+ protected:
+  /// preconditioner (nullptr if none is set)
+  sgpp::base::OperationMatrix* preconditioner;
+  /// temporary vector (reused between solves)
+  sgpp::base::DataVector temp;
+  /// matrix times search direction (reused between solves)
+  sgpp::base::DataVector q;
+  /// residual (reused between solves)
+  sgpp::base::DataVector r;
+  /// search direction (reused between solves)
+  sgpp::base::DataVector d;
+  /// preconditioned residual (reused between solves)
+  sgpp::base::DataVector z;
 };
 
 }  // namespace solver
@@ -0,0 +1,199 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/MultiShiftConjugateGradients.hpp>
+
+#include <sgpp/base/exception/solver_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+MultiShiftConjugateGradients::MultiShiftConjugateGradients(size_t imax, double epsilon)
+    : ConjugateGradients(imax, epsilon) {}
+
+MultiShiftConjugateGradients::~MultiShiftConjugateGradients() {}
+
+void MultiShiftConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                         sgpp::base::DataMatrix& alpha, sgpp::base::DataVector& b,
+                                         const std::vector<double>& shifts, bool verbose) {
+  if (preconditioner != nullptr) {
+    throw sgpp::base::solver_exception(
+        "MultiShiftConjugateGradients::solve : Preconditioning is not supported");
+  }
+
+  this->starting();
+
+  const size_t dim = b.getSize();
+  const size_t numShifts = shifts.size();
+
+  if (verbose == true) {
+    std::cout << "Starting Multi-Shift Conjugated Gradients with " << numShifts << " shifts"
+              << std::endl;
+  }
+
+  // needed for residuum calculation
+  const double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  // number off current iterations
+  this->nIterations = 0;
+
+  alpha.resizeRowsCols(dim, numShifts);
+  alpha.setAll(0.0);
+  residuals.resize(numShifts);
+
+  // the CG iteration is performed for the smallest shift (the worst conditioned system)
+  const double seedShift = (numShifts > 0) ? *std::min_element(shifts.begin(), shifts.end())
+                                           : 0.0;
+
+  // the starting residuals of all shifted systems are b
+  r = b;
+  d = b;
+  q.resize(dim);
+  pBlock.resizeRowsCols(dim, numShifts);
+
+  for (size_t i = 0; i < dim; i++) {
+    for (size_t s = 0; s < numShifts; s++) {
+      pBlock(i, s) = b[i];
+    }
+  }
+
+  double rr = r.dotProduct(r);
+  const double delta_0 = rr * epsilonSquared;
+
+  // residual of shift s is zeta[s] * r
+  std::vector<double> zeta(numShifts, 1.0);
+  std::vector<double> zetaOld(numShifts, 1.0);
+  std::vector<double> zetaNew(numShifts, 1.0);
+  std::vector<double> stepLengths(numShifts, 0.0);
+  std::vector<size_t> activeShifts;
+
+  for (size_t s = 0; s < numShifts; s++) {
+    residuals[s] = rr;
+
+    if (rr > delta_0) {
+      activeShifts.push_back(s);
+    }
+  }
+
+  this->residuum = rr;
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << rr << std::endl;
+    std::cout << "Target norm:               " << delta_0 << std::endl;
+  }
+
+  double stepOld = 1.0;
+  double betaOld = 0.0;
+
+  while ((this->nIterations < this->nMaxIterations) && !activeShifts.empty()) {
+    // q = (A + seedShift * I) d
+    SystemMatrix.mult(d, q);
+
+    if (seedShift != 0.0) {
+      q.axpy(seedShift, d);
+    }
+
+    const double dq = d.dotProduct(q);
+
+    if (dq == 0.0) {
+      break;
+    }
+
+    const double step = rr / dq;
+
+    // step lengths of the shifted systems
+    std::vector<size_t> updatedShifts;
+
+    for (size_t s : activeShifts) {
+      const double delta = shifts[s] - seedShift;
+      const double denominator = step * betaOld * (zetaOld[s] - zeta[s]) +
+                                 zetaOld[s] * stepOld * (1.0 + delta * step);
+
+      if ((denominator != 0.0) && (zeta[s] != 0.0)) {
+        zetaNew[s] = zeta[s] * zetaOld[s] * stepOld / denominator;
+        stepLengths[s] = step * zetaNew[s] / zeta[s];
+        updatedShifts.push_back(s);
+      }
+    }
+
+    // update the solutions of the shifted systems
+    for (size_t i = 0; i < dim; i++) {
+      for (size_t s : updatedShifts) {
+        alpha(i, s) += stepLengths[s] * pBlock(i, s);
+      }
+    }
+
+    // update the residual and the search direction of the CG iteration
+    r.axpy(-step, q);
+    const double rrNew = r.dotProduct(r);
+    const double beta = rrNew / rr;
+
+    d.mult(beta);
+    d.add(r);
+
+    // update the search directions of the shifted systems
+    std::vector<double> betas(numShifts, 0.0);
+
+    for (size_t s : updatedShifts) {
+      const double zetaRatio = zetaNew[s] / zeta[s];
+      betas[s] = beta * zetaRatio * zetaRatio;
+    }
+
+    for (size_t i = 0; i < dim; i++) {
+      for (size_t s : updatedShifts) {
+        pBlock(i, s) = zetaNew[s] * r[i] + betas[s] * pBlock(i, s);
+      }
+    }
+
+    // remove converged shifts
+    activeShifts.clear();
+
+    for (size_t s : updatedShifts) {
+      zetaOld[s] = zeta[s];
+      zeta[s] = zetaNew[s];
+      residuals[s] = zeta[s] * zeta[s] * rrNew;
+
+      if (residuals[s] > delta_0) {
+        activeShifts.push_back(s);
+      }
+    }
+
+    stepOld = step;
+    betaOld = beta;
+    rr = rrNew;
+
+    this->residuum = residuals.max();
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "delta: " << this->residuum << " (" << activeShifts.size()
+                << " shifts not converged)" << std::endl;
+    }
+
+    this->nIterations++;
+  }
+
+  this->residuum = (numShifts > 0) ? residuals.max() : 0.0;
+  this->complete();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << this->residuum << std::endl;
+  }
+}
+
+const sgpp::base::DataVector& MultiShiftConjugateGradients::getResiduals() const {
+  return residuals;
+}
+
+}  // namespace solver
+}  // namespace sgpp
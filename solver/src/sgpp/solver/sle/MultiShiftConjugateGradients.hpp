@@ -0,0 +1,85 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef MULTISHIFTCONJUGATEGRADIENTS_HPP
+#define MULTISHIFTCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Multi-shift conjugate gradients method for solving the shifted systems
+ * \f$(A + \sigma_s I) x_s = b\f$ for multiple shifts \f$\sigma_s\f$ at once
+ * (e.g., regularized least squares systems \f$(B^T B + M \lambda_s I) \alpha_s = B^T y\f$
+ * for a sweep of regularization parameters).
+ *
+ * As the Krylov spaces of all shifted systems coincide, only one CG run (for the smallest
+ * shift) is needed, i.e., one application of \f$A\f$ per iteration regardless of the number
+ * of shifts. The iterates of the other shifts are obtained by short scalar recurrences
+ * (Frommer, BiCGStab(l) for families of shifted linear systems, Computing 70(2), 2003).
+ * Every shift uses the same stopping criterion as ConjugateGradients and is not updated
+ * anymore once converged.
+ *
+ * The starting vectors have to be zero and preconditioning is not supported, since both
+ * would destroy the shift invariance of the Krylov space.
+ */
+class MultiShiftConjugateGradients : public ConjugateGradients {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param imax    maximum number of iterations
+   * @param epsilon relative tolerance of the residual (for every shift)
+   */
+  MultiShiftConjugateGradients(size_t imax, double epsilon);
+
+  /**
+   * Destructor.
+   */
+  ~MultiShiftConjugateGradients() override;
+
+  using ConjugateGradients::solve;
+
+  /**
+   * Solves the shifted systems for all shifts.
+   *
+   * @param SystemMatrix  system matrix \f$A\f$ (symmetric, such that all \f$A + \sigma_s I\f$
+   *                      are positive definite)
+   * @param alpha         solutions (one column per shift), is resized if necessary
+   * @param b             right-hand side
+   * @param shifts        shifts \f$\sigma_s\f$
+   * @param verbose       prints information during execution of the solver
+   */
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+             sgpp::base::DataVector& b, const std::vector<double>& shifts,
+             bool verbose = false);
+
+  /**
+   * @return squared norms of the residuals of the last multi-shift solve (one entry per
+   *         shift), getResiduum() returns their maximum
+   */
+  const sgpp::base::DataVector& getResiduals() const;
+
+ protected:
+  /// search directions of the shifted systems (reused between solves)
+  sgpp::base::DataMatrix pBlock;
+  /// squared residual norms of the last multi-shift solve
+  sgpp::base::DataVector residuals;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* MULTISHIFTCONJUGATEGRADIENTS_HPP */
@@ -0,0 +1,254 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <iostream>
+
+namespace sgpp {
+namespace solver {
+
+namespace {
+
+/**
+ * Computes all dot products needed by the pipelined CG method in one pass.
+ *
+ * @param       r     residual
+ * @param       u     preconditioned residual
+ * @param       w     matrix times preconditioned residual
+ * @param[out]  gamma \f$r^{\mathrm{T}} u\f$
+ * @param[out]  delta \f$w^{\mathrm{T}} u\f$
+ * @param[out]  rr    \f$r^{\mathrm{T}} r\f$
+ */
+void fusedDotProducts(const sgpp::base::DataVector& r, const sgpp::base::DataVector& u,
+                      const sgpp::base::DataVector& w, double& gamma, double& delta, double& rr) {
+  const size_t dim = r.getSize();
+  const double* rPtr = r.data();
+  const double* uPtr = u.data();
+  const double* wPtr = w.data();
+  double curGamma = 0.0;
+  double curDelta = 0.0;
+  double curRR = 0.0;
+
+#pragma omp parallel for reduction(+ : curGamma, curDelta, curRR)
+  for (size_t i = 0; i < dim; i++) {
+    curGamma += rPtr[i] * uPtr[i];
+    curDelta += wPtr[i] * uPtr[i];
+    curRR += rPtr[i] * rPtr[i];
+  }
+
+  gamma = curGamma;
+  delta = curDelta;
+  rr = curRR;
+}
+
+}  // namespace
+
+PipelinedConjugateGradients::PipelinedConjugateGradients(size_t imax, double epsilon)
+    : ConjugateGradients(imax, epsilon) {}
+
+PipelinedConjugateGradients::~PipelinedConjugateGradients() {}
+
+void PipelinedConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                        sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                        bool reuse, bool verbose, double max_threshold) {
+  this->starting();
+
+  if (verbose == true) {
+    std::cout << "Starting Pipelined Conjugated Gradients" << std::endl;
+  }
+
+  // needed for residuum calculation
+  const double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  const size_t dim = alpha.getSize();
+  const bool preconditioned = (preconditioner != nullptr);
+  // number off current iterations
+  this->nIterations = 0;
+
+  // (re-)use temporal vectors, the inherited vectors are used as
+  // q = M^{-1} s and z = A q
+  for (sgpp::base::DataVector* vec : {&temp, &w, &n, &s, &p, &z, &u, &m, &q}) {
+    vec->resize(dim);
+    vec->setAll(0.0);
+  }
+
+  r = b;
+
+  // without preconditioner, u = r, m = w and q = s
+  sgpp::base::DataVector& uRef = (preconditioned ? u : r);
+  sgpp::base::DataVector& mRef = (preconditioned ? m : w);
+  sgpp::base::DataVector& qRef = (preconditioned ? q : s);
+
+  double delta_0 = 0.0;
+  double gamma = 0.0;
+  double delta = 0.0;
+  double rr = 0.0;
+
+  if (reuse == true) {
+    SystemMatrix.mult(s, temp);
+    r.sub(temp);
+    delta_0 = r.dotProduct(r) * epsilonSquared;
+  } else {
+    alpha.setAll(0.0);
+  }
+
+  // calculate the starting residuum
+  SystemMatrix.mult(alpha, temp);
+  r.sub(temp);
+
+  if (preconditioned) {
+    preconditioner->mult(r, u);
+  }
+
+  SystemMatrix.mult(uRef, w);
+  fusedDotProducts(r, uRef, w, gamma, delta, rr);
+
+  if (reuse == false) {
+    delta_0 = rr * epsilonSquared;
+  }
+
+  this->residuum = (delta_0 / epsilonSquared);
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << (delta_0 / epsilonSquared) << std::endl;
+    std::cout << "Target norm:               " << (delta_0) << std::endl;
+  }
+
+  double gammaOld = 0.0;
+  double aOld = 0.0;
+  double beta = 0.0;
+  double a = 0.0;
+
+  while ((this->nIterations < this->nMaxIterations) && (rr > delta_0) && (rr > max_threshold)) {
+    // m = M^{-1} w, n = A m
+    // (independent of the reduction of the previous pass)
+    if (preconditioned) {
+      preconditioner->mult(w, m);
+    }
+
+    SystemMatrix.mult(mRef, n);
+
+    double denominator = delta;
+
+    if (this->nIterations > 0) {
+      beta = gamma / gammaOld;
+      denominator = delta - beta * gamma / aOld;
+    } else {
+      beta = 0.0;
+    }
+
+    if (denominator == 0.0) {
+      break;
+    }
+
+    a = gamma / denominator;
+    gammaOld = gamma;
+    aOld = a;
+
+    // fused update of all vectors and computation of the new dot products
+    double* const xPtr = alpha.data();
+    double* const rPtr = r.data();
+    double* const uPtr = uRef.data();
+    double* const wPtr = w.data();
+    const double* const mPtr = mRef.data();
+    const double* const nPtr = n.data();
+    double* const sPtr = s.data();
+    double* const pPtr = p.data();
+    double* const qPtr = qRef.data();
+    double* const zPtr = z.data();
+    double newGamma = 0.0;
+    double newDelta = 0.0;
+    double newRR = 0.0;
+
+#pragma omp parallel for reduction(+ : newGamma, newDelta, newRR)
+    for (size_t i = 0; i < dim; i++) {
+      // z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p
+      zPtr[i] = nPtr[i] + beta * zPtr[i];
+
+      if (preconditioned) {
+        qPtr[i] = mPtr[i] + beta * qPtr[i];
+      }
+
+      sPtr[i] = wPtr[i] + beta * sPtr[i];
+      pPtr[i] = uPtr[i] + beta * pPtr[i];
+
+      // x = x + a*p, r = r - a*s, u = u - a*q, w = w - a*z
+      xPtr[i] += a * pPtr[i];
+      rPtr[i] -= a * sPtr[i];
+
+      if (preconditioned) {
+        uPtr[i] -= a * qPtr[i];
+      }
+
+      wPtr[i] -= a * zPtr[i];
+
+      newGamma += rPtr[i] * uPtr[i];
+      newDelta += wPtr[i] * uPtr[i];
+      newRR += rPtr[i] * rPtr[i];
+    }
+
+    gamma = newGamma;
+    delta = newDelta;
+    rr = newRR;
+
+    // replace the recursively updated residual by the true one from time to time
+    if (((this->nIterations + 1) % 50) == 0) {
+      replaceResidual(SystemMatrix, alpha, b);
+      fusedDotProducts(r, uRef, w, gamma, delta, rr);
+    }
+
+    this->residuum = rr;
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "delta: " << rr << std::endl;
+    }
+
+    this->nIterations++;
+  }
+
+  this->residuum = rr;
+  this->complete();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << rr << std::endl;
+  }
+}
+
+void PipelinedConjugateGradients::replaceResidual(sgpp::base::OperationMatrix& SystemMatrix,
+                                                  sgpp::base::DataVector& alpha,
+                                                  sgpp::base::DataVector& b) {
+  const bool preconditioned = (preconditioner != nullptr);
+  sgpp::base::DataVector& uRef = (preconditioned ? u : r);
+  sgpp::base::DataVector& qRef = (preconditioned ? q : s);
+
+  // r = b - A*x, u = M^{-1} r, w = A u
+  SystemMatrix.mult(alpha, temp);
+  r = b;
+  r.sub(temp);
+
+  if (preconditioned) {
+    preconditioner->mult(r, u);
+  }
+
+  SystemMatrix.mult(uRef, w);
+
+  // s = A p, q = M^{-1} s, z = A q
+  SystemMatrix.mult(p, s);
+
+  if (preconditioned) {
+    preconditioner->mult(s, q);
+  }
+
+  SystemMatrix.mult(qRef, z);
+}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,86 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PIPELINEDCONJUGATEGRADIENTS_HPP
+#define PIPELINEDCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Pipelined (preconditioned) conjugate gradients method
+ * (Ghysels and Vanroose, Hiding global synchronization latency in the preconditioned
+ * Conjugate Gradient algorithm, Parallel Computing 40(7), 2014).
+ *
+ * In contrast to ConjugateGradients, which needs two dot products (i.e., two global
+ * reductions) at different points of every iteration, all dot products of one iteration
+ * are computed in a single fused pass over the vectors, which also performs all vector
+ * updates, i.e. every iteration has one OpenMP reduction instead of two and reads the vectors
+ * once. The vectors are replicated, hence there is no global communication the reduction
+ * could overlap with (see PipelinedConjugateGradientsSP for the MPI version).
+ * This comes at the cost of four additional vectors and a slightly weaker numerical
+ * stability, which is compensated by replacing the recursively updated residual by the
+ * true residual every 50 iterations (as in ConjugateGradients).
+ *
+ * The solver can be used with any base::OperationMatrix and converges to the same tolerance
+ * as ConjugateGradients (the stopping criterion is the same).
+ */
+class PipelinedConjugateGradients : public ConjugateGradients {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param imax    maximum number of iterations
+   * @param epsilon relative tolerance of the residual
+   */
+  PipelinedConjugateGradients(size_t imax, double epsilon);
+
+  /**
+   * Destructor.
+   */
+  ~PipelinedConjugateGradients() override;
+
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+             double max_threshold = -1.0) override;
+
+ protected:
+  /// preconditioned residual u = M^{-1} r (reused between solves)
+  sgpp::base::DataVector u;
+  /// w = A u (reused between solves)
+  sgpp::base::DataVector w;
+  /// m = M^{-1} w (reused between solves)
+  sgpp::base::DataVector m;
+  /// n = A m (reused between solves)
+  sgpp::base::DataVector n;
+  /// s = A p (reused between solves)
+  sgpp::base::DataVector s;
+  /// search direction p (reused between solves)
+  sgpp::base::DataVector p;
+
+  /**
+   * Replaces the recursively updated vectors r, u, w, s, q and z by their
+   * definitions in terms of the current iterate and search direction.
+   *
+   * @param SystemMatrix  system matrix
+   * @param alpha         current iterate
+   * @param b             right-hand side
+   */
+  void replaceResidual(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+                       sgpp::base::DataVector& b);
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PIPELINEDCONJUGATEGRADIENTS_HPP */
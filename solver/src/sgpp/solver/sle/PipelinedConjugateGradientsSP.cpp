@@ -0,0 +1,197 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef X86_MIC_SYMMETRIC
+#include <mpi.h>
+#endif
+#include <sgpp/solver/sle/PipelinedConjugateGradientsSP.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <iostream>
+
+namespace sgpp {
+namespace solver {
+
+PipelinedConjugateGradientsSP::PipelinedConjugateGradientsSP(size_t imax, float epsilon)
+    : SLESolverSP(imax, epsilon) {}
+
+PipelinedConjugateGradientsSP::~PipelinedConjugateGradientsSP() {}
+
+void PipelinedConjugateGradientsSP::solve(sgpp::base::OperationMatrixSP& SystemMatrix,
+                                          sgpp::base::DataVectorSP& alpha,
+                                          sgpp::base::DataVectorSP& b, bool reuse, bool verbose,
+                                          float max_threshold) {
+  if (verbose == true) {
+    std::cout << "Starting Pipelined Conjugated Gradients" << std::endl;
+  }
+
+  // needed for residuum calculation
+  const float epsilonSquared = this->myEpsilon * this->myEpsilon;
+  const size_t dim = alpha.getSize();
+  // number off current iterations
+  this->nIterations = 0;
+
+  // define temporal vectors
+  sgpp::base::DataVectorSP temp(dim);
+  sgpp::base::DataVectorSP r(b);
+  sgpp::base::DataVectorSP w(dim);
+  sgpp::base::DataVectorSP n(dim);
+  sgpp::base::DataVectorSP s(dim);
+  sgpp::base::DataVectorSP p(dim);
+  sgpp::base::DataVectorSP z(dim);
+  s.setAll(0.0f);
+  p.setAll(0.0f);
+  z.setAll(0.0f);
+
+  float delta_0 = 0.0f;
+
+  if (reuse == true) {
+    delta_0 = r.dotProduct(r) * epsilonSquared;
+  } else {
+    alpha.setAll(0.0f);
+  }
+
+  // calculate the starting residuum and w = A*r
+  SystemMatrix.mult(alpha, temp);
+  r.sub(temp);
+  SystemMatrix.mult(r, w);
+
+  // gamma = r.r (= r.u), delta = w.r (= w.u), rr = r.r
+  float scalars[3] = {r.dotProduct(r), w.dotProduct(r), 0.0f};
+  scalars[2] = scalars[0];
+
+  if (reuse == false) {
+    delta_0 = scalars[2] * epsilonSquared;
+  }
+
+#ifdef X86_MIC_SYMMETRIC
+  MPI_Bcast(&delta_0, 1, MPI_FLOAT, 0, MPI_COMM_WORLD);
+  MPI_Request request;
+  MPI_Ibcast(scalars, 3, MPI_FLOAT, 0, MPI_COMM_WORLD, &request);
+#endif
+
+  this->residuum = (delta_0 / epsilonSquared);
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << (delta_0 / epsilonSquared) << std::endl;
+    std::cout << "Target norm:               " << (delta_0) << std::endl;
+  }
+
+  float gammaOld = 0.0f;
+  float aOld = 0.0f;
+
+  while (true) {
+#ifdef X86_MIC_SYMMETRIC
+    // the stopping criterion is tested with the residual of the previous iteration, whose
+    // broadcast has already completed, such that no matrix-vector product is wasted
+    if ((this->nIterations >= this->nMaxIterations) || (this->residuum <= delta_0) ||
+        (this->residuum <= max_threshold)) {
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+      this->residuum = scalars[2];
+      break;
+    }
+
+    // n = A*w does not depend on the broadcast, i.e. both overlap
+    SystemMatrix.mult(w, n);
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+    const float gamma = scalars[0];
+    const float delta = scalars[1];
+    this->residuum = scalars[2];
+#else
+    const float gamma = scalars[0];
+    const float delta = scalars[1];
+    this->residuum = scalars[2];
+
+    if ((this->nIterations >= this->nMaxIterations) || (scalars[2] <= delta_0) ||
+        (scalars[2] <= max_threshold)) {
+      break;
+    }
+
+    // n = A*w
+    SystemMatrix.mult(w, n);
+#endif
+
+    float beta = 0.0f;
+    float denominator = delta;
+
+    if (this->nIterations > 0) {
+      beta = gamma / gammaOld;
+      denominator = delta - beta * gamma / aOld;
+    }
+
+    if (denominator == 0.0f) {
+      break;
+    }
+
+    const float a = gamma / denominator;
+    gammaOld = gamma;
+    aOld = a;
+
+    // fused update of all vectors and computation of the new dot products
+    float* const xPtr = alpha.getPointer();
+    float* const rPtr = r.getPointer();
+    float* const wPtr = w.getPointer();
+    const float* const nPtr = n.getPointer();
+    float* const sPtr = s.getPointer();
+    float* const pPtr = p.getPointer();
+    float* const zPtr = z.getPointer();
+    float newGamma = 0.0f;
+    float newDelta = 0.0f;
+
+#pragma omp parallel for reduction(+ : newGamma, newDelta)
+    for (size_t i = 0; i < dim; i++) {
+      // z = n + beta*z, s = w + beta*s, p = r + beta*p
+      zPtr[i] = nPtr[i] + beta * zPtr[i];
+      sPtr[i] = wPtr[i] + beta * sPtr[i];
+      pPtr[i] = rPtr[i] + beta * pPtr[i];
+
+      // x = x + a*p, r = r - a*s, w = w - a*z
+      xPtr[i] += a * pPtr[i];
+      rPtr[i] -= a * sPtr[i];
+      wPtr[i] -= a * zPtr[i];
+
+      newGamma += rPtr[i] * rPtr[i];
+      newDelta += wPtr[i] * rPtr[i];
+    }
+
+    // replace the recursively updated residual by the true one from time to time
+    if (((this->nIterations + 1) % 50) == 0) {
+      // r = b - A*x, w = A*r, s = A*p, z = A*s
+      SystemMatrix.mult(alpha, temp);
+      r.copyFrom(b);
+      r.sub(temp);
+      SystemMatrix.mult(r, w);
+      SystemMatrix.mult(p, s);
+      SystemMatrix.mult(s, z);
+      newGamma = r.dotProduct(r);
+      newDelta = w.dotProduct(r);
+    }
+
+    scalars[0] = newGamma;
+    scalars[1] = newDelta;
+    scalars[2] = newGamma;
+
+#ifdef X86_MIC_SYMMETRIC
+    MPI_Ibcast(scalars, 3, MPI_FLOAT, 0, MPI_COMM_WORLD, &request);
+#endif
+
+    if (verbose == true) {
+      std::cout << "delta: " << scalars[2] << std::endl;
+    }
+
+    this->nIterations++;
+  }
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << this->residuum << std::endl;
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
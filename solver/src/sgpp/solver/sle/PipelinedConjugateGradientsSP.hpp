@@ -0,0 +1,56 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PIPELINEDCONJUGATEGRADIENTSSP_HPP
+#define PIPELINEDCONJUGATEGRADIENTSSP_HPP
+
+#include <sgpp/base/datatypes/DataVectorSP.hpp>
+#include <sgpp/base/operation/hash/OperationMatrixSP.hpp>
+
+#include <sgpp/solver/SLESolverSP.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Single precision version of PipelinedConjugateGradients (without preconditioner).
+ * The additional recurrences lose accuracy faster than the ones of ConjugateGradientsSP,
+ * i.e., for ill-conditioned systems the residual may stagnate at a larger norm although the
+ * recursively updated residual is replaced by the true one every 50 iterations.
+ *
+ * If SG++ is built with X86_MIC_SYMMETRIC, the dot products of rank 0 are broadcast to all
+ * ranks (as in ConjugateGradientsSP). The broadcast is non-blocking and overlaps the
+ * matrix-vector product of the next iteration, which does not depend on it. Therefore, the
+ * stopping criterion is tested with the residual of the previous iteration, i.e., the solver
+ * performs one more update after convergence instead of a wasted matrix-vector product.
+ */
+class PipelinedConjugateGradientsSP : public SLESolverSP {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param imax    maximum number of iterations
+   * @param epsilon relative tolerance of the residual
+   */
+  PipelinedConjugateGradientsSP(size_t imax, float epsilon);
+
+  /**
+   * Destructor.
+   */
+  ~PipelinedConjugateGradientsSP() override;
+
+  void solve(sgpp::base::OperationMatrixSP& SystemMatrix, sgpp::base::DataVectorSP& alpha,
+             sgpp::base::DataVectorSP& b, bool reuse = false, bool verbose = false,
+             float max_threshold = -1.0) override;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PIPELINEDCONJUGATEGRADIENTSSP_HPP */
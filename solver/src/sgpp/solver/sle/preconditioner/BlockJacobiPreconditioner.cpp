@@ -0,0 +1,164 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/preconditioner/BlockJacobiPreconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+BlockJacobiPreconditioner::BlockJacobiPreconditioner(const sgpp::base::DataMatrix& systemMatrix,
+                                                     sgpp::base::GridStorage& storage) {
+  const size_t n = storage.getSize();
+  const size_t d = storage.getDimension();
+
+  // group the grid points by their level vector
+  std::map<std::vector<sgpp::base::level_t>, size_t> subspaces;
+  std::vector<sgpp::base::level_t> level(d);
+
+  for (size_t i = 0; i < n; i++) {
+    const sgpp::base::GridPoint& gp = storage.getPoint(i);
+
+    for (size_t t = 0; t < d; t++) {
+      level[t] = gp.getLevel(t);
+    }
+
+    auto it = subspaces.find(level);
+
+    if (it == subspaces.end()) {
+      it = subspaces.insert(std::make_pair(level, blockIndices.size())).first;
+      blockIndices.push_back(std::vector<size_t>());
+    }
+
+    blockIndices[it->second].push_back(i);
+  }
+
+  const size_t numberOfBlocks = blockIndices.size();
+  blockFactors.resize(numberOfBlocks);
+  blockPivots.resize(numberOfBlocks);
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t k = 0; k < numberOfBlocks; k++) {
+    const std::vector<size_t>& indices = blockIndices[k];
+    const size_t m = indices.size();
+    blockFactors[k].resize(m * m);
+
+    for (size_t p = 0; p < m; p++) {
+      for (size_t q = 0; q < m; q++) {
+        blockFactors[k][p * m + q] = systemMatrix.get(indices[p], indices[q]);
+      }
+    }
+
+    factorizeBlock(k);
+  }
+}
+
+BlockJacobiPreconditioner::~BlockJacobiPreconditioner() {}
+
+void BlockJacobiPreconditioner::mult(sgpp::base::DataVector& alpha,
+                                     sgpp::base::DataVector& result) {
+  result.resize(alpha.getSize());
+
+#pragma omp parallel
+  {
+    std::vector<double> y;
+
+#pragma omp for schedule(dynamic)
+    for (size_t k = 0; k < blockIndices.size(); k++) {
+      const std::vector<size_t>& indices = blockIndices[k];
+      const std::vector<double>& lu = blockFactors[k];
+      const std::vector<size_t>& pivots = blockPivots[k];
+      const size_t m = indices.size();
+
+      // apply row permutation
+      y.resize(m);
+
+      for (size_t p = 0; p < m; p++) {
+        y[p] = alpha[indices[pivots[p]]];
+      }
+
+      // forward substitution (L has unit diagonal)
+      for (size_t p = 0; p < m; p++) {
+        for (size_t q = 0; q < p; q++) {
+          y[p] -= lu[p * m + q] * y[q];
+        }
+      }
+
+      // backward substitution
+      for (size_t p = m; p-- > 0;) {
+        for (size_t q = p + 1; q < m; q++) {
+          y[p] -= lu[p * m + q] * y[q];
+        }
+
+        y[p] /= lu[p * m + p];
+      }
+
+      for (size_t p = 0; p < m; p++) {
+        result[indices[p]] = y[p];
+      }
+    }
+  }
+}
+
+size_t BlockJacobiPreconditioner::getNumberOfBlocks() const { return blockIndices.size(); }
+
+void BlockJacobiPreconditioner::factorizeBlock(size_t k) {
+  std::vector<double>& lu = blockFactors[k];
+  std::vector<size_t>& pivots = blockPivots[k];
+  const size_t m = blockIndices[k].size();
+
+  pivots.resize(m);
+
+  for (size_t p = 0; p < m; p++) {
+    pivots[p] = p;
+  }
+
+  for (size_t q = 0; q < m; q++) {
+    // search pivot
+    size_t pivotRow = q;
+
+    for (size_t p = q + 1; p < m; p++) {
+      if (std::abs(lu[p * m + q]) > std::abs(lu[pivotRow * m + q])) {
+        pivotRow = p;
+      }
+    }
+
+    if (lu[pivotRow * m + q] == 0.0) {
+      // singular block ==> don't precondition this block
+      std::fill(lu.begin(), lu.end(), 0.0);
+
+      for (size_t p = 0; p < m; p++) {
+        lu[p * m + p] = 1.0;
+        pivots[p] = p;
+      }
+
+      return;
+    }
+
+    if (pivotRow != q) {
+      std::swap_ranges(lu.begin() + q * m, lu.begin() + (q + 1) * m, lu.begin() + pivotRow * m);
+      std::swap(pivots[q], pivots[pivotRow]);
+    }
+
+    // eliminate
+    for (size_t p = q + 1; p < m; p++) {
+      const double factor = lu[p * m + q] / lu[q * m + q];
+      lu[p * m + q] = factor;
+
+      for (size_t r = q + 1; r < m; r++) {
+        lu[p * m + r] -= factor * lu[q * m + r];
+      }
+    }
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
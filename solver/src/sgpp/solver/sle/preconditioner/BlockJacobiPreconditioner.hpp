@@ -0,0 +1,78 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BLOCKJACOBIPRECONDITIONER_HPP
+#define BLOCKJACOBIPRECONDITIONER_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Block Jacobi preconditioner whose blocks are the hierarchical subspaces of the sparse grid,
+ * i.e., all grid points with the same level vector form one block. The diagonal blocks of the
+ * system matrix are LU-factorized once (with partial pivoting) and the preconditioner
+ * solves the block diagonal system.
+ *
+ * The blocks are taken from an explicitly assembled system matrix (e.g., the matrices of the
+ * datadriven::DBMatOffline classes). For matrix-free systems, JacobiPreconditioner or
+ * LevelScalingPreconditioner should be used instead.
+ */
+class BlockJacobiPreconditioner : public sgpp::base::OperationMatrix {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param systemMatrix  explicit system matrix (one row and column per grid point)
+   * @param storage       storage of the sparse grid (defines the blocks)
+   */
+  BlockJacobiPreconditioner(const sgpp::base::DataMatrix& systemMatrix,
+                            sgpp::base::GridStorage& storage);
+
+  /**
+   * Destructor.
+   */
+  ~BlockJacobiPreconditioner() override;
+
+  /**
+   * @param alpha   vector to be preconditioned
+   * @param result  solution of the block diagonal system with right-hand side alpha
+   */
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  /**
+   * @return number of blocks (subspaces)
+   */
+  size_t getNumberOfBlocks() const;
+
+ protected:
+  /// indices of the grid points of every block
+  std::vector<std::vector<size_t>> blockIndices;
+  /// LU factors of every block (row-major)
+  std::vector<std::vector<double>> blockFactors;
+  /// row permutations of the LU factorizations of every block
+  std::vector<std::vector<size_t>> blockPivots;
+
+  /**
+   * LU-factorizes a block in-place. Singular blocks are replaced by the identity.
+   *
+   * @param k number of the block
+   */
+  void factorizeBlock(size_t k);
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* BLOCKJACOBIPRECONDITIONER_HPP */
@@ -0,0 +1,48 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+JacobiPreconditioner::JacobiPreconditioner(const sgpp::base::DataVector& diagonal)
+    : inverseDiagonal(diagonal) {
+  invertDiagonal();
+}
+
+JacobiPreconditioner::JacobiPreconditioner(sgpp::base::OperationMatrix& systemMatrix,
+                                           size_t size)
+    : inverseDiagonal(size) {
+  systemMatrix.getDiagonal(inverseDiagonal);
+  invertDiagonal();
+}
+
+JacobiPreconditioner::~JacobiPreconditioner() {}
+
+void JacobiPreconditioner::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
+  const size_t n = alpha.getSize();
+  result.resize(n);
+
+#pragma omp parallel for
+  for (size_t i = 0; i < n; i++) {
+    result[i] = inverseDiagonal[i] * alpha[i];
+  }
+}
+
+const sgpp::base::DataVector& JacobiPreconditioner::getInverseDiagonal() const {
+  return inverseDiagonal;
+}
+
+void JacobiPreconditioner::invertDiagonal() {
+  for (size_t i = 0; i < inverseDiagonal.getSize(); i++) {
+    inverseDiagonal[i] = ((inverseDiagonal[i] != 0.0) ? (1.0 / inverseDiagonal[i]) : 1.0);
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
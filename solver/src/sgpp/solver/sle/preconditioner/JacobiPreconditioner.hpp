@@ -0,0 +1,70 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef JACOBIPRECONDITIONER_HPP
+#define JACOBIPRECONDITIONER_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Jacobi (diagonal) preconditioner, i.e., multiplication with the inverse of the
+ * diagonal of the system matrix. Vanishing diagonal entries are replaced by one.
+ */
+class JacobiPreconditioner : public sgpp::base::OperationMatrix {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param diagonal  diagonal of the system matrix
+   */
+  explicit JacobiPreconditioner(const sgpp::base::DataVector& diagonal);
+
+  /**
+   * Constructor taking the diagonal from the system matrix
+   * (see base::OperationMatrix::getDiagonal, e.g., datadriven::DMSystemMatrix).
+   *
+   * @param systemMatrix  system matrix
+   * @param size          number of rows/columns of the system matrix
+   */
+  JacobiPreconditioner(sgpp::base::OperationMatrix& systemMatrix, size_t size);
+
+  /**
+   * Destructor.
+   */
+  ~JacobiPreconditioner() override;
+
+  /**
+   * @param alpha   vector to be preconditioned
+   * @param result  componentwise product of alpha with the inverse diagonal
+   */
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  /**
+   * @return inverse of the diagonal of the system matrix
+   */
+  const sgpp::base::DataVector& getInverseDiagonal() const;
+
+ protected:
+  /// inverse of the diagonal of the system matrix
+  sgpp::base::DataVector inverseDiagonal;
+
+  /**
+   * Inverts the diagonal (stored in inverseDiagonal) in-place.
+   */
+  void invertDiagonal();
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* JACOBIPRECONDITIONER_HPP */
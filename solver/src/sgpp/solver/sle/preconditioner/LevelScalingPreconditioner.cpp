@@ -0,0 +1,26 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/preconditioner/LevelScalingPreconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+// OperationDiagonal scales with (1 / priorBase)^(|l|_1 - d)
+LevelScalingPreconditioner::LevelScalingPreconditioner(sgpp::base::GridStorage& storage,
+                                                       double levelFactor)
+    : scaling(&storage, 1.0 / levelFactor) {}
+
+LevelScalingPreconditioner::~LevelScalingPreconditioner() {}
+
+void LevelScalingPreconditioner::mult(sgpp::base::DataVector& alpha,
+                                      sgpp::base::DataVector& result) {
+  scaling.mult(alpha, result);
+}
+
+}  // namespace solver
+}  // namespace sgpp
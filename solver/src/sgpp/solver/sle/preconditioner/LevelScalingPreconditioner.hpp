@@ -0,0 +1,60 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef LEVELSCALINGPRECONDITIONER_HPP
+#define LEVELSCALINGPRECONDITIONER_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/OperationDiagonal.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Multilevel diagonal scaling preconditioner (similar to the BPX preconditioner in the
+ * hierarchical basis): the coefficient of the grid point with level \f$\mathbf{l}\f$
+ * is scaled by \f$c^{\vert \mathbf{l} \vert_1 - d}\f$.
+ * In contrast to JacobiPreconditioner, no information on the system matrix is needed.
+ *
+ * The factor \f$c\f$ should compensate the level dependence of the diagonal of the system
+ * matrix, i.e., if the diagonal entries grow like \f$\gamma^{\vert \mathbf{l} \vert_1}\f$,
+ * then \f$c = 1/\gamma\f$ should be chosen. For example, for systems dominated by a
+ * regularization with base::OperationDiagonal, \f$c\f$ is the prior base of the
+ * regularization (0.25 by default).
+ */
+class LevelScalingPreconditioner : public sgpp::base::OperationMatrix {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param storage     storage of the sparse grid
+   * @param levelFactor factor \f$c\f$ of the scaling per level
+   */
+  LevelScalingPreconditioner(sgpp::base::GridStorage& storage, double levelFactor);
+
+  /**
+   * Destructor.
+   */
+  ~LevelScalingPreconditioner() override;
+
+  /**
+   * @param alpha   vector to be preconditioned
+   * @param result  alpha scaled level-wise
+   */
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+ protected:
+  /// diagonal operation performing the scaling
+  sgpp::base::OperationDiagonal scaling;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* LEVELSCALINGPRECONDITIONER_HPP */
@@ -8,6 +8,12 @@
 
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
 #include <sgpp/solver/sle/BiCGStab.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/solver/sle/BlockConjugateGradients.hpp>
+#include <sgpp/solver/sle/MultiShiftConjugateGradients.hpp>
+#include <sgpp/solver/sle/preconditioner/BlockJacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/LevelScalingPreconditioner.hpp>
 #include <sgpp/solver/ode/Euler.hpp>
 #include <sgpp/solver/ode/CrankNicolson.hpp>
 #include <sgpp/solver/ode/AdamsBashforth.hpp>
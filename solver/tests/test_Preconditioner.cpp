@@ -0,0 +1,389 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/solver_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationDiagonal.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/solver/sle/BiCGStab.hpp>
+#include <sgpp/solver/sle/BlockConjugateGradients.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/MultiShiftConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+#include <sgpp/solver/sle/preconditioner/BlockJacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/JacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/preconditioner/LevelScalingPreconditioner.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::OperationMatrix;
+
+/**
+ * Regularized least squares system (B^T B + lambda * M * C) of a sparse grid regression
+ * (like datadriven's DMSystemMatrix) with diagonal regularization operator C, whose
+ * entries grow exponentially with the level.
+ */
+class RegressionSystemMatrix : public OperationMatrix {
+ public:
+  RegressionSystemMatrix(sgpp::base::Grid& grid, DataMatrix& data, double lambda)
+      : op(sgpp::op_factory::createOperationMultipleEval(grid, data)),
+        regularization(&grid.getStorage(), priorBase),
+        temp(data.getNrows()),
+        temp2(grid.getSize()),
+        lambda(lambda * static_cast<double>(data.getNrows())) {}
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    op->mult(alpha, temp);
+    op->multTranspose(temp, result);
+    regularization.mult(alpha, temp2);
+    result.axpy(lambda, temp2);
+  }
+
+  void multBlock(DataMatrix& alpha, DataMatrix& result) override {
+    DataMatrix tempBlock;
+    op->multBlock(alpha, tempBlock);
+    op->multTransposeBlock(tempBlock, result);
+    DataMatrix tempBlock2;
+    regularization.multBlock(alpha, tempBlock2);
+    tempBlock2.mult(lambda);
+    result.add(tempBlock2);
+    numberOfBlockMults++;
+  }
+
+  void getDiagonal(DataVector& diagonal) override {
+    op->getBBTDiagonal(diagonal);
+    regularization.getDiagonal(temp2);
+    diagonal.axpy(lambda, temp2);
+  }
+
+  static constexpr double priorBase = 0.25;
+  size_t numberOfBlockMults = 0;
+
+ protected:
+  std::unique_ptr<sgpp::base::OperationMultipleEval> op;
+  sgpp::base::OperationDiagonal regularization;
+  DataVector temp;
+  DataVector temp2;
+  double lambda;
+};
+
+/**
+ * Shifted matrix A + sigma * I.
+ */
+class ShiftedMatrix : public OperationMatrix {
+ public:
+  ShiftedMatrix(OperationMatrix& A, double shift) : A(A), shift(shift) {}
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    A.mult(alpha, result);
+    result.axpy(shift, alpha);
+  }
+
+ protected:
+  OperationMatrix& A;
+  double shift;
+};
+
+/**
+ * Assembles a matrix-free operator explicitly by multiplying it with all unit vectors.
+ */
+DataMatrix assembleMatrix(OperationMatrix& A, size_t n) {
+  DataMatrix matrix(n, n);
+  DataVector unitVector(n, 0.0);
+  DataVector column(n);
+
+  for (size_t j = 0; j < n; j++) {
+    unitVector[j] = 1.0;
+    A.mult(unitVector, column);
+    matrix.setColumn(j, column);
+    unitVector[j] = 0.0;
+  }
+
+  return matrix;
+}
+
+struct RegressionFixture {
+  RegressionFixture() : grid(sgpp::base::Grid::createLinearGrid(dim)), data(numData, dim) {
+    grid->getGenerator().regular(level);
+
+    for (size_t i = 0; i < numData; i++) {
+      const double x1 = std::abs(std::sin(static_cast<double>(i)));
+      const double x2 = std::abs(std::sin(static_cast<double>(i) * x1));
+      data(i, 0) = x1;
+      data(i, 1) = x2;
+    }
+
+    systemMatrix.reset(new RegressionSystemMatrix(*grid, data, 1e-2));
+
+    // right-hand side B^T y
+    DataVector y(numData);
+
+    for (size_t i = 0; i < numData; i++) {
+      y[i] = std::sinh(data(i, 0)) + std::sinh(data(i, 1));
+    }
+
+    std::unique_ptr<sgpp::base::OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(*grid, data));
+    b.resize(grid->getSize());
+    op->multTranspose(y, b);
+  }
+
+  /**
+   * @return relative residual of the solution
+   */
+  double relativeResidual(DataVector& alpha) {
+    DataVector r(alpha.getSize());
+    systemMatrix->mult(alpha, r);
+    r.sub(b);
+    return r.l2Norm() / b.l2Norm();
+  }
+
+  const size_t dim = 2;
+  const size_t level = 5;
+  const size_t numData = 2000;
+  std::unique_ptr<sgpp::base::Grid> grid;
+  DataMatrix data;
+  std::unique_ptr<RegressionSystemMatrix> systemMatrix;
+  DataVector b;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestPreconditioner, RegressionFixture)
+
+BOOST_AUTO_TEST_CASE(testPreconditionedConjugateGradients) {
+  const size_t n = grid->getSize();
+  const size_t maxIt = 1000;
+  const double epsilon = 1e-8;
+
+  sgpp::solver::ConjugateGradients cg(maxIt, epsilon);
+  DataVector alpha(n);
+  cg.solve(*systemMatrix, alpha, b);
+  const size_t iterationsWithout = cg.getNumberIterations();
+  BOOST_CHECK_SMALL(relativeResidual(alpha), 1e-6);
+
+  sgpp::solver::JacobiPreconditioner jacobi(*systemMatrix, n);
+  sgpp::solver::LevelScalingPreconditioner levelScaling(grid->getStorage(),
+                                                        RegressionSystemMatrix::priorBase);
+  const DataMatrix explicitSystemMatrix = assembleMatrix(*systemMatrix, n);
+  sgpp::solver::BlockJacobiPreconditioner blockJacobi(explicitSystemMatrix, grid->getStorage());
+
+  // the diagonal of the system matrix is computed from the operators
+  const DataVector& inverseDiagonal = jacobi.getInverseDiagonal();
+
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_CLOSE(inverseDiagonal[i] * explicitSystemMatrix(i, i), 1.0, 1e-10);
+  }
+
+  BOOST_CHECK_EQUAL(blockJacobi.getNumberOfBlocks(), level * (level + 1) / 2);
+
+  std::vector<OperationMatrix*> preconditioners = {&jacobi, &levelScaling, &blockJacobi};
+
+  for (OperationMatrix* preconditioner : preconditioners) {
+    cg.setPreconditioner(preconditioner);
+    BOOST_CHECK_EQUAL(cg.getPreconditioner(), preconditioner);
+
+    // solve twice to test the reuse of the temporary vectors
+    for (size_t k = 0; k < 2; k++) {
+      DataVector alphaPrec(n);
+      cg.solve(*systemMatrix, alphaPrec, b);
+      BOOST_CHECK_SMALL(relativeResidual(alphaPrec), 1e-6);
+      BOOST_CHECK_LT(cg.getNumberIterations(), iterationsWithout);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPreconditionedBiCGStab) {
+  const size_t n = grid->getSize();
+  const size_t maxIt = 1000;
+  const double epsilon = 1e-8;
+
+  sgpp::solver::JacobiPreconditioner jacobi(*systemMatrix, n);
+  sgpp::solver::BiCGStab bicgstab(maxIt, epsilon);
+  bicgstab.setPreconditioner(&jacobi);
+
+  for (size_t k = 0; k < 2; k++) {
+    DataVector alpha(n);
+    bicgstab.solve(*systemMatrix, alpha, b);
+    BOOST_CHECK_SMALL(relativeResidual(alpha), 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPipelinedConjugateGradients) {
+  const size_t n = grid->getSize();
+  const size_t maxIt = 1000;
+  const double epsilon = 1e-8;
+
+  sgpp::solver::ConjugateGradients cg(maxIt, epsilon);
+  DataVector alphaCG(n);
+  cg.solve(*systemMatrix, alphaCG, b);
+
+  sgpp::solver::PipelinedConjugateGradients pipelinedCG(maxIt, epsilon);
+  sgpp::solver::JacobiPreconditioner jacobi(*systemMatrix, n);
+  std::vector<OperationMatrix*> preconditioners = {nullptr, &jacobi};
+
+  for (OperationMatrix* preconditioner : preconditioners) {
+    pipelinedCG.setPreconditioner(preconditioner);
+
+    // solve twice to test the reuse of the temporary vectors
+    for (size_t k = 0; k < 2; k++) {
+      DataVector alpha(n);
+      pipelinedCG.solve(*systemMatrix, alpha, b);
+      BOOST_CHECK_SMALL(relativeResidual(alpha), 1e-6);
+
+      if (preconditioner == nullptr) {
+        // same iterates as CG in exact arithmetic
+        BOOST_CHECK_LE(pipelinedCG.getNumberIterations(), cg.getNumberIterations() + 2);
+      } else {
+        BOOST_CHECK_LT(pipelinedCG.getNumberIterations(), cg.getNumberIterations());
+      }
+
+      alpha.sub(alphaCG);
+      BOOST_CHECK_SMALL(alpha.l2Norm() / alphaCG.l2Norm(), 1e-4);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testBlockConjugateGradients) {
+  const size_t n = grid->getSize();
+  const size_t numRHS = 4;
+  const size_t maxIt = 1000;
+  const double epsilon = 1e-8;
+
+  // right-hand sides B^T y_j for different targets y_j (e.g., one per class)
+  std::unique_ptr<sgpp::base::OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(*grid, data));
+  DataMatrix y(numData, numRHS);
+
+  for (size_t i = 0; i < numData; i++) {
+    for (size_t j = 0; j < numRHS; j++) {
+      y(i, j) = std::sin(static_cast<double>(j + 1) * data(i, 0)) + std::cos(data(i, 1));
+    }
+  }
+
+  DataMatrix bBlock;
+  op->multTransposeBlock(y, bBlock);
+
+  sgpp::solver::JacobiPreconditioner jacobi(*systemMatrix, n);
+  std::vector<OperationMatrix*> preconditioners = {nullptr, &jacobi};
+
+  for (OperationMatrix* preconditioner : preconditioners) {
+    sgpp::solver::BlockConjugateGradients blockCG(maxIt, epsilon);
+    sgpp::solver::ConjugateGradients cg(maxIt, epsilon);
+    blockCG.setPreconditioner(preconditioner);
+    cg.setPreconditioner(preconditioner);
+
+    // solve twice to test the reuse of the temporary matrices
+    for (size_t k = 0; k < 2; k++) {
+      DataMatrix alphaBlock;
+      systemMatrix->numberOfBlockMults = 0;
+      blockCG.solve(*systemMatrix, alphaBlock, bBlock);
+      BOOST_CHECK_EQUAL(alphaBlock.getNrows(), n);
+      BOOST_CHECK_EQUAL(alphaBlock.getNcols(), numRHS);
+      BOOST_CHECK_EQUAL(blockCG.getResiduals().getSize(), numRHS);
+      BOOST_CHECK_LE(systemMatrix->numberOfBlockMults, blockCG.getNumberIterations() + 1);
+
+      size_t maxIterations = 0;
+
+      for (size_t j = 0; j < numRHS; j++) {
+        DataVector bColumn(n);
+        DataVector alphaColumn(n);
+        DataVector alphaBlockColumn(n);
+        bBlock.getColumn(j, bColumn);
+        alphaBlock.getColumn(j, alphaBlockColumn);
+        cg.solve(*systemMatrix, alphaColumn, bColumn);
+        maxIterations = std::max(maxIterations, cg.getNumberIterations());
+
+        DataVector r(n);
+        systemMatrix->mult(alphaBlockColumn, r);
+        r.sub(bColumn);
+        BOOST_CHECK_SMALL(r.l2Norm() / bColumn.l2Norm(), 1e-6);
+
+        alphaBlockColumn.sub(alphaColumn);
+        BOOST_CHECK_SMALL(alphaBlockColumn.l2Norm() / alphaColumn.l2Norm(), 1e-4);
+      }
+
+      BOOST_CHECK_LE(blockCG.getNumberIterations(), maxIterations + 2);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testMultiShiftConjugateGradients) {
+  const size_t n = grid->getSize();
+  const size_t maxIt = 1000;
+  const double epsilon = 1e-8;
+
+  // (B^T B + lambda * M * C) + sigma * I for a sweep of shifts
+  const std::vector<double> shifts = {1e2, 1.0, 1e-1, 10.0, 1e-2};
+  sgpp::solver::MultiShiftConjugateGradients multiShiftCG(maxIt, epsilon);
+
+  // solve twice to test the reuse of the temporary vectors
+  for (size_t k = 0; k < 2; k++) {
+    DataMatrix alphaShifted;
+    multiShiftCG.solve(*systemMatrix, alphaShifted, b, shifts);
+    BOOST_CHECK_EQUAL(alphaShifted.getNrows(), n);
+    BOOST_CHECK_EQUAL(alphaShifted.getNcols(), shifts.size());
+    BOOST_CHECK_EQUAL(multiShiftCG.getResiduals().getSize(), shifts.size());
+
+    size_t maxIterations = 0;
+
+    for (size_t s = 0; s < shifts.size(); s++) {
+      ShiftedMatrix shiftedMatrix(*systemMatrix, shifts[s]);
+      sgpp::solver::ConjugateGradients cg(maxIt, epsilon);
+      DataVector alpha(n);
+      cg.solve(shiftedMatrix, alpha, b);
+      maxIterations = std::max(maxIterations, cg.getNumberIterations());
+
+      DataVector alphaColumn(n);
+      alphaShifted.getColumn(s, alphaColumn);
+      DataVector r(n);
+      shiftedMatrix.mult(alphaColumn, r);
+      r.sub(b);
+      BOOST_CHECK_SMALL(r.l2Norm() / b.l2Norm(), 1e-6);
+
+      alphaColumn.sub(alpha);
+      BOOST_CHECK_SMALL(alphaColumn.l2Norm() / alpha.l2Norm(), 1e-4);
+    }
+
+    // one Krylov run for all shifts
+    BOOST_CHECK_LE(multiShiftCG.getNumberIterations(), maxIterations + 2);
+  }
+
+  // preconditioning is not supported
+  sgpp::solver::JacobiPreconditioner jacobi(*systemMatrix, n);
+  multiShiftCG.setPreconditioner(&jacobi);
+  DataMatrix alphaShifted;
+  BOOST_CHECK_THROW(multiShiftCG.solve(*systemMatrix, alphaShifted, b, shifts),
+                    sgpp::base::solver_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testJacobiPreconditioner) {
+  DataVector diagonal(3);
+  diagonal[0] = 2.0;
+  diagonal[1] = 0.0;
+  diagonal[2] = -4.0;
+
+  sgpp::solver::JacobiPreconditioner jacobi(diagonal);
+  DataVector x(3, 1.0);
+  DataVector y;
+  jacobi.mult(x, y);
+
+  BOOST_CHECK_EQUAL(y.getSize(), 3);
+  BOOST_CHECK_CLOSE(y[0], 0.5, 1e-12);
+  BOOST_CHECK_CLOSE(y[1], 1.0, 1e-12);
+  BOOST_CHECK_CLOSE(y[2], -0.25, 1e-12);
+}
+
+BOOST_AUTO_TEST_SUITE_END()